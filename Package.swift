@@ -6,6 +6,13 @@
 
 import PackageDescription
 
+// Set KALLIOPE_TRACING in the environment to compile in GMPTracer recording.
+// Without it, traced operations compile to direct calls.
+let tracingSettings: [SwiftSetting] =
+    Context.environment["KALLIOPE_TRACING"] != nil
+        ? [.define("KALLIOPE_TRACING")]
+        : []
+
 let package = Package(
     name: "Kalliope",
     platforms: [
@@ -35,7 +42,8 @@ let package = Package(
     targets: [
         .target(
             name: "Kalliope",
-            dependencies: ["CKalliope", "CKalliopeBridge"]
+            dependencies: ["CKalliope", "CKalliopeBridge"],
+            swiftSettings: tracingSettings
         ),
         .testTarget(
             name: "KalliopeTests",
@@ -77,6 +85,10 @@ let package = Package(
             name: "Linus",
             dependencies: ["CLinus", "CKalliope", "CLinusBridge", "Kalliope"]
         ),
+        .executableTarget(
+            name: "KalliopeTune",
+            dependencies: ["Kalliope", "Linus"]
+        ),
         .testTarget(
             name: "LinusTests",
             dependencies: ["Linus", "CLinus", "CKalliope", "CKalliopeBridge"]
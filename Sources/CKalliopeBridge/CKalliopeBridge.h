@@ -2,7 +2,9 @@
 #define CKALLIOPE_BRIDGE_H
 
 #include <stdarg.h>
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 // Bridge functions to expose GMP va_list variants to Swift
 // These functions are needed because the va_list variants are conditionally
@@ -46,4 +48,59 @@ int ckalliope_restore_stdin(int original_fd);
 // fileHandle should be passed as an Unmanaged<FileHandle> (bridged to void*)
 int ckalliope_safe_file_descriptor(void *fileHandle);
 
+// Operation tracing (see CKalliopeTrace.c)
+// Each thread records into its own fixed-size ring buffer; recording takes no
+// locks. Snapshots may run concurrently with recording and drop any events
+// that were overwritten while being copied.
+
+typedef struct {
+    const uint8_t *name;     // Static, NUL-terminated operation name
+    uint64_t start_ns;       // Monotonic start time
+    uint64_t duration_ns;
+    int64_t size;            // Operand size (limbs or bits of precision)
+    uint32_t category;       // Single category bit
+    uint32_t thread_index;   // Small per-thread index, assigned on first use
+} ckalliope_trace_event;
+
+// Enabled category mask; 0 disables recording
+void ckalliope_trace_set_mask(uint32_t mask);
+uint32_t ckalliope_trace_get_mask(void);
+
+// Monotonic clock in nanoseconds
+uint64_t ckalliope_trace_now(void);
+
+// Record one completed operation on the calling thread's ring buffer
+void ckalliope_trace_record(uint32_t category, const uint8_t *name,
+                            uint64_t start_ns, int64_t size);
+
+// Number of events a snapshot can return at most (all threads' capacity)
+size_t ckalliope_trace_capacity(void);
+
+// Copy the retained events of every thread into `out`; returns the count
+size_t ckalliope_trace_snapshot(ckalliope_trace_event *out, size_t capacity);
+
+// Discard all retained events
+void ckalliope_trace_reset(void);
+
+// Randomized result verification (see CKalliopeVerify.c)
+// Categories are single bits of the mask; counters are kept per category.
+
+// Categories checked automatically; 0 disables automatic checks
+void ckalliope_verify_set_mask(uint32_t mask);
+uint32_t ckalliope_verify_get_mask(void);
+
+// Smallest operand size, in limbs, checked automatically
+void ckalliope_verify_set_minimum_limbs(int64_t limbs);
+int64_t ckalliope_verify_get_minimum_limbs(void);
+
+// Count one check of `category`, and a failure unless `passed`
+void ckalliope_verify_record(uint32_t category, bool passed);
+
+// Read the counters of `category`
+void ckalliope_verify_counts(uint32_t category, uint64_t *checks,
+                             uint64_t *failures);
+
+// Zero every counter
+void ckalliope_verify_reset(void);
+
 #endif /* CKALLIOPE_BRIDGE_H */
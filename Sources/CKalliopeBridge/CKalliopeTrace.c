@@ -0,0 +1,125 @@
+// Per-thread ring buffers for operation tracing.
+//
+// Each thread that records an event gets its own ring on first use. Only the
+// owning thread writes to a ring: it fills the slot, then publishes it by
+// advancing `head` with a release store. Readers take an acquire snapshot of
+// `head`, copy the slots, and re-read `head` to discard any slot the writer
+// may have reused during the copy. Rings are pushed onto a global list with a
+// compare-and-swap and never freed, so events from exited threads remain
+// available until reset.
+
+#include "CKalliopeBridge.h"
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define CKALLIOPE_TRACE_RING_SIZE 16384 // Must be a power of two
+#define CKALLIOPE_TRACE_RING_MASK (CKALLIOPE_TRACE_RING_SIZE - 1)
+
+typedef struct ckalliope_trace_ring {
+    struct ckalliope_trace_ring *next;
+    uint32_t thread_index;
+    _Atomic uint64_t head;      // Number of events ever published
+    _Atomic uint64_t discarded; // Events below this index were reset
+    ckalliope_trace_event events[CKALLIOPE_TRACE_RING_SIZE];
+} ckalliope_trace_ring;
+
+static _Atomic uint32_t trace_mask;
+static _Atomic uint32_t trace_ring_count;
+static ckalliope_trace_ring *_Atomic trace_rings;
+static _Thread_local ckalliope_trace_ring *trace_local_ring;
+
+void ckalliope_trace_set_mask(uint32_t mask) {
+    atomic_store_explicit(&trace_mask, mask, memory_order_relaxed);
+}
+
+uint32_t ckalliope_trace_get_mask(void) {
+    return atomic_load_explicit(&trace_mask, memory_order_relaxed);
+}
+
+uint64_t ckalliope_trace_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static ckalliope_trace_ring *ckalliope_trace_local_ring(void) {
+    ckalliope_trace_ring *ring = trace_local_ring;
+    if (ring != NULL) {
+        return ring;
+    }
+    ring = calloc(1, sizeof(ckalliope_trace_ring));
+    if (ring == NULL) {
+        return NULL;
+    }
+    ring->thread_index = atomic_fetch_add(&trace_ring_count, 1);
+    ckalliope_trace_ring *first = atomic_load(&trace_rings);
+    do {
+        ring->next = first;
+    } while (!atomic_compare_exchange_weak(&trace_rings, &first, ring));
+    trace_local_ring = ring;
+    return ring;
+}
+
+void ckalliope_trace_record(uint32_t category, const uint8_t *name,
+                            uint64_t start_ns, int64_t size) {
+    uint64_t end_ns = ckalliope_trace_now();
+    ckalliope_trace_ring *ring = ckalliope_trace_local_ring();
+    if (ring == NULL) {
+        return;
+    }
+    uint64_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    ckalliope_trace_event *event =
+        &ring->events[head & CKALLIOPE_TRACE_RING_MASK];
+    event->name = name;
+    event->start_ns = start_ns;
+    event->duration_ns = end_ns - start_ns;
+    event->size = size;
+    event->category = category;
+    event->thread_index = ring->thread_index;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+size_t ckalliope_trace_capacity(void) {
+    return (size_t)atomic_load(&trace_ring_count) * CKALLIOPE_TRACE_RING_SIZE;
+}
+
+size_t ckalliope_trace_snapshot(ckalliope_trace_event *out, size_t capacity) {
+    size_t count = 0;
+    for (ckalliope_trace_ring *ring = atomic_load(&trace_rings);
+         ring != NULL && count < capacity; ring = ring->next) {
+        // A ring retains RING_SIZE - 1 events: the slot after the newest
+        // one may be mid-write.
+        const uint64_t retained = CKALLIOPE_TRACE_RING_SIZE - 1;
+        uint64_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        uint64_t first = atomic_load(&ring->discarded);
+        if (head > retained && first < head - retained) {
+            first = head - retained;
+        }
+        size_t start = count;
+        for (uint64_t i = first; i < head && count < capacity; i++) {
+            out[count++] = ring->events[i & CKALLIOPE_TRACE_RING_MASK];
+        }
+        // The writer may have reused slots while we copied; index i is
+        // intact only if i >= after - retained.
+        uint64_t after =
+            atomic_load_explicit(&ring->head, memory_order_acquire);
+        if (after > retained && after - retained > first) {
+            uint64_t lost = after - retained - first;
+            size_t copied = count - start;
+            size_t drop = lost < copied ? (size_t)lost : copied;
+            for (size_t k = start; k + drop < count; k++) {
+                out[k] = out[k + drop];
+            }
+            count -= drop;
+        }
+    }
+    return count;
+}
+
+void ckalliope_trace_reset(void) {
+    for (ckalliope_trace_ring *ring = atomic_load(&trace_rings); ring != NULL;
+         ring = ring->next) {
+        atomic_store(&ring->discarded, atomic_load(&ring->head));
+    }
+}
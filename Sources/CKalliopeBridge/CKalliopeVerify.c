@@ -0,0 +1,64 @@
+// Process-wide switches and counters for randomized result verification.
+//
+// Verified operations read the mask on every call, so it is a relaxed atomic
+// like the trace mask. Counters are relaxed too: they are statistics, read
+// without ordering against the checks that produced them.
+
+#include "CKalliopeBridge.h"
+#include <stdatomic.h>
+
+#define CKALLIOPE_VERIFY_CATEGORY_COUNT 32
+
+static _Atomic uint32_t verify_mask;
+static _Atomic int64_t verify_minimum_limbs = 256;
+static _Atomic uint64_t verify_checks[CKALLIOPE_VERIFY_CATEGORY_COUNT];
+static _Atomic uint64_t verify_failures[CKALLIOPE_VERIFY_CATEGORY_COUNT];
+
+void ckalliope_verify_set_mask(uint32_t mask) {
+    atomic_store_explicit(&verify_mask, mask, memory_order_relaxed);
+}
+
+uint32_t ckalliope_verify_get_mask(void) {
+    return atomic_load_explicit(&verify_mask, memory_order_relaxed);
+}
+
+void ckalliope_verify_set_minimum_limbs(int64_t limbs) {
+    atomic_store_explicit(&verify_minimum_limbs, limbs, memory_order_relaxed);
+}
+
+int64_t ckalliope_verify_get_minimum_limbs(void) {
+    return atomic_load_explicit(&verify_minimum_limbs, memory_order_relaxed);
+}
+
+static int ckalliope_verify_index(uint32_t category) {
+    int index = 0;
+    while (index < CKALLIOPE_VERIFY_CATEGORY_COUNT - 1 &&
+           (category & (1u << index)) == 0) {
+        index++;
+    }
+    return index;
+}
+
+void ckalliope_verify_record(uint32_t category, bool passed) {
+    int index = ckalliope_verify_index(category);
+    atomic_fetch_add_explicit(&verify_checks[index], 1, memory_order_relaxed);
+    if (!passed) {
+        atomic_fetch_add_explicit(&verify_failures[index], 1,
+                                  memory_order_relaxed);
+    }
+}
+
+void ckalliope_verify_counts(uint32_t category, uint64_t *checks,
+                             uint64_t *failures) {
+    int index = ckalliope_verify_index(category);
+    *checks = atomic_load_explicit(&verify_checks[index], memory_order_relaxed);
+    *failures =
+        atomic_load_explicit(&verify_failures[index], memory_order_relaxed);
+}
+
+void ckalliope_verify_reset(void) {
+    for (int i = 0; i < CKALLIOPE_VERIFY_CATEGORY_COUNT; i++) {
+        atomic_store(&verify_checks[i], 0);
+        atomic_store(&verify_failures[i], 0);
+    }
+}
@@ -0,0 +1,307 @@
+import Dispatch
+import Foundation
+
+/// One entry of a registered cache, as seen by `GMPCacheRegistry`.
+public struct GMPCacheEntry {
+    /// The key the cache uses for the entry.
+    public let key: AnyHashable
+
+    /// The approximate memory held by the entry, in bytes.
+    public let byteCount: Int
+
+    /// The entry's eviction priority: entries with the lowest priority are
+    /// evicted first. Obtain it from `GMPCacheRegistry.priority(cost:
+    /// byteCount:)` each time the entry is created or used.
+    public let priority: Double
+
+    /// Create an entry description.
+    public init(key: AnyHashable, byteCount: Int, priority: Double) {
+        self.key = key
+        self.byteCount = byteCount
+        self.priority = priority
+    }
+}
+
+/// A cache whose memory is managed by a `GMPCacheRegistry`.
+///
+/// Conforming caches report their entries and evict them on request. A
+/// cache must not call into the registry while holding its own lock: the
+/// registry calls the cache with the registry lock held.
+public protocol GMPManagedCache: AnyObject, Sendable {
+    /// The cache's name, for statistics.
+    var cacheName: String { get }
+
+    /// The entries currently held.
+    func cacheEntries() -> [GMPCacheEntry]
+
+    /// Remove the entries with these keys. Keys no longer present are
+    /// ignored.
+    func evictCacheEntries(_ keys: [AnyHashable])
+
+    /// Remove every entry.
+    func removeAllCacheEntries()
+}
+
+/// The size of one registered cache.
+public struct GMPCacheStatistics: Sendable {
+    /// The cache name.
+    public let name: String
+
+    /// The number of entries.
+    public let entryCount: Int
+
+    /// The approximate memory held, in bytes.
+    public let byteCount: Int
+}
+
+/// A process-wide byte budget shared by Kalliope and Linus caches.
+///
+/// Caches register with the shared registry and report their entries'
+/// sizes. When the total exceeds `byteBudget`, entries are evicted across
+/// all caches in priority order. Priorities follow the GreedyDual-Size
+/// policy: an entry's priority is the registry's current inflation value
+/// plus its recomputation cost per byte, refreshed on every use. Entries
+/// that are cheap to recompute for their size, or have not been used for a
+/// while, go first; with costs proportional to size the policy is plain
+/// LRU.
+///
+/// Memory that is not held in entries, such as MPFR's constant caches, is
+/// released by trim handlers, which run on `trimAll()`.
+///
+/// ```swift
+/// GMPCacheRegistry.shared.byteBudget = 64 << 20
+/// GMPCacheRegistry.shared.respondsToMemoryPressure = true
+/// ```
+public final class GMPCacheRegistry: @unchecked Sendable {
+    /// The registry used by Kalliope and Linus caches.
+    public static let shared = GMPCacheRegistry()
+
+    private struct _WeakCache {
+        weak var cache: (any GMPManagedCache)?
+    }
+
+    /// Guards all mutable state below.
+    private let lock = NSLock()
+
+    private var _caches: [ObjectIdentifier: _WeakCache] = [:]
+    private var _trimHandlers: [(name: String, handler: @Sendable () -> Void)]
+        = []
+    private var _byteBudget: Int?
+    private var _inflation = 0.0
+    private var _memoryPressureSources: [DispatchSourceMemoryPressure] = []
+
+    /// Create an empty registry.
+    ///
+    /// Most code uses `shared`; separate registries are useful for caches
+    /// with their own budget.
+    public init() {}
+
+    // MARK: - Registration
+
+    /// Register a cache. The registry holds it weakly.
+    ///
+    /// - Parameter cache: The cache.
+    public func register(_ cache: any GMPManagedCache) {
+        lock.lock()
+        _caches[ObjectIdentifier(cache)] = _WeakCache(cache: cache)
+        lock.unlock()
+        didGrow()
+    }
+
+    /// Stop managing a cache.
+    ///
+    /// - Parameter cache: The cache.
+    public func unregister(_ cache: any GMPManagedCache) {
+        lock.lock()
+        defer { lock.unlock() }
+        _caches[ObjectIdentifier(cache)] = nil
+    }
+
+    /// Add a handler that releases memory not held in cache entries. It
+    /// runs on every `trimAll()`.
+    ///
+    /// - Parameters:
+    ///   - name: The handler's name. A handler with the same name is
+    ///     replaced.
+    ///   - handler: Releases the memory.
+    public func addTrimHandler(
+        named name: String,
+        _ handler: @escaping @Sendable () -> Void
+    ) {
+        lock.lock()
+        defer { lock.unlock() }
+        _trimHandlers.removeAll { $0.name == name }
+        _trimHandlers.append((name, handler))
+    }
+
+    // MARK: - Budget
+
+    /// The maximum total size of all registered caches, in bytes, or `nil`
+    /// for no limit. Defaults to `nil`.
+    ///
+    /// Lowering the budget evicts entries immediately.
+    public var byteBudget: Int? {
+        get {
+            lock.lock()
+            defer { lock.unlock() }
+            return _byteBudget
+        }
+        set {
+            precondition((newValue ?? 0) >= 0, "budget must be non-negative")
+            lock.lock()
+            _byteBudget = newValue
+            lock.unlock()
+            didGrow()
+        }
+    }
+
+    /// The eviction priority for an entry that was just created or used.
+    ///
+    /// - Parameters:
+    ///   - cost: The cost of recomputing the entry, in any unit used
+    ///     consistently by all caches. Kalliope and Linus caches use
+    ///     nanoseconds.
+    ///   - byteCount: The entry's size in bytes.
+    /// - Returns: The priority to report in `GMPCacheEntry`.
+    public func priority(cost: Double, byteCount: Int) -> Double {
+        lock.lock()
+        defer { lock.unlock() }
+        return _inflation + cost / Double(Swift.max(byteCount, 1))
+    }
+
+    /// Evict entries if the caches exceed the budget.
+    ///
+    /// Caches call this after adding entries, without holding their own
+    /// lock.
+    public func didGrow() {
+        lock.lock()
+        defer { lock.unlock() }
+        if let budget = _byteBudget {
+            _trim(toBytes: budget)
+        }
+    }
+
+    /// The total size of all registered caches, in bytes.
+    public var totalByteCount: Int {
+        statistics().reduce(0) { $0 + $1.byteCount }
+    }
+
+    /// The size of each registered cache, sorted by name.
+    public func statistics() -> [GMPCacheStatistics] {
+        lock.lock()
+        defer { lock.unlock() }
+        return _liveCaches().map { cache in
+            let entries = cache.cacheEntries()
+            return GMPCacheStatistics(
+                name: cache.cacheName,
+                entryCount: entries.count,
+                byteCount: entries.reduce(0) { $0 + $1.byteCount }
+            )
+        }
+        .sorted { $0.name < $1.name }
+    }
+
+    // MARK: - Trimming
+
+    /// Evict entries, lowest priority first, until the caches hold at most
+    /// `target` bytes.
+    ///
+    /// - Parameter target: The size to trim to, in bytes.
+    /// - Returns: The number of bytes released.
+    @discardableResult
+    public func trim(toBytes target: Int) -> Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return _trim(toBytes: target)
+    }
+
+    /// Empty every registered cache and run the trim handlers.
+    public func trimAll() {
+        lock.lock()
+        let caches = _liveCaches()
+        let handlers = _trimHandlers.map(\.handler)
+        for cache in caches {
+            cache.removeAllCacheEntries()
+        }
+        lock.unlock()
+        for handler in handlers {
+            handler()
+        }
+    }
+
+    /// Whether the registry trims caches when the system reports memory
+    /// pressure. Defaults to `false`.
+    ///
+    /// On a warning the caches are trimmed to half their size; on a
+    /// critical notification `trimAll()` runs.
+    public var respondsToMemoryPressure: Bool {
+        get {
+            lock.lock()
+            defer { lock.unlock() }
+            return !_memoryPressureSources.isEmpty
+        }
+        set {
+            lock.lock()
+            defer { lock.unlock() }
+            guard newValue != !_memoryPressureSources.isEmpty else {
+                return
+            }
+            guard newValue else {
+                _memoryPressureSources.forEach { $0.cancel() }
+                _memoryPressureSources = []
+                return
+            }
+            let warning = DispatchSource.makeMemoryPressureSource(
+                eventMask: .warning,
+                queue: .global(qos: .utility)
+            )
+            warning.setEventHandler { [weak self] in
+                guard let self else {
+                    return
+                }
+                trim(toBytes: totalByteCount / 2)
+            }
+            let critical = DispatchSource.makeMemoryPressureSource(
+                eventMask: .critical,
+                queue: .global(qos: .utility)
+            )
+            critical.setEventHandler { [weak self] in
+                self?.trimAll()
+            }
+            _memoryPressureSources = [warning, critical]
+            _memoryPressureSources.forEach { $0.resume() }
+        }
+    }
+
+    private func _liveCaches() -> [any GMPManagedCache] {
+        _caches = _caches.filter { $0.value.cache != nil }
+        return _caches.values.compactMap(\.cache)
+    }
+
+    private func _trim(toBytes target: Int) -> Int {
+        var entries: [(cache: any GMPManagedCache, entry: GMPCacheEntry)] = []
+        for cache in _liveCaches() {
+            for entry in cache.cacheEntries() {
+                entries.append((cache, entry))
+            }
+        }
+        var total = entries.reduce(0) { $0 + $1.entry.byteCount }
+        guard total > target else {
+            return 0
+        }
+        entries.sort { $0.entry.priority < $1.entry.priority }
+        var victims: [ObjectIdentifier: [AnyHashable]] = [:]
+        var released = 0
+        for (cache, entry) in entries where total > target {
+            victims[ObjectIdentifier(cache), default: []].append(entry.key)
+            total -= entry.byteCount
+            released += entry.byteCount
+            // Surviving entries compete against the evicted priority
+            _inflation = Swift.max(_inflation, entry.priority)
+        }
+        for (id, keys) in victims {
+            _caches[id]?.cache?.evictCacheEntries(keys)
+        }
+        return released
+    }
+}
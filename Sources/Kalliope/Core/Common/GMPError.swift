@@ -63,4 +63,28 @@ public enum GMPError: Error, Equatable {
     /// parameters
     /// (e.g., invalid size for linear congruential generator).
     case invalidRandomState
+
+    /// File access error.
+    ///
+    /// Thrown when a file cannot be opened, mapped, or written.
+    ///
+    /// - Parameter path: The path of the file.
+    case fileAccess(String)
+
+    /// Invalid table file error.
+    ///
+    /// Thrown when a table store file has the wrong magic number, format
+    /// version, limb size or byte order, or is truncated.
+    case invalidTableFile
+
+    /// Invalid tuning profile error.
+    ///
+    /// Thrown when a tuning profile file is not valid profile JSON.
+    case invalidTuningProfile
+
+    /// Invalid primality certificate error.
+    ///
+    /// Thrown when serialized primality certificate data is truncated or
+    /// malformed.
+    case invalidCertificate
 }
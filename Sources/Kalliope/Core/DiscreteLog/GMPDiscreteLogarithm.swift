@@ -0,0 +1,469 @@
+import CKalliope
+import Dispatch
+import Foundation
+
+extension GMPTuningParameter {
+    /// The prime subgroup order size, in bits, from which discrete
+    /// logarithms switch from baby-step giant-step to parallel Pollard rho.
+    public static let discreteLogarithmRhoThreshold = GMPTuningParameter(
+        "DiscreteLogarithm.rhoThreshold",
+        default: 32
+    )
+}
+
+/// Discrete logarithms to a fixed base modulo a prime.
+///
+/// The order of the base is factored once. Each logarithm is then split by
+/// Pohlig–Hellman into one logarithm per prime-power factor, and those into
+/// logarithms in subgroups of prime order `q`. Small subgroups are solved by
+/// baby-step giant-step with a table of 64-bit fingerprints; subgroups from
+/// `GMPTuningParameter.discreteLogarithmRhoThreshold` bits up, and every
+/// subgroup above 40 bits whatever the threshold, are solved by Pollard rho,
+/// with a distinguished-point walk on every core. All group arithmetic goes
+/// through `GMPModularContext`.
+///
+/// ```swift
+/// let log = GMPDiscreteLogarithm(base: g, modulus: p, order: q)
+/// if let x = log.logarithm(of: h) {
+///     assert(g.raisedToPower(x, modulo: p) == h)
+/// }
+/// ```
+///
+/// Rho takes about `√q` group operations in total and baby-step giant-step
+/// about `2√q` with `√q` table entries, so the cost is governed by the
+/// largest prime factor of the order.
+public struct GMPDiscreteLogarithm {
+    /// The prime modulus.
+    public let modulus: GMPInteger
+
+    /// The base, in `1 ..< modulus`.
+    public let base: GMPInteger
+
+    /// The order of `base`, found from the multiple given to `init` by
+    /// removing prime factors while `base` stays a root of unity.
+    public let order: GMPInteger
+
+    /// The prime factorization of `order`, in increasing order of primes.
+    public let factors: [(prime: GMPInteger, exponent: Int)]
+
+    /// Create a solver.
+    ///
+    /// - Parameters:
+    ///   - base: The base. Must satisfy `base^order ≡ 1 (mod modulus)`.
+    ///   - modulus: The modulus. Must be prime.
+    ///   - order: The order of `base`, or a multiple of it. Must be
+    ///     positive.
+    ///   - factors: The prime factorization of `order`, or `nil` to factor
+    ///     it by trial division and Pollard rho. Exponents above those of
+    ///     the true order are lowered.
+    ///
+    /// - Requires: `order` must factor completely, either as given or by the
+    ///   built-in factoring.
+    public init(
+        base: GMPInteger,
+        modulus: GMPInteger,
+        order: GMPInteger,
+        factors: [(prime: GMPInteger, exponent: Int)]? = nil
+    ) {
+        precondition(modulus.isProbablePrime() > 0, "modulus must be prime")
+        precondition(order.isPositive, "order must be positive")
+        let context = GMPModularContext(modulus: modulus)
+        let base = context.reduce(base)
+        precondition(
+            context.raisedToPower(base, order) == 1,
+            "order must be a multiple of the order of base"
+        )
+        let factors = factors ?? GMPPrimalityProver()._factors(
+            of: order,
+            until: { $0 == order }
+        )
+        precondition(
+            factors.reduce(GMPInteger(1)) {
+                $0 * $1.prime.raisedToPower($1.exponent)
+            } == order,
+            "order must factor completely"
+        )
+        // Pohlig–Hellman needs the exact order: with a larger q-part the
+        // generator of the order-q subgroup would be 1
+        var trueOrder = order
+        var reduced: [(prime: GMPInteger, exponent: Int)] = []
+        for (q, e) in factors {
+            var exponent = e
+            while exponent > 0 {
+                let smaller = try! trueOrder.exactlyDivided(by: q)
+                guard context.raisedToPower(base, smaller) == 1 else {
+                    break
+                }
+                trueOrder = smaller
+                exponent -= 1
+            }
+            if exponent > 0 {
+                reduced.append((q, exponent))
+            }
+        }
+        self.modulus = modulus
+        self.base = base
+        self.order = trueOrder
+        self.factors = reduced.sorted { $0.prime < $1.prime }
+    }
+
+    /// The logarithm of `value` to `base`.
+    ///
+    /// - Parameter value: The value.
+    /// - Returns: The `x` in `0 ..< order` with `base^x ≡ value`, or `nil`
+    ///   if `value` is not a power of `base`.
+    public func logarithm(of value: GMPInteger) -> GMPInteger? {
+        let context = GMPModularContext(modulus: modulus)
+        let value = context.reduce(value)
+        guard !value.isZero, context.raisedToPower(value, order) == 1 else {
+            return nil
+        }
+        // Combine the residues modulo each prime power by CRT
+        var result = GMPInteger(0)
+        var combined = GMPInteger(1)
+        for factor in factors {
+            let power = factor.prime.raisedToPower(factor.exponent)
+            guard let residue = _logarithm(
+                of: value,
+                prime: factor.prime,
+                exponent: factor.exponent,
+                context: context
+            ),
+                let inverse = combined.modularInverse(modulo: power)
+            else {
+                return nil
+            }
+            let step = GMPModularContext(modulus: power)
+                .reduce((residue - result) * inverse)
+            result = result + combined * step
+            combined = combined * power
+        }
+        guard context.raisedToPower(base, result) == value else {
+            return nil
+        }
+        return result
+    }
+
+    /// The logarithm modulo `prime^exponent`, digit by digit.
+    private func _logarithm(
+        of value: GMPInteger,
+        prime q: GMPInteger,
+        exponent e: Int,
+        context: GMPModularContext
+    ) -> GMPInteger? {
+        let cofactor = try! order.exactlyDivided(by: q.raisedToPower(e))
+        let g = context.raisedToPower(base, cofactor)
+        let h = context.raisedToPower(value, cofactor)
+        let generator = context.raisedToPower(g, q.raisedToPower(e - 1))
+        guard let gInverse = context.inverse(of: g) else {
+            return nil
+        }
+        var x = GMPInteger(0)
+        var qk = GMPInteger(1)
+        for k in 0 ..< e {
+            // h · g^-x has order dividing q^(e-k); lift it to order q
+            let remaining = context.multiplied(
+                context.raisedToPower(gInverse, x),
+                h
+            )
+            let target = context.raisedToPower(
+                remaining,
+                q.raisedToPower(e - 1 - k)
+            )
+            guard let digit = _primeOrderLogarithm(
+                of: target,
+                base: generator,
+                order: q,
+                context: context
+            ) else {
+                return nil
+            }
+            x = x + digit * qk
+            qk = qk * q
+        }
+        return x
+    }
+
+    /// The largest prime order, in bits, solved by baby-step giant-step.
+    ///
+    /// Its table has `√q` entries in twice as many twelve-byte slots, 24 MB
+    /// at 40 bits. A tuned threshold of `Int.max` must not raise that.
+    static let _babyStepMaximumBits = 40
+
+    /// The logarithm of `h` to a base of prime order `q` (or of order 1).
+    func _primeOrderLogarithm(
+        of h: GMPInteger,
+        base g: GMPInteger,
+        order q: GMPInteger,
+        context: GMPModularContext
+    ) -> GMPInteger? {
+        if h == 1 {
+            return 0
+        }
+        // The modulus is prime, so the elements with h^q = 1 are exactly
+        // the powers of g unless g = 1
+        guard g != 1, context.raisedToPower(h, q) == 1 else {
+            return nil
+        }
+        let threshold = GMPTuningParameter.discreteLogarithmRhoThreshold.value
+        if q.bitCount >= threshold || q.bitCount > Self._babyStepMaximumBits {
+            return _GMPRhoLogarithm(
+                modulus: modulus,
+                base: g,
+                value: h,
+                order: q
+            ).solve()
+        }
+        return _babyStepGiantStep(of: h, base: g, order: q, context: context)
+    }
+
+    /// Baby-step giant-step with a table of fingerprints.
+    ///
+    /// The table stores the low 64 bits of `g^j` and `j`; a match is only
+    /// a candidate, confirmed by one exponentiation.
+    func _babyStepGiantStep(
+        of h: GMPInteger,
+        base g: GMPInteger,
+        order q: GMPInteger,
+        context: GMPModularContext
+    ) -> GMPInteger? {
+        let m = (q - 1).squareRoot.toInt() + 1
+        var table = _GMPFingerprintTable(capacity: m)
+        var babyStep = GMPInteger(1)
+        for j in 0 ..< m {
+            table.insert(context._fingerprint(babyStep), UInt32(j))
+            context.multiply(babyStep, g, into: &babyStep)
+        }
+        // babyStep is now g^m
+        guard let giantStep = context.inverse(of: babyStep) else {
+            return nil
+        }
+        var y = h
+        for i in 0 ..< m {
+            var found: GMPInteger?
+            table.forEach(matching: context._fingerprint(y)) { j in
+                let candidate = GMPInteger(i) * m + Int(j)
+                if context.raisedToPower(g, candidate) == h {
+                    found = candidate
+                }
+            }
+            if let found {
+                return found
+            }
+            context.multiply(y, giantStep, into: &y)
+        }
+        return nil
+    }
+}
+
+// MARK: - Fingerprint Table
+
+/// An open-addressing multimap from 64-bit fingerprints to 32-bit indices.
+///
+/// Twelve bytes per slot, against a `Dictionary` keyed by `GMPInteger`
+/// that stores and hashes every limb.
+struct _GMPFingerprintTable {
+    private var keys: [UInt64]
+    private var values: [UInt32]
+    private let shift: Int
+
+    private static let empty = UInt32.max
+
+    /// A table for up to `capacity` entries, at most half full.
+    init(capacity: Int) {
+        precondition(capacity < Int(UInt32.max), "capacity is too large")
+        var bits = 1
+        while 1 << bits < 2 * capacity {
+            bits += 1
+        }
+        keys = [UInt64](repeating: 0, count: 1 << bits)
+        values = [UInt32](repeating: Self.empty, count: 1 << bits)
+        shift = 64 - bits
+    }
+
+    private func slot(_ key: UInt64) -> Int {
+        // Fibonacci hashing spreads keys that differ only in high bits
+        Int(truncatingIfNeeded: (key &* 0x9E37_79B9_7F4A_7C15) >> shift)
+    }
+
+    mutating func insert(_ key: UInt64, _ value: UInt32) {
+        let mask = keys.count - 1
+        var i = slot(key)
+        while values[i] != Self.empty {
+            i = (i + 1) & mask
+        }
+        keys[i] = key
+        values[i] = value
+    }
+
+    /// Call `body` with every value stored under `key`.
+    func forEach(matching key: UInt64, _ body: (UInt32) -> Void) {
+        let mask = keys.count - 1
+        var i = slot(key)
+        while values[i] != Self.empty {
+            if keys[i] == key {
+                body(values[i])
+            }
+            i = (i + 1) & mask
+        }
+    }
+}
+
+// MARK: - Parallel Rho
+
+/// Pollard rho for `log_g(h)` in a subgroup of prime order `q`, with van
+/// Oorschot–Wiener distinguished points.
+///
+/// Every core runs an r-adding walk `x ← x · M[i]` where
+/// `M[i] = g^a[i] h^b[i]`, tracking `x = g^a h^b`. A walk stops at a
+/// distinguished point, whose fingerprint has its low bits clear, and
+/// reports it to a shared table. Two walks reaching the same point with
+/// different `b` give `log_g(h) = (a' - a) / (b - b') mod q`.
+final class _GMPRhoLogarithm {
+    typealias Point = (x: GMPInteger, a: GMPInteger, b: GMPInteger)
+
+    let modulus: GMPInteger
+    let g: GMPInteger
+    let h: GMPInteger
+    let q: GMPInteger
+
+    /// The number of walk multipliers. A power of two.
+    static let multiplierCount = 32
+
+    /// `(M[i], a[i], b[i])`.
+    private let multipliers: [Point]
+
+    /// The number of low fingerprint bits that must be clear at a
+    /// distinguished point.
+    private let distinguishedBits: Int
+
+    private let lock = NSLock()
+    private var points: [UInt64: [Point]] = [:]
+    private var solution: GMPInteger?
+
+    init(
+        modulus: GMPInteger,
+        base g: GMPInteger,
+        value h: GMPInteger,
+        order q: GMPInteger
+    ) {
+        self.modulus = modulus
+        self.g = g
+        self.h = h
+        self.q = q
+        let context = GMPModularContext(modulus: modulus)
+        let state = GMPRandomState(mersenneTwister: q)
+        multipliers = (0 ..< Self.multiplierCount).map { _ in
+            let a = GMPInteger.random(upperBound: q, using: state)
+            let b = GMPInteger.random(upperBound: q, using: state)
+            let m = context.multiplied(
+                context.raisedToPower(g, a),
+                context.raisedToPower(h, b)
+            )
+            return (m, a, b)
+        }
+        // About √q steps in total; aim for a few hundred distinguished
+        // points among them. The multiplier index is read from the
+        // fingerprint bits above the distinguished ones, and the walk limit
+        // `32 << distinguishedBits` must fit in an `Int`, so subgroups
+        // beyond about 120 bits get sparser distinguished points
+        let indexBits = Self.multiplierCount.trailingZeroBitCount
+        distinguishedBits = Swift.min(
+            Swift.max(0, q.bitCount / 2 - 8),
+            Int.bitWidth - indexBits - 6
+        )
+    }
+
+    private var isSolved: Bool {
+        lock.lock()
+        defer { lock.unlock() }
+        return solution != nil
+    }
+
+    func solve() -> GMPInteger? {
+        let workers = ProcessInfo.processInfo.activeProcessorCount
+        DispatchQueue.concurrentPerform(iterations: workers) { worker in
+            walk(seed: worker)
+        }
+        return solution
+    }
+
+    private func walk(seed: Int) {
+        let context = GMPModularContext(modulus: modulus)
+        let exponents = GMPModularContext(modulus: q)
+        let state = GMPRandomState(mersenneTwister: q + seed)
+        let mask = (UInt64(1) << distinguishedBits) - 1
+        let indexMask = UInt64(Self.multiplierCount - 1)
+        // A walk this long without a distinguished point is in a cycle
+        let limit = 32 << distinguishedBits
+        while !isSolved {
+            var a = GMPInteger.random(upperBound: q, using: state)
+            var b = GMPInteger.random(upperBound: q, using: state)
+            var x = context.multiplied(
+                context.raisedToPower(g, a),
+                context.raisedToPower(h, b)
+            )
+            for _ in 0 ..< limit {
+                let fingerprint = context._fingerprint(x)
+                if fingerprint & mask == 0 {
+                    record((x, a, b), fingerprint: fingerprint)
+                    break
+                }
+                let step = multipliers[
+                    Int((fingerprint >> distinguishedBits) & indexMask)
+                ]
+                context.multiply(x, step.x, into: &x)
+                a = exponents.reduce(a + step.a)
+                b = exponents.reduce(b + step.b)
+            }
+        }
+    }
+
+    private func record(_ point: Point, fingerprint: UInt64) {
+        lock.lock()
+        defer { lock.unlock() }
+        guard solution == nil else {
+            return
+        }
+        for other in points[fingerprint, default: []] where other.x == point.x {
+            let exponents = GMPModularContext(modulus: q)
+            guard let inverse = exponents.inverse(of: point.b - other.b) else {
+                // Both walks followed the same path
+                continue
+            }
+            let candidate = exponents.reduce((other.a - point.a) * inverse)
+            if g.raisedToPower(candidate, modulo: modulus) == h {
+                solution = candidate
+                return
+            }
+        }
+        points[fingerprint, default: []].append(point)
+    }
+}
+
+extension GMPCutoverBenchmark {
+    /// Discrete logarithms in a subgroup of prime order.
+    public static var discreteLogarithm: GMPCutoverBenchmark {
+        GMPCutoverBenchmark(
+            parameter: .discreteLogarithmRhoThreshold,
+            scales: [16, 20, 24, 28, 32, 36]
+        ) { bits in
+            // A prime p = kq + 1 with q prime of the requested size
+            let q = (GMPInteger(1) << (bits - 1)).nextPrime
+            var k = 2
+            while ((q * k) + 1).isProbablePrime() == 0 {
+                k += 2
+            }
+            let p = q * k + 1
+            let g = GMPInteger(2).raisedToPower(GMPInteger(k), modulo: p)
+            let h = g.raisedToPower(q - 3, modulo: p)
+            let log = GMPDiscreteLogarithm(
+                base: g,
+                modulus: p,
+                order: q,
+                factors: [(q, 1)]
+            )
+            return (bits, { _ = log.logarithm(of: h) })
+        }
+    }
+}
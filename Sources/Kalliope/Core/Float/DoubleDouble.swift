@@ -0,0 +1,301 @@
+/// A double-double floating-point number with about 106 bits of precision.
+///
+/// A `DoubleDouble` represents the unevaluated sum `high + low` of two
+/// `Double` values, where `|low| <= ulp(high) / 2`. Arithmetic uses the
+/// error-free transformations `twoSum` and `twoProduct` (the latter via fused
+/// multiply-add), so it runs entirely in hardware floating point and never
+/// allocates.
+///
+/// It fills the gap between `Double` and arbitrary-precision floats: about
+/// twice the precision of `Double` at a small constant factor of its cost.
+/// The exponent range is that of `Double`.
+///
+/// - Note: Results are faithful rather than correctly rounded. Use `GMPFloat`
+///   or `MPFRFloat` when exact rounding semantics matter.
+public struct DoubleDouble: Sendable {
+    /// The leading component.
+    public let high: Double
+
+    /// The trailing component, at most half an ulp of `high`.
+    public let low: Double
+
+    // MARK: - Initialization
+
+    /// Create a double-double from its two components, normalizing them.
+    ///
+    /// - Parameters:
+    ///   - high: The leading component.
+    ///   - low: The trailing component.
+    ///
+    /// - Requires: None
+    /// - Guarantees: Returns a normalized value equal to `high + low`.
+    public init(high: Double, low: Double) {
+        let s = high + low
+        self.high = s
+        self.low = low - (s - high)
+    }
+
+    /// Create a double-double from components already known to be
+    /// normalized.
+    @usableFromInline
+    init(_normalizedHigh high: Double, low: Double) {
+        self.high = high
+        self.low = low
+    }
+
+    /// Create a double-double equal to a `Double`.
+    ///
+    /// - Parameter value: The value.
+    public init(_ value: Double) {
+        high = value
+        low = 0
+    }
+
+    /// Create a double-double equal to an `Int`.
+    ///
+    /// Every `Int` is represented exactly.
+    ///
+    /// - Parameter value: The value.
+    public init(_ value: Int) {
+        let high = Double(value)
+        if high == 0x1p63 {
+            // Rounded up past Int.max, so Int(high) would trap
+            self.init(high: high, low: Double(value &- Int.max) - 1)
+        } else {
+            // The conversion error is small and exactly representable
+            self.init(high: high, low: Double(value - Int(high)))
+        }
+    }
+
+    /// Create a double-double approximating a `GMPInteger`.
+    ///
+    /// - Parameter value: The integer to convert.
+    ///
+    /// - Requires: `value` must be properly initialized.
+    /// - Guarantees: Returns the value truncated to about 106 significant
+    ///   bits. Values outside the `Double` range become infinite.
+    public init(_ value: GMPInteger) {
+        // mpz_get_d truncates, so the remainder has the same sign as value
+        let high = value.toDouble()
+        guard high.isFinite else {
+            self.init(high)
+            return
+        }
+        let remainder = value - GMPInteger(high)
+        self.init(high: high, low: remainder.toDouble())
+    }
+
+    // MARK: - Error-Free Transformations
+
+    /// Compute `a + b` exactly as a normalized pair.
+    @inlinable
+    static func _twoSum(_ a: Double, _ b: Double) -> DoubleDouble {
+        let s = a + b
+        let bb = s - a
+        let e = (a - (s - bb)) + (b - bb)
+        return DoubleDouble(_normalizedHigh: s, low: e)
+    }
+
+    /// Compute `a + b` exactly, assuming `|a| >= |b|`.
+    @inlinable
+    static func _quickTwoSum(_ a: Double, _ b: Double) -> DoubleDouble {
+        let s = a + b
+        return DoubleDouble(_normalizedHigh: s, low: b - (s - a))
+    }
+
+    /// Compute `a * b` exactly using a fused multiply-add.
+    @inlinable
+    static func _twoProduct(_ a: Double, _ b: Double) -> DoubleDouble {
+        let p = a * b
+        return DoubleDouble(_normalizedHigh: p, low: (-p).addingProduct(a, b))
+    }
+
+    // MARK: - Properties
+
+    /// The value zero.
+    public static var zero: DoubleDouble {
+        DoubleDouble(0)
+    }
+
+    /// Check if the value is finite.
+    public var isFinite: Bool {
+        high.isFinite
+    }
+
+    /// Check if the value is NaN.
+    public var isNaN: Bool {
+        high.isNaN
+    }
+
+    /// The absolute value.
+    public var magnitude: DoubleDouble {
+        high < 0 ? -self : self
+    }
+
+    /// The nearest `Double` to this value.
+    public func toDouble() -> Double {
+        high + low
+    }
+
+    // MARK: - Arithmetic
+
+    /// Add two double-doubles.
+    ///
+    /// - Note: Uses the accurate (IEEE-style) double-double addition.
+    @inlinable
+    public static func + (
+        lhs: DoubleDouble,
+        rhs: DoubleDouble
+    ) -> DoubleDouble {
+        let s = _twoSum(lhs.high, rhs.high)
+        let t = _twoSum(lhs.low, rhs.low)
+        let u = _quickTwoSum(s.high, s.low + t.high)
+        return _quickTwoSum(u.high, u.low + t.low)
+    }
+
+    /// Negate a double-double.
+    @inlinable
+    public static prefix func - (value: DoubleDouble) -> DoubleDouble {
+        DoubleDouble(_normalizedHigh: -value.high, low: -value.low)
+    }
+
+    /// Subtract two double-doubles.
+    @inlinable
+    public static func - (
+        lhs: DoubleDouble,
+        rhs: DoubleDouble
+    ) -> DoubleDouble {
+        lhs + -rhs
+    }
+
+    /// Multiply two double-doubles.
+    @inlinable
+    public static func * (
+        lhs: DoubleDouble,
+        rhs: DoubleDouble
+    ) -> DoubleDouble {
+        let p = _twoProduct(lhs.high, rhs.high)
+        let cross = lhs.high * rhs.low + lhs.low * rhs.high
+        return _quickTwoSum(p.high, p.low + cross)
+    }
+
+    /// Multiply a double-double by a `Double`.
+    @inlinable
+    public static func * (lhs: DoubleDouble, rhs: Double) -> DoubleDouble {
+        let p = _twoProduct(lhs.high, rhs)
+        return _quickTwoSum(p.high, p.low + lhs.low * rhs)
+    }
+
+    /// Divide two double-doubles.
+    ///
+    /// - Note: Uses three rounds of long division on the leading components.
+    @inlinable
+    public static func / (
+        lhs: DoubleDouble,
+        rhs: DoubleDouble
+    ) -> DoubleDouble {
+        let q1 = lhs.high / rhs.high
+        var r = lhs - rhs * q1
+        let q2 = r.high / rhs.high
+        r = r - rhs * q2
+        let q3 = r.high / rhs.high
+        return _quickTwoSum(q1, q2) + DoubleDouble(q3)
+    }
+
+    /// Add and assign.
+    @inlinable
+    public static func += (lhs: inout DoubleDouble, rhs: DoubleDouble) {
+        lhs = lhs + rhs
+    }
+
+    /// Subtract and assign.
+    @inlinable
+    public static func -= (lhs: inout DoubleDouble, rhs: DoubleDouble) {
+        lhs = lhs - rhs
+    }
+
+    /// Multiply and assign.
+    @inlinable
+    public static func *= (lhs: inout DoubleDouble, rhs: DoubleDouble) {
+        lhs = lhs * rhs
+    }
+
+    /// Divide and assign.
+    @inlinable
+    public static func /= (lhs: inout DoubleDouble, rhs: DoubleDouble) {
+        lhs = lhs / rhs
+    }
+
+    /// The square root.
+    ///
+    /// - Returns: The square root, or NaN for negative values.
+    ///
+    /// - Note: One Newton step from the `Double` square root of `high`.
+    public func squareRoot() -> DoubleDouble {
+        guard high > 0 else {
+            return high == 0 ? .zero : DoubleDouble(Double.nan)
+        }
+        let x = high.squareRoot()
+        let residual = self - DoubleDouble._twoProduct(x, x)
+        return DoubleDouble._quickTwoSum(x, residual.high / (2 * x))
+    }
+
+    /// Round to the nearest integer, ties away from zero.
+    public func rounded() -> DoubleDouble {
+        let r = high.rounded()
+        if r == high {
+            // high is integral, so only low can carry a fraction
+            return DoubleDouble._quickTwoSum(r, low.rounded())
+        }
+        if (r - high).magnitude == 0.5, low != 0 {
+            // high is exactly halfway; low decides the direction
+            let direction: FloatingPointRoundingRule = low > 0 ? .up : .down
+            return DoubleDouble(high.rounded(direction))
+        }
+        return DoubleDouble(r)
+    }
+
+    /// Convert an integral value to a `GMPInteger`.
+    ///
+    /// - Returns: The integer nearest to this value.
+    ///
+    /// - Requires: The value must be finite.
+    public func roundedToGMPInteger() -> GMPInteger {
+        precondition(isFinite, "value must be finite")
+        let r = rounded()
+        return GMPInteger(r.high) + GMPInteger(r.low)
+    }
+}
+
+// MARK: - Protocol Conformances
+
+extension DoubleDouble: Equatable {
+    public static func == (lhs: DoubleDouble, rhs: DoubleDouble) -> Bool {
+        lhs.high == rhs.high && lhs.low == rhs.low
+    }
+}
+
+extension DoubleDouble: Comparable {
+    public static func < (lhs: DoubleDouble, rhs: DoubleDouble) -> Bool {
+        lhs.high < rhs.high || (lhs.high == rhs.high && lhs.low < rhs.low)
+    }
+}
+
+extension DoubleDouble: ExpressibleByFloatLiteral {
+    public init(floatLiteral value: Double) {
+        self.init(value)
+    }
+}
+
+extension DoubleDouble: ExpressibleByIntegerLiteral {
+    public init(integerLiteral value: Int) {
+        self.init(value)
+    }
+}
+
+extension DoubleDouble: CustomStringConvertible {
+    /// The components, formatted as `high + low`.
+    public var description: String {
+        low == 0 ? "\(high)" : "\(high) + \(low)"
+    }
+}
@@ -0,0 +1,628 @@
+import CKalliope
+import Dispatch
+
+/// Exact orientation and in-circle tests on `Double` coordinates.
+///
+/// Each predicate returns the sign of a determinant (+1, 0 or -1) exactly,
+/// as if it were evaluated in rational arithmetic, but pays for exactness
+/// only when the answer is close:
+///
+/// 1. The determinant is evaluated in `Double` and accepted when it exceeds
+///    a static bound on the rounding error, `c·ε` times the permanent (the
+///    same expression with every term made positive). This decides all but
+///    near-degenerate inputs.
+/// 2. Otherwise it is evaluated exactly as a floating-point expansion, a
+///    sum of nonoverlapping `Double` components built with the error-free
+///    `twoSum` and `twoProduct`.
+/// 3. Expansions are exact only without overflow or underflow, so inputs
+///    whose nonzero magnitudes span too many binades are evaluated on
+///    integer mantissas scaled to a common exponent with `GMPInteger`.
+///
+/// Both faster stages require every nonzero coordinate to lie in
+/// `[2^-100, 2^100]`, which guarantees that no intermediate result
+/// overflows or underflows; other inputs are first scaled by a power of
+/// two, which preserves every sign. Error bounds follow Shewchuk, "Adaptive
+/// Precision Floating-Point Arithmetic and Fast Robust Geometric
+/// Predicates" (1997), as do the sign conventions.
+///
+/// The batch overloads evaluate many predicates over parallel coordinate
+/// arrays, concurrently for large batches.
+///
+/// ```swift
+/// let side = GeometricPredicates.orient2d(a, b, c)
+/// let inside = GeometricPredicates.inCircle(a, b, c, d) > 0
+/// ```
+public enum GeometricPredicates {
+    /// The unit roundoff of `Double`.
+    private static let epsilon = 0x1p-53
+
+    /// Relative error bounds of the `Double` evaluations.
+    private static let orient2dBound = (3 + 16 * epsilon) * epsilon
+    private static let orient3dBound = (7 + 56 * epsilon) * epsilon
+    private static let inCircleBound = (10 + 96 * epsilon) * epsilon
+    private static let inSphereBound = (16 + 224 * epsilon) * epsilon
+
+    /// The number of predicates each task evaluates in a batch.
+    static let batchChunk = 4096
+
+    // MARK: - Orientation
+
+    /// The orientation of three points in the plane.
+    ///
+    /// - Returns: +1 if `a`, `b`, `c` are in counterclockwise order, -1 if
+    ///   clockwise, and 0 if they are collinear.
+    ///
+    /// - Requires: Every coordinate must be finite.
+    public static func orient2d(
+        _ a: SIMD2<Double>,
+        _ b: SIMD2<Double>,
+        _ c: SIMD2<Double>
+    ) -> Int {
+        if _inRange(a), _inRange(b), _inRange(c) {
+            let left = (a.x - c.x) * (b.y - c.y)
+            let right = (a.y - c.y) * (b.x - c.x)
+            let det = left - right
+            let bound = orient2dBound * (abs(left) + abs(right))
+            if abs(det) > bound || bound == 0 {
+                return _sign(det)
+            }
+        }
+        return _exactSign([_scalars(a), _scalars(b), _scalars(c)]) {
+            _orient2d($0)
+        } integer: {
+            _orient2d($0)
+        }
+    }
+
+    /// The orientation of four points in space.
+    ///
+    /// - Returns: +1 if `d` lies below the plane through `a`, `b`, `c`,
+    ///   where "below" is the side from which they appear clockwise; -1 if
+    ///   it lies above, and 0 if the points are coplanar.
+    ///
+    /// - Requires: Every coordinate must be finite.
+    public static func orient3d(
+        _ a: SIMD3<Double>,
+        _ b: SIMD3<Double>,
+        _ c: SIMD3<Double>,
+        _ d: SIMD3<Double>
+    ) -> Int {
+        if _inRange(a), _inRange(b), _inRange(c), _inRange(d) {
+            let ad = a - d
+            let bd = b - d
+            let cd = c - d
+            let bdxcdy = bd.x * cd.y
+            let cdxbdy = cd.x * bd.y
+            let cdxady = cd.x * ad.y
+            let adxcdy = ad.x * cd.y
+            let adxbdy = ad.x * bd.y
+            let bdxady = bd.x * ad.y
+            let det = ad.z * (bdxcdy - cdxbdy)
+                + bd.z * (cdxady - adxcdy)
+                + cd.z * (adxbdy - bdxady)
+            let permanent = (abs(bdxcdy) + abs(cdxbdy)) * abs(ad.z)
+                + (abs(cdxady) + abs(adxcdy)) * abs(bd.z)
+                + (abs(adxbdy) + abs(bdxady)) * abs(cd.z)
+            let bound = orient3dBound * permanent
+            if abs(det) > bound || bound == 0 {
+                return _sign(det)
+            }
+        }
+        let points = [_scalars(a), _scalars(b), _scalars(c), _scalars(d)]
+        return _exactSign(points) {
+            _orient3d($0)
+        } integer: {
+            _orient3d($0)
+        }
+    }
+
+    // MARK: - In-Circle and In-Sphere
+
+    /// Whether a point lies inside the circle through three others.
+    ///
+    /// - Returns: +1 if `d` lies inside the circle through `a`, `b`, `c`,
+    ///   -1 if outside, and 0 if the four points are cocircular. The sign
+    ///   is reversed when `a`, `b`, `c` are in clockwise order.
+    ///
+    /// - Requires: Every coordinate must be finite.
+    public static func inCircle(
+        _ a: SIMD2<Double>,
+        _ b: SIMD2<Double>,
+        _ c: SIMD2<Double>,
+        _ d: SIMD2<Double>
+    ) -> Int {
+        if _inRange(a), _inRange(b), _inRange(c), _inRange(d) {
+            let ad = a - d
+            let bd = b - d
+            let cd = c - d
+            let bdxcdy = bd.x * cd.y
+            let cdxbdy = cd.x * bd.y
+            let cdxady = cd.x * ad.y
+            let adxcdy = ad.x * cd.y
+            let adxbdy = ad.x * bd.y
+            let bdxady = bd.x * ad.y
+            let aLift = ad.x * ad.x + ad.y * ad.y
+            let bLift = bd.x * bd.x + bd.y * bd.y
+            let cLift = cd.x * cd.x + cd.y * cd.y
+            let det = aLift * (bdxcdy - cdxbdy)
+                + bLift * (cdxady - adxcdy)
+                + cLift * (adxbdy - bdxady)
+            let permanent = (abs(bdxcdy) + abs(cdxbdy)) * aLift
+                + (abs(cdxady) + abs(adxcdy)) * bLift
+                + (abs(adxbdy) + abs(bdxady)) * cLift
+            let bound = inCircleBound * permanent
+            if abs(det) > bound || bound == 0 {
+                return _sign(det)
+            }
+        }
+        let points = [_scalars(a), _scalars(b), _scalars(c), _scalars(d)]
+        return _exactSign(points) {
+            _inCircle($0)
+        } integer: {
+            _inCircle($0)
+        }
+    }
+
+    /// Whether a point lies inside the sphere through four others.
+    ///
+    /// - Returns: +1 if `e` lies inside the sphere through `a`, `b`, `c`,
+    ///   `d`, -1 if outside, and 0 if the five points are cospherical. The
+    ///   sign is reversed when `orient3d(a, b, c, d)` is negative.
+    ///
+    /// - Requires: Every coordinate must be finite.
+    public static func inSphere(
+        _ a: SIMD3<Double>,
+        _ b: SIMD3<Double>,
+        _ c: SIMD3<Double>,
+        _ d: SIMD3<Double>,
+        _ e: SIMD3<Double>
+    ) -> Int {
+        if _inRange(a), _inRange(b), _inRange(c), _inRange(d), _inRange(e) {
+            let ae = a - e
+            let be = b - e
+            let ce = c - e
+            let de = d - e
+            let aexbey = ae.x * be.y
+            let bexaey = be.x * ae.y
+            let bexcey = be.x * ce.y
+            let cexbey = ce.x * be.y
+            let cexdey = ce.x * de.y
+            let dexcey = de.x * ce.y
+            let dexaey = de.x * ae.y
+            let aexdey = ae.x * de.y
+            let aexcey = ae.x * ce.y
+            let cexaey = ce.x * ae.y
+            let bexdey = be.x * de.y
+            let dexbey = de.x * be.y
+            let ab = aexbey - bexaey
+            let bc = bexcey - cexbey
+            let cd = cexdey - dexcey
+            let da = dexaey - aexdey
+            let ac = aexcey - cexaey
+            let bd = bexdey - dexbey
+            let abc = ae.z * bc - be.z * ac + ce.z * ab
+            let bcd = be.z * cd - ce.z * bd + de.z * bc
+            let cda = ce.z * da + de.z * ac + ae.z * cd
+            let dab = de.z * ab + ae.z * bd + be.z * da
+            let aLift = ae.x * ae.x + ae.y * ae.y + ae.z * ae.z
+            let bLift = be.x * be.x + be.y * be.y + be.z * be.z
+            let cLift = ce.x * ce.x + ce.y * ce.y + ce.z * ce.z
+            let dLift = de.x * de.x + de.y * de.y + de.z * de.z
+            let det = (dLift * abc - cLift * dab) + (bLift * cda - aLift * bcd)
+
+            let abPlus = abs(aexbey) + abs(bexaey)
+            let bcPlus = abs(bexcey) + abs(cexbey)
+            let cdPlus = abs(cexdey) + abs(dexcey)
+            let daPlus = abs(dexaey) + abs(aexdey)
+            let acPlus = abs(aexcey) + abs(cexaey)
+            let bdPlus = abs(bexdey) + abs(dexbey)
+            let permanent = (cdPlus * abs(be.z) + bdPlus * abs(ce.z)
+                + bcPlus * abs(de.z)) * aLift
+                + (daPlus * abs(ce.z) + acPlus * abs(de.z)
+                    + cdPlus * abs(ae.z)) * bLift
+                + (abPlus * abs(de.z) + bdPlus * abs(ae.z)
+                    + daPlus * abs(be.z)) * cLift
+                + (bcPlus * abs(ae.z) + acPlus * abs(be.z)
+                    + abPlus * abs(ce.z)) * dLift
+            let bound = inSphereBound * permanent
+            if abs(det) > bound || bound == 0 {
+                return _sign(det)
+            }
+        }
+        let points = [a, b, c, d, e].map { _scalars($0) }
+        return _exactSign(points) {
+            _inSphere($0)
+        } integer: {
+            _inSphere($0)
+        }
+    }
+
+    // MARK: - Batches
+
+    /// `orient2d(a[i], b[i], c[i])` for every `i`.
+    ///
+    /// - Requires: The arrays must have equal counts.
+    public static func orient2d(
+        _ a: [SIMD2<Double>],
+        _ b: [SIMD2<Double>],
+        _ c: [SIMD2<Double>]
+    ) -> [Int] {
+        precondition(
+            a.count == b.count && a.count == c.count,
+            "point arrays must have equal counts"
+        )
+        return _batch(count: a.count) { orient2d(a[$0], b[$0], c[$0]) }
+    }
+
+    /// `orient3d(a[i], b[i], c[i], d[i])` for every `i`.
+    ///
+    /// - Requires: The arrays must have equal counts.
+    public static func orient3d(
+        _ a: [SIMD3<Double>],
+        _ b: [SIMD3<Double>],
+        _ c: [SIMD3<Double>],
+        _ d: [SIMD3<Double>]
+    ) -> [Int] {
+        precondition(
+            [b.count, c.count, d.count].allSatisfy { $0 == a.count },
+            "point arrays must have equal counts"
+        )
+        return _batch(count: a.count) {
+            orient3d(a[$0], b[$0], c[$0], d[$0])
+        }
+    }
+
+    /// `inCircle(a[i], b[i], c[i], d[i])` for every `i`.
+    ///
+    /// - Requires: The arrays must have equal counts.
+    public static func inCircle(
+        _ a: [SIMD2<Double>],
+        _ b: [SIMD2<Double>],
+        _ c: [SIMD2<Double>],
+        _ d: [SIMD2<Double>]
+    ) -> [Int] {
+        precondition(
+            [b.count, c.count, d.count].allSatisfy { $0 == a.count },
+            "point arrays must have equal counts"
+        )
+        return _batch(count: a.count) {
+            inCircle(a[$0], b[$0], c[$0], d[$0])
+        }
+    }
+
+    /// `inSphere(a[i], b[i], c[i], d[i], e[i])` for every `i`.
+    ///
+    /// - Requires: The arrays must have equal counts.
+    public static func inSphere(
+        _ a: [SIMD3<Double>],
+        _ b: [SIMD3<Double>],
+        _ c: [SIMD3<Double>],
+        _ d: [SIMD3<Double>],
+        _ e: [SIMD3<Double>]
+    ) -> [Int] {
+        precondition(
+            [b.count, c.count, d.count, e.count].allSatisfy { $0 == a.count },
+            "point arrays must have equal counts"
+        )
+        return _batch(count: a.count) {
+            inSphere(a[$0], b[$0], c[$0], d[$0], e[$0])
+        }
+    }
+
+    /// `body(i)` for `i` in `0 ..< count`, in chunks of `batchChunk`
+    /// evaluated concurrently.
+    private static func _batch(
+        count: Int,
+        _ body: (Int) -> Int
+    ) -> [Int] {
+        var result = [Int](repeating: 0, count: count)
+        let chunks = (count + batchChunk - 1) / batchChunk
+        result.withUnsafeMutableBufferPointer { buffer in
+            guard chunks > 1 else {
+                for i in 0 ..< count {
+                    buffer[i] = body(i)
+                }
+                return
+            }
+            DispatchQueue.concurrentPerform(iterations: chunks) { chunk in
+                let low = chunk * batchChunk
+                for i in low ..< Swift.min(count, low + batchChunk) {
+                    buffer[i] = body(i)
+                }
+            }
+        }
+        return result
+    }
+
+    // MARK: - Exact Evaluation
+
+    /// Whether `x` is zero or of magnitude within `[2^-100, 2^100]`.
+    ///
+    /// Nonzero values in range are multiples of `2^-152`, so every product
+    /// of up to five differences is a nonzero multiple of `2^-760` or zero
+    /// and stays far from the underflow threshold, and far below overflow.
+    @inline(__always)
+    static func _inRange(_ x: Double) -> Bool {
+        let magnitude = abs(x)
+        return magnitude == 0
+            || (magnitude >= 0x1p-100 && magnitude <= 0x1p100)
+    }
+
+    @inline(__always)
+    private static func _inRange<V: SIMD>(_ point: V) -> Bool
+        where V.Scalar == Double
+    {
+        for i in point.indices where !_inRange(point[i]) {
+            return false
+        }
+        return true
+    }
+
+    private static func _sign(_ x: Double) -> Int {
+        x > 0 ? 1 : (x < 0 ? -1 : 0)
+    }
+
+    private static func _scalars<V: SIMD>(_ point: V) -> [Double]
+        where V.Scalar == Double
+    {
+        point.indices.map { point[$0] }
+    }
+
+    /// The sign of a determinant of `points`, by expansions when the
+    /// coordinates can be scaled into range and by integers otherwise.
+    private static func _exactSign(
+        _ points: [[Double]],
+        expansion: ([[_Expansion]]) -> _Expansion,
+        integer: ([[GMPInteger]]) -> GMPInteger
+    ) -> Int {
+        precondition(
+            points.joined().allSatisfy(\.isFinite),
+            "coordinates must be finite"
+        )
+        let nonzero = points.joined().filter { $0 != 0 }
+        guard let largest = nonzero.map(\.exponent).max(),
+              let smallest = nonzero.map(\.exponent).min()
+        else {
+            return 0
+        }
+        var shift = 0
+        if !nonzero.allSatisfy({ _inRange($0) }) {
+            // Bring the largest magnitude to 2^64
+            shift = 64 - largest
+            guard smallest + shift >= -100 else {
+                return integer(_integers(points)).sign
+            }
+        }
+        let expansions = points.map { point in
+            point.map { x in
+                _Expansion(
+                    x == 0 ? 0 : Double(
+                        sign: x.sign,
+                        exponent: x.exponent + shift,
+                        significand: x.significand
+                    )
+                )
+            }
+        }
+        return expansion(expansions).sign
+    }
+
+    /// The coordinates as integers `x · 2^-s` for the smallest ulp
+    /// exponent `s` among them.
+    private static func _integers(_ points: [[Double]]) -> [[GMPInteger]] {
+        let fraction = Double.significandBitCount
+        let shift = points.joined()
+            .filter { $0 != 0 }
+            .map { $0.exponent - fraction }
+            .min() ?? 0
+        return points.map { point in
+            point.map { x in
+                guard x != 0 else {
+                    return GMPInteger(0)
+                }
+                // x = significand · 2^exponent with a significand of at
+                // most 53 bits
+                let mantissa = GMPInteger(Int(x.significand * 0x1p52))
+                    << (x.exponent - fraction - shift)
+                return x < 0 ? -mantissa : mantissa
+            }
+        }
+    }
+
+    // MARK: - Determinants
+
+    private static func _difference<T: _PredicateArithmetic>(
+        _ u: [T],
+        _ v: [T]
+    ) -> [T] {
+        zip(u, v).map { $0 - $1 }
+    }
+
+    private static func _orient2d<T: _PredicateArithmetic>(
+        _ points: [[T]]
+    ) -> T {
+        let ac = _difference(points[0], points[2])
+        let bc = _difference(points[1], points[2])
+        return ac[0] * bc[1] - ac[1] * bc[0]
+    }
+
+    private static func _orient3d<T: _PredicateArithmetic>(
+        _ points: [[T]]
+    ) -> T {
+        let ad = _difference(points[0], points[3])
+        let bd = _difference(points[1], points[3])
+        let cd = _difference(points[2], points[3])
+        let first = ad[2] * (bd[0] * cd[1] - cd[0] * bd[1])
+        let second = bd[2] * (cd[0] * ad[1] - ad[0] * cd[1])
+        let third = cd[2] * (ad[0] * bd[1] - bd[0] * ad[1])
+        return first + second + third
+    }
+
+    private static func _inCircle<T: _PredicateArithmetic>(
+        _ points: [[T]]
+    ) -> T {
+        let ad = _difference(points[0], points[3])
+        let bd = _difference(points[1], points[3])
+        let cd = _difference(points[2], points[3])
+        let aLift = ad[0] * ad[0] + ad[1] * ad[1]
+        let bLift = bd[0] * bd[0] + bd[1] * bd[1]
+        let cLift = cd[0] * cd[0] + cd[1] * cd[1]
+        let first = aLift * (bd[0] * cd[1] - cd[0] * bd[1])
+        let second = bLift * (cd[0] * ad[1] - ad[0] * cd[1])
+        let third = cLift * (ad[0] * bd[1] - bd[0] * ad[1])
+        return first + second + third
+    }
+
+    private static func _inSphere<T: _PredicateArithmetic>(
+        _ points: [[T]]
+    ) -> T {
+        let p = (0 ..< 4).map { _difference(points[$0], points[4]) }
+        func cross(_ i: Int, _ j: Int) -> T {
+            p[i][0] * p[j][1] - p[j][0] * p[i][1]
+        }
+        func lift(_ i: Int) -> T {
+            p[i][0] * p[i][0] + p[i][1] * p[i][1] + p[i][2] * p[i][2]
+        }
+        let (ab, bc, cd) = (cross(0, 1), cross(1, 2), cross(2, 3))
+        let (da, ac, bd) = (cross(3, 0), cross(0, 2), cross(1, 3))
+        let abc = p[0][2] * bc - p[1][2] * ac + p[2][2] * ab
+        let bcd = p[1][2] * cd - p[2][2] * bd + p[3][2] * bc
+        let cda = p[2][2] * da + p[3][2] * ac + p[0][2] * cd
+        let dab = p[3][2] * ab + p[0][2] * bd + p[1][2] * da
+        return (lift(3) * abc - lift(2) * dab)
+            + (lift(1) * cda - lift(0) * bcd)
+    }
+}
+
+// MARK: - Exact Arithmetic
+
+/// The ring operations the exact determinant formulas need.
+protocol _PredicateArithmetic {
+    static func + (lhs: Self, rhs: Self) -> Self
+    static func - (lhs: Self, rhs: Self) -> Self
+    static func * (lhs: Self, rhs: Self) -> Self
+
+    /// +1, 0 or -1.
+    var sign: Int { get }
+}
+
+extension GMPInteger: _PredicateArithmetic {}
+
+/// A floating-point expansion: an exact sum of nonoverlapping `Double`
+/// components.
+///
+/// Components are kept in increasing order of magnitude with zeros
+/// removed, so the sign is that of the last component. Sums and products
+/// follow Shewchuk's zero-eliminating `fast_expansion_sum` and
+/// `scale_expansion` and are exact as long as nothing overflows or
+/// underflows.
+struct _Expansion: _PredicateArithmetic {
+    /// The components, smallest magnitude first.
+    var components: [Double]
+
+    init(_ value: Double) {
+        components = value == 0 ? [] : [value]
+    }
+
+    init(components: [Double]) {
+        self.components = components
+    }
+
+    var sign: Int {
+        guard let last = components.last else {
+            return 0
+        }
+        return last > 0 ? 1 : -1
+    }
+
+    static prefix func - (value: _Expansion) -> _Expansion {
+        _Expansion(components: value.components.map { -$0 })
+    }
+
+    static func + (lhs: _Expansion, rhs: _Expansion) -> _Expansion {
+        let e = lhs.components
+        let f = rhs.components
+        guard !e.isEmpty else {
+            return rhs
+        }
+        guard !f.isEmpty else {
+            return lhs
+        }
+        // Merge by magnitude, then carry a running sum through twoSum,
+        // emitting each nonzero error term
+        var merged: [Double] = []
+        merged.reserveCapacity(e.count + f.count)
+        var i = 0
+        var j = 0
+        while i < e.count, j < f.count {
+            if abs(e[i]) < abs(f[j]) {
+                merged.append(e[i])
+                i += 1
+            } else {
+                merged.append(f[j])
+                j += 1
+            }
+        }
+        merged.append(contentsOf: e[i...])
+        merged.append(contentsOf: f[j...])
+        var result: [Double] = []
+        result.reserveCapacity(merged.count)
+        var q = merged[0]
+        for g in merged.dropFirst() {
+            let sum = DoubleDouble._twoSum(q, g)
+            if sum.low != 0 {
+                result.append(sum.low)
+            }
+            q = sum.high
+        }
+        if q != 0 {
+            result.append(q)
+        }
+        return _Expansion(components: result)
+    }
+
+    static func - (lhs: _Expansion, rhs: _Expansion) -> _Expansion {
+        lhs + -rhs
+    }
+
+    static func * (lhs: _Expansion, rhs: _Expansion) -> _Expansion {
+        let (long, short) = lhs.components.count >= rhs.components.count
+            ? (lhs, rhs)
+            : (rhs, lhs)
+        var result = _Expansion(components: [])
+        for b in short.components {
+            result = result + long._scaled(by: b)
+        }
+        return result
+    }
+
+    /// The exact product with one `Double`.
+    private func _scaled(by b: Double) -> _Expansion {
+        guard let first = components.first else {
+            return self
+        }
+        var result: [Double] = []
+        result.reserveCapacity(2 * components.count)
+        let product = DoubleDouble._twoProduct(first, b)
+        if product.low != 0 {
+            result.append(product.low)
+        }
+        var q = product.high
+        for x in components.dropFirst() {
+            let product = DoubleDouble._twoProduct(x, b)
+            let sum = DoubleDouble._twoSum(q, product.low)
+            if sum.low != 0 {
+                result.append(sum.low)
+            }
+            let next = DoubleDouble._quickTwoSum(product.high, sum.high)
+            if next.low != 0 {
+                result.append(next.low)
+            }
+            q = next.high
+        }
+        if q != 0 {
+            result.append(q)
+        }
+        return _Expansion(components: result)
+    }
+}
@@ -155,14 +155,21 @@ extension GMPInteger {
     /// - Guarantees: Returns a new `GMPInteger` with the product. `self` is
     /// unchanged.
     ///
-    /// - Note: Wraps `mpz_mul`.
+    /// - Note: Wraps `mpz_mul`. Checked by `GMPVerification` when
+    ///   `.multiply` is an automatic category.
     public func multiplied(by other: GMPInteger) -> GMPInteger {
         let result = GMPInteger() // Mutated through pointer below
-        __gmpz_mul(
-            &result._storage.value,
-            &_storage.value,
-            &other._storage.value
-        )
+        let size = Swift.max(limbCount, other.limbCount)
+        GMPTracer._trace(.multiply, "mpz_mul", size: size) {
+            __gmpz_mul(
+                &result._storage.value,
+                &_storage.value,
+                &other._storage.value
+            )
+        }
+        if GMPVerification._isAutomatic(.multiply, size: size) {
+            _ = GMPVerification.verifyProduct(result, self, other)
+        }
         return result
     }
 
@@ -414,13 +421,15 @@ extension GMPInteger {
         _ multiplicand: GMPInteger,
         _ multiplier: GMPInteger
     ) {
-        // Use immutable operations to avoid exclusivity violations when self,
-        // multiplicand,
-        // or multiplier are the same variable. Equivalent to: self = self +
-        // multiplicand * multiplier
-        let product = multiplicand.multiplied(by: multiplier)
-        let result = adding(product)
-        self = result
+        // After _ensureUnique, self's storage is never shared with an operand
+        // (passing self as an operand holds a second reference and forces a
+        // copy), so mpz_addmul can update it in place without a temporary.
+        _ensureUnique()
+        __gmpz_addmul(
+            &_storage.value,
+            &multiplicand._storage.value,
+            &multiplier._storage.value
+        )
     }
 
     /// Add the product of a `GMPInteger` and an `Int` to this integer in place.
@@ -440,11 +449,20 @@ extension GMPInteger {
         _ multiplicand: GMPInteger,
         _ multiplier: Int
     ) {
-        // Use immutable operations to avoid exclusivity violations when self
-        // === multiplicand
-        let product = multiplicand.multiplied(by: multiplier)
-        let result = adding(product)
-        self = result
+        _ensureUnique()
+        if multiplier >= 0 {
+            __gmpz_addmul_ui(
+                &_storage.value,
+                &multiplicand._storage.value,
+                CUnsignedLong(multiplier)
+            )
+        } else {
+            __gmpz_submul_ui(
+                &_storage.value,
+                &multiplicand._storage.value,
+                CUnsignedLong(multiplier.magnitude)
+            )
+        }
     }
 
     /// Subtract the product of two integers from this integer in place.
@@ -466,13 +484,13 @@ extension GMPInteger {
         _ multiplicand: GMPInteger,
         _ multiplier: GMPInteger
     ) {
-        // Use immutable operations to avoid exclusivity violations when self,
-        // multiplicand,
-        // or multiplier are the same variable. Equivalent to: self = self -
-        // multiplicand * multiplier
-        let product = multiplicand.multiplied(by: multiplier)
-        let result = subtracting(product)
-        self = result
+        // See addProduct(_:_:) for why this is safe to do in place
+        _ensureUnique()
+        __gmpz_submul(
+            &_storage.value,
+            &multiplicand._storage.value,
+            &multiplier._storage.value
+        )
     }
 
     /// Subtract the product of a `GMPInteger` and an `Int` from this integer in
@@ -493,11 +511,20 @@ extension GMPInteger {
         _ multiplicand: GMPInteger,
         _ multiplier: Int
     ) {
-        // Use immutable operations to avoid exclusivity violations when self
-        // === multiplicand
-        let product = multiplicand.multiplied(by: multiplier)
-        let result = subtracting(product)
-        self = result
+        _ensureUnique()
+        if multiplier >= 0 {
+            __gmpz_submul_ui(
+                &_storage.value,
+                &multiplicand._storage.value,
+                CUnsignedLong(multiplier)
+            )
+        } else {
+            __gmpz_addmul_ui(
+                &_storage.value,
+                &multiplicand._storage.value,
+                CUnsignedLong(multiplier.magnitude)
+            )
+        }
     }
 
     // MARK: - Power of 2 Operations
@@ -41,11 +41,13 @@ extension GMPInteger {
             throw GMPError.divisionByZero
         }
         let result = GMPInteger() // Mutated through pointer below
-        __gmpz_fdiv_q(
-            &result._storage.value,
-            &_storage.value,
-            &divisor._storage.value
-        )
+        GMPTracer._trace(.divide, "mpz_fdiv_q", size: limbCount) {
+            __gmpz_fdiv_q(
+                &result._storage.value,
+                &_storage.value,
+                &divisor._storage.value
+            )
+        }
         return result
     }
 
@@ -116,11 +118,13 @@ extension GMPInteger {
             throw GMPError.divisionByZero
         }
         let result = GMPInteger() // Mutated through pointer below
-        __gmpz_fdiv_r(
-            &result._storage.value,
-            &_storage.value,
-            &divisor._storage.value
-        )
+        GMPTracer._trace(.divide, "mpz_fdiv_r", size: limbCount) {
+            __gmpz_fdiv_r(
+                &result._storage.value,
+                &_storage.value,
+                &divisor._storage.value
+            )
+        }
         return result
     }
 
@@ -175,7 +179,8 @@ extension GMPInteger {
     /// unchanged.
     ///   The values satisfy: `self = quotient * divisor + remainder`.
     ///
-    /// - Note: Wraps `mpz_fdiv_qr`.
+    /// - Note: Wraps `mpz_fdiv_qr`. Checked by `GMPVerification` when
+    ///   `.divide` is an automatic category.
     /// - Throws: `GMPError.divisionByZero` if `divisor` is zero.
     public func floorQuotientAndRemainder(dividingBy divisor: GMPInteger) throws
         -> (quotient: GMPInteger, remainder: GMPInteger)
@@ -185,12 +190,22 @@ extension GMPInteger {
         }
         let quotient = GMPInteger() // Mutated through pointer below
         let remainder = GMPInteger() // Mutated through pointer below
-        __gmpz_fdiv_qr(
-            &quotient._storage.value,
-            &remainder._storage.value,
-            &_storage.value,
-            &divisor._storage.value
-        )
+        GMPTracer._trace(.divide, "mpz_fdiv_qr", size: limbCount) {
+            __gmpz_fdiv_qr(
+                &quotient._storage.value,
+                &remainder._storage.value,
+                &_storage.value,
+                &divisor._storage.value
+            )
+        }
+        if GMPVerification._isAutomatic(.divide, size: limbCount) {
+            _ = GMPVerification.verifyDivision(
+                dividend: self,
+                divisor: divisor,
+                quotient: quotient,
+                remainder: remainder
+            )
+        }
         return (quotient, remainder)
     }
 
@@ -255,11 +270,13 @@ extension GMPInteger {
             throw GMPError.divisionByZero
         }
         let result = GMPInteger() // Mutated through pointer below
-        __gmpz_cdiv_q(
-            &result._storage.value,
-            &_storage.value,
-            &divisor._storage.value
-        )
+        GMPTracer._trace(.divide, "mpz_cdiv_q", size: limbCount) {
+            __gmpz_cdiv_q(
+                &result._storage.value,
+                &_storage.value,
+                &divisor._storage.value
+            )
+        }
         return result
     }
 
@@ -331,11 +348,13 @@ extension GMPInteger {
             throw GMPError.divisionByZero
         }
         let result = GMPInteger() // Mutated through pointer below
-        __gmpz_cdiv_r(
-            &result._storage.value,
-            &_storage.value,
-            &divisor._storage.value
-        )
+        GMPTracer._trace(.divide, "mpz_cdiv_r", size: limbCount) {
+            __gmpz_cdiv_r(
+                &result._storage.value,
+                &_storage.value,
+                &divisor._storage.value
+            )
+        }
         return result
     }
 
@@ -390,7 +409,8 @@ extension GMPInteger {
     /// - Guarantees: Returns a tuple with quotient and remainder. `self` is
     /// unchanged.
     ///
-    /// - Note: Wraps `mpz_cdiv_qr`.
+    /// - Note: Wraps `mpz_cdiv_qr`. Checked by `GMPVerification` when
+    ///   `.divide` is an automatic category.
     /// - Throws: `GMPError.divisionByZero` if `divisor` is zero.
     public func ceilingQuotientAndRemainder(
         dividingBy divisor: GMPInteger
@@ -402,12 +422,22 @@ extension GMPInteger {
         }
         let quotient = GMPInteger() // Mutated through pointer below
         let remainder = GMPInteger() // Mutated through pointer below
-        __gmpz_cdiv_qr(
-            &quotient._storage.value,
-            &remainder._storage.value,
-            &_storage.value,
-            &divisor._storage.value
-        )
+        GMPTracer._trace(.divide, "mpz_cdiv_qr", size: limbCount) {
+            __gmpz_cdiv_qr(
+                &quotient._storage.value,
+                &remainder._storage.value,
+                &_storage.value,
+                &divisor._storage.value
+            )
+        }
+        if GMPVerification._isAutomatic(.divide, size: limbCount) {
+            _ = GMPVerification.verifyDivision(
+                dividend: self,
+                divisor: divisor,
+                quotient: quotient,
+                remainder: remainder
+            )
+        }
         return (quotient, remainder)
     }
 
@@ -480,11 +510,13 @@ extension GMPInteger {
             throw GMPError.divisionByZero
         }
         let result = GMPInteger() // Mutated through pointer below
-        __gmpz_tdiv_q(
-            &result._storage.value,
-            &_storage.value,
-            &divisor._storage.value
-        )
+        GMPTracer._trace(.divide, "mpz_tdiv_q", size: limbCount) {
+            __gmpz_tdiv_q(
+                &result._storage.value,
+                &_storage.value,
+                &divisor._storage.value
+            )
+        }
         return result
     }
 
@@ -553,11 +585,13 @@ extension GMPInteger {
             throw GMPError.divisionByZero
         }
         let result = GMPInteger() // Mutated through pointer below
-        __gmpz_tdiv_r(
-            &result._storage.value,
-            &_storage.value,
-            &divisor._storage.value
-        )
+        GMPTracer._trace(.divide, "mpz_tdiv_r", size: limbCount) {
+            __gmpz_tdiv_r(
+                &result._storage.value,
+                &_storage.value,
+                &divisor._storage.value
+            )
+        }
         return result
     }
 
@@ -611,7 +645,8 @@ extension GMPInteger {
     /// - Guarantees: Returns a tuple with quotient and remainder. `self` is
     /// unchanged.
     ///
-    /// - Note: Wraps `mpz_tdiv_qr`.
+    /// - Note: Wraps `mpz_tdiv_qr`. Checked by `GMPVerification` when
+    ///   `.divide` is an automatic category.
     /// - Throws: `GMPError.divisionByZero` if `divisor` is zero.
     public func truncatedQuotientAndRemainder(
         dividingBy divisor: GMPInteger
@@ -623,12 +658,22 @@ extension GMPInteger {
         }
         let quotient = GMPInteger() // Mutated through pointer below
         let remainder = GMPInteger() // Mutated through pointer below
-        __gmpz_tdiv_qr(
-            &quotient._storage.value,
-            &remainder._storage.value,
-            &_storage.value,
-            &divisor._storage.value
-        )
+        GMPTracer._trace(.divide, "mpz_tdiv_qr", size: limbCount) {
+            __gmpz_tdiv_qr(
+                &quotient._storage.value,
+                &remainder._storage.value,
+                &_storage.value,
+                &divisor._storage.value
+            )
+        }
+        if GMPVerification._isAutomatic(.divide, size: limbCount) {
+            _ = GMPVerification.verifyDivision(
+                dividend: self,
+                divisor: divisor,
+                quotient: quotient,
+                remainder: remainder
+            )
+        }
         return (quotient, remainder)
     }
 
@@ -704,11 +749,13 @@ extension GMPInteger {
             throw GMPError.divisionByZero
         }
         let result = GMPInteger() // Mutated through pointer below
-        __gmpz_mod(
-            &result._storage.value,
-            &_storage.value,
-            &modulus._storage.value
-        )
+        GMPTracer._trace(.divide, "mpz_mod", size: limbCount) {
+            __gmpz_mod(
+                &result._storage.value,
+                &_storage.value,
+                &modulus._storage.value
+            )
+        }
         return result
     }
 
@@ -771,11 +818,13 @@ extension GMPInteger {
             throw GMPError.divisionByZero
         }
         let result = GMPInteger() // Mutated through pointer below
-        __gmpz_divexact(
-            &result._storage.value,
-            &_storage.value,
-            &divisor._storage.value
-        )
+        GMPTracer._trace(.divide, "mpz_divexact", size: limbCount) {
+            __gmpz_divexact(
+                &result._storage.value,
+                &_storage.value,
+                &divisor._storage.value
+            )
+        }
         return result
     }
 
@@ -0,0 +1,617 @@
+import CKalliope
+
+/// Hex and base64 encoding of `GMPInteger` magnitudes, read from and written
+/// to the limbs directly.
+///
+/// The encoded value is the magnitude's shortest byte string, `byteCount`
+/// bytes with the most significant byte first for `.big` and last for
+/// `.little`; zero is the empty string and the sign is not encoded, as with
+/// `export(order:size:endian:nails:)`. Hex writes each byte as two digits,
+/// high nibble first, so big-endian hex is `toString(base: 16)` padded to
+/// an even length. Base64 uses the standard alphabet with `=` padding.
+///
+/// On little-endian hosts the limbs are the magnitude's little-endian byte
+/// string in memory, so either byte order is a sequence of unaligned word
+/// loads and stores: big-endian order walks down from the top byte. The
+/// main loops expand eight bytes into sixteen hex digits by widening each
+/// byte to a 16-bit lane holding both nibbles, and twelve bytes into
+/// sixteen base64 digits by spreading each 3-byte group's four sextets
+/// over a 32-bit lane, then map digits to ASCII with lane-wise selects.
+/// Decoding reverses the lane transforms and validates every character.
+///
+/// ```swift
+/// let n = GMPInteger(0xDEAD_BEEF)
+/// n.hexEncoded()  // "deadbeef"
+/// n.base64Encoded()  // "3q2+7w=="
+/// GMPInteger(base64: "3q2+7w==")  // 0xDEADBEEF
+/// ```
+extension GMPInteger {
+    // MARK: - Sizes
+
+    /// The number of bytes in the magnitude, zero for zero.
+    public var byteCount: Int {
+        (bitCount + 7) / 8
+    }
+
+    /// The exact length of `encodeHex(into:endian:uppercase:)` output.
+    public var hexEncodedLength: Int {
+        2 * byteCount
+    }
+
+    /// The exact length of `encodeBase64(into:endian:)` output.
+    public var base64EncodedLength: Int {
+        4 * ((byteCount + 2) / 3)
+    }
+
+    // MARK: - Hex
+
+    /// Write the magnitude's bytes as hex digits.
+    ///
+    /// - Parameters:
+    ///   - buffer: The destination, at least `hexEncodedLength` bytes.
+    ///   - endian: The byte order. `.native` uses the host's.
+    ///   - uppercase: Whether to use `A`–`F` rather than `a`–`f`.
+    /// - Returns: The number of bytes written, `hexEncodedLength`.
+    @discardableResult
+    public func encodeHex(
+        into buffer: UnsafeMutableRawBufferPointer,
+        endian: Endianness = .big,
+        uppercase: Bool = false
+    ) -> Int {
+        let n = byteCount
+        precondition(buffer.count >= 2 * n, "buffer too small")
+        guard n > 0 else {
+            return 0
+        }
+        let big = Self._isBigEndian(endian)
+        let out = buffer.baseAddress!
+        let digits: StaticString = uppercase
+            ? "0123456789ABCDEF" : "0123456789abcdef"
+        let letterOffset: UInt8 = uppercase ? 7 : 39
+        GMPTracer._trace(.radixConversion, "hex_encode", size: limbCount) {
+            withExtendedLifetime(self) {
+                let limbs = limbsRead
+                let digit = digits.utf8Start
+                var j = 0
+                if Self._limbsAreByteString {
+                    let base = UnsafeRawPointer(limbs)
+                    while j + 8 <= n {
+                        out.storeBytes(
+                            of: Self._hexDigits(
+                                Self._window(base, n, j, big: big),
+                                letterOffset: letterOffset
+                            ),
+                            toByteOffset: 2 * j,
+                            as: SIMD16<UInt8>.self
+                        )
+                        j += 8
+                    }
+                }
+                while j < n {
+                    let byte = Self._byte(limbs, big ? n - 1 - j : j)
+                    out.storeBytes(
+                        of: digit[Int(byte >> 4)],
+                        toByteOffset: 2 * j,
+                        as: UInt8.self
+                    )
+                    out.storeBytes(
+                        of: digit[Int(byte & 0xF)],
+                        toByteOffset: 2 * j + 1,
+                        as: UInt8.self
+                    )
+                    j += 1
+                }
+            }
+        }
+        return 2 * n
+    }
+
+    /// The magnitude's bytes as hex digits.
+    ///
+    /// - Parameters:
+    ///   - endian: The byte order. `.native` uses the host's.
+    ///   - uppercase: Whether to use `A`–`F` rather than `a`–`f`.
+    /// - Returns: `hexEncodedLength` digits.
+    public func hexEncoded(
+        endian: Endianness = .big,
+        uppercase: Bool = false
+    ) -> String {
+        Self._string(length: hexEncodedLength) {
+            encodeHex(into: $0, endian: endian, uppercase: uppercase)
+        }
+    }
+
+    /// Create a non-negative integer from hex digits of its bytes.
+    ///
+    /// - Parameters:
+    ///   - bytes: An even number of ASCII hex digits in either case, two
+    ///     per byte, high nibble first. Empty for zero.
+    ///   - endian: The byte order. `.native` uses the host's.
+    /// - Returns: `nil` if the length is odd or a byte is not a hex digit.
+    public init?(hex bytes: UnsafeRawBufferPointer, endian: Endianness = .big) {
+        guard bytes.count % 2 == 0 else {
+            return nil
+        }
+        self.init()
+        let n = bytes.count / 2
+        guard n > 0 else {
+            return
+        }
+        let big = Self._isBigEndian(endian)
+        let input = bytes.baseAddress!
+        let count = (n + Self._limbBytes - 1) / Self._limbBytes
+        let limbs = limbsWrite(count: count)
+        limbs.initialize(repeating: 0, count: count)
+        let valid = GMPTracer._trace(
+            .radixConversion,
+            "hex_decode",
+            size: count
+        ) {
+            var j = 0
+            if Self._limbsAreByteString {
+                let base = UnsafeMutableRawPointer(limbs)
+                while j + 8 <= n {
+                    let chars = input.loadUnaligned(
+                        fromByteOffset: 2 * j,
+                        as: SIMD16<UInt8>.self
+                    )
+                    guard let word = Self._hexValue(chars) else {
+                        return false
+                    }
+                    Self._storeWindow(word, base, n, j, big: big)
+                    j += 8
+                }
+            }
+            while j < n {
+                guard
+                    let high = Self._hexValue(input.load(
+                        fromByteOffset: 2 * j,
+                        as: UInt8.self
+                    )),
+                    let low = Self._hexValue(input.load(
+                        fromByteOffset: 2 * j + 1,
+                        as: UInt8.self
+                    ))
+                else {
+                    return false
+                }
+                Self._setByte(limbs, big ? n - 1 - j : j, high << 4 | low)
+                j += 1
+            }
+            return true
+        }
+        guard valid else {
+            return nil
+        }
+        limbsFinish(size: count)
+    }
+
+    /// Create a non-negative integer from hex digits of its bytes.
+    ///
+    /// - Parameters:
+    ///   - string: An even number of hex digits in either case.
+    ///   - endian: The byte order. `.native` uses the host's.
+    /// - Returns: `nil` if the length is odd or a character is not a hex
+    ///   digit.
+    public init?(hex string: String, endian: Endianness = .big) {
+        var string = string
+        guard let value = string.withUTF8({
+            GMPInteger(hex: UnsafeRawBufferPointer($0), endian: endian)
+        }) else {
+            return nil
+        }
+        self = value
+    }
+
+    // MARK: - Base64
+
+    /// Write the magnitude's bytes in base64.
+    ///
+    /// - Parameters:
+    ///   - buffer: The destination, at least `base64EncodedLength` bytes.
+    ///   - endian: The byte order. `.native` uses the host's.
+    /// - Returns: The number of bytes written, `base64EncodedLength`.
+    @discardableResult
+    public func encodeBase64(
+        into buffer: UnsafeMutableRawBufferPointer,
+        endian: Endianness = .big
+    ) -> Int {
+        let n = byteCount
+        let length = 4 * ((n + 2) / 3)
+        precondition(buffer.count >= length, "buffer too small")
+        guard n > 0 else {
+            return 0
+        }
+        let big = Self._isBigEndian(endian)
+        let out = buffer.baseAddress!
+        GMPTracer._trace(.radixConversion, "base64_encode", size: limbCount) {
+            withExtendedLifetime(self) {
+                let limbs = limbsRead
+                var j = 0
+                if Self._limbsAreByteString {
+                    let base = UnsafeRawPointer(limbs)
+                    while j + 16 <= n {
+                        out.storeBytes(
+                            of: Self._base64Digits(
+                                Self._window(base, n, j, big: big),
+                                Self._window(base, n, j + 8, big: big)
+                            ),
+                            toByteOffset: j / 3 * 4,
+                            as: SIMD16<UInt8>.self
+                        )
+                        j += 12
+                    }
+                }
+                let alphabet = Self._base64Alphabet.utf8Start
+                while j < n {
+                    let remaining = Swift.min(3, n - j)
+                    var group = 0
+                    for k in 0 ..< 3 {
+                        let byte = k < remaining
+                            ? Self._byte(limbs, big ? n - 1 - j - k : j + k)
+                            : 0
+                        group = group << 8 | Int(byte)
+                    }
+                    for k in 0 ..< 4 {
+                        out.storeBytes(
+                            of: k <= remaining
+                                ? alphabet[group >> (18 - 6 * k) & 0x3F]
+                                : UInt8(ascii: "="),
+                            toByteOffset: j / 3 * 4 + k,
+                            as: UInt8.self
+                        )
+                    }
+                    j += 3
+                }
+            }
+        }
+        return length
+    }
+
+    /// The magnitude's bytes in base64.
+    ///
+    /// - Parameter endian: The byte order. `.native` uses the host's.
+    /// - Returns: `base64EncodedLength` characters.
+    public func base64Encoded(endian: Endianness = .big) -> String {
+        Self._string(length: base64EncodedLength) {
+            encodeBase64(into: $0, endian: endian)
+        }
+    }
+
+    /// Create a non-negative integer from the base64 encoding of its bytes.
+    ///
+    /// - Parameters:
+    ///   - bytes: Standard base64 with `=` padding to a multiple of four
+    ///     characters. Empty for zero.
+    ///   - endian: The byte order. `.native` uses the host's.
+    /// - Returns: `nil` for a character outside the alphabet, misplaced
+    ///   padding, or nonzero bits after the last byte.
+    public init?(
+        base64 bytes: UnsafeRawBufferPointer,
+        endian: Endianness = .big
+    ) {
+        guard bytes.count % 4 == 0 else {
+            return nil
+        }
+        self.init()
+        guard !bytes.isEmpty else {
+            return
+        }
+        let input = bytes.baseAddress!
+        let equals = UInt8(ascii: "=")
+        var padding = 0
+        while padding < 2,
+              input.load(
+                  fromByteOffset: bytes.count - 1 - padding,
+                  as: UInt8.self
+              ) == equals
+        {
+            padding += 1
+        }
+        let n = bytes.count / 4 * 3 - padding
+        let big = Self._isBigEndian(endian)
+        let count = (n + Self._limbBytes - 1) / Self._limbBytes
+        let limbs = limbsWrite(count: count)
+        limbs.initialize(repeating: 0, count: count)
+        let valid = GMPTracer._trace(
+            .radixConversion,
+            "base64_decode",
+            size: count
+        ) {
+            var j = 0
+            if Self._limbsAreByteString {
+                let base = UnsafeMutableRawPointer(limbs)
+                // The last quad may hold padding and is decoded below
+                while j + 12 <= n, j / 3 * 4 + 20 <= bytes.count {
+                    let chars = input.loadUnaligned(
+                        fromByteOffset: j / 3 * 4,
+                        as: SIMD16<UInt8>.self
+                    )
+                    guard let bytes = Self._base64Value(chars) else {
+                        return false
+                    }
+                    Self._storeWindow(bytes.0, base, n, j, big: big)
+                    Self._storeWindow(bytes.1, base, n, j + 8, big: big)
+                    j += 12
+                }
+            }
+            while j < n {
+                let remaining = Swift.min(3, n - j)
+                var group = 0
+                for k in 0 ..< 4 {
+                    let char = input.load(
+                        fromByteOffset: j / 3 * 4 + k,
+                        as: UInt8.self
+                    )
+                    if k <= remaining {
+                        guard let sextet = Self._base64Value(char) else {
+                            return false
+                        }
+                        group = group << 6 | Int(sextet)
+                    } else {
+                        guard char == equals else {
+                            return false
+                        }
+                        group <<= 6
+                    }
+                }
+                guard group & ((1 << (8 * (3 - remaining))) - 1) == 0 else {
+                    return false
+                }
+                for k in 0 ..< remaining {
+                    Self._setByte(
+                        limbs,
+                        big ? n - 1 - j - k : j + k,
+                        UInt8(truncatingIfNeeded: group >> (16 - 8 * k))
+                    )
+                }
+                j += 3
+            }
+            return true
+        }
+        guard valid else {
+            return nil
+        }
+        limbsFinish(size: count)
+    }
+
+    /// Create a non-negative integer from the base64 encoding of its bytes.
+    ///
+    /// - Parameters:
+    ///   - string: Standard base64 with `=` padding.
+    ///   - endian: The byte order. `.native` uses the host's.
+    /// - Returns: `nil` if the string is not canonical base64.
+    public init?(base64 string: String, endian: Endianness = .big) {
+        var string = string
+        guard let value = string.withUTF8({
+            GMPInteger(base64: UnsafeRawBufferPointer($0), endian: endian)
+        }) else {
+            return nil
+        }
+        self = value
+    }
+
+    // MARK: - Lane Transforms
+
+    private static let _base64Alphabet: StaticString =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+
+    /// Sixteen hex digits of a word, most significant nibble first.
+    @inline(__always)
+    private static func _hexDigits(
+        _ word: UInt64,
+        letterOffset: UInt8
+    ) -> SIMD16<UInt8> {
+        let bytes = unsafeBitCast(word.bigEndian, to: SIMD8<UInt8>.self)
+        let wide = SIMD8<UInt16>(truncatingIfNeeded: bytes)
+        // The low byte of each lane, first in memory, gets the high nibble
+        let pairs = (wide &>> 4) | ((wide & 0xF) &<< 8)
+        let nibbles = unsafeBitCast(pairs, to: SIMD16<UInt8>.self)
+        let letters = SIMD16<UInt8>(repeating: 0)
+            .replacing(with: letterOffset, where: nibbles .> 9)
+        return nibbles &+ 48 &+ letters
+    }
+
+    /// The word spelled by sixteen hex digits, or `nil` for a non-digit.
+    @inline(__always)
+    private static func _hexValue(_ chars: SIMD16<UInt8>) -> UInt64? {
+        let digits = chars &- 48
+        let letters = (chars | 0x20) &- 97
+        let isLetter = letters .< 6
+        guard all((digits .< 10) .| isLetter) else {
+            return nil
+        }
+        let nibbles = digits.replacing(with: letters &+ 10, where: isLetter)
+        let pairs = unsafeBitCast(nibbles, to: SIMD8<UInt16>.self)
+        let bytes = SIMD8<UInt8>(
+            truncatingIfNeeded: ((pairs & 0xFF) &<< 4) | (pairs &>> 8)
+        )
+        return UInt64(bigEndian: unsafeBitCast(bytes, to: UInt64.self))
+    }
+
+    /// The value of one hex digit.
+    @inline(__always)
+    private static func _hexValue(_ char: UInt8) -> UInt8? {
+        let digit = char &- 48
+        let letter = (char | 0x20) &- 97
+        if digit < 10 {
+            return digit
+        }
+        return letter < 6 ? letter + 10 : nil
+    }
+
+    /// Sixteen base64 digits of the twelve bytes `high` and the top half of
+    /// `low`, most significant first.
+    @inline(__always)
+    private static func _base64Digits(
+        _ high: UInt64,
+        _ low: UInt64
+    ) -> SIMD16<UInt8> {
+        let groups = SIMD4<UInt32>(
+            UInt32(truncatingIfNeeded: high >> 40),
+            UInt32(truncatingIfNeeded: high >> 16),
+            UInt32(truncatingIfNeeded: high << 8 | low >> 56),
+            UInt32(truncatingIfNeeded: low >> 32)
+        ) & 0xFF_FFFF
+        // Byte k of each lane, k-th in memory, gets the k-th sextet
+        let first = groups &>> 18
+        let second = (groups &>> 4) & 0x3F00
+        let third = (groups &<< 10) & 0x3F_0000
+        let fourth = (groups &<< 24) & 0x3F00_0000
+        let sextets = unsafeBitCast(
+            first | second | third | fourth,
+            to: SIMD16<UInt8>.self
+        )
+        // Offsets to "A", "a", "0", "+" and "/", modulo 256
+        var offsets = SIMD16<UInt8>(repeating: 65)
+        offsets.replace(with: 71, where: sextets .>= 26)
+        offsets.replace(with: 252, where: sextets .>= 52)
+        offsets.replace(with: 237, where: sextets .== 62)
+        offsets.replace(with: 240, where: sextets .== 63)
+        return sextets &+ offsets
+    }
+
+    /// The twelve bytes spelled by sixteen base64 digits, as a word and the
+    /// four bytes after it, or `nil` for a character outside the alphabet.
+    @inline(__always)
+    private static func _base64Value(
+        _ chars: SIMD16<UInt8>
+    ) -> (UInt64, UInt32)? {
+        let upper = chars &- 65
+        let lower = chars &- 97
+        let isUpper = upper .< 26
+        let isLower = lower .< 26
+        let isPlus = chars .== 43
+        let isSlash = chars .== 47
+        let isDigit = (chars &- 48) .< 10
+        guard all(isUpper .| isLower .| isDigit .| isPlus .| isSlash) else {
+            return nil
+        }
+        var sextets = chars &+ 4
+        sextets.replace(with: upper, where: isUpper)
+        sextets.replace(with: lower &+ 26, where: isLower)
+        sextets.replace(with: 62, where: isPlus)
+        sextets.replace(with: 63, where: isSlash)
+        let lanes = unsafeBitCast(sextets, to: SIMD4<UInt32>.self)
+        let first = (lanes & 0x3F) &<< 18
+        let second = (lanes & 0x3F00) &<< 4
+        let third = (lanes & 0x3F_0000) &>> 10
+        let groups = first | second | third | lanes &>> 24
+        let high = UInt64(groups[0]) << 40 | UInt64(groups[1]) << 16
+            | UInt64(groups[2]) >> 8
+        return (high, groups[2] << 24 | groups[3])
+    }
+
+    /// The value of one base64 character.
+    @inline(__always)
+    private static func _base64Value(_ char: UInt8) -> UInt8? {
+        switch char {
+        case UInt8(ascii: "A") ... UInt8(ascii: "Z"): char - 65
+        case UInt8(ascii: "a") ... UInt8(ascii: "z"): char - 71
+        case UInt8(ascii: "0") ... UInt8(ascii: "9"): char + 4
+        case UInt8(ascii: "+"): 62
+        case UInt8(ascii: "/"): 63
+        default: nil
+        }
+    }
+
+    // MARK: - Byte Access
+
+    private static let _limbBytes = MemoryLayout<UInt>.size
+
+    /// Whether limb memory is the magnitude's little-endian byte string,
+    /// which the vector loops load and store directly.
+    private static var _limbsAreByteString: Bool {
+        #if _endian(little)
+            true
+        #else
+            false
+        #endif
+    }
+
+    private static func _isBigEndian(_ endian: Endianness) -> Bool {
+        switch endian {
+        case .big: true
+        case .little: false
+        case .native: 1.bigEndian == 1
+        }
+    }
+
+    /// Byte `i` of the magnitude, counting from the least significant.
+    @inline(__always)
+    private static func _byte(_ limbs: UnsafePointer<UInt>, _ i: Int) -> UInt8 {
+        UInt8(
+            truncatingIfNeeded: limbs[i / _limbBytes] >> (i % _limbBytes * 8)
+        )
+    }
+
+    /// Set byte `i` of zeroed limbs, counting from the least significant.
+    @inline(__always)
+    private static func _setByte(
+        _ limbs: UnsafeMutablePointer<UInt>,
+        _ i: Int,
+        _ byte: UInt8
+    ) {
+        limbs[i / _limbBytes] |= UInt(byte) << (i % _limbBytes * 8)
+    }
+
+    /// Bytes `j ..< j + 8` of the `n`-byte string in the chosen order, the
+    /// first as the most significant byte.
+    @inline(__always)
+    private static func _window(
+        _ base: UnsafeRawPointer,
+        _ n: Int,
+        _ j: Int,
+        big: Bool
+    ) -> UInt64 {
+        // Big-endian order reads the string backwards from the top byte
+        big
+            ? UInt64(littleEndian: base.loadUnaligned(
+                fromByteOffset: n - 8 - j,
+                as: UInt64.self
+            ))
+            : UInt64(bigEndian: base.loadUnaligned(
+                fromByteOffset: j,
+                as: UInt64.self
+            ))
+    }
+
+    /// Store `value`, most significant byte first, as bytes `j ...` of the
+    /// `n`-byte string in the chosen order.
+    @inline(__always)
+    private static func _storeWindow<T: FixedWidthInteger>(
+        _ value: T,
+        _ base: UnsafeMutableRawPointer,
+        _ n: Int,
+        _ j: Int,
+        big: Bool
+    ) {
+        if big {
+            base.storeBytes(
+                of: value.littleEndian,
+                toByteOffset: n - T.bitWidth / 8 - j,
+                as: T.self
+            )
+        } else {
+            base.storeBytes(of: value.bigEndian, toByteOffset: j, as: T.self)
+        }
+    }
+
+    /// A string of `length` ASCII bytes written by `body`.
+    ///
+    /// iOS 13 is the only supported platform without
+    /// `String(unsafeUninitializedCapacity:)`, so only it takes the copy.
+    private static func _string(
+        length: Int,
+        _ body: (UnsafeMutableRawBufferPointer) -> Int
+    ) -> String {
+        if #available(iOS 14, *) {
+            return String(unsafeUninitializedCapacity: length) {
+                body(UnsafeMutableRawBufferPointer($0))
+            }
+        }
+        var bytes = [UInt8](repeating: 0, count: length)
+        _ = bytes.withUnsafeMutableBytes(body)
+        return String(decoding: bytes, as: UTF8.self)
+    }
+}
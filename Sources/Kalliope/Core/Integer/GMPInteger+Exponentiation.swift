@@ -99,19 +99,30 @@ extension GMPInteger {
     /// modular
     ///   inverse doesn't exist.
     ///
-    /// - Note: Wraps `mpz_powm`.
+    /// - Note: Wraps `mpz_powm`. Checked by `GMPVerification` when `.powm`
+    ///   is an automatic category.
     public func raisedToPower(
         _ exponent: GMPInteger,
         modulo modulus: GMPInteger
     ) -> GMPInteger {
         precondition(!modulus.isZero, "modulus must not be zero")
         let result = GMPInteger() // Mutated through pointer below
-        __gmpz_powm(
-            &result._storage.value,
-            &_storage.value,
-            &exponent._storage.value,
-            &modulus._storage.value
-        )
+        GMPTracer._trace(.powm, "mpz_powm", size: modulus.limbCount) {
+            __gmpz_powm(
+                &result._storage.value,
+                &_storage.value,
+                &exponent._storage.value,
+                &modulus._storage.value
+            )
+        }
+        if GMPVerification._isAutomatic(.powm, size: modulus.limbCount) {
+            _ = GMPVerification.verifyModularPower(
+                result,
+                base: self,
+                exponent: exponent,
+                modulus: modulus
+            )
+        }
         return result
     }
 
@@ -130,7 +141,8 @@ extension GMPInteger {
     /// - Guarantees: Returns a new `GMPInteger` with the result. `self` is
     /// unchanged.
     ///
-    /// - Note: Wraps `mpz_powm_ui`.
+    /// - Note: Wraps `mpz_powm_ui`. Checked by `GMPVerification` when
+    ///   `.powm` is an automatic category.
     public func raisedToPower(
         _ exponent: Int,
         modulo modulus: GMPInteger
@@ -138,20 +150,32 @@ extension GMPInteger {
         precondition(!modulus.isZero, "modulus must not be zero")
         let result = GMPInteger() // Mutated through pointer below
         if exponent >= 0 {
-            __gmpz_powm_ui(
-                &result._storage.value,
-                &_storage.value,
-                CUnsignedLong(exponent),
-                &modulus._storage.value
-            )
+            GMPTracer._trace(.powm, "mpz_powm_ui", size: modulus.limbCount) {
+                __gmpz_powm_ui(
+                    &result._storage.value,
+                    &_storage.value,
+                    CUnsignedLong(exponent),
+                    &modulus._storage.value
+                )
+            }
         } else {
             // For negative exponent, convert to GMPInteger and use mpz_powm
             let expGMP = GMPInteger(exponent)
-            __gmpz_powm(
-                &result._storage.value,
-                &_storage.value,
-                &expGMP._storage.value,
-                &modulus._storage.value
+            GMPTracer._trace(.powm, "mpz_powm", size: modulus.limbCount) {
+                __gmpz_powm(
+                    &result._storage.value,
+                    &_storage.value,
+                    &expGMP._storage.value,
+                    &modulus._storage.value
+                )
+            }
+        }
+        if GMPVerification._isAutomatic(.powm, size: modulus.limbCount) {
+            _ = GMPVerification.verifyModularPower(
+                result,
+                base: self,
+                exponent: GMPInteger(exponent),
+                modulus: modulus
             )
         }
         return result
@@ -186,6 +210,9 @@ extension GMPInteger {
     /// provides
     ///   protection against timing and cache-based side-channel attacks.
     ///
+    /// - Note: For repeated operations with the same modulus, use
+    ///   `GMPSecureModularContext`, which reuses its scratch space.
+    ///
     /// - Note: Wraps `mpz_powm_sec`.
     public func raisedToPowerSecure(
         _ exponent: GMPInteger,
@@ -193,14 +220,8 @@ extension GMPInteger {
     ) -> GMPInteger {
         precondition(!modulus.isZero, "modulus must not be zero")
         precondition(exponent.isPositive, "exponent must be positive")
-        // Check that modulus is odd (we know modulus is not zero from above)
-        let two = GMPInteger(2)
-        // Safe to force try since two is 2 (non-zero), and we've checked
-        // modulus is not zero
-        precondition(
-            (try! modulus.absoluteValue().modulo(two)).toInt() == 1,
-            "modulus must be odd"
-        )
+        // Test the low bit directly; no temporaries are needed
+        precondition(modulus.isOdd, "modulus must be odd")
         let result = GMPInteger() // Mutated through pointer below
         __gmpz_powm_sec(
             &result._storage.value,
@@ -234,8 +234,14 @@ public struct GMPInteger {
             "base must be 0 or in the range 2-62"
         )
         _storage = _GMPIntegerStorage()
-        let result = string.withCString { cString in
-            __gmpz_set_str(&_storage.value, cString, Int32(base))
+        let result = GMPTracer._trace(
+            .radixConversion,
+            "mpz_set_str",
+            size: limbCount
+        ) {
+            string.withCString { cString in
+                __gmpz_set_str(&_storage.value, cString, Int32(base))
+            }
         }
         if result != 0 {
             return nil
@@ -612,7 +618,9 @@ public struct GMPInteger {
         let buffer = UnsafeMutablePointer<CChar>
             .allocate(capacity: size + 2) // +2 for sign and null terminator
         defer { buffer.deallocate() }
-        __gmpz_get_str(buffer, Int32(base), &_storage.value)
+        GMPTracer._trace(.radixConversion, "mpz_get_str", size: limbCount) {
+            _ = __gmpz_get_str(buffer, Int32(base), &_storage.value)
+        }
         return String(cString: buffer)
     }
 
@@ -0,0 +1,141 @@
+import CKalliope
+
+/// A modular arithmetic context for a fixed modulus.
+///
+/// `GMPModularContext` is the fast counterpart of `GMPSecureModularContext`
+/// for code that repeats many operations modulo one number, such as group
+/// walks. Residues stay in `0 ..< modulus` as ordinary `GMPInteger`s. The
+/// `into:` variants keep the double-width product and the reduced result in
+/// scratch integers owned by the context, then swap the result into place.
+/// Writing into an operand, as below, therefore never copies it, and a loop
+/// that reuses its integers stops allocating once they reach full size.
+///
+/// ```swift
+/// let context = GMPModularContext(modulus: p)
+/// var x = GMPInteger(1)
+/// for _ in 0 ..< steps {
+///     context.multiply(x, g, into: &x)
+/// }
+/// ```
+///
+/// - Important: A context is not thread-safe, because it owns its scratch
+///   integers. Use one context per thread.
+public final class GMPModularContext {
+    /// The modulus. Always positive.
+    public let modulus: GMPInteger
+
+    /// The double-width product of the last multiplication.
+    private var _product = GMPInteger()
+
+    /// The next reduced result, swapped with the caller's integer.
+    private var _result = GMPInteger()
+
+    /// Create a context for the given modulus.
+    ///
+    /// - Parameter modulus: The modulus. Must be positive.
+    public init(modulus: GMPInteger) {
+        precondition(modulus.isPositive, "modulus must be positive")
+        self.modulus = modulus
+        __gmpz_realloc2(
+            &_product._storage.value,
+            mp_bitcnt_t(2 * modulus.bitCount)
+        )
+        __gmpz_realloc2(
+            &_result._storage.value,
+            mp_bitcnt_t(modulus.bitCount)
+        )
+    }
+
+    // MARK: - Arithmetic
+
+    /// Reduce a value into `0 ..< modulus`.
+    ///
+    /// - Note: Wraps `mpz_mod`.
+    public func reduce(_ value: GMPInteger) -> GMPInteger {
+        var result = GMPInteger()
+        __gmpz_mod(
+            &result._storage.value,
+            &value._storage.value,
+            &modulus._storage.value
+        )
+        return result
+    }
+
+    /// Multiply two residues modulo the modulus.
+    ///
+    /// - Parameters:
+    ///   - a: The first factor, in `0 ..< modulus`.
+    ///   - b: The second factor, in `0 ..< modulus`.
+    ///   - result: Receives `(a * b) mod modulus`. May be `a` or `b`.
+    ///
+    /// The old storage of `result` becomes the context's next scratch
+    /// result. When `result` aliases an operand that storage is still
+    /// shared during this call, but is free again by the next one.
+    ///
+    /// - Note: Wraps `mpz_mul` and `mpz_tdiv_r`.
+    public func multiply(
+        _ a: GMPInteger,
+        _ b: GMPInteger,
+        into result: inout GMPInteger
+    ) {
+        __gmpz_mul(
+            &_product._storage.value,
+            &a._storage.value,
+            &b._storage.value
+        )
+        _result._ensureUnique()
+        __gmpz_tdiv_r(
+            &_result._storage.value,
+            &_product._storage.value,
+            &modulus._storage.value
+        )
+        swap(&result, &_result)
+    }
+
+    /// Multiply two residues modulo the modulus.
+    ///
+    /// - Parameters:
+    ///   - a: The first factor, in `0 ..< modulus`.
+    ///   - b: The second factor, in `0 ..< modulus`.
+    /// - Returns: `(a * b) mod modulus`.
+    public func multiplied(_ a: GMPInteger, _ b: GMPInteger) -> GMPInteger {
+        var result = GMPInteger()
+        multiply(a, b, into: &result)
+        return result
+    }
+
+    /// Raise a residue to a non-negative power modulo the modulus.
+    ///
+    /// - Parameters:
+    ///   - base: The base, in `0 ..< modulus`.
+    ///   - exponent: The exponent. Must be non-negative.
+    /// - Returns: `base^exponent mod modulus`.
+    ///
+    /// - Note: Wraps `mpz_powm`.
+    public func raisedToPower(
+        _ base: GMPInteger,
+        _ exponent: GMPInteger
+    ) -> GMPInteger {
+        precondition(!exponent.isNegative, "exponent must be non-negative")
+        return base.raisedToPower(exponent, modulo: modulus)
+    }
+
+    /// The inverse of a residue modulo the modulus.
+    ///
+    /// - Parameter value: The residue.
+    /// - Returns: The inverse, or `nil` if `value` is not a unit.
+    ///
+    /// - Note: Wraps `mpz_invert`.
+    public func inverse(of value: GMPInteger) -> GMPInteger? {
+        value.modularInverse(modulo: modulus)
+    }
+
+    /// The low 64 bits of a residue, used as a hash-table fingerprint.
+    ///
+    /// Residues of a group walk are spread across `0 ..< modulus`, so their
+    /// low limbs are as good a key as their full values without hashing
+    /// every limb.
+    func _fingerprint(_ value: GMPInteger) -> UInt64 {
+        value.isZero ? 0 : UInt64(truncatingIfNeeded: value.limbsRead[0])
+    }
+}
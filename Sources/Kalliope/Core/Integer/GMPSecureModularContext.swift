@@ -0,0 +1,359 @@
+import CKalliope
+
+/// A side-channel-resistant modular arithmetic context for a fixed modulus.
+///
+/// `GMPSecureModularContext` wraps GMP's `mpn_sec_*` functions. Every
+/// operation works on operands padded to the modulus size and exponents
+/// padded to `exponentBitCount` bits, so the sequence of instructions and
+/// memory accesses depends only on those sizes, never on the operand values.
+///
+/// All operand, product and exponent buffers, plus the GMP scratch area, are
+/// allocated once when the context is created, sized from the `*_itch`
+/// functions, and reused for every call. Combined with the `into:` variants,
+/// which write into an existing `GMPInteger`, repeated operations perform no
+/// allocation at all.
+///
+/// ```swift
+/// let context = GMPSecureModularContext(modulus: n, exponentBitCount: 2048)
+/// var signature = GMPInteger()
+/// context.raisedToPower(message, d, into: &signature)
+/// ```
+///
+/// - Important: A context is not thread-safe, because it owns a single
+///   scratch area. Use one context per thread.
+///
+/// - Note: Converting operands from and results to `GMPInteger` reveals
+///   their limb counts, as every `mpz` function does. Operand values are
+///   otherwise never branched on.
+public final class GMPSecureModularContext {
+    /// The modulus. Always odd and positive.
+    public let modulus: GMPInteger
+
+    /// The number of limbs every operand is padded to.
+    public let limbCount: Int
+
+    /// The number of exponent bits processed by every exponentiation.
+    public let exponentBitCount: Int
+
+    /// The single allocation backing every buffer below.
+    private let _block: UnsafeMutablePointer<UInt>
+    private let _blockCount: Int
+
+    /// The modulus limbs (`limbCount`).
+    private let _modulus: UnsafeMutablePointer<UInt>
+    /// First operand (`limbCount`).
+    private let _a: UnsafeMutablePointer<UInt>
+    /// Second operand (`limbCount`).
+    private let _b: UnsafeMutablePointer<UInt>
+    /// Result (`limbCount`).
+    private let _result: UnsafeMutablePointer<UInt>
+    /// Double-width product or reduction input (`2 * limbCount`).
+    private let _product: UnsafeMutablePointer<UInt>
+    /// Exponent, padded to `exponentBitCount` bits.
+    private let _exponent: UnsafeMutablePointer<UInt>
+    private let _exponentLimbCount: Int
+    /// GMP scratch space, sized from the largest `*_itch` requirement.
+    private let _scratch: UnsafeMutablePointer<UInt>
+
+    /// Create a context for the given modulus.
+    ///
+    /// - Parameters:
+    ///   - modulus: The modulus. Must be odd and positive.
+    ///   - exponentBitCount: The number of exponent bits processed by every
+    ///     exponentiation. Exponents must be smaller than
+    ///     `2^exponentBitCount`. Defaults to the bit size of the modulus,
+    ///     which covers reduced private exponents. Must be positive.
+    ///
+    /// - Requires: `modulus` must be odd and positive. `exponentBitCount`
+    ///   must be positive.
+    /// - Guarantees: All buffers and the scratch area are allocated. No
+    ///   further allocation happens inside the context.
+    ///
+    /// - Note: Sizes the scratch area from `mpn_sec_powm_itch`,
+    ///   `mpn_sec_mul_itch`, `mpn_sec_div_r_itch` and `mpn_sec_invert_itch`.
+    public init(modulus: GMPInteger, exponentBitCount: Int? = nil) {
+        precondition(modulus.isPositive, "modulus must be positive")
+        precondition(modulus.isOdd, "modulus must be odd")
+        let n = modulus.limbCount
+        let bits = exponentBitCount ?? n * UInt.bitWidth
+        precondition(bits > 0, "exponentBitCount must be positive")
+
+        self.modulus = modulus
+        limbCount = n
+        self.exponentBitCount = bits
+        _exponentLimbCount = (bits + UInt.bitWidth - 1) / UInt.bitWidth
+
+        let itch = Swift.max(
+            __gmpn_sec_powm_itch(mp_size_t(n), mp_bitcnt_t(bits), mp_size_t(n)),
+            __gmpn_sec_mul_itch(mp_size_t(n), mp_size_t(n)),
+            __gmpn_sec_div_r_itch(mp_size_t(2 * n), mp_size_t(n)),
+            __gmpn_sec_invert_itch(mp_size_t(n))
+        )
+
+        _blockCount = 6 * n + _exponentLimbCount + Int(itch)
+        _block = UnsafeMutablePointer<UInt>.allocate(capacity: _blockCount)
+        _block.initialize(repeating: 0, count: _blockCount)
+        _modulus = _block
+        _a = _modulus + n
+        _b = _a + n
+        _result = _b + n
+        _product = _result + n
+        _exponent = _product + 2 * n
+        _scratch = _exponent + _exponentLimbCount
+
+        let source = modulus.limbsRead
+        for i in 0 ..< n {
+            _modulus[i] = source[i]
+        }
+    }
+
+    deinit {
+        // Clear intermediate values before releasing the memory
+        _block.update(repeating: 0, count: _blockCount)
+        _block.deallocate()
+    }
+
+    // MARK: - Operand Loading
+
+    /// Reduce `value` modulo the modulus into `destination` (`limbCount`
+    /// limbs).
+    private func _load(
+        _ value: GMPInteger,
+        into destination: UnsafeMutablePointer<UInt>
+    ) {
+        precondition(!value.isNegative, "operand must be non-negative")
+        let n = limbCount
+        let count = value.limbCount
+        precondition(
+            count <= 2 * n,
+            "operand must have at most twice as many limbs as the modulus"
+        )
+        let source = value.limbsRead
+        for i in 0 ..< 2 * n {
+            _product[i] = i < count ? source[i] : 0
+        }
+        __gmpn_sec_div_r(
+            _product,
+            mp_size_t(2 * n),
+            _modulus,
+            mp_size_t(n),
+            _scratch
+        )
+        for i in 0 ..< n {
+            destination[i] = _product[i]
+        }
+    }
+
+    /// Copy `_result` into `result`, reusing its limb allocation.
+    private func _store(into result: inout GMPInteger) {
+        let n = limbCount
+        let destination = result.limbsWrite(count: n)
+        for i in 0 ..< n {
+            destination[i] = _result[i]
+        }
+        result.limbsFinish(size: n)
+    }
+
+    // MARK: - Arithmetic
+
+    /// Reduce a value modulo the modulus.
+    ///
+    /// - Parameters:
+    ///   - value: The value to reduce. Must be non-negative with at most
+    ///     `2 * limbCount` limbs.
+    ///   - result: Receives `value mod modulus`.
+    ///
+    /// - Note: Wraps `mpn_sec_div_r`.
+    public func reduce(_ value: GMPInteger, into result: inout GMPInteger) {
+        _load(value, into: _result)
+        _store(into: &result)
+    }
+
+    /// Add two values modulo the modulus.
+    ///
+    /// - Parameters:
+    ///   - a: The first operand. Must be non-negative with at most
+    ///     `2 * limbCount` limbs.
+    ///   - b: The second operand, with the same constraints as `a`.
+    ///   - result: Receives `(a + b) mod modulus`.
+    ///
+    /// - Note: Wraps `mpn_add_n`, `mpn_sub_n` and `mpn_cnd_add_n`.
+    public func add(
+        _ a: GMPInteger,
+        _ b: GMPInteger,
+        into result: inout GMPInteger
+    ) {
+        let n = mp_size_t(limbCount)
+        _load(a, into: _a)
+        _load(b, into: _b)
+        let carry = __gmpn_add_n(_a, _a, _b, n)
+        let borrow = __gmpn_sub_n(_result, _a, _modulus, n)
+        // Add the modulus back only if the sum was already below it
+        __gmpn_cnd_add_n(borrow & (carry ^ 1), _result, _result, _modulus, n)
+        _store(into: &result)
+    }
+
+    /// Subtract two values modulo the modulus.
+    ///
+    /// - Parameters:
+    ///   - a: The minuend. Must be non-negative with at most `2 * limbCount`
+    ///     limbs.
+    ///   - b: The subtrahend, with the same constraints as `a`.
+    ///   - result: Receives `(a - b) mod modulus`, in `0 ..< modulus`.
+    ///
+    /// - Note: Wraps `mpn_sub_n` and `mpn_cnd_add_n`.
+    public func subtract(
+        _ a: GMPInteger,
+        _ b: GMPInteger,
+        into result: inout GMPInteger
+    ) {
+        let n = mp_size_t(limbCount)
+        _load(a, into: _a)
+        _load(b, into: _b)
+        let borrow = __gmpn_sub_n(_result, _a, _b, n)
+        __gmpn_cnd_add_n(borrow, _result, _result, _modulus, n)
+        _store(into: &result)
+    }
+
+    /// Multiply two values modulo the modulus.
+    ///
+    /// - Parameters:
+    ///   - a: The first factor. Must be non-negative with at most
+    ///     `2 * limbCount` limbs.
+    ///   - b: The second factor, with the same constraints as `a`.
+    ///   - result: Receives `(a * b) mod modulus`.
+    ///
+    /// - Note: Wraps `mpn_sec_mul` and `mpn_sec_div_r`.
+    public func multiply(
+        _ a: GMPInteger,
+        _ b: GMPInteger,
+        into result: inout GMPInteger
+    ) {
+        let n = mp_size_t(limbCount)
+        _load(a, into: _a)
+        _load(b, into: _b)
+        __gmpn_sec_mul(_product, _a, n, _b, n, _scratch)
+        __gmpn_sec_div_r(_product, 2 * n, _modulus, n, _scratch)
+        for i in 0 ..< limbCount {
+            _result[i] = _product[i]
+        }
+        _store(into: &result)
+    }
+
+    /// Raise a value to a power modulo the modulus in constant time.
+    ///
+    /// - Parameters:
+    ///   - base: The base. Must be non-negative with at most `2 * limbCount`
+    ///     limbs.
+    ///   - exponent: The exponent. Must be positive and less than
+    ///     `2^exponentBitCount`.
+    ///   - result: Receives `base^exponent mod modulus`.
+    ///
+    /// - Requires: `exponent` must be positive and fit in
+    ///   `exponentBitCount` bits.
+    /// - Guarantees: All `exponentBitCount` bits are processed regardless of
+    ///   the exponent value. `result` reuses its existing limb allocation
+    ///   when large enough.
+    ///
+    /// - Note: Wraps `mpn_sec_powm`.
+    public func raisedToPower(
+        _ base: GMPInteger,
+        _ exponent: GMPInteger,
+        into result: inout GMPInteger
+    ) {
+        precondition(exponent.isPositive, "exponent must be positive")
+        precondition(
+            exponent.bitCount <= exponentBitCount,
+            "exponent must fit in exponentBitCount bits"
+        )
+        let n = mp_size_t(limbCount)
+        _load(base, into: _a)
+        let count = exponent.limbCount
+        let source = exponent.limbsRead
+        for i in 0 ..< _exponentLimbCount {
+            _exponent[i] = i < count ? source[i] : 0
+        }
+        __gmpn_sec_powm(
+            _result,
+            _a,
+            n,
+            _exponent,
+            mp_bitcnt_t(exponentBitCount),
+            _modulus,
+            n,
+            _scratch
+        )
+        _store(into: &result)
+    }
+
+    /// Compute the modular inverse of a value in constant time.
+    ///
+    /// - Parameters:
+    ///   - value: The value to invert. Must be non-negative with at most
+    ///     `2 * limbCount` limbs.
+    ///   - result: Receives the inverse when it exists.
+    ///
+    /// - Throws: `GMPError.divisionByZero` if `value` is not invertible
+    ///   modulo the modulus. `result` is left unchanged in that case.
+    ///
+    /// - Note: Wraps `mpn_sec_invert`.
+    public func invert(
+        _ value: GMPInteger,
+        into result: inout GMPInteger
+    ) throws {
+        let n = mp_size_t(limbCount)
+        _load(value, into: _a)
+        let succeeded = __gmpn_sec_invert(
+            _result,
+            _a,
+            _modulus,
+            n,
+            mp_bitcnt_t(2 * limbCount * UInt.bitWidth),
+            _scratch
+        )
+        guard succeeded != 0 else {
+            throw GMPError.divisionByZero
+        }
+        _store(into: &result)
+    }
+
+    // MARK: - Convenience
+
+    /// Raise a value to a power modulo the modulus in constant time.
+    ///
+    /// - Returns: A new `GMPInteger` equal to `base^exponent mod modulus`.
+    ///
+    /// - Note: See `raisedToPower(_:_:into:)`.
+    public func raisedToPower(
+        _ base: GMPInteger,
+        _ exponent: GMPInteger
+    ) -> GMPInteger {
+        var result = GMPInteger(preallocatedBits: limbCount * UInt.bitWidth)
+        raisedToPower(base, exponent, into: &result)
+        return result
+    }
+
+    /// Multiply two values modulo the modulus.
+    ///
+    /// - Returns: A new `GMPInteger` equal to `(a * b) mod modulus`.
+    ///
+    /// - Note: See `multiply(_:_:into:)`.
+    public func multiplied(_ a: GMPInteger, _ b: GMPInteger) -> GMPInteger {
+        var result = GMPInteger(preallocatedBits: limbCount * UInt.bitWidth)
+        multiply(a, b, into: &result)
+        return result
+    }
+
+    /// Compute the modular inverse of a value in constant time.
+    ///
+    /// - Returns: A new `GMPInteger` with the inverse.
+    ///
+    /// - Throws: `GMPError.divisionByZero` if no inverse exists.
+    ///
+    /// - Note: See `invert(_:into:)`.
+    public func inverse(of value: GMPInteger) throws -> GMPInteger {
+        var result = GMPInteger(preallocatedBits: limbCount * UInt.bitWidth)
+        try invert(value, into: &result)
+        return result
+    }
+}
@@ -0,0 +1,413 @@
+import Dispatch
+import Foundation
+
+/// A dense matrix of arbitrary-precision integers.
+///
+/// `GMPIntegerMatrix` stores its entries row-major in a single array and has
+/// value semantics: copying a matrix is cheap, and entries are copied lazily
+/// through the copy-on-write storage of `GMPInteger`.
+///
+/// Row operations (`addMultiple`, `subtractMultiple`,
+/// `subtractLinearCombination`) update entries in place with
+/// `addProduct`/`subtractProduct`, so reducing a lattice basis does not
+/// allocate a temporary per entry. Wide row operations and batches of row dot
+/// products are split across cores once the work is large enough to amortize
+/// the dispatch overhead.
+public struct GMPIntegerMatrix {
+    /// The number of rows.
+    public let rowCount: Int
+
+    /// The number of columns.
+    public let columnCount: Int
+
+    /// The entries, row-major.
+    @usableFromInline
+    var _entries: [GMPInteger]
+
+    /// The minimum estimated work (columns times limbs per entry) before row
+    /// operations are split across cores.
+    ///
+    /// Tuned by `GMPTuningParameter.integerMatrixParallelThreshold`.
+    public static var parallelThreshold: Int {
+        GMPTuningParameter.integerMatrixParallelThreshold.value
+    }
+
+    // MARK: - Initialization
+
+    /// Create a zero matrix.
+    ///
+    /// - Parameters:
+    ///   - rows: The number of rows. Must be non-negative.
+    ///   - columns: The number of columns. Must be non-negative.
+    ///
+    /// - Requires: `rows` and `columns` must be non-negative.
+    /// - Guarantees: Returns a `rows x columns` matrix of zeros.
+    public init(rows: Int, columns: Int) {
+        precondition(rows >= 0, "rows must be non-negative")
+        precondition(columns >= 0, "columns must be non-negative")
+        rowCount = rows
+        columnCount = columns
+        _entries = (0 ..< rows * columns).map { _ in GMPInteger() }
+    }
+
+    /// Create a matrix from an array of rows.
+    ///
+    /// - Parameter rows: The rows. Every row must have the same length.
+    ///
+    /// - Requires: All rows must have the same number of entries.
+    /// - Guarantees: Returns a matrix with the given rows. The entries share
+    ///   storage with `rows` until either is modified.
+    public init(_ rows: [[GMPInteger]]) {
+        let columns = rows.first?.count ?? 0
+        precondition(
+            rows.allSatisfy { $0.count == columns },
+            "all rows must have the same number of entries"
+        )
+        rowCount = rows.count
+        columnCount = columns
+        _entries = rows.flatMap { $0 }
+    }
+
+    /// Create a matrix from an array of rows of machine integers.
+    ///
+    /// - Parameter rows: The rows. Every row must have the same length.
+    public init(_ rows: [[Int]]) {
+        self.init(rows.map { $0.map { GMPInteger($0) } })
+    }
+
+    /// Create an identity matrix.
+    ///
+    /// - Parameter size: The number of rows and columns. Must be
+    ///   non-negative.
+    /// - Returns: The `size x size` identity matrix.
+    public static func identity(_ size: Int) -> GMPIntegerMatrix {
+        var result = GMPIntegerMatrix(rows: size, columns: size)
+        for i in 0 ..< size {
+            result[i, i] = GMPInteger(1)
+        }
+        return result
+    }
+
+    // MARK: - Element Access
+
+    /// Access the entry at the given row and column.
+    ///
+    /// - Parameters:
+    ///   - row: The row index. Must be in `0 ..< rowCount`.
+    ///   - column: The column index. Must be in `0 ..< columnCount`.
+    public subscript(row: Int, column: Int) -> GMPInteger {
+        get {
+            _checkIndex(row: row, column: column)
+            return _entries[row * columnCount + column]
+        }
+        set {
+            _checkIndex(row: row, column: column)
+            _entries[row * columnCount + column] = newValue
+        }
+    }
+
+    /// Get a row as an array.
+    ///
+    /// - Parameter index: The row index. Must be in `0 ..< rowCount`.
+    /// - Returns: The entries of the row.
+    public func row(_ index: Int) -> [GMPInteger] {
+        precondition(index >= 0 && index < rowCount, "row index out of range")
+        let start = index * columnCount
+        return Array(_entries[start ..< start + columnCount])
+    }
+
+    /// The rows as an array of arrays.
+    public var rows: [[GMPInteger]] {
+        (0 ..< rowCount).map { row($0) }
+    }
+
+    /// The transposed matrix.
+    public var transposed: GMPIntegerMatrix {
+        var result = GMPIntegerMatrix(rows: columnCount, columns: rowCount)
+        for i in 0 ..< rowCount {
+            for j in 0 ..< columnCount {
+                result._entries[j * rowCount + i] =
+                    _entries[i * columnCount + j]
+            }
+        }
+        return result
+    }
+
+    /// The largest bit count of any entry.
+    public var maximumBitCount: Int {
+        _entries.reduce(0) { Swift.max($0, $1.bitCount) }
+    }
+
+    private func _checkIndex(row: Int, column: Int) {
+        precondition(row >= 0 && row < rowCount, "row index out of range")
+        precondition(
+            column >= 0 && column < columnCount,
+            "column index out of range"
+        )
+    }
+
+    // MARK: - Row Operations
+
+    /// Swap two rows.
+    ///
+    /// - Parameters:
+    ///   - i: The first row index.
+    ///   - j: The second row index.
+    ///
+    /// - Guarantees: Only the `GMPInteger` references are exchanged; no limbs
+    ///   are copied.
+    public mutating func swapRows(_ i: Int, _ j: Int) {
+        precondition(i >= 0 && i < rowCount, "row index out of range")
+        precondition(j >= 0 && j < rowCount, "row index out of range")
+        guard i != j else {
+            return
+        }
+        for c in 0 ..< columnCount {
+            _entries.swapAt(i * columnCount + c, j * columnCount + c)
+        }
+    }
+
+    /// Add a multiple of one row to another in place.
+    ///
+    /// - Parameters:
+    ///   - source: The row to scale. Must differ from `target`.
+    ///   - factor: The scale factor.
+    ///   - target: The row to update.
+    ///
+    /// - Guarantees: `row(target) += factor * row(source)`.
+    ///
+    /// - Note: Uses `addProduct` (`mpz_addmul`) on each entry.
+    public mutating func addMultiple(
+        ofRow source: Int,
+        by factor: GMPInteger,
+        toRow target: Int
+    ) {
+        subtractLinearCombination(
+            ofRows: [source],
+            coefficients: [factor.negated()],
+            fromRow: target
+        )
+    }
+
+    /// Subtract a multiple of one row from another in place.
+    ///
+    /// - Parameters:
+    ///   - source: The row to scale. Must differ from `target`.
+    ///   - factor: The scale factor.
+    ///   - target: The row to update.
+    ///
+    /// - Guarantees: `row(target) -= factor * row(source)`.
+    ///
+    /// - Note: Uses `subtractProduct` (`mpz_submul`) on each entry.
+    public mutating func subtractMultiple(
+        ofRow source: Int,
+        by factor: GMPInteger,
+        fromRow target: Int
+    ) {
+        subtractLinearCombination(
+            ofRows: [source],
+            coefficients: [factor],
+            fromRow: target
+        )
+    }
+
+    /// Subtract a linear combination of rows from another row in place.
+    ///
+    /// All coefficients are applied in one pass over the columns, so each
+    /// target entry is visited once. When the row is wide enough, columns are
+    /// split into chunks that are updated concurrently.
+    ///
+    /// - Parameters:
+    ///   - sources: The rows to combine. None may equal `target`.
+    ///   - coefficients: One coefficient per source row.
+    ///   - target: The row to update.
+    ///
+    /// - Requires: `sources` and `coefficients` must have the same length.
+    /// - Guarantees: `row(target) -= sum(coefficients[k] * row(sources[k]))`.
+    ///
+    /// - Note: Uses `subtractProduct` (`mpz_submul`) on each entry.
+    public mutating func subtractLinearCombination(
+        ofRows sources: [Int],
+        coefficients: [GMPInteger],
+        fromRow target: Int
+    ) {
+        precondition(
+            sources.count == coefficients.count,
+            "sources and coefficients must have the same length"
+        )
+        precondition(
+            target >= 0 && target < rowCount,
+            "row index out of range"
+        )
+        for source in sources {
+            precondition(
+                source >= 0 && source < rowCount && source != target,
+                "source rows must be valid and differ from the target row"
+            )
+        }
+        guard !sources.isEmpty, columnCount > 0 else {
+            return
+        }
+        let columns = columnCount
+        let work = columns * sources.count
+            * Swift.max(1, _entries[target * columns].limbCount)
+        let chunkCount = work >= Self.parallelThreshold
+            ? Swift.min(columns, ProcessInfo.processInfo.activeProcessorCount)
+            : 1
+        _entries.withUnsafeMutableBufferPointer { buffer in
+            let entries = buffer
+            let update = { (chunk: Int) in
+                let lower = chunk * columns / chunkCount
+                let upper = (chunk + 1) * columns / chunkCount
+                for (k, source) in sources.enumerated() {
+                    let coefficient = coefficients[k]
+                    if coefficient.isZero {
+                        continue
+                    }
+                    for c in lower ..< upper {
+                        let entry = entries[source * columns + c]
+                        entries[target * columns + c]
+                            .subtractProduct(entry, coefficient)
+                    }
+                }
+            }
+            if chunkCount == 1 {
+                update(0)
+            } else {
+                // Chunks touch disjoint columns, so entries never race
+                DispatchQueue.concurrentPerform(
+                    iterations: chunkCount,
+                    execute: update
+                )
+            }
+        }
+    }
+
+    // MARK: - Products
+
+    /// Compute the dot product of two rows.
+    ///
+    /// - Parameters:
+    ///   - i: The first row index.
+    ///   - j: The second row index.
+    /// - Returns: The exact inner product of the two rows.
+    ///
+    /// - Note: Accumulates with `addProduct` (`mpz_addmul`).
+    public func dotProduct(ofRow i: Int, withRow j: Int) -> GMPInteger {
+        precondition(i >= 0 && i < rowCount, "row index out of range")
+        precondition(j >= 0 && j < rowCount, "row index out of range")
+        var sum = GMPInteger()
+        let a = i * columnCount
+        let b = j * columnCount
+        for c in 0 ..< columnCount {
+            sum.addProduct(_entries[a + c], _entries[b + c])
+        }
+        return sum
+    }
+
+    /// Compute the dot products of one row with several others.
+    ///
+    /// - Parameters:
+    ///   - i: The row index.
+    ///   - others: The rows to pair with `i`.
+    /// - Returns: `dotProduct(ofRow: i, withRow: others[k])` for each `k`.
+    ///
+    /// - Note: The products are computed concurrently when the total work
+    ///   exceeds `parallelThreshold`.
+    public func dotProducts(
+        ofRow i: Int,
+        withRows others: [Int]
+    ) -> [GMPInteger] {
+        let work = others.count * columnCount
+            * Swift.max(1, _entries.first?.limbCount ?? 1)
+        guard work >= Self.parallelThreshold, others.count > 1 else {
+            return others.map { dotProduct(ofRow: i, withRow: $0) }
+        }
+        var results = [GMPInteger](
+            repeating: GMPInteger(),
+            count: others.count
+        )
+        results.withUnsafeMutableBufferPointer { buffer in
+            DispatchQueue.concurrentPerform(iterations: others.count) { k in
+                buffer[k] = dotProduct(ofRow: i, withRow: others[k])
+            }
+        }
+        return results
+    }
+
+    /// Compute the Gram matrix `self * transposed`.
+    ///
+    /// - Returns: The symmetric `rowCount x rowCount` matrix of row inner
+    ///   products.
+    public var gramMatrix: GMPIntegerMatrix {
+        var result = GMPIntegerMatrix(rows: rowCount, columns: rowCount)
+        for i in 0 ..< rowCount {
+            let products = dotProducts(ofRow: i, withRows: Array(0 ... i))
+            for j in 0 ... i {
+                result._entries[i * rowCount + j] = products[j]
+                result._entries[j * rowCount + i] = products[j]
+            }
+        }
+        return result
+    }
+
+    /// Multiply two matrices.
+    ///
+    /// - Parameter other: The right-hand factor. Its row count must equal
+    ///   this matrix's column count.
+    /// - Returns: The matrix product.
+    public func multiplied(by other: GMPIntegerMatrix) -> GMPIntegerMatrix {
+        precondition(
+            columnCount == other.rowCount,
+            "column count must equal the other matrix's row count"
+        )
+        var result = GMPIntegerMatrix(
+            rows: rowCount,
+            columns: other.columnCount
+        )
+        for i in 0 ..< rowCount {
+            for k in 0 ..< columnCount {
+                let a = _entries[i * columnCount + k]
+                if a.isZero {
+                    continue
+                }
+                for j in 0 ..< other.columnCount {
+                    result._entries[i * other.columnCount + j].addProduct(
+                        a,
+                        other._entries[k * other.columnCount + j]
+                    )
+                }
+            }
+        }
+        return result
+    }
+
+    /// Multiply two matrices.
+    public static func * (
+        lhs: GMPIntegerMatrix,
+        rhs: GMPIntegerMatrix
+    ) -> GMPIntegerMatrix {
+        lhs.multiplied(by: rhs)
+    }
+}
+
+// MARK: - Protocol Conformances
+
+extension GMPIntegerMatrix: Equatable {
+    public static func == (
+        lhs: GMPIntegerMatrix,
+        rhs: GMPIntegerMatrix
+    ) -> Bool {
+        lhs.rowCount == rhs.rowCount && lhs.columnCount == rhs.columnCount
+            && lhs._entries == rhs._entries
+    }
+}
+
+extension GMPIntegerMatrix: CustomStringConvertible {
+    /// The rows, one per line, in decimal.
+    public var description: String {
+        rows.map { row in
+            "[" + row.map { $0.toString() }.joined(separator: ", ") + "]"
+        }.joined(separator: "\n")
+    }
+}
@@ -0,0 +1,534 @@
+import Dispatch
+import Foundation
+
+extension GMPTuningParameter {
+    /// The number of residues (product length times primes) from which
+    /// `NumberTheoreticTransform.product(_:_:)` works on its primes
+    /// concurrently.
+    public static let numberTheoreticTransformParallelThreshold =
+        GMPTuningParameter(
+            "NumberTheoreticTransform.parallelThreshold",
+            default: 1 << 14
+        )
+}
+
+/// A number-theoretic transform of a fixed power-of-two length over a
+/// word-sized prime field.
+///
+/// The forward transform is a decimation-in-frequency (Gentleman–Sande)
+/// network taking natural-order input to bit-reversed output, and the
+/// inverse a decimation-in-time (Cooley–Tukey) network taking it back, so
+/// convolutions never permute. Both are table driven and cache blocked:
+///
+/// - Twiddles come from tables cached per prime and length, laid out so
+///   that each level reads the powers of its root contiguously, with a
+///   Shoup quotient stored beside each power.
+/// - Levels whose blocks exceed `blockLength` run one at a time over the
+///   whole range; each block at or below it then runs all its remaining
+///   levels while it is in cache.
+/// - Butterflies use Shoup products and Harvey's lazy reduction, keeping
+///   values in `0 ..< 2p` between levels; pointwise products in
+///   convolutions use Montgomery reduction, whose `2^-64` factor is folded
+///   into the final scaling.
+///
+/// `product(_:_:)` multiplies `GMPInteger` polynomials by transforms modulo
+/// several `WordPrimeField.transformPrimes`, one prime per core, and
+/// Chinese remaindering.
+///
+/// ```swift
+/// let field = WordPrimeField.transformPrimes[0]
+/// let transform = NumberTheoreticTransform(field: field, length: 8)
+/// let c = transform.convolution([1, 2, 3], [4, 5])  // [4, 13, 22, 15, ...]
+/// ```
+public struct NumberTheoreticTransform: Sendable {
+    /// The field the transform works in.
+    public let field: WordPrimeField
+
+    /// The number of points, a power of two.
+    public let length: Int
+
+    /// The twiddle tables, shared through `_NTTTableCache`.
+    let _tables: _NTTTables
+
+    /// The largest block, in words, whose levels run while it is in cache:
+    /// 16 KiB, half a typical L1 data cache.
+    public static let blockLength = 1 << 11
+
+    /// The minimum number of residues before `product(_:_:)` is split
+    /// across cores; see
+    /// `GMPTuningParameter.numberTheoreticTransformParallelThreshold`.
+    public static var parallelThreshold: Int {
+        GMPTuningParameter.numberTheoreticTransformParallelThreshold.value
+    }
+
+    /// Create a transform.
+    ///
+    /// - Parameters:
+    ///   - field: The field, with `field.twoAdicity` at least `log2(length)`.
+    ///   - length: The number of points, a power of two.
+    public init(field: WordPrimeField, length: Int) {
+        precondition(
+            length > 0 && length & (length - 1) == 0,
+            "length must be a power of two"
+        )
+        let log2Length = length.trailingZeroBitCount
+        precondition(
+            log2Length <= field.twoAdicity,
+            "field has no root of unity of that order"
+        )
+        self.field = field
+        self.length = length
+        _tables = _NTTTableCache.shared.tables(
+            field: field,
+            log2Length: log2Length
+        )
+    }
+
+    // MARK: - Transforms
+
+    /// Transform residues in place, from natural to bit-reversed order.
+    ///
+    /// - Parameter values: `length` residues.
+    public func forward(_ values: inout [UInt64]) {
+        precondition(values.count == length, "values must fill the transform")
+        let p = field.modulus
+        values.withUnsafeMutableBufferPointer { buffer in
+            _forward(buffer.baseAddress!, length)
+            for i in buffer.indices where buffer[i] >= p {
+                buffer[i] -= p
+            }
+        }
+    }
+
+    /// Invert `forward(_:)` in place, from bit-reversed to natural order,
+    /// including the division by `length`.
+    ///
+    /// - Parameter values: `length` residues.
+    public func inverse(_ values: inout [UInt64]) {
+        precondition(values.count == length, "values must fill the transform")
+        values.withUnsafeMutableBufferPointer { buffer in
+            _inverse(buffer.baseAddress!, length)
+            _scale(
+                buffer,
+                _tables.inverseScale,
+                _tables.inverseScaleQuotient
+            )
+        }
+    }
+
+    /// The cyclic convolution of two residue sequences.
+    ///
+    /// - Parameters:
+    ///   - lhs: At most `length` residues.
+    ///   - rhs: At most `length` residues.
+    /// - Returns: `length` residues: `Σ lhs[i] rhs[j]` over
+    ///   `i + j ≡ k (mod length)`.
+    public func convolution(_ lhs: [UInt64], _ rhs: [UInt64]) -> [UInt64] {
+        precondition(
+            lhs.count <= length && rhs.count <= length,
+            "inputs must fit the transform"
+        )
+        var a = lhs + [UInt64](repeating: 0, count: length - lhs.count)
+        var b = rhs + [UInt64](repeating: 0, count: length - rhs.count)
+        a.withUnsafeMutableBufferPointer { x in
+            b.withUnsafeMutableBufferPointer { y in
+                _forward(x.baseAddress!, length)
+                _forward(y.baseAddress!, length)
+                // Lazy values below 2p have products below p · 2^64
+                for i in x.indices {
+                    x[i] = field._montgomeryProduct(x[i], y[i])
+                }
+                _inverse(x.baseAddress!, length)
+                _scale(
+                    x,
+                    _tables.convolutionScale,
+                    _tables.convolutionScaleQuotient
+                )
+            }
+        }
+        return a
+    }
+
+    /// Multiply by a fixed factor and reduce into `0 ..< p`.
+    private func _scale(
+        _ values: UnsafeMutableBufferPointer<UInt64>,
+        _ factor: UInt64,
+        _ quotient: UInt64
+    ) {
+        let p = field.modulus
+        for i in values.indices {
+            let x = field._shoupProduct(values[i], factor, quotient)
+            values[i] = x >= p ? x - p : x
+        }
+    }
+
+    /// The forward network on `count` values in `0 ..< 2p`, leaving them in
+    /// `0 ..< 2p`.
+    private func _forward(_ a: UnsafeMutablePointer<UInt64>, _ count: Int) {
+        if count > Self.blockLength {
+            let half = count / 2
+            _forwardLevel(a, count, half)
+            _forward(a, half)
+            _forward(a + half, half)
+            return
+        }
+        var half = count / 2
+        while half >= 1 {
+            _forwardLevel(a, count, half)
+            half /= 2
+        }
+    }
+
+    /// The inverse network on `count` values in `0 ..< 2p`, leaving them in
+    /// `0 ..< 2p`, without the division by `count`.
+    private func _inverse(_ a: UnsafeMutablePointer<UInt64>, _ count: Int) {
+        if count > Self.blockLength {
+            let half = count / 2
+            _inverse(a, half)
+            _inverse(a + half, half)
+            _inverseLevel(a, count, half)
+            return
+        }
+        var half = 1
+        while half < count {
+            _inverseLevel(a, count, half)
+            half *= 2
+        }
+    }
+
+    /// One level of Gentleman–Sande butterflies
+    /// `(u, v) ↦ (u + v, (u - v) ωʲ)` over blocks of `2 · half`.
+    @inline(__always)
+    private func _forwardLevel(
+        _ a: UnsafeMutablePointer<UInt64>,
+        _ count: Int,
+        _ half: Int
+    ) {
+        let p = field.modulus
+        let twoP = p << 1
+        let roots = _tables.roots + half
+        let quotients = _tables.rootQuotients + half
+        for start in stride(from: 0, to: count, by: 2 * half) {
+            let x = a + start
+            let y = x + half
+            for j in 0 ..< half {
+                let u = x[j]
+                let v = y[j]
+                let sum = u &+ v
+                x[j] = sum >= twoP ? sum &- twoP : sum
+                // u - v + 2p is below 4p, within a word
+                y[j] = field._shoupProduct(
+                    u &- v &+ twoP,
+                    roots[j],
+                    quotients[j]
+                )
+            }
+        }
+    }
+
+    /// One level of Cooley–Tukey butterflies
+    /// `(u, v) ↦ (u + v ω⁻ʲ, u - v ω⁻ʲ)` over blocks of `2 · half`.
+    @inline(__always)
+    private func _inverseLevel(
+        _ a: UnsafeMutablePointer<UInt64>,
+        _ count: Int,
+        _ half: Int
+    ) {
+        let p = field.modulus
+        let twoP = p << 1
+        let roots = _tables.inverseRoots + half
+        let quotients = _tables.inverseRootQuotients + half
+        for start in stride(from: 0, to: count, by: 2 * half) {
+            let x = a + start
+            let y = x + half
+            for j in 0 ..< half {
+                let u = x[j]
+                let v = field._shoupProduct(y[j], roots[j], quotients[j])
+                let sum = u &+ v
+                let difference = u &- v &+ twoP
+                x[j] = sum >= twoP ? sum &- twoP : sum
+                y[j] = difference >= twoP
+                    ? difference &- twoP
+                    : difference
+            }
+        }
+    }
+}
+
+// MARK: - Multimodular Products
+
+extension NumberTheoreticTransform {
+    /// The product of two polynomials with `GMPInteger` coefficients.
+    ///
+    /// The factors are reduced modulo enough `WordPrimeField.transformPrimes`
+    /// to determine every product coefficient with its sign, multiplied
+    /// modulo each prime, concurrently across primes once the product has
+    /// `parallelThreshold` residues, and lifted back with
+    /// `WordPrimePolynomial.lifted(_:)`. Products beyond the prime table
+    /// fall back to Kronecker substitution. Multimodular products are
+    /// checked by `GMPVerification` when `.polynomialProduct` is an
+    /// automatic category.
+    ///
+    /// - Parameters:
+    ///   - lhs: The first factor's coefficients, constant term first.
+    ///   - rhs: The second factor's coefficients, constant term first.
+    /// - Returns: The `lhs.count + rhs.count - 1` product coefficients, or
+    ///   none if a factor has no coefficients.
+    public static func product(
+        _ lhs: [GMPInteger],
+        _ rhs: [GMPInteger]
+    ) -> [GMPInteger] {
+        guard !lhs.isEmpty, !rhs.isEmpty else {
+            return []
+        }
+        let count = lhs.count + rhs.count - 1
+        let terms = Swift.min(lhs.count, rhs.count)
+        // Coefficients are below 2^(bits - 1) in magnitude, and each prime
+        // exceeds 2^61
+        let bits = lhs.map(\.bitCount).max()! + rhs.map(\.bitCount).max()!
+            + (Int.bitWidth - terms.leadingZeroBitCount) + 1
+        let primes = WordPrimeField.transformPrimes
+        let primeCount = bits / 61 + 1
+        guard primeCount <= primes.count, count <= 1 << 40 else {
+            return GMPInteger._kroneckerProduct(lhs, rhs, count: count)
+        }
+        let fields = Array(primes.prefix(primeCount))
+        let parallel = count * primeCount >= parallelThreshold
+            && ProcessInfo.processInfo.activeProcessorCount > 1
+        var images = [[UInt64]](repeating: [], count: primeCount)
+        images.withUnsafeMutableBufferPointer { buffer in
+            let image = { (i: Int) in
+                let field = fields[i]
+                buffer[i] = WordPrimePolynomial._product(
+                    lhs.map { field.residue(of: $0) },
+                    rhs.map { field.residue(of: $0) },
+                    field
+                )
+            }
+            if parallel, primeCount > 1 {
+                DispatchQueue.concurrentPerform(
+                    iterations: primeCount,
+                    execute: image
+                )
+            } else {
+                for i in 0 ..< primeCount {
+                    image(i)
+                }
+            }
+        }
+        let result = WordPrimePolynomial._lifted(
+            images,
+            fields,
+            count: count,
+            parallel: parallel
+        )
+        if GMPVerification._isAutomatic(.polynomialProduct) {
+            _ = GMPVerification.verifyPolynomialProduct(result, lhs, rhs)
+        }
+        return result
+    }
+}
+
+// MARK: - Tables
+
+/// The twiddle tables of one prime and length.
+///
+/// Entry `h + j` of `roots`, for `h` a power of two below the length and
+/// `j < h`, is `ω₂ₕʲ` for the primitive `2h`-th root `ω₂ₕ` used by the
+/// level with blocks of `2h`; `inverseRoots` holds the inverses. The four
+/// tables share one allocation.
+final class _NTTTables: @unchecked Sendable {
+    let roots: UnsafeMutablePointer<UInt64>
+    let rootQuotients: UnsafeMutablePointer<UInt64>
+    let inverseRoots: UnsafeMutablePointer<UInt64>
+    let inverseRootQuotients: UnsafeMutablePointer<UInt64>
+
+    /// `1/n`, for `NumberTheoreticTransform.inverse(_:)`.
+    let inverseScale: UInt64
+    let inverseScaleQuotient: UInt64
+
+    /// `2^64/n`, which also undoes the Montgomery factor of pointwise
+    /// products.
+    let convolutionScale: UInt64
+    let convolutionScaleQuotient: UInt64
+
+    /// The number of points.
+    let length: Int
+
+    init(field: WordPrimeField, log2Length: Int) {
+        let n = 1 << log2Length
+        length = n
+        let storage = UnsafeMutablePointer<UInt64>.allocate(capacity: 4 * n)
+        storage.initialize(repeating: 0, count: 4 * n)
+        roots = storage
+        rootQuotients = storage + n
+        inverseRoots = storage + 2 * n
+        inverseRootQuotients = storage + 3 * n
+        var root = field.rootOfUnity(log2Order: log2Length)
+        var half = n / 2
+        while half >= 1 {
+            let inverse = field.inverse(of: root)!
+            var power: UInt64 = 1
+            var inversePower: UInt64 = 1
+            for j in 0 ..< half {
+                roots[half + j] = power
+                rootQuotients[half + j] = field._shoupQuotient(power)
+                inverseRoots[half + j] = inversePower
+                inverseRootQuotients[half + j] = field._shoupQuotient(
+                    inversePower
+                )
+                power = field.multiply(power, root)
+                inversePower = field.multiply(inversePower, inverse)
+            }
+            root = field.multiply(root, root)
+            half /= 2
+        }
+        inverseScale = field.inverse(of: UInt64(n) % field.modulus)!
+        inverseScaleQuotient = field._shoupQuotient(inverseScale)
+        convolutionScale = field._montgomeryForm(inverseScale)
+        convolutionScaleQuotient = field._shoupQuotient(convolutionScale)
+    }
+
+    deinit {
+        roots.deallocate()
+    }
+
+    /// The memory held, in bytes.
+    var byteCount: Int {
+        4 * length * MemoryLayout<UInt64>.stride
+    }
+}
+
+/// The process-wide cache of transform tables, keyed by prime and length.
+///
+/// The cache is managed by `GMPCacheRegistry.shared`, so tables may be
+/// evicted under a byte budget and are recomputed on next use. Evicted
+/// tables stay alive while a transform still holds them.
+final class _NTTTableCache: GMPManagedCache, @unchecked Sendable {
+    /// The shared cache, registered with the shared registry.
+    static let shared: _NTTTableCache = {
+        let cache = _NTTTableCache()
+        GMPCacheRegistry.shared.register(cache)
+        return cache
+    }()
+
+    /// A cache key.
+    struct Key: Hashable {
+        let modulus: UInt64
+        let log2Length: Int
+    }
+
+    /// Cached tables with their accounting.
+    struct Entry {
+        let tables: _NTTTables
+
+        /// The time taken to compute the tables, in nanoseconds.
+        let cost: Double
+
+        var priority: Double
+    }
+
+    /// Guards `entries`.
+    private let lock = NSLock()
+
+    /// The cached tables.
+    private var entries: [Key: Entry] = [:]
+
+    let cacheName = "NumberTheoreticTransform.tables"
+
+    /// The tables for a prime and length, computing them on first use.
+    ///
+    /// Computation happens outside the lock; if two threads race on the
+    /// same key, the first result stored wins.
+    func tables(field: WordPrimeField, log2Length: Int) -> _NTTTables {
+        let key = Key(modulus: field.modulus, log2Length: log2Length)
+        let registry = GMPCacheRegistry.shared
+        lock.lock()
+        let cached = entries[key]
+        lock.unlock()
+        if let cached {
+            let priority = registry.priority(
+                cost: cached.cost,
+                byteCount: cached.tables.byteCount
+            )
+            lock.lock()
+            entries[key]?.priority = priority
+            lock.unlock()
+            return cached.tables
+        }
+        let start = DispatchTime.now().uptimeNanoseconds
+        let computed = _NTTTables(field: field, log2Length: log2Length)
+        let cost = Double(DispatchTime.now().uptimeNanoseconds - start)
+        let entry = Entry(
+            tables: computed,
+            cost: cost,
+            priority: registry.priority(
+                cost: cost,
+                byteCount: computed.byteCount
+            )
+        )
+        lock.lock()
+        if let existing = entries[key] {
+            lock.unlock()
+            return existing.tables
+        }
+        entries[key] = entry
+        lock.unlock()
+        registry.didGrow()
+        return computed
+    }
+
+    /// Remove every cached table.
+    func removeAll() {
+        lock.lock()
+        defer { lock.unlock() }
+        entries.removeAll()
+    }
+
+    // MARK: - GMPManagedCache
+
+    func cacheEntries() -> [GMPCacheEntry] {
+        lock.lock()
+        defer { lock.unlock() }
+        return entries.map { key, entry in
+            GMPCacheEntry(
+                key: key,
+                byteCount: entry.tables.byteCount,
+                priority: entry.priority
+            )
+        }
+    }
+
+    func evictCacheEntries(_ keys: [AnyHashable]) {
+        lock.lock()
+        defer { lock.unlock() }
+        for case let key as Key in keys {
+            entries[key] = nil
+        }
+    }
+
+    func removeAllCacheEntries() {
+        removeAll()
+    }
+}
+
+extension GMPCutoverBenchmark {
+    /// Squares of polynomials with 256-bit coefficients, over nine primes.
+    public static var numberTheoreticTransformProduct: GMPCutoverBenchmark {
+        GMPCutoverBenchmark(
+            parameter: .numberTheoreticTransformParallelThreshold,
+            scales: [64, 128, 256, 512, 1024, 2048]
+        ) { count in
+            let f = (0 ..< count).map { i in
+                let word = UInt64(i) &* 0x9E37_79B9_7F4A_7C15
+                return (GMPInteger(UInt(truncatingIfNeeded: word)) << 192) + i
+            }
+            let primes = (2 * 256 + 2 + count.bitWidth
+                - count.leadingZeroBitCount) / 61 + 1
+            return (
+                (2 * count - 1) * primes,
+                { _ = NumberTheoreticTransform.product(f, f) }
+            )
+        }
+    }
+}
@@ -0,0 +1,199 @@
+/// Arithmetic modulo a word-sized prime.
+///
+/// Residues are `UInt64` values in `0 ..< modulus`. Products use Montgomery
+/// reduction with `R = 2^64`, so multiplying never divides; residues
+/// multiplied by one fixed factor many times, such as transform twiddles,
+/// use Shoup's precomputed quotients instead. The modulus is below `2^62`,
+/// which leaves two spare bits for the lazily reduced values of
+/// `NumberTheoreticTransform` butterflies.
+///
+/// ```swift
+/// let field = WordPrimeField(modulus: 998_244_353)
+/// let x = field.multiply(123_456_789, field.inverse(of: 3)!)
+/// ```
+public struct WordPrimeField: Hashable, Sendable {
+    /// The prime modulus, odd and below `2^62`.
+    public let modulus: UInt64
+
+    /// `-modulus⁻¹ mod 2^64`, for Montgomery reduction.
+    let _negatedInverse: UInt64
+
+    /// `2^128 mod modulus`, which maps residues into Montgomery form.
+    let _montgomerySquare: UInt64
+
+    /// Create a field for a prime modulus.
+    ///
+    /// - Parameter modulus: An odd prime below `2^62`.
+    public init(modulus: UInt64) {
+        precondition(
+            modulus > 2 && modulus < 1 << 62,
+            "modulus must be an odd prime below 2^62"
+        )
+        precondition(
+            GMPInteger(Int(modulus)).isProbablePrime() > 0,
+            "modulus must be prime"
+        )
+        self.init(_prime: modulus)
+    }
+
+    /// Create a field for a modulus already known to be an odd prime below
+    /// `2^62`.
+    init(_prime modulus: UInt64) {
+        self.modulus = modulus
+        // Newton's iteration doubles the correct low bits of the inverse;
+        // an odd number is its own inverse modulo 8
+        var inverse = modulus
+        for _ in 0 ..< 5 {
+            inverse = inverse &* (2 &- modulus &* inverse)
+        }
+        _negatedInverse = 0 &- inverse
+        let r = (UInt64.max % modulus + 1) % modulus
+        _montgomerySquare = modulus.dividingFullWidth((r, 0)).remainder
+    }
+
+    /// The largest `k` with `2^k` dividing `modulus - 1`: transforms of up to
+    /// `2^k` points exist.
+    public var twoAdicity: Int {
+        (modulus - 1).trailingZeroBitCount
+    }
+
+    // MARK: - Arithmetic
+
+    /// Reduce any word into `0 ..< modulus`.
+    @inline(__always)
+    public func reduce(_ value: UInt64) -> UInt64 {
+        value % modulus
+    }
+
+    /// The residue of an integer of any size and sign.
+    public func residue(of value: GMPInteger) -> UInt64 {
+        UInt64(try! value.floorRemainder(dividingBy: Int(modulus)))
+    }
+
+    /// `a + b` for residues `a` and `b`.
+    @inline(__always)
+    public func add(_ a: UInt64, _ b: UInt64) -> UInt64 {
+        let sum = a &+ b
+        return sum >= modulus ? sum &- modulus : sum
+    }
+
+    /// `a - b` for residues `a` and `b`.
+    @inline(__always)
+    public func subtract(_ a: UInt64, _ b: UInt64) -> UInt64 {
+        a >= b ? a &- b : a &+ (modulus &- b)
+    }
+
+    /// `-a` for a residue `a`.
+    @inline(__always)
+    public func negate(_ a: UInt64) -> UInt64 {
+        a == 0 ? 0 : modulus &- a
+    }
+
+    /// `a · b` for residues `a` and `b`, by two Montgomery reductions.
+    @inline(__always)
+    public func multiply(_ a: UInt64, _ b: UInt64) -> UInt64 {
+        _montgomeryProduct(_montgomeryProduct(a, b), _montgomerySquare)
+    }
+
+    /// `base^exponent`, with `0^0 = 1`.
+    public func power(_ base: UInt64, _ exponent: UInt64) -> UInt64 {
+        var result: UInt64 = 1
+        var square = base
+        var e = exponent
+        while e != 0 {
+            if e & 1 == 1 {
+                result = multiply(result, square)
+            }
+            square = multiply(square, square)
+            e >>= 1
+        }
+        return result
+    }
+
+    /// The multiplicative inverse, or `nil` for zero.
+    public func inverse(of value: UInt64) -> UInt64? {
+        value == 0 ? nil : power(value, modulus - 2)
+    }
+
+    /// A primitive `2^log2Order`-th root of unity.
+    ///
+    /// - Parameter log2Order: At most `twoAdicity`.
+    public func rootOfUnity(log2Order: Int) -> UInt64 {
+        precondition(
+            log2Order >= 0 && log2Order <= twoAdicity,
+            "no root of unity of that order"
+        )
+        // A quadratic nonresidue raised to the odd part of p - 1 has order
+        // exactly 2^twoAdicity
+        var g: UInt64 = 2
+        while power(g, (modulus - 1) / 2) != modulus - 1 {
+            g += 1
+        }
+        let root = power(g, (modulus - 1) >> twoAdicity)
+        return power(root, 1 << (twoAdicity - log2Order))
+    }
+
+    // MARK: - Montgomery and Shoup Products
+
+    /// `t · 2^-64 mod modulus` for `t = high · 2^64 + low < modulus · 2^64`.
+    @inline(__always)
+    func _montgomeryReduce(_ high: UInt64, _ low: UInt64) -> UInt64 {
+        // low + m·p ≡ 0 (mod 2^64), so t + m·p is the exact multiple
+        // (high + mh + carry) · 2^64, below 2p · 2^64
+        let m = low &* _negatedInverse
+        let mh = m.multipliedFullWidth(by: modulus).high
+        let carry: UInt64 = low == 0 ? 0 : 1
+        let result = high &+ mh &+ carry
+        return result >= modulus ? result &- modulus : result
+    }
+
+    /// `a · b · 2^-64 mod modulus`, for `a · b < modulus · 2^64`.
+    @inline(__always)
+    func _montgomeryProduct(_ a: UInt64, _ b: UInt64) -> UInt64 {
+        let (high, low) = a.multipliedFullWidth(by: b)
+        return _montgomeryReduce(high, low)
+    }
+
+    /// `a · 2^64 mod modulus`: one Montgomery product by the result gives an
+    /// ordinary product.
+    @inline(__always)
+    func _montgomeryForm(_ a: UInt64) -> UInt64 {
+        _montgomeryProduct(a, _montgomerySquare)
+    }
+
+    /// `⌊w · 2^64 / modulus⌋`, the Shoup quotient of a fixed factor `w`.
+    func _shoupQuotient(_ w: UInt64) -> UInt64 {
+        modulus.dividingFullWidth((w, 0)).quotient
+    }
+
+    /// `x · w mod modulus` up to one extra `modulus`: a value in
+    /// `0 ..< 2 · modulus`, for any word `x`.
+    @inline(__always)
+    func _shoupProduct(
+        _ x: UInt64,
+        _ w: UInt64,
+        _ quotient: UInt64
+    ) -> UInt64 {
+        let q = x.multipliedFullWidth(by: quotient).high
+        return w &* x &- q &* modulus
+    }
+
+    // MARK: - Transform Primes
+
+    /// Primes `c · 2^40 + 1` below `2^62`, in decreasing order, for
+    /// multimodular products: each supports transforms of up to `2^40`
+    /// points, and 256 of them cover products with about 15,000-bit
+    /// coefficients.
+    public static let transformPrimes: [WordPrimeField] = {
+        var primes: [WordPrimeField] = []
+        var c = (1 << 22) - 1
+        while primes.count < 256 {
+            let p = c << 40 | 1
+            if GMPInteger(p).isProbablePrime() > 0 {
+                primes.append(WordPrimeField(_prime: UInt64(p)))
+            }
+            c -= 1
+        }
+        return primes
+    }()
+}
@@ -0,0 +1,481 @@
+import Dispatch
+import Foundation
+
+extension GMPTuningParameter {
+    /// The length of the shorter factor from which `WordPrimePolynomial`
+    /// products use `NumberTheoreticTransform` instead of the schoolbook
+    /// method. Division switches to Newton iteration, and multipoint
+    /// evaluation to remainder trees, at the same size.
+    public static let wordPrimePolynomialTransformThreshold =
+        GMPTuningParameter(
+            "WordPrimePolynomial.transformThreshold",
+            default: 48
+        )
+}
+
+/// A dense polynomial over a `WordPrimeField`.
+///
+/// Coefficients are residues, constant term first, with no trailing zeros.
+/// Arithmetic is quasi-linear once operands reach
+/// `GMPTuningParameter.wordPrimePolynomialTransformThreshold`:
+///
+/// - Products use `NumberTheoreticTransform` convolutions when the field has
+///   roots of unity of the needed order, and the schoolbook method with
+///   Montgomery products otherwise.
+/// - Division computes the reversed divisor's power-series inverse by
+///   Newton iteration.
+/// - Multipoint evaluation reduces down a subproduct tree of the points.
+///
+/// `gcd(_:_:)` is Euclid's algorithm on top of division. `lifted(_:)`
+/// combines images modulo several primes into `GMPInteger` coefficients by
+/// Chinese remaindering.
+///
+/// ```swift
+/// let field = WordPrimeField.transformPrimes[0]
+/// let f = WordPrimePolynomial([1, 2, 1], field: field)  // (x + 1)²
+/// let g = WordPrimePolynomial([1, 1], field: field)
+/// let (q, r) = f.quotientAndRemainder(dividingBy: g)  // x + 1, 0
+/// ```
+public struct WordPrimePolynomial: Equatable, Sendable {
+    /// The coefficient field.
+    public let field: WordPrimeField
+
+    /// The coefficients, constant term first, without trailing zeros.
+    public let coefficients: [UInt64]
+
+    /// The size from which quasi-linear algorithms are used; see
+    /// `GMPTuningParameter.wordPrimePolynomialTransformThreshold`.
+    public static var transformThreshold: Int {
+        GMPTuningParameter.wordPrimePolynomialTransformThreshold.value
+    }
+
+    /// Create a polynomial from words, which are reduced into the field.
+    ///
+    /// - Parameters:
+    ///   - coefficients: The coefficients, constant term first.
+    ///   - field: The coefficient field.
+    public init(_ coefficients: [UInt64], field: WordPrimeField) {
+        self.init(
+            _trimming: coefficients.map { field.reduce($0) },
+            field: field
+        )
+    }
+
+    /// Create the image of an integer polynomial.
+    ///
+    /// - Parameters:
+    ///   - coefficients: The coefficients, constant term first.
+    ///   - field: The coefficient field.
+    public init(_ coefficients: [GMPInteger], field: WordPrimeField) {
+        self.init(
+            _trimming: coefficients.map { field.residue(of: $0) },
+            field: field
+        )
+    }
+
+    /// Create a polynomial from residues, dropping trailing zeros.
+    init(_trimming coefficients: [UInt64], field: WordPrimeField) {
+        var coefficients = coefficients
+        while coefficients.last == 0 {
+            coefficients.removeLast()
+        }
+        self.coefficients = coefficients
+        self.field = field
+    }
+
+    /// The degree, or -1 for the zero polynomial.
+    public var degree: Int {
+        coefficients.count - 1
+    }
+
+    /// Whether this is the zero polynomial.
+    public var isZero: Bool {
+        coefficients.isEmpty
+    }
+
+    // MARK: - Arithmetic
+
+    /// The sum.
+    public static func + (
+        lhs: WordPrimePolynomial,
+        rhs: WordPrimePolynomial
+    ) -> WordPrimePolynomial {
+        precondition(lhs.field == rhs.field, "fields must match")
+        return WordPrimePolynomial(
+            _trimming: _sum(lhs.coefficients, rhs.coefficients, lhs.field),
+            field: lhs.field
+        )
+    }
+
+    /// The difference.
+    public static func - (
+        lhs: WordPrimePolynomial,
+        rhs: WordPrimePolynomial
+    ) -> WordPrimePolynomial {
+        precondition(lhs.field == rhs.field, "fields must match")
+        let field = lhs.field
+        return WordPrimePolynomial(
+            _trimming: _sum(
+                lhs.coefficients,
+                rhs.coefficients.map { field.negate($0) },
+                field
+            ),
+            field: field
+        )
+    }
+
+    /// The product, by transform once both factors have
+    /// `transformThreshold` coefficients.
+    public static func * (
+        lhs: WordPrimePolynomial,
+        rhs: WordPrimePolynomial
+    ) -> WordPrimePolynomial {
+        precondition(lhs.field == rhs.field, "fields must match")
+        return WordPrimePolynomial(
+            _trimming: _product(lhs.coefficients, rhs.coefficients, lhs.field),
+            field: lhs.field
+        )
+    }
+
+    /// Divide with remainder.
+    ///
+    /// - Parameter divisor: A nonzero polynomial over the same field.
+    /// - Returns: `quotient` and `remainder` with
+    ///   `self = quotient · divisor + remainder` and
+    ///   `remainder.degree < divisor.degree`.
+    public func quotientAndRemainder(
+        dividingBy divisor: WordPrimePolynomial
+    ) -> (quotient: WordPrimePolynomial, remainder: WordPrimePolynomial) {
+        precondition(field == divisor.field, "fields must match")
+        precondition(!divisor.isZero, "divisor must not be zero")
+        let (q, r) = Self._quotientAndRemainder(
+            coefficients,
+            divisor.coefficients,
+            field
+        )
+        return (
+            WordPrimePolynomial(_trimming: q, field: field),
+            WordPrimePolynomial(_trimming: r, field: field)
+        )
+    }
+
+    /// The monic greatest common divisor, or zero if both are zero.
+    public static func gcd(
+        _ a: WordPrimePolynomial,
+        _ b: WordPrimePolynomial
+    ) -> WordPrimePolynomial {
+        precondition(a.field == b.field, "fields must match")
+        let field = a.field
+        var (x, y) = (a.coefficients, b.coefficients)
+        while !y.isEmpty {
+            (x, y) = (y, _trimmed(_quotientAndRemainder(x, y, field).1))
+        }
+        guard let leading = x.last else {
+            return a
+        }
+        let inverse = field._montgomeryForm(field.inverse(of: leading)!)
+        return WordPrimePolynomial(
+            _trimming: x.map { field._montgomeryProduct($0, inverse) },
+            field: field
+        )
+    }
+
+    // MARK: - Evaluation
+
+    /// The value at a point, by Horner's rule.
+    ///
+    /// - Parameter point: A residue.
+    public func evaluated(at point: UInt64) -> UInt64 {
+        let x = field._montgomeryForm(point)
+        var value: UInt64 = 0
+        for c in coefficients.reversed() {
+            value = field.add(field._montgomeryProduct(value, x), c)
+        }
+        return value
+    }
+
+    /// The values at several points.
+    ///
+    /// From `transformThreshold` points on, the polynomial is reduced
+    /// modulo the products of ever smaller groups of linear factors
+    /// `x - u`, down a subproduct tree, instead of evaluated point by point.
+    ///
+    /// - Parameter points: Residues.
+    public func evaluated(at points: [UInt64]) -> [UInt64] {
+        let threshold = Self.transformThreshold
+        guard points.count >= threshold, coefficients.count >= threshold else {
+            return points.map { evaluated(at: $0) }
+        }
+        // Level 0 holds the linear factors; each level multiplies pairs
+        var tree = [points.map { [field.negate($0), 1] }]
+        while tree[tree.count - 1].count > 1 {
+            let level = tree[tree.count - 1]
+            tree.append(
+                stride(from: 0, to: level.count, by: 2).map { i in
+                    i + 1 < level.count
+                        ? Self._product(level[i], level[i + 1], field)
+                        : level[i]
+                }
+            )
+        }
+        var remainders = [
+            Self._quotientAndRemainder(
+                coefficients,
+                tree[tree.count - 1][0],
+                field
+            ).1,
+        ]
+        for level in tree.dropLast().reversed() {
+            remainders = level.indices.map { i in
+                Self._quotientAndRemainder(remainders[i / 2], level[i], field)
+                    .1
+            }
+        }
+        return remainders.map { $0.first ?? 0 }
+    }
+
+    // MARK: - Chinese Remaindering
+
+    /// The integer polynomial with the given images and coefficients in the
+    /// symmetric range `(-M/2, M/2]`, for `M` the product of the primes.
+    ///
+    /// Each coefficient is lifted by Garner's mixed-radix algorithm in word
+    /// arithmetic, and only the final radix conversion uses `GMPInteger`.
+    ///
+    /// - Parameter images: Images modulo distinct primes.
+    public static func lifted(_ images: [WordPrimePolynomial]) -> [GMPInteger] {
+        precondition(!images.isEmpty, "at least one image is needed")
+        let fields = images.map(\.field)
+        precondition(
+            Set(fields.map(\.modulus)).count == fields.count,
+            "primes must be distinct"
+        )
+        let count = images.map(\.coefficients.count).max()!
+        return _lifted(
+            images.map(\.coefficients),
+            fields,
+            count: count,
+            parallel: count * images.count
+                >= NumberTheoreticTransform.parallelThreshold
+        )
+    }
+
+    /// Lift `count` coefficients from residue sequences, missing entries
+    /// being zero.
+    static func _lifted(
+        _ images: [[UInt64]],
+        _ fields: [WordPrimeField],
+        count: Int,
+        parallel: Bool
+    ) -> [GMPInteger] {
+        let t = fields.count
+        // Garner's constants in Montgomery form: pⱼ mod pᵢ for j < i, and
+        // (p₀ ⋯ pᵢ₋₁)⁻¹ mod pᵢ times 2^128
+        var primeResidues: [[UInt64]] = []
+        var inverses: [UInt64] = []
+        var modulus = GMPInteger(1)
+        for (i, field) in fields.enumerated() {
+            let p = field.modulus
+            var product: UInt64 = 1
+            primeResidues.append((0 ..< i).map { j in
+                let residue = fields[j].modulus % p
+                product = field.multiply(product, residue)
+                return field._montgomeryForm(residue)
+            })
+            let inverse = field.inverse(of: product)!
+            inverses.append(
+                field._montgomeryForm(field._montgomeryForm(inverse))
+            )
+            modulus = modulus * Int(p)
+        }
+        let half = modulus >> 1
+
+        func lift(_ k: Int) -> GMPInteger {
+            var digits = [UInt64](repeating: 0, count: t)
+            for i in 0 ..< t {
+                let field = fields[i]
+                // With R = 2^64, Horner's rule on the digits below i gives
+                // their value times R⁻¹: the terms dⱼR⁻¹ come from one
+                // reduction each, without dividing
+                var value: UInt64 = 0
+                for j in stride(from: i - 1, through: 0, by: -1) {
+                    value = field.add(
+                        field._montgomeryProduct(value, primeResidues[i][j]),
+                        field._montgomeryReduce(0, digits[j])
+                    )
+                }
+                let residue = k < images[i].count ? images[i][k] : 0
+                let difference = field.subtract(
+                    field._montgomeryReduce(0, residue),
+                    value
+                )
+                digits[i] = field._montgomeryProduct(difference, inverses[i])
+            }
+            var x = GMPInteger(Int(digits[t - 1]))
+            for j in stride(from: t - 2, through: 0, by: -1) {
+                x = x * Int(fields[j].modulus) + Int(digits[j])
+            }
+            return x > half ? x - modulus : x
+        }
+
+        var result = [GMPInteger](repeating: 0, count: count)
+        let chunks = parallel
+            ? Swift.min(count, 4 * ProcessInfo.processInfo.activeProcessorCount)
+            : 1
+        result.withUnsafeMutableBufferPointer { buffer in
+            DispatchQueue.concurrentPerform(iterations: chunks) { chunk in
+                let start = count * chunk / chunks
+                let end = count * (chunk + 1) / chunks
+                for k in start ..< end {
+                    buffer[k] = lift(k)
+                }
+            }
+        }
+        return result
+    }
+
+    // MARK: - Kernels
+
+    /// Residue sequences without trailing zeros.
+    static func _trimmed(_ a: [UInt64]) -> [UInt64] {
+        var a = a
+        while a.last == 0 {
+            a.removeLast()
+        }
+        return a
+    }
+
+    /// The coefficientwise sum.
+    static func _sum(
+        _ a: [UInt64],
+        _ b: [UInt64],
+        _ field: WordPrimeField
+    ) -> [UInt64] {
+        let (long, short) = a.count >= b.count ? (a, b) : (b, a)
+        var c = long
+        for i in short.indices {
+            c[i] = field.add(c[i], short[i])
+        }
+        return c
+    }
+
+    /// The `a.count + b.count - 1` product coefficients, or none if a
+    /// factor has none.
+    static func _product(
+        _ a: [UInt64],
+        _ b: [UInt64],
+        _ field: WordPrimeField
+    ) -> [UInt64] {
+        guard !a.isEmpty, !b.isEmpty else {
+            return []
+        }
+        let count = a.count + b.count - 1
+        let log2Length = Int.bitWidth - (count - 1).leadingZeroBitCount
+        guard Swift.min(a.count, b.count) >= transformThreshold,
+              log2Length <= field.twoAdicity
+        else {
+            // Schoolbook, with one factor in Montgomery form so each term
+            // takes one reduction
+            var c = [UInt64](repeating: 0, count: count)
+            for i in a.indices where a[i] != 0 {
+                let x = field._montgomeryForm(a[i])
+                for j in b.indices {
+                    c[i + j] = field.add(
+                        c[i + j],
+                        field._montgomeryProduct(x, b[j])
+                    )
+                }
+            }
+            return c
+        }
+        let transform = NumberTheoreticTransform(
+            field: field,
+            length: 1 << log2Length
+        )
+        return Array(transform.convolution(a, b).prefix(count))
+    }
+
+    /// The first `count` coefficients of `1/f`, for `f[0] ≠ 0`, by Newton's
+    /// iteration `g ← g (2 - f g)`, which doubles the correct terms.
+    static func _inverseSeries(
+        _ f: [UInt64],
+        count: Int,
+        _ field: WordPrimeField
+    ) -> [UInt64] {
+        var g = [field.inverse(of: f[0])!]
+        while g.count < count {
+            let next = Swift.min(2 * g.count, count)
+            var e = Array(
+                _product(Array(f.prefix(next)), g, field).prefix(next)
+            )
+            for i in e.indices {
+                e[i] = field.negate(e[i])
+            }
+            e[0] = field.add(e[0], 2)
+            g = Array(_product(g, e, field).prefix(next))
+            g += [UInt64](repeating: 0, count: next - g.count)
+        }
+        return g
+    }
+
+    /// Quotient and remainder of trimmed sequences, `b` nonempty.
+    static func _quotientAndRemainder(
+        _ a: [UInt64],
+        _ b: [UInt64],
+        _ field: WordPrimeField
+    ) -> ([UInt64], [UInt64]) {
+        let d = b.count - 1
+        guard a.count > d else {
+            return ([], a)
+        }
+        let m = a.count - d
+        let threshold = transformThreshold
+        if d >= threshold, m >= threshold {
+            // rev(q) = rev(a) / rev(b) mod x^m
+            let inverse = _inverseSeries(b.reversed(), count: m, field)
+            let q = Array(
+                _product(Array(a.reversed().prefix(m)), inverse, field)
+                    .prefix(m)
+                    .reversed()
+            )
+            let bq = _product(b, q, field)
+            let r = (0 ..< d).map { field.subtract(a[$0], bq[$0]) }
+            return (q, _trimmed(r))
+        }
+        let inverse = field.inverse(of: b[d])!
+        var r = a
+        var q = [UInt64](repeating: 0, count: m)
+        for k in stride(from: m - 1, through: 0, by: -1) {
+            let c = field.multiply(r[k + d], inverse)
+            q[k] = c
+            guard c != 0 else {
+                continue
+            }
+            let x = field._montgomeryForm(c)
+            for j in 0 ..< d {
+                r[k + j] = field.subtract(
+                    r[k + j],
+                    field._montgomeryProduct(x, b[j])
+                )
+            }
+        }
+        return (q, _trimmed(Array(r.prefix(d))))
+    }
+}
+
+extension GMPCutoverBenchmark {
+    /// Products of two dense polynomials modulo the first transform prime.
+    public static var wordPrimePolynomialMultiplication: GMPCutoverBenchmark {
+        GMPCutoverBenchmark(
+            parameter: .wordPrimePolynomialTransformThreshold,
+            scales: [8, 16, 32, 64, 128, 256]
+        ) { count in
+            let field = WordPrimeField.transformPrimes[0]
+            let f = WordPrimePolynomial(
+                (0 ..< count).map { UInt64($0) &* 0x9E37_79B9_7F4A_7C15 },
+                field: field
+            )
+            return (count, { _ = f * f })
+        }
+    }
+}
@@ -0,0 +1,652 @@
+import Dispatch
+
+extension GMPTuningParameter {
+    /// The number of coefficients from which Taylor shifts `p(x) ↦ p(x + 1)`
+    /// in real root isolation switch from the quadratic addition scheme to
+    /// divide and conquer with Kronecker products.
+    public static let realRootTaylorShiftThreshold = GMPTuningParameter(
+        "RealRoot.taylorShiftThreshold",
+        default: 64
+    )
+}
+
+/// A real root of an integer polynomial, isolated in an interval.
+///
+/// `roots(of:)` finds every distinct real root of a polynomial with
+/// `GMPInteger` coefficients, each in an interval with dyadic endpoints
+/// containing no other root, by Descartes' rule of signs with bisection
+/// (the Vincent–Collins–Akritas method):
+///
+/// - The polynomial is reduced to its square-free part, with the gcd of
+///   `p` and `p'` found by the heuristic evaluation method (falling back to
+///   a primitive remainder sequence).
+/// - Positive and negative roots are isolated separately in `(0, 2^e)`,
+///   for a Fujiwara bound `2^e`. The polynomial of each interval is mapped
+///   to `(0, 1)`, and the sign variations of `(x + 1)ⁿ q(1/(x + 1))` bound
+///   the number of roots inside: none ends the search, one isolates a root
+///   and more bisects the interval.
+/// - Taylor shifts, the dominant cost, switch to divide and conquer over
+///   precomputed `(x + 1)^(2^j)` with Kronecker products once the
+///   polynomial has more coefficients than
+///   `GMPTuningParameter.realRootTaylorShiftThreshold`.
+/// - The intervals of each subdivision level are processed concurrently.
+///
+/// `refined(bits:)` narrows an interval by Abbott's quadratic interval
+/// refinement, which converges quadratically once the secant through the
+/// endpoints is a good guess; `value(precision:)` in Linus rounds a root
+/// to an `MPFRFloat`.
+///
+/// ```swift
+/// // x³ - 2x: roots -√2, 0, √2
+/// let roots = GMPRealRoot.roots(of: [0, -2, 0, 1])
+/// let sqrt2 = roots[2].refined(bits: 100)
+/// ```
+public struct GMPRealRoot {
+    /// The square-free primitive polynomial the root belongs to, constant
+    /// term first.
+    let _polynomial: [GMPInteger]
+
+    /// The endpoints as numerators over `2^_exponent`.
+    let _lower: GMPInteger
+    let _upper: GMPInteger
+    let _exponent: Int
+
+    /// The subdivision count of the next quadratic refinement step.
+    let _steps: Int
+
+    /// The lower endpoint of the isolating interval.
+    public var lower: GMPRational {
+        try! GMPRational(
+            numerator: _lower,
+            denominator: GMPInteger(1) << _exponent
+        )
+    }
+
+    /// The upper endpoint of the isolating interval.
+    public var upper: GMPRational {
+        try! GMPRational(
+            numerator: _upper,
+            denominator: GMPInteger(1) << _exponent
+        )
+    }
+
+    /// Whether the root is known exactly, as `lower == upper`.
+    public var isExact: Bool {
+        _lower == _upper
+    }
+
+    /// Whether the interval is at most `2^-bits` wide.
+    func _isNarrow(bits: Int) -> Bool {
+        let width = _upper - _lower
+        let scale = _exponent - bits
+        return scale >= 0
+            ? width <= GMPInteger(1) << scale
+            : width << -scale <= 1
+    }
+
+    // MARK: - Isolation
+
+    /// The distinct real roots of a polynomial, in increasing order.
+    ///
+    /// - Parameter coefficients: The coefficients, constant term first. Not
+    ///   all may be zero.
+    /// - Returns: One isolating interval per distinct real root; roots that
+    ///   are dyadic rationals met during bisection are exact.
+    public static func roots(of coefficients: [GMPInteger]) -> [GMPRealRoot] {
+        var p = _trimmed(coefficients)
+        precondition(!p.isEmpty, "polynomial must not be zero")
+        p = _squareFree(p)
+        var roots: [GMPRealRoot] = []
+        if p[0].isZero {
+            // Deflate the root at zero, which is simple
+            p.removeFirst()
+            roots.append(GMPRealRoot(p, 0, 0, exponent: 0))
+        }
+        guard p.count > 1 else {
+            return roots
+        }
+        let shift = _TaylorShift(count: p.count)
+        let n = p.count - 1
+        for negative in [false, true] {
+            let q = negative
+                ? p.enumerated().map { i, a in i % 2 == 0 ? a : -a }
+                : p
+            // Map (0, 2^e) to (0, 1)
+            let e = _rootBoundExponent(q)
+            let scaled = _removingTwos(
+                q.enumerated().map { i, a in
+                    e >= 0 ? a << (e * i) : a << (-e * (n - i))
+                }
+            )
+            for (index, depth, exact) in _positiveRoots(scaled, shift) {
+                // The interval (c, c + 1) · 2^(e - depth)
+                var low = index
+                var high = exact ? index : index + 1
+                var exponent = depth - e
+                if exponent < 0 {
+                    low = low << -exponent
+                    high = high << -exponent
+                    exponent = 0
+                }
+                if negative {
+                    (low, high) = (-high, -low)
+                }
+                let root = GMPRealRoot(p, low, high, exponent: exponent)
+                roots.append(exact ? root : root._separated())
+            }
+        }
+        return roots.sorted { $0.lower < $1.lower }
+    }
+
+    private init(
+        _ polynomial: [GMPInteger],
+        _ lower: GMPInteger,
+        _ upper: GMPInteger,
+        exponent: Int,
+        steps: Int = 4
+    ) {
+        // Drop common factors of two from the endpoints
+        var shift = exponent
+        for endpoint in [lower, upper] {
+            if let bit = endpoint.firstSetBit {
+                shift = Swift.min(shift, bit)
+            }
+        }
+        _polynomial = polynomial
+        _lower = lower >> shift
+        _upper = upper >> shift
+        _exponent = exponent - shift
+        _steps = steps
+    }
+
+    /// The root with endpoints that are not roots of the polynomial.
+    ///
+    /// An endpoint can be an exact root found at a bisection midpoint of a
+    /// neighbouring interval, which leaves refinement without the sign on
+    /// that side. As roots are simple, the sign just inside such an
+    /// endpoint is the sign of the derivative there, so the interval is
+    /// bisected by sign until both endpoints have nonzero values.
+    func _separated() -> GMPRealRoot {
+        let p = _polynomial
+        var a = _lower
+        var b = _upper
+        var k = _exponent
+        let lowerSign = Self._value(p, a, k).sign
+        guard lowerSign == 0 || Self._value(p, b, k).sign == 0 else {
+            return self
+        }
+        let derivative = (1 ..< p.count).map { p[$0] * $0 }
+        let leftSign = lowerSign != 0
+            ? lowerSign
+            : Self._value(derivative, a, k).sign
+        repeat {
+            a = a << 1
+            b = b << 1
+            k += 1
+            let middle = (a + b) >> 1
+            let middleSign = Self._value(p, middle, k).sign
+            if middleSign == 0 {
+                return GMPRealRoot(p, middle, middle, exponent: k)
+            }
+            if middleSign == leftSign {
+                a = middle
+            } else {
+                b = middle
+            }
+        } while Self._value(p, a, k).isZero || Self._value(p, b, k).isZero
+        return GMPRealRoot(p, a, b, exponent: k)
+    }
+
+    /// A subdivision node: the polynomial whose roots in `(0, 1)` are those
+    /// of the scaled input in `(index, index + 1) / 2^depth`.
+    private struct _Node {
+        let polynomial: [GMPInteger]
+        let index: GMPInteger
+        let depth: Int
+    }
+
+    /// The roots of `q` in `(0, 1)` as `(index, depth, exact)`: exact roots
+    /// `index / 2^depth` and isolating intervals
+    /// `(index, index + 1) / 2^depth`.
+    private static func _positiveRoots(
+        _ q: [GMPInteger],
+        _ shift: _TaylorShift
+    ) -> [(GMPInteger, Int, Bool)] {
+        var found: [(GMPInteger, Int, Bool)] = []
+        var pending = [_Node(polynomial: q, index: 0, depth: 0)]
+        while !pending.isEmpty {
+            let nodes = pending
+            var outcomes = [([(GMPInteger, Int, Bool)], [_Node])?](
+                repeating: nil,
+                count: nodes.count
+            )
+            outcomes.withUnsafeMutableBufferPointer { buffer in
+                if nodes.count == 1 {
+                    buffer[0] = _subdivide(nodes[0], shift)
+                } else {
+                    DispatchQueue.concurrentPerform(
+                        iterations: nodes.count
+                    ) { i in
+                        buffer[i] = _subdivide(nodes[i], shift)
+                    }
+                }
+            }
+            pending = []
+            for outcome in outcomes {
+                found += outcome!.0
+                pending += outcome!.1
+            }
+        }
+        return found
+    }
+
+    /// Count the roots of a node and bisect it if there may be several.
+    private static func _subdivide(
+        _ node: _Node,
+        _ shift: _TaylorShift
+    ) -> ([(GMPInteger, Int, Bool)], [_Node]) {
+        let q = node.polynomial
+        let variations = _signVariations(shift.shifted(q.reversed()))
+        if variations == 0 {
+            return ([], [])
+        }
+        if variations == 1 {
+            return ([(node.index, node.depth, false)], [])
+        }
+        // 2ⁿ q(x/2) on the left half, and its shift by 1 on the right
+        let n = q.count - 1
+        let left = _removingTwos(
+            q.enumerated().map { i, a in a << (n - i) }
+        )
+        var right = shift.shifted(left)
+        let depth = node.depth + 1
+        let middle = node.index * 2 + 1
+        var found: [(GMPInteger, Int, Bool)] = []
+        if right[0].isZero {
+            found.append((middle, depth, true))
+            right.removeFirst()
+        }
+        var children = [
+            _Node(polynomial: left, index: node.index * 2, depth: depth),
+        ]
+        if right.count > 1 {
+            children.append(
+                _Node(polynomial: right, index: middle, depth: depth)
+            )
+        }
+        return (found, children)
+    }
+
+    /// The number of sign changes, ignoring zeros.
+    private static func _signVariations(_ a: [GMPInteger]) -> Int {
+        var count = 0
+        var last = 0
+        for c in a {
+            let sign = c.sign
+            if sign != 0 {
+                if last != 0, sign != last {
+                    count += 1
+                }
+                last = sign
+            }
+        }
+        return count
+    }
+
+    /// An exponent `e` with every root of `q` below `2^e` in magnitude,
+    /// from Fujiwara's bound `2 max |aᵢ/aₙ|^(1/(n-i))`.
+    private static func _rootBoundExponent(_ q: [GMPInteger]) -> Int {
+        let n = q.count - 1
+        let leading = q[n].bitCount
+        var e = Int.min
+        for i in 0 ..< n where !q[i].isZero {
+            // |aᵢ/aₙ| < 2^bits
+            let bits = q[i].bitCount - leading + 1
+            let degree = n - i
+            let root = bits >= 0
+                ? (bits + degree - 1) / degree
+                : -(-bits / degree)
+            e = Swift.max(e, root)
+        }
+        return e == Int.min ? 0 : e + 2
+    }
+
+    // MARK: - Refinement
+
+    /// The root in an interval at most `2^-bits` wide.
+    ///
+    /// Each step of quadratic interval refinement splits the interval into
+    /// `N` parts, guesses the part holding the root from the secant through
+    /// the endpoints and checks it with two sign evaluations. A correct
+    /// guess squares `N`, so the width shrinks quadratically near the
+    /// root; a wrong one falls back to `√N` and bisects.
+    public func refined(bits: Int) -> GMPRealRoot {
+        guard !isExact else {
+            return self
+        }
+        let p = _polynomial
+        var a = _lower
+        var b = _upper
+        var k = _exponent
+        var n = _steps
+        let leftSign = Self._value(p, a, k).sign
+        var root = self
+        while !root._isNarrow(bits: bits) {
+            if n >= 4 {
+                let logN = n.trailingZeroBitCount
+                let va = Self._value(p, a, k)
+                let vb = Self._value(p, b, k)
+                // m = round(N·va / (va - vb)), the secant's part
+                let numerator = va * n
+                let denominator = va - vb
+                var m = try! (numerator * 2 + denominator)
+                    .floorDivided(by: denominator * 2)
+                if m.isNegative {
+                    m = 0
+                } else if m > GMPInteger(n) {
+                    m = GMPInteger(n)
+                }
+                let step = b - a
+                let x = (a << logN) + m * step
+                let scaled = k + logN
+                let xSign = Self._value(p, x, scaled).sign
+                if xSign == 0 {
+                    return GMPRealRoot(p, x, x, exponent: scaled)
+                }
+                let other = xSign == leftSign ? x + step : x - step
+                let otherSign = Self._value(p, other, scaled).sign
+                if otherSign == 0 {
+                    return GMPRealRoot(p, other, other, exponent: scaled)
+                }
+                if otherSign != xSign {
+                    // Square N, keeping it a machine integer
+                    n = logN < 32 ? n * n : n
+                    root = GMPRealRoot(
+                        p,
+                        Swift.min(x, other),
+                        Swift.max(x, other),
+                        exponent: scaled,
+                        steps: n
+                    )
+                    (a, b, k) = (root._lower, root._upper, root._exponent)
+                    continue
+                }
+                n = 1 << (logN / 2)
+            } else {
+                n = 4
+            }
+            // Bisect
+            let middle = a + b
+            let middleSign = Self._value(p, middle, k + 1).sign
+            if middleSign == 0 {
+                return GMPRealRoot(p, middle, middle, exponent: k + 1)
+            }
+            let (low, high) = middleSign == leftSign
+                ? (middle, b << 1)
+                : (a << 1, middle)
+            root = GMPRealRoot(p, low, high, exponent: k + 1, steps: n)
+            (a, b, k) = (root._lower, root._upper, root._exponent)
+        }
+        return root
+    }
+
+    /// `2^(kn) p(u / 2^k)`, which has the sign of `p(u / 2^k)`.
+    static func _value(
+        _ p: [GMPInteger],
+        _ u: GMPInteger,
+        _ k: Int
+    ) -> GMPInteger {
+        let n = p.count - 1
+        var h = p[n]
+        for i in stride(from: n - 1, through: 0, by: -1) {
+            h = h * u + (p[i] << (k * (n - i)))
+        }
+        return h
+    }
+
+    // MARK: - Square-Free Part
+
+    /// The polynomial without trailing zero coefficients.
+    static func _trimmed(_ a: [GMPInteger]) -> [GMPInteger] {
+        var a = a
+        while a.last?.isZero == true {
+            a.removeLast()
+        }
+        return a
+    }
+
+    /// The polynomial divided by the largest power of two dividing every
+    /// coefficient, which leaves its roots unchanged.
+    static func _removingTwos(_ a: [GMPInteger]) -> [GMPInteger] {
+        let shift = a.compactMap(\.firstSetBit).min() ?? 0
+        return shift == 0 ? a : a.map { $0 >> shift }
+    }
+
+    /// The polynomial divided by the gcd of its coefficients, with a
+    /// positive leading coefficient.
+    static func _primitive(_ a: [GMPInteger]) -> [GMPInteger] {
+        var content = GMPInteger(0)
+        for c in a where !c.isZero {
+            content = GMPInteger.gcd(content, c)
+            if content == 1 {
+                break
+            }
+        }
+        if a.last?.isNegative == true {
+            content = -content
+        }
+        return content == 1 ? a : a.map { try! $0.exactlyDivided(by: content) }
+    }
+
+    /// The square-free part `p / gcd(p, p')`, primitive.
+    static func _squareFree(_ p: [GMPInteger]) -> [GMPInteger] {
+        let p = _primitive(p)
+        guard p.count > 2 else {
+            return p
+        }
+        let derivative = (1 ..< p.count).map { p[$0] * $0 }
+        let g = _gcd(p, derivative)
+        guard g.count > 1 else {
+            return p
+        }
+        return _primitive(_exactQuotient(p, g)!)
+    }
+
+    /// The primitive gcd of two primitive polynomials, by the heuristic
+    /// gcd: the integer gcd of their values at a large `ξ`, read back as
+    /// balanced base-`ξ` digits, is the gcd if it divides both.
+    static func _gcd(_ a: [GMPInteger], _ b: [GMPInteger]) -> [GMPInteger] {
+        let norm = Swift.min(
+            a.map { $0.absoluteValue() }.max()!,
+            b.map { $0.absoluteValue() }.max()!
+        )
+        var xi = norm * 2 + 29
+        for _ in 0 ..< 6 {
+            let h = GMPInteger.gcd(_evaluated(a, at: xi), _evaluated(b, at: xi))
+            let candidate = _primitive(_balancedDigits(h, base: xi))
+            if _exactQuotient(a, candidate) != nil,
+               _exactQuotient(b, candidate) != nil
+            {
+                return candidate
+            }
+            xi = try! (xi * 73794).floorDivided(by: 27011)
+        }
+        return _remainderSequenceGCD(a, b)
+    }
+
+    /// The primitive gcd by the primitive pseudo-remainder sequence.
+    private static func _remainderSequenceGCD(
+        _ a: [GMPInteger],
+        _ b: [GMPInteger]
+    ) -> [GMPInteger] {
+        var (f, g) = a.count >= b.count ? (a, b) : (b, a)
+        while !g.isEmpty {
+            let r = _pseudoRemainder(f, g)
+            f = g
+            g = r.isEmpty ? [] : _primitive(r)
+        }
+        return _primitive(f)
+    }
+
+    /// `lc(g)^(deg f - deg g + 1) f mod g`, up to a constant factor.
+    private static func _pseudoRemainder(
+        _ f: [GMPInteger],
+        _ g: [GMPInteger]
+    ) -> [GMPInteger] {
+        var r = f
+        let d = g.count - 1
+        let lead = g[d]
+        while r.count > d {
+            let c = r[r.count - 1]
+            let offset = r.count - 1 - d
+            r = r.map { $0 * lead }
+            for j in 0 ... d {
+                r[offset + j].subtractProduct(c, g[j])
+            }
+            r = _trimmed(r)
+        }
+        return r
+    }
+
+    /// `a / b` if `b` divides `a` over the integers.
+    static func _exactQuotient(
+        _ a: [GMPInteger],
+        _ b: [GMPInteger]
+    ) -> [GMPInteger]? {
+        let d = b.count - 1
+        guard a.count > d else {
+            return a.isEmpty ? [] : nil
+        }
+        var r = a
+        var q = [GMPInteger](repeating: 0, count: a.count - d)
+        for k in stride(from: a.count - 1 - d, through: 0, by: -1) {
+            let c = r[k + d]
+            guard !c.isZero else {
+                continue
+            }
+            guard c.isDivisible(by: b[d]) else {
+                return nil
+            }
+            q[k] = try! c.exactlyDivided(by: b[d])
+            for j in 0 ... d {
+                r[k + j].subtractProduct(q[k], b[j])
+            }
+        }
+        return r.allSatisfy(\.isZero) ? q : nil
+    }
+
+    /// `a(x)` by Horner's rule.
+    private static func _evaluated(
+        _ a: [GMPInteger],
+        at x: GMPInteger
+    ) -> GMPInteger {
+        var h = GMPInteger(0)
+        for c in a.reversed() {
+            h = h * x + c
+        }
+        return h
+    }
+
+    /// The polynomial whose coefficients are the balanced base-`base`
+    /// digits of `h`, constant term first.
+    private static func _balancedDigits(
+        _ h: GMPInteger,
+        base: GMPInteger
+    ) -> [GMPInteger] {
+        var h = h
+        var digits: [GMPInteger] = []
+        let half = try! base.floorDivided(by: 2)
+        while !h.isZero {
+            var digit = try! h.floorRemainder(dividingBy: base)
+            if digit > half {
+                digit = digit - base
+            }
+            digits.append(digit)
+            h = try! (h - digit).exactlyDivided(by: base)
+        }
+        return digits
+    }
+}
+
+// MARK: - Taylor Shift
+
+/// `p(x) ↦ p(x + 1)` for polynomials of up to a fixed size.
+///
+/// Below the tuning threshold the shift is the quadratic scheme of
+/// repeated synthetic division, additions only. Above it, `p = lo + x^m hi`
+/// for the largest power of two `m` below the size, and
+/// `p(x + 1) = lo(x + 1) + (x + 1)^m hi(x + 1)`, with the binomial rows
+/// `(x + 1)^m` computed once and the product by Kronecker substitution.
+final class _TaylorShift: @unchecked Sendable {
+    /// The coefficients of `(x + 1)^(2^j)`.
+    private let rows: [[GMPInteger]]
+
+    init(count: Int) {
+        var rows: [[GMPInteger]] = []
+        var m = 1
+        while m < count {
+            var row = [GMPInteger(1)]
+            for j in 0 ..< m {
+                row.append(try! (row[j] * (m - j)).exactlyDivided(by: j + 1))
+            }
+            rows.append(row)
+            m *= 2
+        }
+        self.rows = rows
+    }
+
+    func shifted(_ a: [GMPInteger]) -> [GMPInteger] {
+        let threshold = Swift.max(
+            2,
+            GMPTuningParameter.realRootTaylorShiftThreshold.value
+        )
+        return _shifted(a, threshold: threshold)
+    }
+
+    private func _shifted(
+        _ a: [GMPInteger],
+        threshold: Int
+    ) -> [GMPInteger] {
+        let n = a.count
+        guard n > threshold else {
+            var b = a
+            for i in 0 ..< Swift.max(n - 1, 0) {
+                for j in stride(from: n - 2, through: i, by: -1) {
+                    b[j] += b[j + 1]
+                }
+            }
+            return b
+        }
+        let j = Int.bitWidth - 1 - (n - 1).leadingZeroBitCount
+        let m = 1 << j
+        var result = _shifted(Array(a[..<m]), threshold: threshold)
+        let high = GMPInteger._kroneckerProduct(
+            rows[j],
+            _shifted(Array(a[m...]), threshold: threshold),
+            count: n
+        )
+        result += [GMPInteger](repeating: 0, count: n - m)
+        for i in 0 ..< n {
+            result[i] += high[i]
+        }
+        return result
+    }
+}
+
+extension GMPCutoverBenchmark {
+    /// Taylor shifts of polynomials with 64-bit coefficients.
+    public static var realRootTaylorShift: GMPCutoverBenchmark {
+        GMPCutoverBenchmark(
+            parameter: .realRootTaylorShiftThreshold,
+            scales: [16, 32, 64, 128, 256, 512]
+        ) { count in
+            let p = (0 ..< count).map {
+                GMPInteger(UInt(
+                    truncatingIfNeeded: UInt64($0) &* 0x9E37_79B9_7F4A_7C15
+                ))
+            }
+            let shift = _TaylorShift(count: count)
+            return (count, { _ = shift.shifted(p) })
+        }
+    }
+}
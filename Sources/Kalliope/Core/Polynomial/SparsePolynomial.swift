@@ -0,0 +1,662 @@
+import Dispatch
+import Foundation
+
+extension GMPTuningParameter {
+    /// The number of term products (terms of one factor times terms of the
+    /// other) from which sparse polynomial multiplication is split across
+    /// cores.
+    public static let sparsePolynomialParallelThreshold = GMPTuningParameter(
+        "SparsePolynomial.parallelThreshold",
+        default: 1 << 16
+    )
+}
+
+/// A multivariate polynomial with `GMPInteger` coefficients, stored sparsely.
+///
+/// Each monomial is packed into one 64-bit word with a field of
+/// `64 / variableCount` bits per exponent, the first variable in the most
+/// significant field. Comparing words then compares monomials in
+/// lexicographic order, and multiplying monomials is one integer addition.
+/// The top bit of each field is kept clear as a guard, so exponent overflow
+/// and monomial divisibility are single mask tests.
+///
+/// Terms are kept sorted by decreasing monomial with nonzero coefficients.
+/// Products and quotients follow Monagan and Pearce's heap algorithms: the
+/// term products are merged in order from a heap with one entry per term
+/// of the shorter factor, so like terms meet consecutively and are combined
+/// into one running coefficient with `addProduct`, with no hashing and no
+/// intermediate product terms. Large products are split across cores by
+/// partitioning the output monomial range, each core merging the term
+/// products that fall into its slice.
+///
+/// ```swift
+/// let x = SparsePolynomial(variable: 0, of: 2)
+/// let y = SparsePolynomial(variable: 1, of: 2)
+/// let f = (x + y) * (x - y)  // x² - y²
+/// let (q, r) = f.quotientAndRemainder(dividingBy: x - y)  // x + y, 0
+/// ```
+public struct SparsePolynomial: Equatable {
+    /// The number of variables.
+    public let variableCount: Int
+
+    /// The packed monomials, decreasing.
+    var _monomials: [UInt64]
+
+    /// The coefficients, nonzero, parallel to `_monomials`.
+    var _coefficients: [GMPInteger]
+
+    /// The minimum number of term products before multiplication is split
+    /// across cores.
+    ///
+    /// Tuned by `GMPTuningParameter.sparsePolynomialParallelThreshold`.
+    public static var parallelThreshold: Int {
+        GMPTuningParameter.sparsePolynomialParallelThreshold.value
+    }
+
+    // MARK: - Initialization
+
+    /// Create a polynomial from its terms, combining like terms.
+    ///
+    /// - Parameters:
+    ///   - variableCount: The number of variables, from 1 to 32.
+    ///   - terms: Exponent vectors of `variableCount` entries with their
+    ///     coefficients, in any order.
+    ///
+    /// - Requires: Every exponent must be between 0 and `maxExponent` for
+    ///   `variableCount` variables.
+    public init(
+        variableCount: Int,
+        terms: [(exponents: [Int], coefficient: GMPInteger)]
+    ) {
+        precondition(
+            variableCount >= 1 && variableCount <= 32,
+            "variableCount must be between 1 and 32"
+        )
+        self.variableCount = variableCount
+        let packed = terms.map {
+            (Self._pack($0.exponents, variableCount), $0.coefficient)
+        }.sorted { $0.0 > $1.0 }
+        _monomials = []
+        _coefficients = []
+        for (monomial, coefficient) in packed {
+            if _monomials.last == monomial {
+                _coefficients[_coefficients.count - 1] += coefficient
+            } else {
+                _monomials.append(monomial)
+                _coefficients.append(coefficient)
+            }
+        }
+        _removeZeros()
+    }
+
+    /// Create a constant polynomial.
+    public init(constant: GMPInteger, variableCount: Int) {
+        self.init(
+            variableCount: variableCount,
+            terms: [([Int](repeating: 0, count: variableCount), constant)]
+        )
+    }
+
+    /// Create the polynomial equal to one variable.
+    ///
+    /// - Parameters:
+    ///   - index: The variable, from 0 to `variableCount - 1`.
+    ///   - variableCount: The number of variables.
+    public init(variable index: Int, of variableCount: Int) {
+        precondition(
+            index >= 0 && index < variableCount,
+            "variable index out of range"
+        )
+        var exponents = [Int](repeating: 0, count: variableCount)
+        exponents[index] = 1
+        self.init(variableCount: variableCount, terms: [(exponents, 1)])
+    }
+
+    /// A polynomial from packed terms already in order.
+    init(
+        variableCount: Int,
+        monomials: [UInt64],
+        coefficients: [GMPInteger]
+    ) {
+        self.variableCount = variableCount
+        _monomials = monomials
+        _coefficients = coefficients
+    }
+
+    private mutating func _removeZeros() {
+        guard _coefficients.contains(where: \.isZero) else {
+            return
+        }
+        let kept = _coefficients.indices.filter { !_coefficients[$0].isZero }
+        _monomials = kept.map { _monomials[$0] }
+        _coefficients = kept.map { _coefficients[$0] }
+    }
+
+    // MARK: - Monomial Packing
+
+    /// The width of each exponent field, in bits.
+    static func _fieldWidth(_ variableCount: Int) -> Int {
+        64 / variableCount
+    }
+
+    /// The largest exponent a polynomial in `variableCount` variables can
+    /// hold, one less than half the field range.
+    public static func maxExponent(variableCount: Int) -> Int {
+        Int((UInt64(1) << (_fieldWidth(variableCount) - 1)) - 1)
+    }
+
+    /// The guard bits, the top bit of every field.
+    static func _guardMask(_ variableCount: Int) -> UInt64 {
+        let width = _fieldWidth(variableCount)
+        var mask: UInt64 = 0
+        for v in 0 ..< variableCount {
+            mask |= UInt64(1) << (_shift(v, variableCount) + width - 1)
+        }
+        return mask
+    }
+
+    /// The position of variable `v`'s field.
+    static func _shift(_ v: Int, _ variableCount: Int) -> Int {
+        (variableCount - 1 - v) * _fieldWidth(variableCount)
+    }
+
+    static func _pack(_ exponents: [Int], _ variableCount: Int) -> UInt64 {
+        precondition(
+            exponents.count == variableCount,
+            "exponent vector must have variableCount entries"
+        )
+        let limit = maxExponent(variableCount: variableCount)
+        var monomial: UInt64 = 0
+        for (v, e) in exponents.enumerated() {
+            precondition(e >= 0 && e <= limit, "exponent out of range")
+            monomial |= UInt64(e) << _shift(v, variableCount)
+        }
+        return monomial
+    }
+
+    func _unpack(_ monomial: UInt64) -> [Int] {
+        let mask = (UInt64(1) << Self._fieldWidth(variableCount)) &- 1
+        return (0 ..< variableCount).map {
+            Int((monomial >> Self._shift($0, variableCount)) & mask)
+        }
+    }
+
+    // MARK: - Properties
+
+    /// The number of nonzero terms.
+    public var termCount: Int {
+        _monomials.count
+    }
+
+    /// Whether the polynomial is zero.
+    public var isZero: Bool {
+        _monomials.isEmpty
+    }
+
+    /// The terms in decreasing lexicographic order of their monomials.
+    public var terms: [(exponents: [Int], coefficient: GMPInteger)] {
+        zip(_monomials, _coefficients).map { (_unpack($0), $1) }
+    }
+
+    /// The largest exponent of each variable, or zeros for the zero
+    /// polynomial.
+    public var degrees: [Int] {
+        var result = [Int](repeating: 0, count: variableCount)
+        for monomial in _monomials {
+            for (v, e) in _unpack(monomial).enumerated() {
+                result[v] = Swift.max(result[v], e)
+            }
+        }
+        return result
+    }
+
+    /// The value at a point.
+    ///
+    /// - Parameter point: One value per variable.
+    public func evaluated(at point: [GMPInteger]) -> GMPInteger {
+        precondition(
+            point.count == variableCount,
+            "point must have variableCount coordinates"
+        )
+        var result = GMPInteger(0)
+        for (exponents, coefficient) in terms {
+            var term = coefficient
+            for (v, e) in exponents.enumerated() where e > 0 {
+                term = term * point[v].raisedToPower(e)
+            }
+            result += term
+        }
+        return result
+    }
+
+    // MARK: - Addition
+
+    /// The sum, merging the two sorted term lists.
+    public static func + (
+        lhs: SparsePolynomial,
+        rhs: SparsePolynomial
+    ) -> SparsePolynomial {
+        precondition(
+            lhs.variableCount == rhs.variableCount,
+            "polynomials must have the same number of variables"
+        )
+        var monomials: [UInt64] = []
+        var coefficients: [GMPInteger] = []
+        monomials.reserveCapacity(lhs.termCount + rhs.termCount)
+        coefficients.reserveCapacity(lhs.termCount + rhs.termCount)
+        var i = 0
+        var j = 0
+        while i < lhs.termCount || j < rhs.termCount {
+            let a = i < lhs.termCount ? lhs._monomials[i] : nil
+            let b = j < rhs.termCount ? rhs._monomials[j] : nil
+            if let a, b == nil || a > b! {
+                monomials.append(a)
+                coefficients.append(lhs._coefficients[i])
+                i += 1
+            } else if let b, a == nil || b > a! {
+                monomials.append(b)
+                coefficients.append(rhs._coefficients[j])
+                j += 1
+            } else {
+                let sum = lhs._coefficients[i] + rhs._coefficients[j]
+                if !sum.isZero {
+                    monomials.append(lhs._monomials[i])
+                    coefficients.append(sum)
+                }
+                i += 1
+                j += 1
+            }
+        }
+        return SparsePolynomial(
+            variableCount: lhs.variableCount,
+            monomials: monomials,
+            coefficients: coefficients
+        )
+    }
+
+    /// The negation.
+    public static prefix func - (value: SparsePolynomial) -> SparsePolynomial {
+        SparsePolynomial(
+            variableCount: value.variableCount,
+            monomials: value._monomials,
+            coefficients: value._coefficients.map { -$0 }
+        )
+    }
+
+    /// The difference.
+    public static func - (
+        lhs: SparsePolynomial,
+        rhs: SparsePolynomial
+    ) -> SparsePolynomial {
+        lhs + -rhs
+    }
+
+    /// The product with an integer.
+    public static func * (
+        lhs: GMPInteger,
+        rhs: SparsePolynomial
+    ) -> SparsePolynomial {
+        guard !lhs.isZero else {
+            return SparsePolynomial(
+                variableCount: rhs.variableCount,
+                monomials: [],
+                coefficients: []
+            )
+        }
+        return SparsePolynomial(
+            variableCount: rhs.variableCount,
+            monomials: rhs._monomials,
+            coefficients: rhs._coefficients.map { lhs * $0 }
+        )
+    }
+
+    // MARK: - Multiplication
+
+    /// The product, by heap merging of the term products.
+    ///
+    /// Once the factors have `parallelThreshold` term products, the output
+    /// monomials are cut into one slice per core at quantiles of a grid of
+    /// sampled products. Since `m ↦ fᵢ·m` preserves the monomial order,
+    /// each term `fᵢ` of the shorter factor contributes a contiguous run of
+    /// the other factor's terms to each slice, found by binary search, and
+    /// each core merges its runs independently. Split products are checked
+    /// by `GMPVerification` when `.polynomialProduct` is an automatic
+    /// category.
+    ///
+    /// - Requires: No exponent of the product exceeds `maxExponent`.
+    public static func * (
+        lhs: SparsePolynomial,
+        rhs: SparsePolynomial
+    ) -> SparsePolynomial {
+        precondition(
+            lhs.variableCount == rhs.variableCount,
+            "polynomials must have the same number of variables"
+        )
+        let n = lhs.variableCount
+        let limit = maxExponent(variableCount: n)
+        precondition(
+            zip(lhs.degrees, rhs.degrees).allSatisfy { $0 <= limit - $1 },
+            "product exponent out of range"
+        )
+        // Rows from the shorter factor keep the heap small
+        let (f, g) = lhs.termCount <= rhs.termCount ? (lhs, rhs) : (rhs, lhs)
+        guard !f.isZero else {
+            return SparsePolynomial(
+                variableCount: n,
+                monomials: [],
+                coefficients: []
+            )
+        }
+        let work = f.termCount * g.termCount
+        let cores = ProcessInfo.processInfo.activeProcessorCount
+        guard work >= parallelThreshold, cores > 1, g.termCount > 1 else {
+            let (monomials, coefficients) = _multiply(
+                f,
+                g,
+                above: nil,
+                atMost: nil
+            )
+            return SparsePolynomial(
+                variableCount: n,
+                monomials: monomials,
+                coefficients: coefficients
+            )
+        }
+        let bounds = _sliceBounds(f, g, count: cores)
+        var slices = [([UInt64], [GMPInteger])?](
+            repeating: nil,
+            count: bounds.count + 1
+        )
+        slices.withUnsafeMutableBufferPointer { buffer in
+            DispatchQueue.concurrentPerform(iterations: buffer.count) { k in
+                buffer[k] = _multiply(
+                    f,
+                    g,
+                    above: k < bounds.count ? bounds[k] : nil,
+                    atMost: k > 0 ? bounds[k - 1] : nil
+                )
+            }
+        }
+        var monomials: [UInt64] = []
+        var coefficients: [GMPInteger] = []
+        for slice in slices {
+            monomials += slice!.0
+            coefficients += slice!.1
+        }
+        let product = SparsePolynomial(
+            variableCount: n,
+            monomials: monomials,
+            coefficients: coefficients
+        )
+        if GMPVerification._isAutomatic(.polynomialProduct) {
+            _ = GMPVerification.verifyPolynomialProduct(product, lhs, rhs)
+        }
+        return product
+    }
+
+    /// Decreasing monomials cutting the product into about `count` slices
+    /// of similar size, from a grid of sampled term products.
+    private static func _sliceBounds(
+        _ f: SparsePolynomial,
+        _ g: SparsePolynomial,
+        count: Int
+    ) -> [UInt64] {
+        let grid = 16
+        var samples: [UInt64] = []
+        for a in 0 ..< grid {
+            for b in 0 ..< grid {
+                samples.append(
+                    f._monomials[a * f.termCount / grid]
+                        + g._monomials[b * g.termCount / grid]
+                )
+            }
+        }
+        samples.sort(by: >)
+        var bounds: [UInt64] = []
+        for k in 1 ..< count {
+            let bound = samples[k * samples.count / count]
+            if bounds.last.map({ bound < $0 }) ?? true {
+                bounds.append(bound)
+            }
+        }
+        return bounds
+    }
+
+    /// The terms of `f·g` with monomials in `(lower, upper]`, an absent
+    /// bound meaning no limit.
+    private static func _multiply(
+        _ f: SparsePolynomial,
+        _ g: SparsePolynomial,
+        above lower: UInt64?,
+        atMost upper: UInt64?
+    ) -> ([UInt64], [GMPInteger]) {
+        // The first column of row i at or below `bound`, or past the end
+        func column(_ i: Int, _ bound: UInt64?) -> Int {
+            guard let bound else {
+                return 0
+            }
+            var low = 0
+            var high = g.termCount
+            while low < high {
+                let middle = (low + high) / 2
+                if f._monomials[i] + g._monomials[middle] <= bound {
+                    high = middle
+                } else {
+                    low = middle + 1
+                }
+            }
+            return low
+        }
+        var heap = _TermHeap()
+        var ends = [Int](repeating: g.termCount, count: f.termCount)
+        for i in 0 ..< f.termCount {
+            let start = column(i, upper)
+            ends[i] = lower.map { _ in column(i, lower) } ?? g.termCount
+            if start < ends[i] {
+                heap.push(f._monomials[i] + g._monomials[start], i, start)
+            }
+        }
+        var monomials: [UInt64] = []
+        var coefficients: [GMPInteger] = []
+        while let monomial = heap.top {
+            var coefficient = GMPInteger(0)
+            while heap.top == monomial {
+                let (i, j) = heap.pop()
+                coefficient.addProduct(f._coefficients[i], g._coefficients[j])
+                if j + 1 < ends[i] {
+                    heap.push(f._monomials[i] + g._monomials[j + 1], i, j + 1)
+                }
+            }
+            if !coefficient.isZero {
+                monomials.append(monomial)
+                coefficients.append(coefficient)
+            }
+        }
+        return (monomials, coefficients)
+    }
+
+    // MARK: - Division
+
+    /// The quotient and remainder by heap division.
+    ///
+    /// Terms are eliminated in decreasing order: each term whose monomial
+    /// is divisible by the divisor's leading monomial and whose coefficient
+    /// is divisible by its leading coefficient becomes a quotient term, and
+    /// every other term goes to the remainder, so `self = q·divisor + r`
+    /// with no remainder term divisible by the leading term. The products
+    /// `qₖ·gⱼ` still to be subtracted wait in a heap with one entry per
+    /// quotient term, as in Monagan and Pearce's division.
+    ///
+    /// - Parameter divisor: A nonzero polynomial in the same variables.
+    /// - Returns: The quotient and the remainder.
+    ///
+    /// - Requires: No exponent of a product `qₖ·gⱼ` exceeds
+    ///   `maxExponent`. Degrees alone do not bound these: a divisor term
+    ///   below the leading one can raise later variables with every
+    ///   quotient term, so each product is checked as it is formed.
+    public func quotientAndRemainder(
+        dividingBy divisor: SparsePolynomial
+    ) -> (quotient: SparsePolynomial, remainder: SparsePolynomial) {
+        precondition(
+            variableCount == divisor.variableCount,
+            "polynomials must have the same number of variables"
+        )
+        precondition(!divisor.isZero, "divisor must not be zero")
+        let guardMask = Self._guardMask(variableCount)
+        let g = divisor
+        // Fields hold at most maxExponent, so a sum of two sets a guard bit
+        // exactly when it overflows
+        func product(_ term: UInt64, _ j: Int) -> UInt64 {
+            let monomial = term + g._monomials[j]
+            precondition(
+                monomial & guardMask == 0,
+                "product exponent out of range"
+            )
+            return monomial
+        }
+        let leadingMonomial = g._monomials[0]
+        let leadingCoefficient = g._coefficients[0]
+        var quotient: ([UInt64], [GMPInteger]) = ([], [])
+        var remainder: ([UInt64], [GMPInteger]) = ([], [])
+        var heap = _TermHeap()
+        var i = 0
+        while true {
+            let next = i < termCount ? _monomials[i] : nil
+            guard let monomial = [next, heap.top].compactMap({ $0 }).max()
+            else {
+                break
+            }
+            var coefficient = GMPInteger(0)
+            if next == monomial {
+                coefficient = _coefficients[i]
+                i += 1
+            }
+            while heap.top == monomial {
+                let (k, j) = heap.pop()
+                coefficient.subtractProduct(
+                    quotient.1[k],
+                    g._coefficients[j]
+                )
+                if j + 1 < g.termCount {
+                    heap.push(product(quotient.0[k], j + 1), k, j + 1)
+                }
+            }
+            guard !coefficient.isZero else {
+                continue
+            }
+            // Each field borrows from its guard bit only if the divisor's
+            // exponent is larger
+            let difference = (monomial | guardMask) - leadingMonomial
+            if difference & guardMask == guardMask,
+               coefficient.isDivisible(by: leadingCoefficient)
+            {
+                let term = difference ^ guardMask
+                quotient.0.append(term)
+                quotient.1.append(
+                    try! coefficient.exactlyDivided(by: leadingCoefficient)
+                )
+                if g.termCount > 1 {
+                    heap.push(product(term, 1), quotient.0.count - 1, 1)
+                }
+            } else {
+                remainder.0.append(monomial)
+                remainder.1.append(coefficient)
+            }
+        }
+        return (
+            SparsePolynomial(
+                variableCount: variableCount,
+                monomials: quotient.0,
+                coefficients: quotient.1
+            ),
+            SparsePolynomial(
+                variableCount: variableCount,
+                monomials: remainder.0,
+                coefficients: remainder.1
+            )
+        )
+    }
+}
+
+// MARK: - Term Heap
+
+/// A binary max-heap of pending term products `(monomial, row, column)`.
+struct _TermHeap {
+    private var monomials: [UInt64] = []
+    private var positions: [(Int, Int)] = []
+
+    /// The largest pending monomial.
+    var top: UInt64? {
+        monomials.first
+    }
+
+    mutating func push(_ monomial: UInt64, _ row: Int, _ column: Int) {
+        monomials.append(monomial)
+        positions.append((row, column))
+        var child = monomials.count - 1
+        while child > 0 {
+            let parent = (child - 1) / 2
+            guard monomials[parent] < monomials[child] else {
+                break
+            }
+            monomials.swapAt(parent, child)
+            positions.swapAt(parent, child)
+            child = parent
+        }
+    }
+
+    /// Remove the largest entry, returning its row and column.
+    mutating func pop() -> (Int, Int) {
+        let result = positions[0]
+        monomials.swapAt(0, monomials.count - 1)
+        positions.swapAt(0, positions.count - 1)
+        monomials.removeLast()
+        positions.removeLast()
+        var parent = 0
+        while true {
+            let left = 2 * parent + 1
+            guard left < monomials.count else {
+                break
+            }
+            let right = left + 1
+            let child = right < monomials.count
+                && monomials[right] > monomials[left] ? right : left
+            guard monomials[child] > monomials[parent] else {
+                break
+            }
+            monomials.swapAt(parent, child)
+            positions.swapAt(parent, child)
+            parent = child
+        }
+        return result
+    }
+}
+
+extension GMPCutoverBenchmark {
+    /// Products of two sparse trivariate polynomials with 64-bit
+    /// coefficients.
+    public static var sparsePolynomialMultiplication: GMPCutoverBenchmark {
+        GMPCutoverBenchmark(
+            parameter: .sparsePolynomialParallelThreshold,
+            scales: [16, 32, 64, 128, 256, 512]
+        ) { terms in
+            func polynomial(_ seed: Int) -> SparsePolynomial {
+                SparsePolynomial(
+                    variableCount: 3,
+                    terms: (0 ..< terms).map { k in
+                        let exponents = [
+                            (k * 7 + seed) % 29,
+                            (k * 11 + seed) % 31,
+                            (k * 13 + seed) % 37,
+                        ]
+                        let coefficient = GMPInteger(k &* 0x9E37_79B9 + seed)
+                        return (exponents, coefficient)
+                    }
+                )
+            }
+            let f = polynomial(1)
+            let g = polynomial(2)
+            return (f.termCount * g.termCount, { _ = f * g })
+        }
+    }
+}
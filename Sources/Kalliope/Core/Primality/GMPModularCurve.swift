@@ -0,0 +1,96 @@
+import CKalliope
+
+/// A short Weierstrass curve `y² = x³ + ax + b` over `Z/nZ`, where `n` is
+/// not known to be prime.
+///
+/// Points are affine, and every operation fails rather than divide by a
+/// non-unit. A result that is returned was therefore computed correctly
+/// modulo every prime factor of `n`, which is what the elliptic curve
+/// primality proof needs.
+struct _GMPModularCurve {
+    typealias Point = (x: GMPInteger, y: GMPInteger)
+
+    let n: GMPInteger
+    let a: GMPInteger
+    let b: GMPInteger
+
+    /// `v mod n`, in `[0, n)`.
+    func reduce(_ v: GMPInteger) -> GMPInteger {
+        let r = v % n
+        return r.isNegative ? r + n : r
+    }
+
+    /// Whether `4a³ + 27b²` is a unit, so the curve is nonsingular modulo
+    /// every prime factor of `n`.
+    var isNonsingular: Bool {
+        let discriminant = reduce(a * a * a * 4 + b * b * 27)
+        return GMPInteger.gcd(discriminant, n) == 1
+    }
+
+    /// Whether the affine point `(x, y)` satisfies the curve equation.
+    func contains(x: GMPInteger, y: GMPInteger) -> Bool {
+        reduce(y * y - x * x * x - a * x - b).isZero
+    }
+
+    /// `2P`, or `nil` if `2y` is not a unit.
+    func double(_ p: Point) -> Point? {
+        guard let d = (p.y * 2).modularInverse(modulo: n) else {
+            return nil
+        }
+        let slope = reduce((p.x * p.x * 3 + a) * d)
+        let x = reduce(slope * slope - p.x * 2)
+        return (x, reduce(slope * (p.x - x) - p.y))
+    }
+
+    /// `P + Q` for `P ≠ ±Q`, or `nil` if `x(Q) - x(P)` is not a unit.
+    func add(_ p: Point, _ q: Point) -> Point? {
+        guard let d = (q.x - p.x).modularInverse(modulo: n) else {
+            return nil
+        }
+        let slope = reduce((q.y - p.y) * d)
+        let x = reduce(slope * slope - p.x - q.x)
+        return (x, reduce(slope * (p.x - x) - p.y))
+    }
+
+    /// `[k]P`, by left-to-right double-and-add, or `nil` if an
+    /// intermediate step fails.
+    ///
+    /// - Requires: `k >= 1`.
+    func multiply(_ p: Point, by k: GMPInteger) -> Point? {
+        precondition(k.sign > 0, "k must be positive")
+        var result = p
+        for i in stride(from: k.bitCount - 2, through: 0, by: -1) {
+            guard let doubled = double(result) else {
+                return nil
+            }
+            result = doubled
+            if k.testBit(i) {
+                guard let sum = add(result, p) else {
+                    return nil
+                }
+                result = sum
+            }
+        }
+        return result
+    }
+
+    /// Whether `P` has order exactly `q` modulo every prime factor of `n`,
+    /// given that `q` is an odd prime.
+    ///
+    /// `Q = [cofactor]P` is computed in affine coordinates, so it is not
+    /// the point at infinity. `[q]Q` is the point at infinity exactly when
+    /// `[q - 1]Q = -Q`, which is also computed in affine coordinates.
+    func hasPrimeOrder(
+        _ p: Point,
+        cofactor: GMPInteger,
+        prime q: GMPInteger
+    ) -> Bool {
+        guard q > 2,
+              let point = multiply(p, by: cofactor),
+              let last = multiply(point, by: q - 1)
+        else {
+            return false
+        }
+        return last.x == point.x && reduce(last.y + point.y).isZero
+    }
+}
@@ -0,0 +1,521 @@
+import CKalliope
+import Dispatch
+import Foundation
+
+/// A proof that an integer is prime, checkable without trusting whoever
+/// produced it.
+///
+/// A certificate is a tree: each step reduces the primality of its number
+/// to the primality of smaller numbers, each with its own certificate,
+/// until every leaf is small enough to check directly. Produce
+/// certificates with `GMPPrimalityProver`, check them with `verify()`, and
+/// store them with `serialized()`.
+///
+/// ```swift
+/// let prover = GMPPrimalityProver()
+/// if let certificate = prover.certificate(for: p) {
+///     let data = certificate.serialized()
+///     // later, elsewhere
+///     let ok = try GMPPrimalityCertificate(serialized: data).verify()
+/// }
+/// ```
+public indirect enum GMPPrimalityCertificate: Hashable {
+    /// A prime below 2⁶⁴, checked by strong-pseudoprime tests to the first
+    /// twelve prime bases, which have no common pseudoprime below
+    /// 3.18 · 10²³.
+    case small(GMPInteger)
+
+    /// A proof from the factored part of `n - 1`.
+    case nMinusOne(GMPNMinusOneProof)
+
+    /// A proof from a point of large prime order on an elliptic curve
+    /// modulo `n`.
+    case ellipticCurve(GMPEllipticCurveProof)
+
+    /// The number this certificate proves prime.
+    public var number: GMPInteger {
+        switch self {
+        case let .small(n):
+            n
+        case let .nMinusOne(proof):
+            proof.number
+        case let .ellipticCurve(proof):
+            proof.number
+        }
+    }
+
+    /// The certificates this one depends on.
+    public var children: [GMPPrimalityCertificate] {
+        switch self {
+        case .small:
+            []
+        case let .nMinusOne(proof):
+            proof.factors.map(\.certificate)
+        case let .ellipticCurve(proof):
+            [proof.certificate]
+        }
+    }
+
+    /// Check the certificate.
+    ///
+    /// Every step is checked independently, on all cores: a step holds
+    /// given only that its children prove the numbers it relies on, so the
+    /// whole tree holds when every step does.
+    ///
+    /// - Returns: `true` if the certificate proves `number` prime.
+    public func verify() -> Bool {
+        var steps: [GMPPrimalityCertificate] = []
+        var pending = [self]
+        while let step = pending.popLast() {
+            steps.append(step)
+            pending.append(contentsOf: step.children)
+        }
+        var results = [Bool](repeating: false, count: steps.count)
+        results.withUnsafeMutableBufferPointer { buffer in
+            DispatchQueue.concurrentPerform(iterations: steps.count) { i in
+                buffer[i] = steps[i]._verifyStep()
+            }
+        }
+        return !results.contains(false)
+    }
+
+    /// Check this step, assuming its children are valid.
+    func _verifyStep() -> Bool {
+        switch self {
+        case let .small(n):
+            n._isSmallPrime
+        case let .nMinusOne(proof):
+            proof._verifyStep()
+        case let .ellipticCurve(proof):
+            proof._verifyStep()
+        }
+    }
+}
+
+// MARK: - n - 1 Proofs
+
+/// A Pocklington or Brillhart–Lehmer–Selfridge proof.
+///
+/// `F`, the product of `prime^exponent` over the factors, divides `n - 1`.
+/// Each factor's witness `a` satisfies `a^(n-1) ≡ 1` and
+/// `gcd(a^((n-1)/prime) - 1, n) = 1`, so every prime factor of `n` is
+/// `1 mod F`. Then `n` is prime if `F² > n` (Pocklington), or if
+/// `F³ >= n` and, writing `n = c₂F² + c₁F + 1`, `c₁² - 4c₂` is not a
+/// square (Brillhart, Lehmer and Selfridge, 1975).
+public struct GMPNMinusOneProof: Hashable {
+    /// A prime factor of `n - 1` used by the proof.
+    public struct Factor: Hashable {
+        /// The prime.
+        public let prime: GMPInteger
+
+        /// The exponent of `prime` in `F`.
+        public let exponent: Int
+
+        /// The base `a` of the Pocklington condition for this prime.
+        public let witness: GMPInteger
+
+        /// The certificate for `prime`.
+        public let certificate: GMPPrimalityCertificate
+
+        public init(
+            prime: GMPInteger,
+            exponent: Int,
+            witness: GMPInteger,
+            certificate: GMPPrimalityCertificate
+        ) {
+            self.prime = prime
+            self.exponent = exponent
+            self.witness = witness
+            self.certificate = certificate
+        }
+    }
+
+    /// The number proven prime.
+    public let number: GMPInteger
+
+    /// The factored part of `number - 1`.
+    public let factors: [Factor]
+
+    public init(number: GMPInteger, factors: [Factor]) {
+        self.number = number
+        self.factors = factors
+    }
+
+    func _verifyStep() -> Bool {
+        let n = number
+        guard n > 214 else {
+            return false
+        }
+        let nMinusOne = n - 1
+        var factored = GMPInteger(1)
+        for factor in factors {
+            guard factor.exponent >= 1, factor.exponent <= n.bitCount,
+                  factor.certificate.number == factor.prime,
+                  factor.witness > 1, factor.witness < nMinusOne
+            else {
+                return false
+            }
+            // One power at a time, so a huge exponent stops at n - 1
+            for _ in 0 ..< factor.exponent {
+                factored = factored * factor.prime
+                guard nMinusOne.isDivisible(by: factored) else {
+                    return false
+                }
+            }
+            let a = factor.witness
+            guard a.raisedToPower(nMinusOne, modulo: n) == 1,
+                  let exponent = try? nMinusOne
+                  .exactlyDivided(by: factor.prime),
+                  GMPInteger.gcd(a.raisedToPower(exponent, modulo: n) - 1, n)
+                  == 1
+            else {
+                return false
+            }
+        }
+        if factored * factored > n {
+            return true
+        }
+        guard factored * factored * factored >= n else {
+            return false
+        }
+        let (c2, c1) = try! (nMinusOne / factored)
+            .truncatedQuotientAndRemainder(dividingBy: factored)
+        let test = c1 * c1 - c2 * 4
+        return test.isNegative || !test.isPerfectSquare
+    }
+}
+
+// MARK: - Elliptic Curve Proofs
+
+/// A Goldwasser–Kilian elliptic curve proof.
+///
+/// For `gcd(n, 6) = 1` and a nonsingular curve `y² = x³ + ax + b` modulo
+/// `n`, the point `P = (x, y)` is on the curve, `prime` divides `order`,
+/// `[order / prime]P` is finite and `[prime]([order / prime]P)` is the
+/// point at infinity. If `prime > (n^(1/4) + 1)²`, then `n` is prime.
+public struct GMPEllipticCurveProof: Hashable {
+    /// The number proven prime.
+    public let number: GMPInteger
+
+    /// The curve coefficient `a`.
+    public let a: GMPInteger
+
+    /// The curve coefficient `b`.
+    public let b: GMPInteger
+
+    /// The x-coordinate of `P`.
+    public let x: GMPInteger
+
+    /// The y-coordinate of `P`.
+    public let y: GMPInteger
+
+    /// The number of points on the curve, if `number` is prime.
+    public let order: GMPInteger
+
+    /// The large prime factor of `order`.
+    public let prime: GMPInteger
+
+    /// The certificate for `prime`.
+    public let certificate: GMPPrimalityCertificate
+
+    public init(
+        number: GMPInteger,
+        a: GMPInteger,
+        b: GMPInteger,
+        x: GMPInteger,
+        y: GMPInteger,
+        order: GMPInteger,
+        prime: GMPInteger,
+        certificate: GMPPrimalityCertificate
+    ) {
+        self.number = number
+        self.a = a
+        self.b = b
+        self.x = x
+        self.y = y
+        self.order = order
+        self.prime = prime
+        self.certificate = certificate
+    }
+
+    /// Whether `q > (n^(1/4) + 1)²`, tested as `(⌊√q⌋ - 1)⁴ > n`.
+    static func _primeIsLargeEnough(
+        _ q: GMPInteger,
+        for n: GMPInteger
+    ) -> Bool {
+        (q.squareRoot - 1).raisedToPower(4) > n
+    }
+
+    func _verifyStep() -> Bool {
+        let n = number
+        guard n > 1,
+              GMPInteger.gcd(n, 6) == 1,
+              certificate.number == prime,
+              Self._primeIsLargeEnough(prime, for: n),
+              order.isDivisible(by: prime),
+              let cofactor = try? order.exactlyDivided(by: prime),
+              cofactor.sign > 0
+        else {
+            return false
+        }
+        let curve = _GMPModularCurve(n: n, a: a, b: b)
+        guard curve.isNonsingular, curve.contains(x: x, y: y) else {
+            return false
+        }
+        return curve.hasPrimeOrder(
+            (x, y),
+            cofactor: cofactor,
+            prime: prime
+        )
+    }
+}
+
+// MARK: - Small Primes
+
+extension GMPInteger {
+    /// The bases for `_isSmallPrime`.
+    static let _smallPrimeBases = [2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37]
+
+    /// Whether this integer is a prime below 2⁶⁴, by deterministic
+    /// Miller–Rabin.
+    var _isSmallPrime: Bool {
+        guard sign > 0, bitCount <= 64, self >= 2 else {
+            return false
+        }
+        for base in Self._smallPrimeBases {
+            if self == GMPInteger(base) {
+                return true
+            }
+            if isDivisible(by: base) {
+                return false
+            }
+        }
+        return Self._smallPrimeBases.allSatisfy {
+            _isStrongProbablePrime(base: GMPInteger($0))
+        }
+    }
+
+    /// Whether this odd integer greater than `base` is a strong probable
+    /// prime to `base`.
+    func _isStrongProbablePrime(base: GMPInteger) -> Bool {
+        let nMinusOne = self - 1
+        let s = nMinusOne.firstSetBit!
+        let d = nMinusOne >> s
+        var x = base.raisedToPower(d, modulo: self)
+        if x == 1 || x == nMinusOne {
+            return true
+        }
+        for _ in 1 ..< Swift.max(s, 1) {
+            x = x.raisedToPower(2, modulo: self)
+            if x == nMinusOne {
+                return true
+            }
+        }
+        return false
+    }
+}
+
+// MARK: - Serialization
+
+/// The binary certificate format.
+///
+/// The format is the 4-byte magic `"KPC1"` followed by the root step. A
+/// step is a tag byte followed by its fields; integers are a LEB128 byte
+/// count and that many little-endian bytes, and child steps follow their
+/// parent in place:
+///
+///     small          1, n
+///     n - 1          2, n, factor count, then per factor:
+///                    prime, exponent, witness, certificate
+///     elliptic curve 3, n, a, b, x, y, order, prime, certificate
+enum _GMPCertificateFormat {
+    static let magic: [UInt8] = Array("KPC1".utf8)
+    static let smallTag: UInt8 = 1
+    static let nMinusOneTag: UInt8 = 2
+    static let ellipticCurveTag: UInt8 = 3
+    /// The deepest nesting `init(serialized:)` accepts, far beyond any
+    /// certificate the prover writes but shallow enough for the stack.
+    static let maxDepth = 1024
+}
+
+extension GMPPrimalityCertificate {
+    /// The certificate in a compact binary form.
+    ///
+    /// - Returns: Bytes that `init(serialized:)` reads back.
+    public func serialized() -> Data {
+        var bytes = _GMPCertificateFormat.magic
+        _write(to: &bytes)
+        return Data(bytes)
+    }
+
+    /// Read a certificate written by `serialized()`.
+    ///
+    /// The certificate is only parsed; call `verify()` to check it.
+    ///
+    /// - Parameter data: The serialized certificate.
+    /// - Throws: `GMPError.invalidCertificate` if the data is malformed or
+    ///   nested more deeply than any real certificate.
+    public init(serialized data: Data) throws {
+        let bytes = [UInt8](data)
+        let magic = _GMPCertificateFormat.magic
+        guard bytes.starts(with: magic) else {
+            throw GMPError.invalidCertificate
+        }
+        var offset = magic.count
+        self = try Self._read(bytes, at: &offset, depth: 0)
+        guard offset == bytes.count else {
+            throw GMPError.invalidCertificate
+        }
+    }
+
+    private func _write(to bytes: inout [UInt8]) {
+        typealias Format = _GMPCertificateFormat
+        switch self {
+        case let .small(n):
+            bytes.append(Format.smallTag)
+            Self._write(n, to: &bytes)
+        case let .nMinusOne(proof):
+            bytes.append(Format.nMinusOneTag)
+            Self._write(proof.number, to: &bytes)
+            Self._writeCount(proof.factors.count, to: &bytes)
+            for factor in proof.factors {
+                Self._write(factor.prime, to: &bytes)
+                Self._writeCount(factor.exponent, to: &bytes)
+                Self._write(factor.witness, to: &bytes)
+                factor.certificate._write(to: &bytes)
+            }
+        case let .ellipticCurve(proof):
+            bytes.append(Format.ellipticCurveTag)
+            for value in [
+                proof.number, proof.a, proof.b, proof.x, proof.y,
+                proof.order, proof.prime,
+            ] {
+                Self._write(value, to: &bytes)
+            }
+            proof.certificate._write(to: &bytes)
+        }
+    }
+
+    private static func _read(
+        _ bytes: [UInt8],
+        at offset: inout Int,
+        depth: Int
+    ) throws -> GMPPrimalityCertificate {
+        typealias Format = _GMPCertificateFormat
+        guard offset < bytes.count, depth < Format.maxDepth else {
+            throw GMPError.invalidCertificate
+        }
+        let tag = bytes[offset]
+        offset += 1
+        switch tag {
+        case Format.smallTag:
+            return try .small(_readInteger(bytes, at: &offset))
+        case Format.nMinusOneTag:
+            let number = try _readInteger(bytes, at: &offset)
+            let count = try _readCount(bytes, at: &offset)
+            var factors: [GMPNMinusOneProof.Factor] = []
+            for _ in 0 ..< count {
+                let prime = try _readInteger(bytes, at: &offset)
+                let exponent = try _readCount(bytes, at: &offset)
+                let witness = try _readInteger(bytes, at: &offset)
+                let certificate = try _read(
+                    bytes,
+                    at: &offset,
+                    depth: depth + 1
+                )
+                factors.append(
+                    GMPNMinusOneProof.Factor(
+                        prime: prime,
+                        exponent: exponent,
+                        witness: witness,
+                        certificate: certificate
+                    )
+                )
+            }
+            return .nMinusOne(
+                GMPNMinusOneProof(number: number, factors: factors)
+            )
+        case Format.ellipticCurveTag:
+            var values: [GMPInteger] = []
+            for _ in 0 ..< 7 {
+                try values.append(_readInteger(bytes, at: &offset))
+            }
+            let certificate = try _read(
+                bytes,
+                at: &offset,
+                depth: depth + 1
+            )
+            return .ellipticCurve(
+                GMPEllipticCurveProof(
+                    number: values[0],
+                    a: values[1],
+                    b: values[2],
+                    x: values[3],
+                    y: values[4],
+                    order: values[5],
+                    prime: values[6],
+                    certificate: certificate
+                )
+            )
+        default:
+            throw GMPError.invalidCertificate
+        }
+    }
+
+    private static func _writeCount(_ count: Int, to bytes: inout [UInt8]) {
+        var value = UInt(count)
+        while value >= 0x80 {
+            bytes.append(UInt8(value & 0x7F) | 0x80)
+            value >>= 7
+        }
+        bytes.append(UInt8(value))
+    }
+
+    private static func _readCount(
+        _ bytes: [UInt8],
+        at offset: inout Int
+    ) throws -> Int {
+        var value = 0
+        var shift = 0
+        while true {
+            guard offset < bytes.count, shift < 63 else {
+                throw GMPError.invalidCertificate
+            }
+            let byte = bytes[offset]
+            offset += 1
+            value |= Int(byte & 0x7F) << shift
+            if byte & 0x80 == 0 {
+                return value
+            }
+            shift += 7
+        }
+    }
+
+    private static func _write(_ value: GMPInteger, to bytes: inout [UInt8]) {
+        // export(size: 1) is a sign byte followed by little-endian bytes;
+        // certificate integers are never negative
+        let exported = value.export(size: 1).dropFirst()
+        _writeCount(exported.count, to: &bytes)
+        bytes.append(contentsOf: exported)
+    }
+
+    private static func _readInteger(
+        _ bytes: [UInt8],
+        at offset: inout Int
+    ) throws -> GMPInteger {
+        let count = try _readCount(bytes, at: &offset)
+        guard count <= bytes.count - offset else {
+            throw GMPError.invalidCertificate
+        }
+        let magnitude = bytes[offset ..< offset + count]
+        offset += count
+        guard count > 0 else {
+            return GMPInteger()
+        }
+        guard let value = GMPInteger(data: Data([0] + magnitude), size: 1)
+        else {
+            throw GMPError.invalidCertificate
+        }
+        return value
+    }
+}
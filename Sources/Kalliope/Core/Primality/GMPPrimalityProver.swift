@@ -0,0 +1,539 @@
+import CKalliope
+import Dispatch
+
+/// Produces `GMPPrimalityCertificate`s.
+///
+/// For each number the prover first tries an `n - 1` proof, which needs the
+/// factored part of `n - 1` to reach `n^(1/3)`. Factors are found by trial
+/// division and Pollard's rho. Otherwise it builds an elliptic curve proof
+/// and recurses on the curve order's large prime factor, shrinking the
+/// number at each step.
+///
+/// The elliptic curve step does not count points. It uses curves whose
+/// order follows from `n` alone: supersingular curves (`n + 1` points when
+/// `n ≡ 2 mod 3` or `n ≡ 3 mod 4`) and curves with complex multiplication
+/// by the nine class-number-one discriminants, whose orders come from
+/// Cornacchia's algorithm. This covers most primes up to several hundred
+/// digits; for a prime none of those orders suits, `certificate(for:)`
+/// returns `nil`.
+///
+/// Work runs in parallel: the prime factors of `n - 1` are certified as
+/// concurrent subproblems, and the candidate curve orders are split
+/// concurrently.
+public struct GMPPrimalityProver {
+    /// The largest prime used for trial division. Defaults to 2¹⁶.
+    public var trialDivisionBound = 1 << 16
+
+    /// The number of Pollard rho steps spent per factor. Defaults to 2¹⁴.
+    public var rhoIterations = 1 << 14
+
+    /// The number of random curves and points tried per candidate curve
+    /// order. Defaults to 64.
+    public var curveAttempts = 64
+
+    /// Create a prover with the default search limits.
+    public init() {}
+
+    /// Find a certificate for `n`.
+    ///
+    /// - Parameter n: The number to prove prime.
+    /// - Returns: A certificate, or `nil` if `n` is not prime or no proof
+    ///   was found within the search limits.
+    public func certificate(for n: GMPInteger) -> GMPPrimalityCertificate? {
+        guard n >= 2 else {
+            return nil
+        }
+        if n.bitCount <= 64 {
+            return n._isSmallPrime ? .small(n) : nil
+        }
+        guard n.isProbablePrime(reps: 25) > 0 else {
+            return nil
+        }
+        if let proof = _nMinusOneProof(for: n) {
+            return .nMinusOne(proof)
+        }
+        return _ellipticCurveProof(for: n).map { .ellipticCurve($0) }
+    }
+
+    // MARK: - n - 1
+
+    func _nMinusOneProof(for n: GMPInteger) -> GMPNMinusOneProof? {
+        // Use the smallest primes that suffice: large ones are costly to
+        // certify
+        let found = _factors(of: n - 1, until: { $0 * $0 * $0 >= n })
+            .sorted { $0.prime < $1.prime }
+        var used: [(prime: GMPInteger, exponent: Int)] = []
+        var factored = GMPInteger(1)
+        for factor in found where factored * factored * factored < n {
+            used.append(factor)
+            factored = factored * factor.prime.raisedToPower(factor.exponent)
+        }
+        guard factored * factored * factored >= n else {
+            return nil
+        }
+
+        var witnesses: [GMPInteger] = []
+        for factor in used {
+            guard let witness = _witness(for: n, prime: factor.prime) else {
+                return nil
+            }
+            witnesses.append(witness)
+        }
+
+        var certificates = [GMPPrimalityCertificate?](
+            repeating: nil,
+            count: used.count
+        )
+        certificates.withUnsafeMutableBufferPointer { buffer in
+            DispatchQueue.concurrentPerform(iterations: used.count) { i in
+                buffer[i] = certificate(for: used[i].prime)
+            }
+        }
+        var factors: [GMPNMinusOneProof.Factor] = []
+        for (i, factor) in used.enumerated() {
+            guard let certificate = certificates[i] else {
+                return nil
+            }
+            factors.append(
+                GMPNMinusOneProof.Factor(
+                    prime: factor.prime,
+                    exponent: factor.exponent,
+                    witness: witnesses[i],
+                    certificate: certificate
+                )
+            )
+        }
+        let proof = GMPNMinusOneProof(number: n, factors: factors)
+        // Fails only if the BLS square test finds n composite
+        return proof._verifyStep() ? proof : nil
+    }
+
+    /// The smallest base satisfying the Pocklington condition for `prime`.
+    private func _witness(
+        for n: GMPInteger,
+        prime: GMPInteger
+    ) -> GMPInteger? {
+        let nMinusOne = n - 1
+        let exponent = try! nMinusOne.exactlyDivided(by: prime)
+        for base in 2 ..< 1000 {
+            let a = GMPInteger(base)
+            guard a.raisedToPower(nMinusOne, modulo: n) == 1 else {
+                return nil
+            }
+            if GMPInteger.gcd(a.raisedToPower(exponent, modulo: n) - 1, n)
+                == 1
+            {
+                return a
+            }
+        }
+        return nil
+    }
+
+    /// Prime factors of `m` with their exponents, found by trial division
+    /// and then Pollard's rho until `isEnough` holds for their product.
+    func _factors(
+        of m: GMPInteger,
+        until isEnough: (GMPInteger) -> Bool
+    ) -> [(prime: GMPInteger, exponent: Int)] {
+        var found: [(prime: GMPInteger, exponent: Int)] = []
+        var remaining = m
+        var product = GMPInteger(1)
+
+        func divideOut(_ prime: GMPInteger) {
+            var exponent = 0
+            while remaining.isDivisible(by: prime) {
+                remaining = try! remaining.exactlyDivided(by: prime)
+                exponent += 1
+            }
+            guard exponent > 0 else {
+                return
+            }
+            found.append((prime, exponent))
+            product = product * prime.raisedToPower(exponent)
+        }
+
+        for p in _GMPSmallPrimes.upTo(trialDivisionBound) {
+            if remaining.isDivisible(by: p) {
+                divideOut(GMPInteger(p))
+            }
+        }
+        var composites: [GMPInteger] = []
+        if remaining > 1 {
+            composites.append(remaining)
+        }
+        while let c = composites.popLast(), !isEnough(product) {
+            if c.isProbablePrime(reps: 25) > 0 {
+                divideOut(c)
+            } else if let d = _rho(c) {
+                composites.append(d)
+                composites.append(try! c.exactlyDivided(by: d))
+            }
+        }
+        return found
+    }
+
+    /// A nontrivial factor of the composite `n`, by Pollard's rho with
+    /// batched GCDs, or `nil` if none is found within `rhoIterations`.
+    func _rho(_ n: GMPInteger) -> GMPInteger? {
+        let batch = 64
+        for c in 1 ... 3 {
+            var x = GMPInteger(2)
+            var y = GMPInteger(2)
+            var product = GMPInteger(1)
+            var saved = (x, y)
+            for i in 1 ... rhoIterations {
+                x = (x * x + c) % n
+                y = (y * y + c) % n
+                y = (y * y + c) % n
+                product = (product * (x - y)) % n
+                guard i % batch == 0 else {
+                    continue
+                }
+                let g = GMPInteger.gcd(product, n)
+                if g == 1 {
+                    saved = (x, y)
+                    continue
+                }
+                if g != n {
+                    return g
+                }
+                // The batch overshot; replay it one step at a time
+                (x, y) = saved
+                for _ in 0 ..< batch {
+                    x = (x * x + c) % n
+                    y = (y * y + c) % n
+                    y = (y * y + c) % n
+                    let g = GMPInteger.gcd(x - y, n)
+                    if g != 1 {
+                        if g != n {
+                            return g
+                        }
+                        break
+                    }
+                }
+                break
+            }
+        }
+        return nil
+    }
+
+    // MARK: - Elliptic Curves
+
+    /// A curve order to try, and how to draw curves with that order.
+    struct _Candidate {
+        let order: GMPInteger
+        let j: _GMPCurveInvariant
+    }
+
+    func _ellipticCurveProof(for n: GMPInteger) -> GMPEllipticCurveProof? {
+        let candidates = _GMPCurveInvariant.candidates(for: n)
+        var primes = [GMPInteger?](repeating: nil, count: candidates.count)
+        primes.withUnsafeMutableBufferPointer { buffer in
+            DispatchQueue.concurrentPerform(iterations: candidates.count) {
+                buffer[$0] = _largePrimeFactor(of: candidates[$0].order, n)
+            }
+        }
+        // Try the smallest primes first: they shrink the problem the most
+        let order = candidates.indices
+            .filter { primes[$0] != nil }
+            .sorted { primes[$0]! < primes[$1]! }
+        for i in order {
+            let candidate = candidates[i]
+            let q = primes[i]!
+            guard let proof = _curveProof(for: n, candidate, prime: q)
+            else {
+                continue
+            }
+            guard let certificate = certificate(for: q) else {
+                continue
+            }
+            return GMPEllipticCurveProof(
+                number: n,
+                a: proof.a,
+                b: proof.b,
+                x: proof.x,
+                y: proof.y,
+                order: candidate.order,
+                prime: q,
+                certificate: certificate
+            )
+        }
+        return nil
+    }
+
+    /// The probable prime left after removing small factors from `order`,
+    /// if it is large enough for an elliptic curve proof of `n`.
+    func _largePrimeFactor(
+        of order: GMPInteger,
+        _ n: GMPInteger
+    ) -> GMPInteger? {
+        var q = order
+        for p in _GMPSmallPrimes.upTo(trialDivisionBound) {
+            while q.isDivisible(by: p) {
+                q = try! q.exactlyDivided(by: p)
+            }
+        }
+        // A prime not below n would not shrink the problem
+        while q < n, GMPEllipticCurveProof._primeIsLargeEnough(q, for: n) {
+            if q.isProbablePrime(reps: 25) > 0 {
+                return q
+            }
+            guard let d = _rho(q) else {
+                return nil
+            }
+            // Keep the larger part, which may still be prime
+            let other = try! q.exactlyDivided(by: d)
+            q = d > other ? d : other
+        }
+        return nil
+    }
+
+    /// A curve with the candidate's invariant and a point of order `q`.
+    private func _curveProof(
+        for n: GMPInteger,
+        _ candidate: _Candidate,
+        prime q: GMPInteger
+    ) -> (a: GMPInteger, b: GMPInteger, x: GMPInteger, y: GMPInteger)? {
+        let cofactor = try! candidate.order.exactlyDivided(by: q)
+        let state = GMPRandomState(mersenneTwister: candidate.order)
+        for _ in 0 ..< curveAttempts {
+            guard let curve = candidate.j.randomCurve(modulo: n, using: state)
+            else {
+                continue
+            }
+            let modular = _GMPModularCurve(n: n, a: curve.a, b: curve.b)
+            guard modular.isNonsingular,
+                  modular.hasPrimeOrder(
+                      (curve.x, curve.y),
+                      cofactor: cofactor,
+                      prime: q
+                  )
+            else {
+                continue
+            }
+            return curve
+        }
+        return nil
+    }
+}
+
+// MARK: - CM Curves
+
+/// The j-invariant of a family of curves with known orders.
+enum _GMPCurveInvariant {
+    /// `y² = x³ + b`: complex multiplication by `Z[ω]`, or supersingular
+    /// when `n ≡ 2 mod 3`.
+    case zero
+
+    /// `y² = x³ + ax`: complex multiplication by `Z[i]`, or supersingular
+    /// when `n ≡ 3 mod 4`.
+    case j1728
+
+    /// Another class-number-one j-invariant.
+    case other(Int)
+
+    /// `(|D|, j)` for the discriminants of class number one beyond -3 and
+    /// -4.
+    static let discriminants: [(d: Int, j: Int)] = [
+        (7, -3375), (8, 8000), (11, -32768), (19, -884_736),
+        (43, -884_736_000), (67, -147_197_952_000),
+        (163, -262_537_412_640_768_000),
+    ]
+
+    /// Curve orders and families for `n`, assuming `n` is prime.
+    static func candidates(
+        for n: GMPInteger
+    ) -> [GMPPrimalityProver._Candidate] {
+        typealias Candidate = GMPPrimalityProver._Candidate
+        var result: [Candidate] = []
+        let np1 = n + 1
+        func add(_ j: _GMPCurveInvariant, _ traces: [GMPInteger]) {
+            for t in traces where !t.isZero {
+                result.append(Candidate(order: np1 - t, j: j))
+                result.append(Candidate(order: np1 + t, j: j))
+            }
+        }
+        if (try? n.modulo(3)) == 2 {
+            result.append(Candidate(order: np1, j: .zero))
+        }
+        if (try? n.modulo(4)) == 3 {
+            result.append(Candidate(order: np1, j: .j1728))
+        }
+        if let r = _cornacchia(n, 3) {
+            add(.zero, [r.t, (r.t + r.v * 3) / 2, (r.t - r.v * 3) / 2])
+        }
+        if let r = _cornacchia(n, 4) {
+            add(.j1728, [r.t, r.v * 2])
+        }
+        for (d, j) in discriminants {
+            if let r = _cornacchia(n, d) {
+                add(.other(j), [r.t])
+            }
+        }
+        return result
+    }
+
+    /// A random curve in this family with a point on it, without square
+    /// roots: the point is chosen first and the curve fitted to it.
+    func randomCurve(
+        modulo n: GMPInteger,
+        using state: GMPRandomState
+    ) -> (a: GMPInteger, b: GMPInteger, x: GMPInteger, y: GMPInteger)? {
+        let curve = _GMPModularCurve(n: n, a: 0, b: 0)
+        let x = GMPInteger.random(upperBound: n, using: state)
+        let y = GMPInteger.random(upperBound: n, using: state)
+        switch self {
+        case .zero:
+            let b = curve.reduce(y * y - x * x * x)
+            return b.isZero ? nil : (GMPInteger(0), b, x, y)
+        case .j1728:
+            guard let inverse = x.modularInverse(modulo: n) else {
+                return nil
+            }
+            let a = curve.reduce((y * y - x * x * x) * inverse)
+            return a.isZero ? nil : (a, GMPInteger(0), x, y)
+        case let .other(j):
+            // j = 1728 · 4A³ / (4A³ + 27B²) for these A and B. The
+            // quadratic twist by r = x³ + Ax + B carries (x, 1) on
+            // r·y² = x³ + Ax + B to (rx, r²) on y² = x³ + Ar²x + Br³,
+            // so either twist turns up at random.
+            let j = GMPInteger(j)
+            let k = GMPInteger(1728) - j
+            let a = curve.reduce(j * k * 3)
+            let b = curve.reduce(j * k * k * 2)
+            let r = curve.reduce(x * x * x + a * x + b)
+            guard !r.isZero else {
+                return nil
+            }
+            let r2 = curve.reduce(r * r)
+            return (
+                curve.reduce(a * r2),
+                curve.reduce(b * r2 * r),
+                curve.reduce(r * x),
+                r2
+            )
+        }
+    }
+
+    /// `(t, v)` with `t² + d·v² = 4n`, by the modified Cornacchia
+    /// algorithm, assuming `n` is an odd prime.
+    static func _cornacchia(
+        _ n: GMPInteger,
+        _ d: Int
+    ) -> (t: GMPInteger, v: GMPInteger)? {
+        guard GMPInteger.kroneckerSymbol(-d, n) == 1,
+              var b = _squareRoot(GMPInteger(-d), modulo: n)
+        else {
+            return nil
+        }
+        if b.isOdd != (d % 2 == 1) {
+            b = n - b
+        }
+        let fourN = n * 4
+        var a = n * 2
+        let limit = fourN.squareRoot
+        while b > limit {
+            (a, b) = (b, a % b)
+        }
+        let c = fourN - b * b
+        guard c.isDivisible(by: d) else {
+            return nil
+        }
+        let v2 = try! c.exactlyDivided(by: GMPInteger(d))
+        guard v2.isPerfectSquare else {
+            return nil
+        }
+        return (b, v2.squareRoot)
+    }
+
+    /// A square root of `a` modulo the odd prime `p`, by Tonelli–Shanks.
+    static func _squareRoot(
+        _ a: GMPInteger,
+        modulo p: GMPInteger
+    ) -> GMPInteger? {
+        let curve = _GMPModularCurve(n: p, a: 0, b: 0)
+        let a = curve.reduce(a)
+        guard !a.isZero else {
+            return a
+        }
+        guard GMPInteger.jacobiSymbol(a, p) == 1 else {
+            return nil
+        }
+        let pMinusOne = p - 1
+        let s = pMinusOne.firstSetBit!
+        let q = pMinusOne >> s
+        var z = GMPInteger(2)
+        while GMPInteger.jacobiSymbol(z, p) != -1 {
+            z = z + 1
+        }
+        var m = s
+        var c = z.raisedToPower(q, modulo: p)
+        var t = a.raisedToPower(q, modulo: p)
+        var r = a.raisedToPower((q + 1) >> 1, modulo: p)
+        while t != 1 {
+            var i = 0
+            var power = t
+            while power != 1 {
+                power = power.raisedToPower(2, modulo: p)
+                i += 1
+                if i == m {
+                    return nil
+                }
+            }
+            let b = c.raisedToPower(
+                GMPInteger(1) << (m - i - 1),
+                modulo: p
+            )
+            m = i
+            c = b.raisedToPower(2, modulo: p)
+            t = curve.reduce(t * c)
+            r = curve.reduce(r * b)
+        }
+        return curve.reduce(r * r) == a ? r : nil
+    }
+}
+
+// MARK: - Small Primes
+
+/// The primes used for trial division, sieved once.
+enum _GMPSmallPrimes {
+    static let _primes: [Int] = {
+        let limit = 1 << 20
+        var composite = [Bool](repeating: false, count: limit + 1)
+        var primes: [Int] = []
+        for i in 2 ... limit where !composite[i] {
+            primes.append(i)
+            for j in stride(from: i * i, through: limit, by: i) {
+                composite[j] = true
+            }
+        }
+        return primes
+    }()
+
+    /// The primes up to `bound`, capped at 2²⁰.
+    static func upTo(_ bound: Int) -> ArraySlice<Int> {
+        let primes = _primes
+        var low = 0
+        var high = primes.count
+        while low < high {
+            let mid = (low + high) / 2
+            if primes[mid] <= bound {
+                low = mid + 1
+            } else {
+                high = mid
+            }
+        }
+        return primes[..<low]
+    }
+}
+
+extension GMPInteger {
+    /// A certificate proving this integer prime, from a default
+    /// `GMPPrimalityProver`.
+    ///
+    /// - Returns: The certificate, or `nil` if this integer is not prime or
+    ///   no proof was found.
+    public func primalityCertificate() -> GMPPrimalityCertificate? {
+        GMPPrimalityProver().certificate(for: self)
+    }
+}
@@ -515,4 +515,26 @@ public struct GMPRandomState {
             }
         }
     }
+
+    // MARK: - Pointer Access
+
+    /// Execute a closure with a mutable pointer to the underlying
+    /// `gmp_randstate_t`.
+    ///
+    /// This lets other libraries built on GMP (such as MPFR) draw from this
+    /// state. Like the `random(...using:)` functions, drawing through the
+    /// pointer advances the state in place, and the advance is visible to
+    /// every copy sharing this storage.
+    ///
+    /// - Parameter body: A closure that receives the pointer and returns a
+    ///   value. The pointer must not escape the closure.
+    /// - Returns: The value returned by the closure.
+    public func withMutableCPointer<T>(
+        _ body: (UnsafeMutablePointer<gmp_randstate_t>) throws -> T
+    ) rethrows -> T {
+        let storage = _storage
+        return try withUnsafeMutablePointer(to: &storage.value) { ptr in
+            try body(ptr)
+        }
+    }
 }
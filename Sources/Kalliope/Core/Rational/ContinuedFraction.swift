@@ -0,0 +1,402 @@
+import CKalliope
+
+extension GMPTuningParameter {
+    /// The operand size, in bits, above which continued fraction expansion
+    /// switches from Euclidean division to the recursive half-GCD.
+    public static let continuedFractionHalfGCDThreshold = GMPTuningParameter(
+        "ContinuedFraction.halfGCDThreshold",
+        default: 2048
+    )
+}
+
+/// The regular continued fraction `[a0; a1, a2, ...]` of an exact rational
+/// value.
+///
+/// Iterating yields the partial quotients. They are computed lazily, in
+/// blocks: each block runs a recursive half-GCD on the leading bits of the
+/// current remainders, so expanding an `n`-bit value costs
+/// `O(M(n) log n)` rather than the `O(n²)` of repeated division. Blocks
+/// start small and double, so consumers that stop early, such as
+/// `bestApproximation(maxDenominator:)`, only pay for the quotients they
+/// read.
+///
+/// ```swift
+/// let cf = try ContinuedFraction(numerator: 355, denominator: 113)
+/// Array(cf)                                   // [3, 7, 16]
+/// cf.bestApproximation(maxDenominator: 100)   // 311/99
+/// ```
+public struct ContinuedFraction: Sequence {
+    /// The numerator of the value, not necessarily reduced.
+    let _numerator: GMPInteger
+
+    /// The denominator of the value. Always positive.
+    let _denominator: GMPInteger
+
+    /// Create the continued fraction of a rational.
+    ///
+    /// - Parameter value: The value.
+    public init(_ value: GMPRational) {
+        _numerator = value.numerator
+        _denominator = value.denominator
+    }
+
+    /// Create the continued fraction of `numerator / denominator`.
+    ///
+    /// The fraction need not be in lowest terms; no GCD is computed.
+    ///
+    /// - Parameters:
+    ///   - numerator: The numerator.
+    ///   - denominator: The denominator.
+    /// - Throws: `GMPError.divisionByZero` if `denominator` is zero.
+    public init(numerator: GMPInteger, denominator: GMPInteger) throws {
+        guard !denominator.isZero else {
+            throw GMPError.divisionByZero
+        }
+        if denominator.isNegative {
+            _numerator = -numerator
+            _denominator = -denominator
+        } else {
+            _numerator = numerator
+            _denominator = denominator
+        }
+    }
+
+    /// Create the continued fraction of `mantissa · 2^exponent`.
+    ///
+    /// This is the exact value of a binary floating-point number. Common
+    /// factors of 2 are removed by shifting; no rational is built.
+    ///
+    /// - Parameters:
+    ///   - mantissa: The integer mantissa.
+    ///   - exponent: The binary exponent.
+    public init(mantissa: GMPInteger, exponent: Int) {
+        if mantissa.isZero {
+            _numerator = mantissa
+            _denominator = GMPInteger(1)
+        } else if exponent >= 0 {
+            _numerator = mantissa << exponent
+            _denominator = GMPInteger(1)
+        } else {
+            let shift = Swift.min(mantissa.firstSetBit!, -exponent)
+            _numerator = mantissa >> shift
+            _denominator = GMPInteger(1) << (-exponent - shift)
+        }
+    }
+
+    public func makeIterator() -> Iterator {
+        Iterator(numerator: _numerator, denominator: _denominator)
+    }
+
+    /// Generates partial quotients in half-GCD blocks.
+    public struct Iterator: IteratorProtocol {
+        /// The current remainders, with `_a > _b >= 0`.
+        var _a: GMPInteger
+        var _b: GMPInteger
+
+        /// The current block of quotients and the next one to return.
+        var _block: [GMPInteger]
+        var _index = 0
+
+        /// The number of leading bits reduced by the next block, halved.
+        var _blockBits = 256
+
+        init(numerator: GMPInteger, denominator: GMPInteger) {
+            let (quotient, remainder) = try! numerator
+                .floorQuotientAndRemainder(dividingBy: denominator)
+            _block = [quotient]
+            _a = denominator
+            _b = remainder
+        }
+
+        public mutating func next() -> GMPInteger? {
+            if _index == _block.count {
+                guard !_b.isZero else {
+                    return nil
+                }
+                _refill()
+            }
+            defer { _index += 1 }
+            return _block[_index]
+        }
+
+        mutating func _refill() {
+            _index = 0
+            let threshold = _GMPQuotientReduction.threshold
+            let n = _a.bitCount
+            guard n > threshold else {
+                // Few quotients remain; finish them without a matrix
+                _block.removeAll(keepingCapacity: true)
+                while !_b.isZero {
+                    let quotient = _a / _b
+                    (_a, _b) = (_b, _a - quotient * _b)
+                    _block.append(quotient)
+                }
+                return
+            }
+            let shift = Swift.max(0, n - 2 * _blockBits)
+            var reduction = _GMPQuotientReduction.halfGCD(
+                _a >> shift,
+                _b >> shift,
+                threshold: threshold
+            )
+            if shift > 0 {
+                reduction.extend(to: _a, _b)
+            }
+            if reduction.quotients.isEmpty {
+                reduction.step()
+            }
+            _blockBits *= 2
+            _block = reduction.quotients
+            _a = reduction.alpha
+            _b = reduction.beta
+        }
+    }
+
+    /// The convergents `p_k / q_k`, in lowest terms, generated lazily.
+    public var convergents: Convergents {
+        Convergents(_fraction: self)
+    }
+
+    /// The convergents of a continued fraction.
+    public struct Convergents: Sequence {
+        let _fraction: ContinuedFraction
+
+        public func makeIterator() -> Iterator {
+            Iterator(_quotients: _fraction.makeIterator())
+        }
+
+        /// Generates convergents from the partial quotients.
+        public struct Iterator: IteratorProtocol {
+            var _quotients: ContinuedFraction.Iterator
+            var _previous = (p: GMPInteger(0), q: GMPInteger(1))
+            var _current = (p: GMPInteger(1), q: GMPInteger(0))
+
+            public mutating func next() -> GMPRational? {
+                guard let a = _quotients.next() else {
+                    return nil
+                }
+                (_previous, _current) = (
+                    _current,
+                    (
+                        p: a * _current.p + _previous.p,
+                        q: a * _current.q + _previous.q
+                    )
+                )
+                return GMPRational(
+                    _reducedNumerator: _current.p,
+                    denominator: _current.q
+                )
+            }
+        }
+    }
+
+    /// The closest rational to the value with denominator at most
+    /// `maxDenominator`.
+    ///
+    /// The result is a convergent or a semiconvergent. Expansion stops at
+    /// the first convergent whose denominator exceeds the bound, so the
+    /// cost depends on the bound rather than on the size of the value.
+    ///
+    /// - Parameter maxDenominator: The largest allowed denominator.
+    /// - Returns: The best approximation, in lowest terms. Of two equally
+    ///   close candidates, the one with the smaller denominator.
+    ///
+    /// - Requires: `maxDenominator >= 1`.
+    public func bestApproximation(
+        maxDenominator: GMPInteger
+    ) -> GMPRational {
+        precondition(maxDenominator.sign > 0, "maxDenominator must be >= 1")
+        var previous = (p: GMPInteger(0), q: GMPInteger(1))
+        var current = (p: GMPInteger(1), q: GMPInteger(0))
+        for a in self {
+            let q = a * current.q + previous.q
+            guard q <= maxDenominator else {
+                // The first step always fits, so current.q >= 1 here
+                let t = (maxDenominator - previous.q) / current.q
+                let semi = (
+                    p: t * current.p + previous.p,
+                    q: t * current.q + previous.q
+                )
+                let chosen = _distance(semi) * current.q
+                    < _distance(current) * semi.q ? semi : current
+                return GMPRational(
+                    _reducedNumerator: chosen.p,
+                    denominator: chosen.q
+                )
+            }
+            (previous, current) = (
+                current,
+                (p: a * current.p + previous.p, q: q)
+            )
+        }
+        return GMPRational(_reducedNumerator: current.p, denominator: current.q)
+    }
+
+    /// `|value - p/q| · q · denominator`, as an integer.
+    private func _distance(_ c: (p: GMPInteger, q: GMPInteger)) -> GMPInteger {
+        (_numerator * c.q - c.p * _denominator).absoluteValue()
+    }
+}
+
+// MARK: - Half-GCD
+
+/// A prefix of the Euclidean quotient sequence of `a / b`.
+///
+/// Holds the quotients `q1, ..., qj`, the matrix
+/// `M = [[q1, 1], [1, 0]] ⋯ [[qj, 1], [1, 0]]`, and the remainders
+/// `(alpha, beta)` with `(a, b) = M · (alpha, beta)`. The prefix is the
+/// start of the true quotient sequence exactly when
+/// `0 <= beta < alpha` (and the last quotient is not a 1 ending the
+/// expansion); quotients computed from truncated operands are checked
+/// against that condition after `extend(to:_:)`.
+struct _GMPQuotientReduction {
+    var quotients: [GMPInteger] = []
+    var m00 = GMPInteger(1)
+    var m01 = GMPInteger(0)
+    var m10 = GMPInteger(0)
+    var m11 = GMPInteger(1)
+    var alpha: GMPInteger
+    var beta: GMPInteger
+
+    /// The half-GCD recursion cutoff in bits, never below 128 so that the
+    /// recursion always shrinks its operands.
+    static var threshold: Int {
+        Swift.max(
+            128,
+            GMPTuningParameter.continuedFractionHalfGCDThreshold.value
+        )
+    }
+
+    init(_ a: GMPInteger, _ b: GMPInteger) {
+        alpha = a
+        beta = b
+    }
+
+    /// Whether the quotients are a prefix of the true quotient sequence.
+    var isValid: Bool {
+        beta.sign >= 0 && beta < alpha
+            && !(beta.isZero && quotients.last == GMPInteger(1))
+    }
+
+    /// Perform one Euclidean division step.
+    ///
+    /// - Requires: `beta > 0`.
+    mutating func step() {
+        let q = alpha / beta
+        (alpha, beta) = (beta, alpha - q * beta)
+        quotients.append(q)
+        (m00, m01) = (m00 * q + m01, m00)
+        (m10, m11) = (m10 * q + m11, m10)
+    }
+
+    /// Undo the last step.
+    mutating func pop() {
+        let q = quotients.removeLast()
+        (alpha, beta) = (alpha * q + beta, alpha)
+        (m00, m01) = (m01, m00 - m01 * q)
+        (m10, m11) = (m11, m10 - m11 * q)
+    }
+
+    /// Recompute the remainders for the full operands `(a, b)`, dropping
+    /// trailing quotients that the truncated operands got wrong.
+    ///
+    /// - Requires: `a > b >= 0`.
+    mutating func extend(to a: GMPInteger, _ b: GMPInteger) {
+        // M⁻¹ = det · [[m11, -m01], [-m10, m00]], det = (-1)^j
+        var x = m11 * a - m01 * b
+        var y = m00 * b - m10 * a
+        if quotients.count % 2 == 1 {
+            x = -x
+            y = -y
+        }
+        alpha = x
+        beta = y
+        while !isValid {
+            pop()
+        }
+    }
+
+    /// Append the steps of a reduction of `(alpha, beta)`.
+    mutating func append(_ other: _GMPQuotientReduction) {
+        quotients.append(contentsOf: other.quotients)
+        (m00, m01) = (
+            m00 * other.m00 + m01 * other.m10,
+            m00 * other.m01 + m01 * other.m11
+        )
+        (m10, m11) = (
+            m10 * other.m00 + m11 * other.m10,
+            m10 * other.m01 + m11 * other.m11
+        )
+        alpha = other.alpha
+        beta = other.beta
+    }
+
+    /// Reduce `(a, b)` until `beta` has at most half the bits of `a`.
+    ///
+    /// Recursively reduces the leading half of the operands, applies the
+    /// result to the full operands, takes one division step, and reduces
+    /// the leading part again (Schönhage; Möller, "On Schönhage's
+    /// algorithm and subquadratic integer GCD computation").
+    ///
+    /// - Requires: `a >= b >= 0`.
+    static func halfGCD(
+        _ a: GMPInteger,
+        _ b: GMPInteger,
+        threshold: Int
+    ) -> _GMPQuotientReduction {
+        var reduction = _GMPQuotientReduction(a, b)
+        let n = a.bitCount
+        let s = n / 2 + 1
+        guard n > threshold else {
+            while reduction.beta.bitCount > s {
+                reduction.step()
+            }
+            return reduction
+        }
+        let m = n / 2
+        reduction = halfGCD(a >> m, b >> m, threshold: threshold)
+        reduction.extend(to: a, b)
+        if reduction.beta.bitCount > s {
+            reduction.step()
+        }
+        if reduction.beta.bitCount > s {
+            let alpha = reduction.alpha
+            let beta = reduction.beta
+            let k = 2 * s - alpha.bitCount
+            var second = halfGCD(alpha >> k, beta >> k, threshold: threshold)
+            second.extend(to: alpha, beta)
+            reduction.append(second)
+        }
+        while reduction.beta.bitCount > s {
+            reduction.step()
+        }
+        return reduction
+    }
+}
+
+extension GMPRational {
+    /// Create a rational from a numerator and a positive denominator that
+    /// are already coprime, without canonicalizing.
+    init(_reducedNumerator numerator: GMPInteger, denominator: GMPInteger) {
+        self.init()
+        __gmpq_set_num(&_storage.value, &numerator._storage.value)
+        __gmpq_set_den(&_storage.value, &denominator._storage.value)
+    }
+}
+
+extension GMPCutoverBenchmark {
+    /// Continued fraction expansion of a random rational.
+    public static var continuedFractionExpansion: GMPCutoverBenchmark {
+        GMPCutoverBenchmark(
+            parameter: .continuedFractionHalfGCDThreshold,
+            scales: [512, 1024, 2048, 4096, 8192, 16384, 32768]
+        ) { bits in
+            let state = GMPRandomState(mersenneTwister: GMPInteger(bits))
+            let fraction = try! ContinuedFraction(
+                numerator: GMPInteger.random(bits: bits, using: state),
+                denominator: GMPInteger.random(bits: bits, using: state) + 1
+            )
+            return (bits, { for _ in fraction {} })
+        }
+    }
+}
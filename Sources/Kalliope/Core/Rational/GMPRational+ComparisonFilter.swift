@@ -0,0 +1,172 @@
+import CKalliope
+
+/// A bounded estimate of a rational's magnitude, used to decide comparisons
+/// without cross-multiplying.
+///
+/// For `q = n/d` with `n = mn · 2^en` and `d = md · 2^ed` (`mn`, `md` in
+/// `[0.5, 1)`, as returned by `mpz_get_d_2exp`):
+///
+/// - `|q|` lies strictly between `2^(exponent - 1)` and `2^(exponent + 1)`,
+///   where `exponent = en - ed`;
+/// - `mantissa = |mn| / md` approximates `|q| / 2^exponent` with relative
+///   error below `2^-50` (two truncations and one rounding).
+struct _GMPRationalEstimate {
+    /// The sign: -1, 0, or 1.
+    let sign: Int
+
+    /// The difference of the numerator and denominator bit lengths.
+    let exponent: Int
+
+    /// `|q| / 2^exponent`, approximately; in `(0.5, 2)`.
+    let mantissa: Double
+
+    /// Relative differences below this leave the comparison to `mpq_cmp`.
+    ///
+    /// The two mantissas and their quotient carry a combined relative error
+    /// below `2^-48`; the margin absorbs it with room to spare.
+    static let tolerance = 0x1p-45
+
+    /// Estimate a rational.
+    ///
+    /// - Parameter q: The rational. Read only.
+    ///
+    /// - Wraps: `mpz_get_d_2exp`
+    init(_ q: UnsafeMutablePointer<mpq_t>) {
+        sign = Int(q.pointee._mp_num._mp_size).signum()
+        var numeratorExponent = 0
+        var denominatorExponent = 0
+        let numerator = withUnsafeMutablePointer(to: &q.pointee._mp_num) {
+            __gmpz_get_d_2exp(&numeratorExponent, $0)
+        }
+        let denominator = withUnsafeMutablePointer(to: &q.pointee._mp_den) {
+            __gmpz_get_d_2exp(&denominatorExponent, $0)
+        }
+        exponent = numeratorExponent - denominatorExponent
+        mantissa = sign == 0 ? 0 : Swift.abs(numerator) / denominator
+    }
+
+    /// Compare the values behind two estimates.
+    ///
+    /// - Returns: -1, 0, or 1 when the estimates decide the comparison,
+    ///   `nil` when the values are too close to tell.
+    static func compare(_ a: Self, _ b: Self) -> Int? {
+        guard a.sign == b.sign else {
+            return a.sign < b.sign ? -1 : 1
+        }
+        guard a.sign != 0 else {
+            return 0
+        }
+        // Stage 1: disjoint bit-length ranges
+        if a.exponent >= b.exponent + 2 {
+            return a.sign
+        }
+        if b.exponent >= a.exponent + 2 {
+            return -a.sign
+        }
+        // Stage 2: the exponents differ by at most 1, so the scaled ratio
+        // cannot overflow or lose precision
+        let scaled = Double(
+            sign: .plus,
+            exponent: a.exponent - b.exponent,
+            significand: a.mantissa
+        )
+        let ratio = scaled / b.mantissa
+        if ratio > 1 + tolerance {
+            return a.sign
+        }
+        if ratio < 1 - tolerance {
+            return -a.sign
+        }
+        return nil
+    }
+}
+
+extension GMPRational {
+    /// The total limb count of both operands below which comparisons go
+    /// straight to `mpq_cmp`, whose cross-multiplication is then cheaper
+    /// than estimating.
+    static let _comparisonFilterLimbCount = 8
+
+    /// The number of limbs in the numerator and denominator.
+    var _limbCount: Int {
+        Int(_storage.value._mp_num._mp_size.magnitude)
+            + Int(_storage.value._mp_den._mp_size)
+    }
+
+    /// A bounded estimate of this value's magnitude.
+    var _estimate: _GMPRationalEstimate {
+        withUnsafeMutablePointer(to: &_storage.value) {
+            _GMPRationalEstimate($0)
+        }
+    }
+
+    /// Compare two rationals, filtering by magnitude estimates before
+    /// falling back to `mpq_cmp`.
+    ///
+    /// - Returns: -1, 0, or 1 as `lhs` is less than, equal to, or greater
+    ///   than `rhs`.
+    static func _compare(_ lhs: GMPRational, _ rhs: GMPRational) -> Int {
+        if lhs._limbCount + rhs._limbCount >= _comparisonFilterLimbCount,
+           let result = _GMPRationalEstimate.compare(
+               lhs._estimate,
+               rhs._estimate
+           )
+        {
+            return result
+        }
+        return Int(__gmpq_cmp(&lhs._storage.value, &rhs._storage.value))
+            .signum()
+    }
+}
+
+/// A rational paired with a cached magnitude estimate, for values that are
+/// compared many times, such as sort keys or heap elements.
+///
+/// The estimate is computed once, so most comparisons between keys read two
+/// cached doubles and never touch the components. Only values that agree to
+/// about 45 bits are compared exactly with `mpq_cmp`.
+///
+/// ```swift
+/// let sorted = values.map(GMPRationalSortKey.init).sorted().map(\.value)
+/// ```
+public struct GMPRationalSortKey: Comparable {
+    /// The rational.
+    public let value: GMPRational
+
+    let _estimate: _GMPRationalEstimate
+
+    /// Create a key, estimating the value's magnitude.
+    ///
+    /// - Parameter value: The rational.
+    public init(_ value: GMPRational) {
+        self.value = value
+        _estimate = value._estimate
+    }
+
+    /// Compare two keys, exactly.
+    ///
+    /// - Returns: -1, 0, or 1.
+    public func compare(to other: GMPRationalSortKey) -> Int {
+        if let result = _GMPRationalEstimate.compare(
+            _estimate,
+            other._estimate
+        ) {
+            return result
+        }
+        return value.compare(to: other.value).signum()
+    }
+
+    public static func < (
+        lhs: GMPRationalSortKey,
+        rhs: GMPRationalSortKey
+    ) -> Bool {
+        lhs.compare(to: rhs) < 0
+    }
+
+    public static func == (
+        lhs: GMPRationalSortKey,
+        rhs: GMPRationalSortKey
+    ) -> Bool {
+        lhs.compare(to: rhs) == 0
+    }
+}
@@ -0,0 +1,141 @@
+import CKalliope
+
+extension GMPRational: PowerSeriesCoefficient {
+    public init(_ value: Int, matching _: GMPRational) {
+        self.init(GMPInteger(value))
+    }
+
+    /// The quotient by a nonzero integer.
+    public func divided(by divisor: Int) -> GMPRational {
+        precondition(divisor != 0, "divisor must not be zero")
+        return try! divided(by: GMPRational(GMPInteger(divisor)))
+    }
+
+    /// The multiplicative inverse.
+    ///
+    /// - Requires: The value must not be zero.
+    public func reciprocal() -> GMPRational {
+        precondition(!isZero, "value must not be zero")
+        return try! inverted()
+    }
+
+    /// The truncated product by Kronecker substitution.
+    ///
+    /// Both factors are scaled to integer polynomials by the least common
+    /// multiple of their denominators, multiplied as two packed integers in
+    /// one `mpz_mul`, and scaled back. GMP's subquadratic multiplication
+    /// then does the work of a polynomial FFT.
+    public static func truncatedProduct(
+        _ lhs: [GMPRational],
+        _ rhs: [GMPRational],
+        count: Int
+    ) -> [GMPRational] {
+        let (a, aScale) = _integerPolynomial(lhs.prefix(count))
+        let (b, bScale) = _integerPolynomial(rhs.prefix(count))
+        let scale = aScale * bScale
+        return GMPInteger._kroneckerProduct(a, b, count: count).map {
+            try! GMPRational(numerator: $0, denominator: scale)
+        }
+    }
+
+    /// Integer coefficients and the common denominator they were scaled by.
+    private static func _integerPolynomial(
+        _ coefficients: ArraySlice<GMPRational>
+    ) -> ([GMPInteger], GMPInteger) {
+        let scale = coefficients.reduce(GMPInteger(1)) {
+            GMPInteger.lcm($0, $1.denominator)
+        }
+        let integers = coefficients.map {
+            $0.numerator * (try! scale.exactlyDivided(by: $0.denominator))
+        }
+        return (integers, scale)
+    }
+}
+
+extension GMPInteger {
+    /// The first `count` coefficients of the product of two integer
+    /// polynomials, by Kronecker substitution.
+    ///
+    /// Each polynomial is evaluated at `2^w`, for a limb-aligned slot width
+    /// `w` wide enough to hold any product coefficient with its sign, by
+    /// copying coefficient limbs into slots. The product is then unpacked
+    /// as signed digits in base `2^w`.
+    static func _kroneckerProduct(
+        _ a: [GMPInteger],
+        _ b: [GMPInteger],
+        count: Int
+    ) -> [GMPInteger] {
+        let aBits = a.map(\.bitCount).max() ?? 0
+        let bBits = b.map(\.bitCount).max() ?? 0
+        let terms = Swift.min(a.count, b.count)
+        let bits = aBits + bBits + (terms.bitWidth - terms.leadingZeroBitCount)
+            + 1
+        let slotLimbs = (bits + UInt.bitWidth - 1) / UInt.bitWidth
+        let product = _kroneckerPack(a, slotLimbs: slotLimbs)
+            * _kroneckerPack(b, slotLimbs: slotLimbs)
+        return _kroneckerUnpack(product, slotLimbs: slotLimbs, count: count)
+    }
+
+    /// `Σ values[i] · 2^(i·w)` for `w = slotLimbs` limbs.
+    private static func _kroneckerPack(
+        _ values: [GMPInteger],
+        slotLimbs: Int
+    ) -> GMPInteger {
+        // Pack the positive and the negative coefficients separately, then
+        // subtract
+        func pack(sign: Int) -> GMPInteger {
+            var result = GMPInteger()
+            let total = values.count * slotLimbs
+            guard total > 0 else {
+                return result
+            }
+            let limbs = result.limbsWrite(count: total)
+            limbs.update(repeating: 0, count: total)
+            for (i, value) in values.enumerated() where value.sign == sign {
+                let source = value.limbsRead
+                for j in 0 ..< value.limbCount {
+                    limbs[i * slotLimbs + j] = source[j]
+                }
+            }
+            result.limbsFinish(size: total)
+            return result
+        }
+        return pack(sign: 1) - pack(sign: -1)
+    }
+
+    /// The signed base-`2^w` digits `0 ..< count` of `value`.
+    private static func _kroneckerUnpack(
+        _ value: GMPInteger,
+        slotLimbs: Int,
+        count: Int
+    ) -> [GMPInteger] {
+        let negative = value.isNegative
+        let limbCount = value.limbCount
+        let source = value.limbsRead
+        let half = GMPInteger(1) << (slotLimbs * UInt.bitWidth - 1)
+        let full = half << 1
+        var carry = false
+        var result: [GMPInteger] = []
+        result.reserveCapacity(count)
+        for k in 0 ..< count {
+            var digit = GMPInteger()
+            let limbs = digit.limbsWrite(count: slotLimbs)
+            for j in 0 ..< slotLimbs {
+                let index = k * slotLimbs + j
+                limbs[j] = index < limbCount ? source[index] : 0
+            }
+            digit.limbsFinish(size: slotLimbs)
+            if carry {
+                digit = digit + 1
+            }
+            // Digits of at least half the slot are negative coefficients
+            // borrowed from the next slot
+            carry = digit >= half
+            if carry {
+                digit = digit - full
+            }
+            result.append(negative ? -digit : digit)
+        }
+        return result
+    }
+}
@@ -0,0 +1,318 @@
+import CKalliope
+import Dispatch
+
+/// A field whose elements can be the coefficients of a `PowerSeries`.
+///
+/// Conforming types supply field arithmetic and, optionally, a faster
+/// truncated product of coefficient arrays, which every series operation is
+/// built on. `GMPRational` multiplies by Kronecker substitution and
+/// `MPFRFloat` (in Linus) by rounded dot products.
+public protocol PowerSeriesCoefficient {
+    /// The integer `value`, in the same setting as `template` (for example
+    /// at its precision).
+    init(_ value: Int, matching template: Self)
+
+    static func + (lhs: Self, rhs: Self) -> Self
+    static func - (lhs: Self, rhs: Self) -> Self
+    static func * (lhs: Self, rhs: Self) -> Self
+
+    /// Whether the value is zero.
+    var isZero: Bool { get }
+
+    /// The quotient by a nonzero integer.
+    func divided(by divisor: Int) -> Self
+
+    /// The multiplicative inverse.
+    ///
+    /// - Requires: The value must not be zero.
+    func reciprocal() -> Self
+
+    /// The first `count` coefficients of the product of two polynomials.
+    ///
+    /// - Parameters:
+    ///   - lhs: The coefficients of the first factor, constant term first.
+    ///     Must not be empty.
+    ///   - rhs: The coefficients of the second factor. Must not be empty.
+    ///   - count: The number of coefficients wanted. Must be positive.
+    /// - Returns: `count` coefficients, zero beyond the full product.
+    static func truncatedProduct(
+        _ lhs: [Self],
+        _ rhs: [Self],
+        count: Int
+    ) -> [Self]
+}
+
+extension PowerSeriesCoefficient {
+    /// The schoolbook product, `O(count²)` coefficient operations.
+    public static func truncatedProduct(
+        _ lhs: [Self],
+        _ rhs: [Self],
+        count: Int
+    ) -> [Self] {
+        let zero = Self(0, matching: lhs[0])
+        var result = [Self](repeating: zero, count: count)
+        for i in 0 ..< Swift.min(lhs.count, count) where !lhs[i].isZero {
+            for j in 0 ..< Swift.min(rhs.count, count - i) {
+                result[i + j] = result[i + j] + lhs[i] * rhs[j]
+            }
+        }
+        return result
+    }
+}
+
+/// A power series truncated after a fixed number of terms.
+///
+/// The series `c₀ + c₁x + c₂x² + ...` is known modulo `x^order`. Binary
+/// operations truncate to the smaller order. Multiplication goes through the
+/// coefficient type's `truncatedProduct`, and every other operation is built
+/// from a constant number of multiplications per Newton step: `inverse()`,
+/// `squareRoot()`, `logarithm()` and `exponential()` cost `O(M(n))` for
+/// `n` terms, where `M(n)` is the cost of one product, against the `O(n²)`
+/// of the coefficient recurrences. `composed(with:)` uses the Brent–Kung
+/// baby-step giant-step method, `O(√n)` products, computing its independent
+/// blocks concurrently.
+///
+/// ```swift
+/// // The first 20 terms of exp(x) / (1 - x)
+/// let x = PowerSeries<GMPRational>([0, 1], order: 20)
+/// let one = PowerSeries<GMPRational>([1], order: 20)
+/// let f = x.exponential() * (one - x).inverse()
+/// ```
+public struct PowerSeries<Coefficient: PowerSeriesCoefficient> {
+    /// The coefficients `c₀ ..< c_order`, constant term first.
+    public private(set) var coefficients: [Coefficient]
+
+    /// The number of known terms.
+    public var order: Int {
+        coefficients.count
+    }
+
+    /// Create a series from its coefficients.
+    ///
+    /// - Parameters:
+    ///   - coefficients: The leading coefficients, constant term first.
+    ///     Must not be empty.
+    ///   - order: The number of known terms. Defaults to
+    ///     `coefficients.count`; missing coefficients are zero and extra
+    ///     ones are dropped.
+    public init(_ coefficients: [Coefficient], order: Int? = nil) {
+        precondition(!coefficients.isEmpty, "coefficients must not be empty")
+        let order = order ?? coefficients.count
+        precondition(order > 0, "order must be positive")
+        var coefficients = Array(coefficients.prefix(order))
+        let zero = Coefficient(0, matching: coefficients[0])
+        while coefficients.count < order {
+            coefficients.append(zero)
+        }
+        self.coefficients = coefficients
+    }
+
+    /// The coefficient of `x^index`.
+    ///
+    /// - Requires: `0 <= index < order`.
+    public subscript(index: Int) -> Coefficient {
+        coefficients[index]
+    }
+
+    /// The integer `value` as a series of the given order.
+    private func _constant(_ value: Int, order: Int) -> PowerSeries {
+        PowerSeries(
+            [Coefficient(value, matching: coefficients[0])],
+            order: order
+        )
+    }
+
+    /// The series modulo `x^order`.
+    ///
+    /// - Parameter order: The new number of terms. Must be positive and at
+    ///   most `self.order`.
+    public func truncated(to order: Int) -> PowerSeries {
+        precondition(order > 0 && order <= self.order, "order out of range")
+        return PowerSeries(Array(coefficients.prefix(order)))
+    }
+
+    // MARK: - Arithmetic
+
+    /// The sum, to the smaller order.
+    public static func + (lhs: PowerSeries, rhs: PowerSeries) -> PowerSeries {
+        let n = Swift.min(lhs.order, rhs.order)
+        return PowerSeries((0 ..< n).map { lhs[$0] + rhs[$0] })
+    }
+
+    /// The difference, to the smaller order.
+    public static func - (lhs: PowerSeries, rhs: PowerSeries) -> PowerSeries {
+        let n = Swift.min(lhs.order, rhs.order)
+        return PowerSeries((0 ..< n).map { lhs[$0] - rhs[$0] })
+    }
+
+    /// The product, to the smaller order, from the coefficient type's
+    /// `truncatedProduct`.
+    public static func * (lhs: PowerSeries, rhs: PowerSeries) -> PowerSeries {
+        let n = Swift.min(lhs.order, rhs.order)
+        return PowerSeries(
+            Coefficient.truncatedProduct(
+                lhs.coefficients,
+                rhs.coefficients,
+                count: n
+            )
+        )
+    }
+
+    /// The product with a scalar.
+    public static func * (lhs: Coefficient, rhs: PowerSeries) -> PowerSeries {
+        PowerSeries(rhs.coefficients.map { lhs * $0 })
+    }
+
+    /// The formal derivative, known to one term fewer.
+    ///
+    /// - Requires: `order >= 2`.
+    public func derivative() -> PowerSeries {
+        precondition(order >= 2, "order must be at least 2")
+        return PowerSeries(
+            (1 ..< order).map {
+                coefficients[$0] * Coefficient($0, matching: coefficients[0])
+            }
+        )
+    }
+
+    /// The formal integral with constant term zero, known to one term more.
+    public func integral() -> PowerSeries {
+        let zero = Coefficient(0, matching: coefficients[0])
+        return PowerSeries(
+            [zero] + coefficients.enumerated().map {
+                $0.element.divided(by: $0.offset + 1)
+            }
+        )
+    }
+
+    // MARK: - Newton Iterations
+
+    /// The multiplicative inverse.
+    ///
+    /// Newton's iteration `g ← g(2 - fg)` doubles the number of correct
+    /// terms with two products per step.
+    ///
+    /// - Requires: The constant term must not be zero.
+    public func inverse() -> PowerSeries {
+        precondition(!coefficients[0].isZero, "constant term must not be zero")
+        var g = PowerSeries([coefficients[0].reciprocal()])
+        var known = 1
+        while known < order {
+            known = Swift.min(2 * known, order)
+            let g2 = PowerSeries(g.coefficients, order: known)
+            let error = truncated(to: known) * g2
+            g = g2 * (_constant(2, order: known) - error)
+        }
+        return g
+    }
+
+    /// The square root with constant term 1.
+    ///
+    /// Newton's iteration `r ← r + r(1 - fr²)/2` for `1/√f` uses three
+    /// products per step; one more gives `√f = f · r`.
+    ///
+    /// - Requires: The constant term must be 1.
+    public func squareRoot() -> PowerSeries {
+        let one = Coefficient(1, matching: coefficients[0])
+        precondition((coefficients[0] - one).isZero, "constant term must be 1")
+        var r = PowerSeries([one])
+        var known = 1
+        while known < order {
+            known = Swift.min(2 * known, order)
+            let r2 = PowerSeries(r.coefficients, order: known)
+            let error = _constant(1, order: known)
+                - truncated(to: known) * (r2 * r2)
+            r = r2 + r2 * PowerSeries(error.coefficients.map {
+                $0.divided(by: 2)
+            })
+        }
+        return self * r
+    }
+
+    /// The logarithm, `∫ f'/f`, with constant term 0.
+    ///
+    /// - Requires: The constant term must be 1.
+    public func logarithm() -> PowerSeries {
+        let one = Coefficient(1, matching: coefficients[0])
+        precondition((coefficients[0] - one).isZero, "constant term must be 1")
+        guard order > 1 else {
+            return _constant(0, order: 1)
+        }
+        let quotient = derivative() * truncated(to: order - 1).inverse()
+        return quotient.integral()
+    }
+
+    /// The exponential, with constant term 1.
+    ///
+    /// Newton's iteration `g ← g(1 + f - log g)` doubles the number of
+    /// correct terms with one product and one logarithm per step.
+    ///
+    /// - Requires: The constant term must be zero.
+    public func exponential() -> PowerSeries {
+        precondition(coefficients[0].isZero, "constant term must be zero")
+        var g = _constant(1, order: 1)
+        var known = 1
+        while known < order {
+            known = Swift.min(2 * known, order)
+            let g2 = PowerSeries(g.coefficients, order: known)
+            let step = _constant(1, order: known) + truncated(to: known)
+                - g2.logarithm()
+            g = g2 * step
+        }
+        return g
+    }
+
+    // MARK: - Composition
+
+    /// The composition `f(g(x))`.
+    ///
+    /// Brent and Kung's method splits `f` into `⌈n/k⌉` blocks of `k ≈ √n`
+    /// coefficients. Each block is evaluated at `g` from the baby steps
+    /// `g, g², ..., g^k`, concurrently, and the blocks are combined by
+    /// Horner's rule in `g^k`, each step truncated to the terms that still
+    /// matter.
+    ///
+    /// - Parameter inner: The inner series. Its constant term must be zero.
+    /// - Returns: The composition, to the smaller of the two orders.
+    public func composed(with inner: PowerSeries) -> PowerSeries {
+        precondition(inner[0].isZero, "inner constant term must be zero")
+        let n = Swift.min(order, inner.order)
+        let g = inner.truncated(to: n)
+        var k = 1
+        while k * k < n {
+            k += 1
+        }
+        var powers = [_constant(1, order: n)]
+        for _ in 0 ..< k {
+            powers.append(powers[powers.count - 1] * g)
+        }
+        let giantStep = powers[k]
+
+        let blockCount = (n + k - 1) / k
+        var blocks = [PowerSeries?](repeating: nil, count: blockCount)
+        blocks.withUnsafeMutableBufferPointer { buffer in
+            DispatchQueue.concurrentPerform(iterations: blockCount) { i in
+                // Block i is multiplied by g^(ik), so only n - ik terms
+                // survive
+                let terms = n - i * k
+                var sum = _constant(0, order: terms)
+                for j in 0 ..< Swift.min(k, terms) {
+                    let c = coefficients[i * k + j]
+                    if !c.isZero {
+                        sum = sum + c * powers[j].truncated(to: terms)
+                    }
+                }
+                buffer[i] = sum
+            }
+        }
+
+        var result = blocks[blockCount - 1]!
+        for i in stride(from: blockCount - 2, through: 0, by: -1) {
+            let terms = n - i * k
+            result = PowerSeries(result.coefficients, order: terms)
+                * giantStep.truncated(to: terms)
+                + blocks[i]!
+        }
+        return result
+    }
+}
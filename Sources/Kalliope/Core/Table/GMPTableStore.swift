@@ -0,0 +1,330 @@
+import CKalliope
+import Darwin
+
+/// The kind of data held by a table in a `GMPTableStore`.
+///
+/// Kalliope defines the kinds below. Other modules extend this type with
+/// their own kinds (Linus adds `.mpfrFloats`) and read them through
+/// `GMPTableStore.rawTable(named:kind:)`.
+public struct GMPTableKind: RawRepresentable, Hashable, Sendable {
+    public let rawValue: UInt32
+
+    public init(rawValue: UInt32) {
+        self.rawValue = rawValue
+    }
+
+    /// Arbitrary-precision integers, read as `GMPIntegerTable`.
+    public static let integers = GMPTableKind(rawValue: 1)
+
+    /// Unsigned 64-bit words, read as `UnsafeBufferPointer<UInt64>`.
+    public static let words = GMPTableKind(rawValue: 2)
+}
+
+/// The on-disk layout of a table store file.
+///
+/// All fields are native-endian and every offset is a multiple of 8, so the
+/// mapped file can be read in place:
+///
+///     header     (64 bytes)  magic, format version, limb bits, byte order
+///                            mark, table count, directory offset, version
+///     directory  (80 bytes per table)  name (48 bytes, NUL-padded), kind,
+///                            reserved, element count, offset, length
+///     payloads   one per table, each 8-byte aligned
+///
+/// An integer table payload is `count` index entries of two `Int64`s (limb
+/// offset into the limb region, signed `mpz` size), followed by the limb
+/// region.
+enum _GMPTableFormat {
+    static let magic: UInt64 = 0x3130_4C42_5450_4D47 // "GMPTBL01"
+    static let formatVersion: UInt32 = 1
+    static let byteOrderMark: UInt32 = 0x0102_0304
+    static let limbBits = UInt32(MemoryLayout<mp_limb_t>.size * 8)
+    static let headerSize = 64
+    static let directoryEntrySize = 80
+    static let nameSize = 48
+    static let integerIndexEntrySize = 16
+}
+
+/// A read-only, memory-mapped file of precomputed tables.
+///
+/// Opening a store maps the file and validates its header and directory;
+/// table contents are not parsed or copied. Elements are read in place, so
+/// startup costs only the page-ins of the entries actually used.
+///
+/// Build stores with `GMPTableStoreBuilder`. Tables are looked up by name
+/// and kind.
+///
+/// - Note: The store must outlive any pointer obtained from it. Table views
+///   such as `GMPIntegerTable` keep their store alive.
+public final class GMPTableStore: @unchecked Sendable {
+    struct _Entry {
+        let kind: GMPTableKind
+        let count: Int
+        let offset: Int
+        let length: Int
+    }
+
+    /// The path the store was opened from.
+    public let path: String
+
+    /// The data version recorded by the builder.
+    ///
+    /// This is the caller's own version number for the table contents,
+    /// independent of the file format version.
+    public let version: Int
+
+    let _base: UnsafeRawPointer
+    let _size: Int
+    let _entries: [String: _Entry]
+
+    /// Open and map a table store.
+    ///
+    /// - Parameter path: The path of a file written by
+    ///   `GMPTableStoreBuilder.write(to:)`.
+    /// - Throws: `GMPError.fileAccess` if the file cannot be opened or
+    ///   mapped, `GMPError.invalidTableFile` if it is not a valid store for
+    ///   this platform's limb size and byte order.
+    ///
+    /// - Guarantees: The file is mapped read-only and private; later changes
+    ///   to the file by other processes are not guaranteed to be visible.
+    /// - Wraps: `mmap`
+    public init(contentsOf path: String) throws {
+        let fd = open(path, O_RDONLY)
+        guard fd >= 0 else {
+            throw GMPError.fileAccess(path)
+        }
+        defer { close(fd) }
+        var info = stat()
+        guard fstat(fd, &info) == 0 else {
+            throw GMPError.fileAccess(path)
+        }
+        let size = Int(info.st_size)
+        guard size >= _GMPTableFormat.headerSize else {
+            throw GMPError.invalidTableFile
+        }
+        guard let mapped = mmap(nil, size, PROT_READ, MAP_PRIVATE, fd, 0),
+              mapped != UnsafeMutableRawPointer(bitPattern: -1)
+        else {
+            throw GMPError.fileAccess(path)
+        }
+        let base = UnsafeRawPointer(mapped)
+        let directory: (version: Int, entries: [String: _Entry])
+        do {
+            directory = try Self._readDirectory(base, size: size)
+        } catch {
+            munmap(mapped, size)
+            throw error
+        }
+        self.path = path
+        version = directory.version
+        _entries = directory.entries
+        _base = base
+        _size = size
+    }
+
+    deinit {
+        munmap(UnsafeMutableRawPointer(mutating: _base), _size)
+    }
+
+    private static func _readDirectory(
+        _ base: UnsafeRawPointer,
+        size: Int
+    ) throws -> (version: Int, entries: [String: _Entry]) {
+        typealias Format = _GMPTableFormat
+        guard base.load(as: UInt64.self) == Format.magic,
+              base.load(fromByteOffset: 8, as: UInt32.self)
+              == Format.formatVersion,
+              base.load(fromByteOffset: 12, as: UInt32.self)
+              == Format.limbBits,
+              base.load(fromByteOffset: 16, as: UInt32.self)
+              == Format.byteOrderMark
+        else {
+            throw GMPError.invalidTableFile
+        }
+        let tableCount = Int(base.load(fromByteOffset: 20, as: UInt32.self))
+        let directory = Int(base.load(fromByteOffset: 24, as: UInt64.self))
+        let version = Int(base.load(fromByteOffset: 32, as: Int64.self))
+        guard directory % 8 == 0,
+              directory <= size,
+              tableCount <= (size - directory) / Format.directoryEntrySize
+        else {
+            throw GMPError.invalidTableFile
+        }
+
+        var entries: [String: _Entry] = [:]
+        for t in 0 ..< tableCount {
+            let entry = base + directory + t * Format.directoryEntrySize
+            let nameBytes = UnsafeRawBufferPointer(
+                start: entry,
+                count: Format.nameSize
+            )
+            let name = String(
+                decoding: nameBytes.prefix { $0 != 0 },
+                as: UTF8.self
+            )
+            let kind = entry.load(fromByteOffset: 48, as: UInt32.self)
+            let count = entry.load(fromByteOffset: 56, as: UInt64.self)
+            let offset = entry.load(fromByteOffset: 64, as: UInt64.self)
+            let length = entry.load(fromByteOffset: 72, as: UInt64.self)
+            guard offset % 8 == 0,
+                  offset <= UInt64(size),
+                  length <= UInt64(size) - offset,
+                  count <= length
+            else {
+                throw GMPError.invalidTableFile
+            }
+            entries[name] = _Entry(
+                kind: GMPTableKind(rawValue: kind),
+                count: Int(count),
+                offset: Int(offset),
+                length: Int(length)
+            )
+        }
+        return (version, entries)
+    }
+
+    // MARK: - Lookup
+
+    /// The names of all tables in the store.
+    public var tableNames: [String] {
+        _entries.keys.sorted()
+    }
+
+    /// The raw payload of a table.
+    ///
+    /// This is the extension point for table kinds defined outside
+    /// Kalliope.
+    ///
+    /// - Parameters:
+    ///   - name: The table name.
+    ///   - kind: The expected kind.
+    /// - Returns: The element count and the mapped payload bytes, or `nil`
+    ///   if there is no table with this name and kind. The bytes are valid
+    ///   while the store is alive.
+    public func rawTable(
+        named name: String,
+        kind: GMPTableKind
+    ) -> (count: Int, payload: UnsafeRawBufferPointer)? {
+        guard let entry = _entries[name], entry.kind == kind else {
+            return nil
+        }
+        let payload = UnsafeRawBufferPointer(
+            start: _base + entry.offset,
+            count: entry.length
+        )
+        return (entry.count, payload)
+    }
+
+    /// A table of integers.
+    ///
+    /// - Parameter name: The table name.
+    /// - Returns: A view of the table, or `nil` if there is no integer table
+    ///   with this name.
+    public func integers(named name: String) -> GMPIntegerTable? {
+        guard let table = rawTable(named: name, kind: .integers),
+              table.count <= table.payload.count
+              / _GMPTableFormat.integerIndexEntrySize
+        else {
+            return nil
+        }
+        return GMPIntegerTable(
+            store: self,
+            count: table.count,
+            payload: table.payload
+        )
+    }
+
+    /// A table of 64-bit words, such as small primes.
+    ///
+    /// - Parameter name: The table name.
+    /// - Returns: The mapped words, or `nil` if there is no word table with
+    ///   this name. The buffer is valid while the store is alive.
+    public func words(named name: String) -> UnsafeBufferPointer<UInt64>? {
+        guard let table = rawTable(named: name, kind: .words),
+              table.count <= table.payload.count / 8
+        else {
+            return nil
+        }
+        let start = table.payload.baseAddress?
+            .assumingMemoryBound(to: UInt64.self)
+        return UnsafeBufferPointer(start: start, count: table.count)
+    }
+}
+
+// MARK: - Integer Tables
+
+/// A read-only view of an integer table in a `GMPTableStore`.
+///
+/// Elements are not copied out of the mapping: `withElement(at:_:)` wraps
+/// an element's limbs in place as a read-only `mpz_t`. Subscripting makes
+/// an ordinary `GMPInteger` copy.
+public struct GMPIntegerTable: RandomAccessCollection {
+    /// The store, kept alive by this view.
+    public let store: GMPTableStore
+
+    /// The number of elements.
+    public let count: Int
+
+    let _index: UnsafePointer<Int64>
+    let _limbs: UnsafePointer<mp_limb_t>
+    let _limbCount: Int
+
+    init(store: GMPTableStore, count: Int, payload: UnsafeRawBufferPointer) {
+        self.store = store
+        self.count = count
+        let base = payload.baseAddress!
+        let indexBytes = count * _GMPTableFormat.integerIndexEntrySize
+        _index = base.assumingMemoryBound(to: Int64.self)
+        _limbs = (base + indexBytes).assumingMemoryBound(to: mp_limb_t.self)
+        _limbCount = (payload.count - indexBytes)
+            / MemoryLayout<mp_limb_t>.size
+    }
+
+    public var startIndex: Int {
+        0
+    }
+
+    public var endIndex: Int {
+        count
+    }
+
+    /// Execute a closure with a read-only `mpz_t` for an element.
+    ///
+    /// The `mpz_t` points directly at the mapped limbs. It may be passed as
+    /// an input to any GMP function but must not be modified, cleared, or
+    /// used after the closure returns.
+    ///
+    /// - Parameters:
+    ///   - index: The element index.
+    ///   - body: A closure that receives the pointer and returns a value.
+    /// - Returns: The value returned by the closure.
+    ///
+    /// - Requires: `0 <= index < count`.
+    /// - Wraps: `mpz_roinit_n`
+    public func withElement<T>(
+        at index: Int,
+        _ body: (UnsafePointer<mpz_t>) throws -> T
+    ) rethrows -> T {
+        precondition(index >= 0 && index < count, "index out of range")
+        let offset = Int(_index[2 * index])
+        let size = Int(_index[2 * index + 1])
+        precondition(
+            offset >= 0 && offset <= _limbCount - abs(size),
+            "table element out of range"
+        )
+        var view = mpz_t()
+        __gmpz_roinit_n(&view, _limbs + offset, size)
+        return try withExtendedLifetime(store) {
+            try body(&view)
+        }
+    }
+
+    /// The element at `index`, copied into a new `GMPInteger`.
+    public subscript(index: Int) -> GMPInteger {
+        withElement(at: index) { element in
+            let result = GMPInteger()
+            __gmpz_set(&result._storage.value, element)
+            return result
+        }
+    }
+}
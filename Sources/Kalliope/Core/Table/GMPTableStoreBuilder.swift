@@ -0,0 +1,299 @@
+import CKalliope
+import Foundation
+
+/// Builds and writes a table store file for `GMPTableStore`.
+///
+/// Tables are computed once, added by name, and written in the store's
+/// mappable layout. Loading the file later with `GMPTableStore` replaces the
+/// computation with a page-in.
+///
+/// ```swift
+/// var builder = GMPTableStoreBuilder(version: 3)
+/// builder.addPrimes(upTo: 100_000_000)
+/// builder.addFactorials(through: 1000)
+/// try builder.write(to: path)
+/// ```
+public struct GMPTableStoreBuilder {
+    struct _Table {
+        let name: String
+        let kind: GMPTableKind
+        let count: Int
+        let payload: [UInt8]
+    }
+
+    /// The data version to record in the file, read back as
+    /// `GMPTableStore.version`.
+    public var version: Int
+
+    var _tables: [_Table] = []
+
+    /// Create an empty builder.
+    ///
+    /// - Parameter version: The data version to record. Defaults to 0.
+    public init(version: Int = 0) {
+        self.version = version
+    }
+
+    // MARK: - Adding Tables
+
+    /// Add a table with a caller-defined payload.
+    ///
+    /// This is the extension point for table kinds defined outside
+    /// Kalliope. The payload is written as-is, padded to a multiple of 8
+    /// bytes.
+    ///
+    /// - Parameters:
+    ///   - name: The table name. Must be non-empty, unique, and at most 47
+    ///     bytes of UTF-8.
+    ///   - kind: The table kind.
+    ///   - count: The number of elements, as reported by
+    ///     `GMPTableStore.rawTable(named:kind:)`.
+    ///   - payload: The payload bytes.
+    public mutating func addRaw(
+        _ name: String,
+        kind: GMPTableKind,
+        count: Int,
+        payload: [UInt8]
+    ) {
+        precondition(
+            !name.isEmpty && name.utf8.count < _GMPTableFormat.nameSize,
+            "table name must be 1 to 47 bytes of UTF-8"
+        )
+        precondition(
+            !_tables.contains { $0.name == name },
+            "table names must be unique"
+        )
+        precondition(count >= 0, "count must be non-negative")
+        _tables.append(
+            _Table(name: name, kind: kind, count: count, payload: payload)
+        )
+    }
+
+    /// Add a table of integers.
+    ///
+    /// - Parameters:
+    ///   - name: The table name.
+    ///   - integers: The values.
+    public mutating func add(_ name: String, integers: [GMPInteger]) {
+        let indexSize = integers.count * _GMPTableFormat.integerIndexEntrySize
+        var index = [Int64]()
+        index.reserveCapacity(2 * integers.count)
+        var limbs = [mp_limb_t]()
+        for value in integers {
+            value.withCPointer { ptr in
+                let size = Int(ptr.pointee._mp_size)
+                index.append(Int64(limbs.count))
+                index.append(Int64(size))
+                let source = __gmpz_limbs_read(ptr)!
+                limbs.append(
+                    contentsOf: UnsafeBufferPointer(
+                        start: source,
+                        count: abs(size)
+                    )
+                )
+            }
+        }
+        var payload = [UInt8]()
+        payload.reserveCapacity(
+            indexSize + limbs.count * MemoryLayout<mp_limb_t>.size
+        )
+        index.withUnsafeBytes { payload.append(contentsOf: $0) }
+        limbs.withUnsafeBytes { payload.append(contentsOf: $0) }
+        addRaw(name, kind: .integers, count: integers.count, payload: payload)
+    }
+
+    /// Add a table of 64-bit words.
+    ///
+    /// - Parameters:
+    ///   - name: The table name.
+    ///   - words: The values.
+    public mutating func add(_ name: String, words: [UInt64]) {
+        let payload = words.withUnsafeBytes { Array($0) }
+        addRaw(name, kind: .words, count: words.count, payload: payload)
+    }
+
+    /// Add the primes up to `limit` as a word table.
+    ///
+    /// Uses a sieve of Eratosthenes over odd numbers.
+    ///
+    /// - Parameters:
+    ///   - name: The table name. Defaults to `"primes"`.
+    ///   - limit: The inclusive upper bound.
+    public mutating func addPrimes(
+        _ name: String = "primes",
+        upTo limit: Int
+    ) {
+        precondition(limit >= 0, "limit must be non-negative")
+        var primes: [UInt64] = limit >= 2 ? [2] : []
+        if limit >= 3 {
+            // composite[i] describes 2i + 1
+            var composite = [Bool](repeating: false, count: limit / 2 + 1)
+            var i = 1
+            while (2 * i + 1) * (2 * i + 1) <= limit {
+                if !composite[i] {
+                    let p = 2 * i + 1
+                    let start = p * p / 2
+                    for j in stride(from: start, through: limit / 2, by: p) {
+                        composite[j] = true
+                    }
+                }
+                i += 1
+            }
+            for i in 1 ... (limit - 1) / 2 where !composite[i] {
+                primes.append(UInt64(2 * i + 1))
+            }
+        }
+        add(name, words: primes)
+    }
+
+    /// Add the factorials 0!, 1!, ..., n! as an integer table.
+    ///
+    /// - Parameters:
+    ///   - name: The table name. Defaults to `"factorials"`.
+    ///   - n: The largest argument.
+    public mutating func addFactorials(
+        _ name: String = "factorials",
+        through n: Int
+    ) {
+        precondition(n >= 0, "n must be non-negative")
+        var values = [GMPInteger(1)]
+        values.reserveCapacity(n + 1)
+        for k in stride(from: 1, through: n, by: 1) {
+            values.append(values[k - 1] * k)
+        }
+        add(name, integers: values)
+    }
+
+    /// Add the powers base^0, base^1, ..., base^(count - 1) as an integer
+    /// table, for fixed-base exponentiation.
+    ///
+    /// - Parameters:
+    ///   - name: The table name.
+    ///   - base: The base.
+    ///   - count: The number of powers.
+    public mutating func addPowers(
+        _ name: String,
+        of base: GMPInteger,
+        count: Int
+    ) {
+        precondition(count >= 0, "count must be non-negative")
+        var values = [GMPInteger]()
+        values.reserveCapacity(count)
+        var power = GMPInteger(1)
+        for _ in 0 ..< count {
+            values.append(power)
+            power = power * base
+        }
+        add(name, integers: values)
+    }
+
+    // MARK: - Writing
+
+    /// Serialize the tables in the store layout.
+    ///
+    /// - Returns: The file contents.
+    public func serialized() -> Data {
+        typealias Format = _GMPTableFormat
+        func aligned(_ n: Int) -> Int {
+            (n + 7) & ~7
+        }
+        let directory = Format.headerSize
+        var offset = directory + _tables.count * Format.directoryEntrySize
+        var offsets = [Int]()
+        for table in _tables {
+            offsets.append(offset)
+            offset = aligned(offset + table.payload.count)
+        }
+
+        var data = Data(count: offset)
+        data.withUnsafeMutableBytes { bytes in
+            let base = bytes.baseAddress!
+            base.storeBytes(of: Format.magic, as: UInt64.self)
+            base.storeBytes(
+                of: Format.formatVersion,
+                toByteOffset: 8,
+                as: UInt32.self
+            )
+            base.storeBytes(
+                of: Format.limbBits,
+                toByteOffset: 12,
+                as: UInt32.self
+            )
+            base.storeBytes(
+                of: Format.byteOrderMark,
+                toByteOffset: 16,
+                as: UInt32.self
+            )
+            base.storeBytes(
+                of: UInt32(_tables.count),
+                toByteOffset: 20,
+                as: UInt32.self
+            )
+            base.storeBytes(
+                of: UInt64(directory),
+                toByteOffset: 24,
+                as: UInt64.self
+            )
+            base.storeBytes(
+                of: Int64(version),
+                toByteOffset: 32,
+                as: Int64.self
+            )
+
+            for (t, table) in _tables.enumerated() {
+                let entry = base + directory + t * Format.directoryEntrySize
+                for (k, byte) in table.name.utf8.enumerated() {
+                    entry.storeBytes(of: byte, toByteOffset: k, as: UInt8.self)
+                }
+                entry.storeBytes(
+                    of: table.kind.rawValue,
+                    toByteOffset: 48,
+                    as: UInt32.self
+                )
+                entry.storeBytes(
+                    of: UInt64(table.count),
+                    toByteOffset: 56,
+                    as: UInt64.self
+                )
+                entry.storeBytes(
+                    of: UInt64(offsets[t]),
+                    toByteOffset: 64,
+                    as: UInt64.self
+                )
+                entry.storeBytes(
+                    of: UInt64(table.payload.count),
+                    toByteOffset: 72,
+                    as: UInt64.self
+                )
+                table.payload.withUnsafeBytes { payload in
+                    guard let source = payload.baseAddress else {
+                        return
+                    }
+                    (base + offsets[t]).copyMemory(
+                        from: source,
+                        byteCount: payload.count
+                    )
+                }
+            }
+        }
+        return data
+    }
+
+    /// Write the store to a file.
+    ///
+    /// The file is written atomically, so a process mapping the previous
+    /// version keeps a consistent view.
+    ///
+    /// - Parameter path: The destination path.
+    /// - Throws: `GMPError.fileAccess` if the file cannot be written.
+    public func write(to path: String) throws {
+        do {
+            try serialized().write(
+                to: URL(fileURLWithPath: path),
+                options: .atomic
+            )
+        } catch {
+            throw GMPError.fileAccess(path)
+        }
+    }
+}
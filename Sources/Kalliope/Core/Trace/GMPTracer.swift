@@ -0,0 +1,238 @@
+import CKalliope
+import CKalliopeBridge
+import Foundation
+
+/// Operation families that `GMPTracer` can record.
+public struct GMPTraceCategory: OptionSet, Hashable, Sendable {
+    public let rawValue: UInt32
+
+    public init(rawValue: UInt32) {
+        self.rawValue = rawValue
+    }
+
+    /// Integer multiplication.
+    public static let multiply = GMPTraceCategory(rawValue: 1 << 0)
+
+    /// Integer division, quotients and remainders.
+    public static let divide = GMPTraceCategory(rawValue: 1 << 1)
+
+    /// Modular exponentiation.
+    public static let powm = GMPTraceCategory(rawValue: 1 << 2)
+
+    /// Conversion between integers and strings.
+    public static let radixConversion = GMPTraceCategory(rawValue: 1 << 3)
+
+    /// MPFR transcendental functions (recorded by Linus).
+    public static let transcendental = GMPTraceCategory(rawValue: 1 << 4)
+
+    /// Every category.
+    public static let all: GMPTraceCategory = [
+        .multiply, .divide, .powm, .radixConversion, .transcendental,
+    ]
+
+    /// The name used in exported traces.
+    var _name: String {
+        switch self {
+        case .multiply: "multiply"
+        case .divide: "divide"
+        case .powm: "powm"
+        case .radixConversion: "radix"
+        case .transcendental: "transcendental"
+        default: "other"
+        }
+    }
+}
+
+/// One recorded operation.
+public struct GMPTraceEvent: Sendable {
+    /// The operation, such as `"mpz_mul"`.
+    public let name: String
+
+    /// The operation family.
+    public let category: GMPTraceCategory
+
+    /// The start time, in nanoseconds on a monotonic clock.
+    public let startNanoseconds: UInt64
+
+    /// The duration, in nanoseconds.
+    public let durationNanoseconds: UInt64
+
+    /// The operand size: limbs of the largest integer operand, or bits of
+    /// precision for MPFR operations.
+    public let size: Int
+
+    /// A small index identifying the recording thread.
+    public let threadIndex: Int
+}
+
+/// Opt-in tracing of Kalliope and Linus operations.
+///
+/// Sampling profilers attribute time to a handful of `__gmpn_*` frames;
+/// the tracer instead records each traced operation with its name and
+/// operand size, so a timeline shows which logical operation is slow.
+///
+/// Tracing is compiled in only when the package is built with the
+/// `KALLIOPE_TRACING` compilation condition (set the `KALLIOPE_TRACING`
+/// environment variable when resolving the package). Otherwise every traced
+/// operation compiles to a direct call and the tracer never records.
+///
+/// When compiled in, nothing is recorded until categories are enabled. Each
+/// thread records into its own fixed-size ring buffer without locks; when a
+/// ring is full the oldest events are overwritten.
+///
+/// ```swift
+/// GMPTracer.enabledCategories = [.multiply, .divide]
+/// runWorkload()
+/// try GMPTracer.writeChromeTrace(to: "trace.json")
+/// ```
+public enum GMPTracer {
+    /// Whether tracing was compiled in.
+    public static var isCompiledIn: Bool {
+        #if KALLIOPE_TRACING
+            true
+        #else
+            false
+        #endif
+    }
+
+    /// The categories currently being recorded. Empty by default.
+    ///
+    /// Setting this has no effect on what is recorded unless tracing is
+    /// compiled in.
+    public static var enabledCategories: GMPTraceCategory {
+        get {
+            GMPTraceCategory(rawValue: ckalliope_trace_get_mask())
+        }
+        set {
+            ckalliope_trace_set_mask(newValue.rawValue)
+        }
+    }
+
+    /// Discard all recorded events.
+    public static func reset() {
+        ckalliope_trace_reset()
+    }
+
+    /// The events currently retained by all threads, ordered by start time.
+    public static func events() -> [GMPTraceEvent] {
+        let capacity = ckalliope_trace_capacity()
+        guard capacity > 0 else {
+            return []
+        }
+        let buffer = UnsafeMutablePointer<ckalliope_trace_event>
+            .allocate(capacity: capacity)
+        defer { buffer.deallocate() }
+        let count = ckalliope_trace_snapshot(buffer, capacity)
+        return (0 ..< count).map { i in
+            let event = buffer[i]
+            return GMPTraceEvent(
+                name: String(cString: event.name),
+                category: GMPTraceCategory(rawValue: event.category),
+                startNanoseconds: event.start_ns,
+                durationNanoseconds: event.duration_ns,
+                size: Int(event.size),
+                threadIndex: Int(event.thread_index)
+            )
+        }
+        .sorted { $0.startNanoseconds < $1.startNanoseconds }
+    }
+
+    /// The retained events in Chrome trace event format.
+    ///
+    /// Each operation is a complete (`"X"`) event with its operand size in
+    /// `args`. The result opens in `chrome://tracing` and Perfetto.
+    ///
+    /// - Returns: The trace as a JSON string.
+    public static func chromeTraceJSON() -> String {
+        let events = events()
+        let origin = events.first?.startNanoseconds ?? 0
+        var json = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":["
+        for (i, event) in events.enumerated() {
+            if i > 0 {
+                json += ","
+            }
+            let start = Double(event.startNanoseconds - origin) / 1000
+            let duration = Double(event.durationNanoseconds) / 1000
+            json += "{\"name\":\"\(_escaped(event.name))\""
+            json += ",\"cat\":\"\(event.category._name)\",\"ph\":\"X\""
+            json += ",\"ts\":\(start),\"dur\":\(duration)"
+            json += ",\"pid\":1,\"tid\":\(event.threadIndex)"
+            json += ",\"args\":{\"size\":\(event.size)}}"
+        }
+        json += "]}"
+        return json
+    }
+
+    /// Write the retained events to a Chrome trace JSON file.
+    ///
+    /// - Parameter path: The destination path.
+    /// - Throws: `GMPError.fileAccess` if the file cannot be written.
+    public static func writeChromeTrace(to path: String) throws {
+        do {
+            try Data(chromeTraceJSON().utf8).write(
+                to: URL(fileURLWithPath: path),
+                options: .atomic
+            )
+        } catch {
+            throw GMPError.fileAccess(path)
+        }
+    }
+
+    private static func _escaped(_ string: String) -> String {
+        string.replacingOccurrences(of: "\\", with: "\\\\")
+            .replacingOccurrences(of: "\"", with: "\\\"")
+    }
+
+    // MARK: - Recording
+
+    /// Run `body`, recording it as `name` if `category` is enabled.
+    ///
+    /// This is the hook used by traced operations. Without
+    /// `KALLIOPE_TRACING` it inlines to a direct call of `body`.
+    ///
+    /// - Parameters:
+    ///   - category: The operation family. Must be a single category.
+    ///   - name: The operation name.
+    ///   - size: The operand size, in limbs or bits of precision.
+    ///   - body: The operation.
+    /// - Returns: The value returned by `body`.
+    @inlinable @inline(__always)
+    public static func _trace<T>(
+        _ category: GMPTraceCategory,
+        _ name: StaticString,
+        size: @autoclosure () -> Int,
+        _ body: () throws -> T
+    ) rethrows -> T {
+        #if KALLIOPE_TRACING
+            guard let start = _begin(category) else {
+                return try body()
+            }
+            defer { _end(category, name, start: start, size: size()) }
+        #endif
+        return try body()
+    }
+
+    /// The start time if `category` is enabled, otherwise `nil`.
+    @usableFromInline
+    static func _begin(_ category: GMPTraceCategory) -> UInt64? {
+        guard ckalliope_trace_get_mask() & category.rawValue != 0 else {
+            return nil
+        }
+        return ckalliope_trace_now()
+    }
+
+    @usableFromInline
+    static func _end(
+        _ category: GMPTraceCategory,
+        _ name: StaticString,
+        start: UInt64,
+        size: Int
+    ) {
+        ckalliope_trace_record(
+            category.rawValue,
+            name.utf8Start,
+            start,
+            Int64(size)
+        )
+    }
+}
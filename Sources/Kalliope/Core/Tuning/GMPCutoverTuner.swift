@@ -0,0 +1,193 @@
+import Dispatch
+
+/// A workload that measures one tuning parameter's cutover.
+///
+/// The benchmark prepares an operation at each scale. The tuner times the
+/// operation with the parameter forced to `Int.max` (the basic strategy)
+/// and to 0 (the strategy the parameter guards), and looks for the work
+/// above which the guarded strategy is consistently faster.
+public struct GMPCutoverBenchmark {
+    /// The parameter being tuned.
+    public let parameter: GMPTuningParameter
+
+    /// The scales to measure, in increasing order.
+    public let scales: [Int]
+
+    /// Prepare the operation for a scale.
+    ///
+    /// Returns the operation's work, in the units the parameter is compared
+    /// against, and the operation to time. Setup is not timed.
+    public let prepare: (Int) -> (work: Int, operation: () -> Void)
+
+    /// Create a benchmark.
+    ///
+    /// - Parameters:
+    ///   - parameter: The parameter being tuned.
+    ///   - scales: The scales to measure, in increasing order.
+    ///   - prepare: Prepares the operation for a scale.
+    public init(
+        parameter: GMPTuningParameter,
+        scales: [Int],
+        prepare: @escaping (Int) -> (work: Int, operation: () -> Void)
+    ) {
+        self.parameter = parameter
+        self.scales = scales
+        self.prepare = prepare
+    }
+
+    /// Row operations on a `GMPIntegerMatrix` with 4-limb entries.
+    public static var integerMatrixRowOperations: GMPCutoverBenchmark {
+        GMPCutoverBenchmark(
+            parameter: .integerMatrixParallelThreshold,
+            scales: [4, 8, 16, 32, 64, 128, 256, 512, 1024]
+        ) { columns in
+            let sources = 8
+            let entry = (GMPInteger(1) << 255) - 1
+            var matrix = GMPIntegerMatrix(
+                (0 ... sources).map { _ in
+                    [GMPInteger](repeating: entry, count: columns)
+                }
+            )
+            let coefficients = (1 ... sources).map { GMPInteger($0) }
+            return (
+                columns * sources * entry.limbCount,
+                {
+                    matrix.subtractLinearCombination(
+                        ofRows: Array(0 ..< sources),
+                        coefficients: coefficients,
+                        fromRow: sources
+                    )
+                }
+            )
+        }
+    }
+}
+
+/// One scale of a cutover measurement.
+public struct GMPCutoverMeasurement: Sendable {
+    /// The scale passed to the benchmark.
+    public let scale: Int
+
+    /// The operation's work, in the parameter's units.
+    public let work: Int
+
+    /// The best time with the basic strategy, in nanoseconds.
+    public let basicNanoseconds: UInt64
+
+    /// The best time with the guarded strategy, in nanoseconds.
+    public let guardedNanoseconds: UInt64
+}
+
+/// The measured cutover for one parameter.
+public struct GMPCutoverResult: Sendable {
+    /// The parameter.
+    public let parameter: GMPTuningParameter
+
+    /// The smallest measured work from which the guarded strategy is faster
+    /// at every larger scale, or `Int.max` if it never is.
+    public let threshold: Int
+
+    /// The measurements, one per scale.
+    public let measurements: [GMPCutoverMeasurement]
+}
+
+/// Measures cutovers on the current machine and produces a tuning profile.
+///
+/// This is Kalliope's counterpart of GMP's `tuneup`: GMP tunes its own
+/// `mpn` thresholds when it is built, while the tuner measures the
+/// strategy thresholds Kalliope and Linus add on top, such as when to split
+/// matrix kernels across cores.
+///
+/// ```swift
+/// let profile = GMPCutoverTuner().run()
+/// try profile.write(to: "tuning.json")
+/// ```
+///
+/// - Note: Measurements override parameters process-wide while they run.
+///   Run the tuner on an otherwise idle machine, in a release build.
+public struct GMPCutoverTuner {
+    /// The benchmarks to run.
+    public var benchmarks: [GMPCutoverBenchmark]
+
+    /// The number of timed runs per strategy and scale; the fastest counts.
+    public var repetitions: Int
+
+    /// Create a tuner.
+    ///
+    /// - Parameters:
+    ///   - benchmarks: The benchmarks to run. Defaults to Kalliope's own.
+    ///   - repetitions: Timed runs per strategy and scale. Defaults to 5.
+    public init(
+        benchmarks: [GMPCutoverBenchmark] = [.integerMatrixRowOperations],
+        repetitions: Int = 5
+    ) {
+        precondition(repetitions > 0, "repetitions must be positive")
+        self.benchmarks = benchmarks
+        self.repetitions = repetitions
+    }
+
+    /// Measure one benchmark.
+    ///
+    /// - Parameter benchmark: The benchmark.
+    /// - Returns: The measurements and the resulting threshold.
+    public func measure(_ benchmark: GMPCutoverBenchmark) -> GMPCutoverResult {
+        let measurements = benchmark.scales.map { scale in
+            let (work, operation) = benchmark.prepare(scale)
+            operation() // Warm up caches and lazily allocated storage
+            let basic = GMPTuning.withValue(.max, for: benchmark.parameter) {
+                _fastest(operation)
+            }
+            let guarded = GMPTuning.withValue(0, for: benchmark.parameter) {
+                _fastest(operation)
+            }
+            return GMPCutoverMeasurement(
+                scale: scale,
+                work: work,
+                basicNanoseconds: basic,
+                guardedNanoseconds: guarded
+            )
+        }
+        var threshold = Int.max
+        for measurement in measurements.reversed() {
+            guard measurement.guardedNanoseconds
+                < measurement.basicNanoseconds
+            else {
+                break
+            }
+            threshold = measurement.work
+        }
+        return GMPCutoverResult(
+            parameter: benchmark.parameter,
+            threshold: threshold,
+            measurements: measurements
+        )
+    }
+
+    /// Measure every benchmark.
+    ///
+    /// - Parameter progress: Called with each result as it is measured.
+    /// - Returns: A profile for the current machine with one value per
+    ///   benchmark.
+    public func run(
+        progress: (GMPCutoverResult) -> Void = { _ in }
+    ) -> GMPTuningProfile {
+        var profile = GMPTuningProfile()
+        for benchmark in benchmarks {
+            let result = measure(benchmark)
+            profile[result.parameter] = result.threshold
+            progress(result)
+        }
+        return profile
+    }
+
+    private func _fastest(_ operation: () -> Void) -> UInt64 {
+        var best = UInt64.max
+        for _ in 0 ..< repetitions {
+            let start = DispatchTime.now().uptimeNanoseconds
+            operation()
+            let elapsed = DispatchTime.now().uptimeNanoseconds - start
+            best = Swift.min(best, elapsed)
+        }
+        return best
+    }
+}
@@ -0,0 +1,263 @@
+import Foundation
+
+/// A named, size-dependent cutover used to choose between strategies.
+///
+/// Each parameter has a compiled-in default. The value in effect is read
+/// from the process-wide `GMPTuning.profile`, which may override the
+/// default with a value measured on the current machine by
+/// `GMPCutoverTuner`.
+///
+/// Modules declare their own parameters as static members:
+///
+/// ```swift
+/// extension GMPTuningParameter {
+///     static let myCutover = GMPTuningParameter(
+///         "myModule.myCutover",
+///         default: 1000
+///     )
+/// }
+/// ```
+public struct GMPTuningParameter: Hashable, Sendable {
+    /// The key of the parameter in a tuning profile.
+    public let name: String
+
+    /// The value used when the profile does not set this parameter.
+    public let defaultValue: Int
+
+    /// Create a parameter.
+    ///
+    /// - Parameters:
+    ///   - name: The profile key, conventionally `"<type>.<property>"`.
+    ///   - defaultValue: The compiled-in value.
+    public init(_ name: String, default defaultValue: Int) {
+        self.name = name
+        self.defaultValue = defaultValue
+    }
+
+    /// The value in effect: the profile's value if it sets one, otherwise
+    /// the default.
+    public var value: Int {
+        GMPTuning._state.value(for: self)
+    }
+
+    /// The minimum estimated work before `GMPIntegerMatrix` row operations
+    /// are split across cores.
+    public static let integerMatrixParallelThreshold = GMPTuningParameter(
+        "GMPIntegerMatrix.parallelThreshold",
+        default: 4096
+    )
+}
+
+/// Measured cutover values for one machine.
+///
+/// Profiles are stored as JSON:
+///
+/// ```json
+/// {"machine": "arm64, 10 cores",
+///  "values": {"GMPIntegerMatrix.parallelThreshold": 2048}}
+/// ```
+///
+/// Parameters missing from a profile keep their compiled-in defaults, so a
+/// profile written by an older tuner remains valid.
+public struct GMPTuningProfile: Codable, Equatable, Sendable {
+    /// A description of the machine the profile was measured on.
+    public var machine: String
+
+    /// The tuned values, keyed by parameter name.
+    public var values: [String: Int]
+
+    /// Create a profile.
+    ///
+    /// - Parameters:
+    ///   - machine: The machine description. Defaults to
+    ///     `GMPTuningProfile.currentMachine`.
+    ///   - values: The tuned values. Defaults to none.
+    public init(
+        machine: String = GMPTuningProfile.currentMachine,
+        values: [String: Int] = [:]
+    ) {
+        self.machine = machine
+        self.values = values
+    }
+
+    /// Read a profile from a JSON file.
+    ///
+    /// - Parameter path: The path of a file written by `write(to:)`.
+    /// - Throws: `GMPError.fileAccess` if the file cannot be read,
+    ///   `GMPError.invalidTuningProfile` if it is not a tuning profile.
+    public init(contentsOf path: String) throws {
+        let data: Data
+        do {
+            data = try Data(contentsOf: URL(fileURLWithPath: path))
+        } catch {
+            throw GMPError.fileAccess(path)
+        }
+        do {
+            self = try JSONDecoder().decode(Self.self, from: data)
+        } catch {
+            throw GMPError.invalidTuningProfile
+        }
+    }
+
+    /// The value for a parameter: the profile's value if it sets one,
+    /// otherwise the default.
+    public subscript(parameter: GMPTuningParameter) -> Int {
+        get {
+            values[parameter.name] ?? parameter.defaultValue
+        }
+        set {
+            values[parameter.name] = newValue
+        }
+    }
+
+    /// Write the profile as JSON.
+    ///
+    /// - Parameter path: The destination path.
+    /// - Throws: `GMPError.fileAccess` if the file cannot be written.
+    public func write(to path: String) throws {
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = [.prettyPrinted, .sortedKeys]
+        do {
+            try encoder.encode(self).write(
+                to: URL(fileURLWithPath: path),
+                options: .atomic
+            )
+        } catch {
+            throw GMPError.fileAccess(path)
+        }
+    }
+
+    /// The architecture and core count of the current machine.
+    public static var currentMachine: String {
+        #if arch(arm64)
+            let architecture = "arm64"
+        #elseif arch(x86_64)
+            let architecture = "x86_64"
+        #else
+            let architecture = "unknown"
+        #endif
+        let cores = ProcessInfo.processInfo.activeProcessorCount
+        return "\(architecture), \(cores) cores"
+    }
+}
+
+/// The process-wide tuning profile.
+///
+/// On first use the profile is loaded from the file named by the
+/// `KALLIOPE_TUNING_PROFILE` environment variable. If the variable is unset
+/// or the file cannot be read, every parameter keeps its compiled-in
+/// default.
+///
+/// Generate a profile for the current machine with the `KalliopeTune`
+/// executable:
+///
+/// ```sh
+/// swift run -c release KalliopeTune tuning.json
+/// KALLIOPE_TUNING_PROFILE=tuning.json ./my-app
+/// ```
+public enum GMPTuning {
+    /// The environment variable naming the profile loaded at startup.
+    public static let environmentVariable = "KALLIOPE_TUNING_PROFILE"
+
+    /// The profile in effect.
+    ///
+    /// Setting this replaces the profile for the whole process.
+    public static var profile: GMPTuningProfile {
+        get {
+            _state.profile
+        }
+        set {
+            _state.profile = newValue
+        }
+    }
+
+    /// Replace the profile with one read from a file.
+    ///
+    /// - Parameter path: The path of a profile.
+    /// - Throws: `GMPError.fileAccess` or `GMPError.invalidTuningProfile`
+    ///   if the profile cannot be read; the current profile is kept.
+    public static func load(from path: String) throws {
+        profile = try GMPTuningProfile(contentsOf: path)
+    }
+
+    /// Discard any tuned values, restoring the compiled-in defaults.
+    public static func resetToDefaults() {
+        profile = GMPTuningProfile()
+    }
+
+    /// Run `body` with `parameter` temporarily set to `value`.
+    ///
+    /// Used by `GMPCutoverTuner` to force one strategy or the other. The
+    /// override is process-wide, not scoped to the calling thread, since
+    /// the work it steers may run on other cores. Setting and restoring
+    /// the value are each atomic, so overrides of different parameters do
+    /// not disturb each other; overrides of the same parameter must not
+    /// overlap.
+    ///
+    /// - Parameters:
+    ///   - parameter: The parameter to override.
+    ///   - value: The temporary value.
+    ///   - body: The work to run.
+    /// - Returns: The value returned by `body`.
+    public static func withValue<T>(
+        _ value: Int,
+        for parameter: GMPTuningParameter,
+        _ body: () throws -> T
+    ) rethrows -> T {
+        let saved = _state.exchange(value, for: parameter)
+        defer { _state.exchange(saved, for: parameter) }
+        return try body()
+    }
+
+    static let _state = _GMPTuningState()
+}
+
+/// Lock-protected storage for `GMPTuning.profile`.
+final class _GMPTuningState: @unchecked Sendable {
+    /// Guards `_profile`.
+    private let lock = NSLock()
+
+    private var _profile: GMPTuningProfile
+
+    init() {
+        let environment = ProcessInfo.processInfo.environment
+        if let path = environment[GMPTuning.environmentVariable],
+           let loaded = try? GMPTuningProfile(contentsOf: path)
+        {
+            _profile = loaded
+        } else {
+            _profile = GMPTuningProfile()
+        }
+    }
+
+    var profile: GMPTuningProfile {
+        get {
+            lock.lock()
+            defer { lock.unlock() }
+            return _profile
+        }
+        set {
+            lock.lock()
+            defer { lock.unlock() }
+            _profile = newValue
+        }
+    }
+
+    /// Set or clear one value of the profile.
+    ///
+    /// - Returns: The profile's previous value for `parameter`.
+    @discardableResult
+    func exchange(_ value: Int?, for parameter: GMPTuningParameter) -> Int? {
+        lock.lock()
+        defer { lock.unlock() }
+        let previous = _profile.values[parameter.name]
+        _profile.values[parameter.name] = value
+        return previous
+    }
+
+    func value(for parameter: GMPTuningParameter) -> Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return _profile.values[parameter.name] ?? parameter.defaultValue
+    }
+}
@@ -0,0 +1,396 @@
+import CKalliope
+import CKalliopeBridge
+import Foundation
+
+/// Operation families that `GMPVerification` checks and counts.
+public struct GMPVerificationCategory: OptionSet, Hashable, Sendable {
+    public let rawValue: UInt32
+
+    public init(rawValue: UInt32) {
+        self.rawValue = rawValue
+    }
+
+    /// Integer products.
+    public static let multiply = GMPVerificationCategory(rawValue: 1 << 0)
+
+    /// Integer quotients and remainders.
+    public static let divide = GMPVerificationCategory(rawValue: 1 << 1)
+
+    /// Modular exponentiation.
+    public static let powm = GMPVerificationCategory(rawValue: 1 << 2)
+
+    /// Products of dense and sparse polynomials.
+    public static let polynomialProduct = GMPVerificationCategory(
+        rawValue: 1 << 3
+    )
+
+    /// Every category.
+    public static let all: GMPVerificationCategory = [
+        .multiply, .divide, .powm, .polynomialProduct,
+    ]
+}
+
+/// The checks of one category since the last reset.
+public struct GMPVerificationStatistics: Sendable {
+    /// The category counted.
+    public let category: GMPVerificationCategory
+
+    /// The number of results checked.
+    public let checks: Int
+
+    /// The number of results found wrong.
+    public let failures: Int
+
+    /// `failures / checks`, or zero before any check.
+    public var failureRate: Double {
+        checks == 0 ? 0 : Double(failures) / Double(checks)
+    }
+}
+
+/// Randomized checks of big-integer and polynomial results.
+///
+/// A result is checked by reducing every operand modulo a few random
+/// 61-bit primes and repeating the operation on the residues, so a check
+/// costs one `mpz_fdiv_ui` pass over each operand, linear in its size,
+/// where the operation itself may be superlinear or may have run across
+/// cores. A wrong integer result passes only if the error is divisible by
+/// every chosen prime; with a difference of `b` bits that happens for at
+/// most `b / 60` of the primes, so each prime passes a given wrong result
+/// with probability below `b / 2^55`. Polynomial products are compared at
+/// a random point modulo each prime.
+///
+/// Modular powers are the exception: the unknown multiple of the modulus
+/// rules out a residue check of `a^e mod m` alone, so the power is
+/// recomputed modulo `m·p` for a random prime `p`, and that recomputation
+/// is itself checked against a word-sized power modulo `p`.
+///
+/// Checks can also run automatically: operations in `automaticCategories`
+/// check their own results once their operands reach
+/// `automaticMinimumLimbs`, and multimodular and parallel polynomial
+/// products check every result. Every check, explicit or automatic, is
+/// counted in `statistics()`.
+///
+/// The primes are drawn once per process from the system random source.
+///
+/// ```swift
+/// GMPVerification.automaticCategories = [.multiply, .polynomialProduct]
+/// runWorkload()
+/// let failures = GMPVerification.statistics().map(\.failureRate)
+/// ```
+public enum GMPVerification {
+    /// The number of primes each check uses unless told otherwise.
+    public static let defaultPrimeCount = 2
+
+    // MARK: - Automatic Checks
+
+    /// The categories whose operations check their own results. Empty by
+    /// default.
+    public static var automaticCategories: GMPVerificationCategory {
+        get {
+            GMPVerificationCategory(rawValue: ckalliope_verify_get_mask())
+        }
+        set {
+            ckalliope_verify_set_mask(newValue.rawValue)
+        }
+    }
+
+    /// The operand size, in limbs of the largest operand (the modulus for
+    /// modular powers), from which integer operations check themselves.
+    /// 256 by default.
+    public static var automaticMinimumLimbs: Int {
+        get {
+            Int(ckalliope_verify_get_minimum_limbs())
+        }
+        set {
+            precondition(newValue >= 0, "size must not be negative")
+            ckalliope_verify_set_minimum_limbs(Int64(newValue))
+        }
+    }
+
+    /// Whether an operation of `category` on operands of `size` limbs
+    /// checks its result automatically.
+    @inline(__always)
+    static func _isAutomatic(
+        _ category: GMPVerificationCategory,
+        size: Int = .max
+    ) -> Bool {
+        ckalliope_verify_get_mask() & category.rawValue != 0
+            && size >= ckalliope_verify_get_minimum_limbs()
+    }
+
+    // MARK: - Statistics
+
+    /// The counters of one category.
+    ///
+    /// - Parameter category: A single category, such as `.multiply`. Sets
+    ///   of categories are not summed; call `statistics()` for all of them.
+    public static func statistics(
+        for category: GMPVerificationCategory
+    ) -> GMPVerificationStatistics {
+        precondition(
+            category.rawValue.nonzeroBitCount == 1,
+            "category must be a single category"
+        )
+        var checks: UInt64 = 0
+        var failures: UInt64 = 0
+        ckalliope_verify_counts(category.rawValue, &checks, &failures)
+        return GMPVerificationStatistics(
+            category: category,
+            checks: Int(checks),
+            failures: Int(failures)
+        )
+    }
+
+    /// The counters of every category.
+    public static func statistics() -> [GMPVerificationStatistics] {
+        [.multiply, .divide, .powm, .polynomialProduct].map {
+            statistics(for: $0)
+        }
+    }
+
+    /// Zero every counter.
+    public static func resetStatistics() {
+        ckalliope_verify_reset()
+    }
+
+    private static func _record(
+        _ category: GMPVerificationCategory,
+        _ passed: Bool
+    ) -> Bool {
+        precondition(
+            category.rawValue.nonzeroBitCount == 1,
+            "category must be a single category"
+        )
+        ckalliope_verify_record(category.rawValue, passed)
+        return passed
+    }
+
+    // MARK: - Integers
+
+    /// Check that `product == lhs * rhs`.
+    ///
+    /// - Parameters:
+    ///   - product: The claimed product.
+    ///   - lhs: The first factor.
+    ///   - rhs: The second factor.
+    ///   - primeCount: The number of random primes, from 1 to 32.
+    /// - Returns: `false` if the product is certainly wrong, `true` if it
+    ///   agrees modulo every prime.
+    public static func verifyProduct(
+        _ product: GMPInteger,
+        _ lhs: GMPInteger,
+        _ rhs: GMPInteger,
+        primeCount: Int = defaultPrimeCount
+    ) -> Bool {
+        let passed = _fields(primeCount).allSatisfy { field in
+            field.residue(of: product) == field.multiply(
+                field.residue(of: lhs),
+                field.residue(of: rhs)
+            )
+        }
+        return _record(.multiply, passed)
+    }
+
+    /// Check that `dividend == quotient * divisor + remainder` with
+    /// `|remainder| < |divisor|`, which holds for floor, ceiling and
+    /// truncated division alike.
+    ///
+    /// - Parameters:
+    ///   - dividend: The number divided.
+    ///   - divisor: The divisor. Must not be zero.
+    ///   - quotient: The claimed quotient.
+    ///   - remainder: The claimed remainder.
+    ///   - primeCount: The number of random primes, from 1 to 32.
+    /// - Returns: `false` if the division is certainly wrong, `true` if it
+    ///   agrees modulo every prime.
+    public static func verifyDivision(
+        dividend: GMPInteger,
+        divisor: GMPInteger,
+        quotient: GMPInteger,
+        remainder: GMPInteger,
+        primeCount: Int = defaultPrimeCount
+    ) -> Bool {
+        precondition(!divisor.isZero, "divisor must not be zero")
+        let passed = remainder.compareAbsoluteValue(to: divisor) < 0
+            && _fields(primeCount).allSatisfy { field in
+                field.residue(of: dividend) == field.add(
+                    field.multiply(
+                        field.residue(of: quotient),
+                        field.residue(of: divisor)
+                    ),
+                    field.residue(of: remainder)
+                )
+            }
+        return _record(.divide, passed)
+    }
+
+    /// Check that `power == base^exponent mod |modulus|`.
+    ///
+    /// The power is recomputed modulo `|modulus|·p` for one random prime
+    /// `p`, which costs about as much as the original exponentiation; the
+    /// recomputed value is checked modulo `p` against a word-sized power.
+    /// A negative exponent is checked as `power · base^|exponent| ≡ 1`.
+    ///
+    /// - Parameters:
+    ///   - power: The claimed power.
+    ///   - base: The base.
+    ///   - exponent: The exponent.
+    ///   - modulus: The modulus. Must not be zero.
+    /// - Returns: `false` if the power is certainly wrong.
+    public static func verifyModularPower(
+        _ power: GMPInteger,
+        base: GMPInteger,
+        exponent: GMPInteger,
+        modulus: GMPInteger
+    ) -> Bool {
+        precondition(!modulus.isZero, "modulus must not be zero")
+        let field = _fields(1)[0]
+        let p = field.modulus
+        let m = modulus.absoluteValue()
+        guard !power.isNegative, power.compareAbsoluteValue(to: m) < 0 else {
+            return _record(.powm, false)
+        }
+        // t = base^|exponent| mod m·p, by a separate mpz_powm
+        let e = exponent.absoluteValue()
+        let extended = m * Int(p)
+        let t = GMPInteger()
+        __gmpz_powm(
+            &t._storage.value,
+            &base._storage.value,
+            &e._storage.value,
+            &extended._storage.value
+        )
+        // Fermat's little theorem reduces the exponent modulo p - 1
+        let b = field.residue(of: base)
+        let expected: UInt64 = if e.isZero {
+            1
+        } else if b == 0 {
+            0
+        } else {
+            field.power(
+                b,
+                UInt64(try! e.floorRemainder(dividingBy: Int(p - 1)))
+            )
+        }
+        guard field.residue(of: t) == expected else {
+            return _record(.powm, false)
+        }
+        let u = try! t.floorRemainder(dividingBy: m)
+        guard exponent.isNegative else {
+            return _record(.powm, u == power)
+        }
+        let product = GMPInteger()
+        __gmpz_mul(
+            &product._storage.value,
+            &u._storage.value,
+            &power._storage.value
+        )
+        let one = try! GMPInteger(1).floorRemainder(dividingBy: m)
+        let passed = try! product.floorRemainder(dividingBy: m) == one
+        return _record(.powm, passed)
+    }
+
+    // MARK: - Polynomials
+
+    /// Check a product of dense polynomials by comparing values at a
+    /// random point modulo each prime.
+    ///
+    /// - Parameters:
+    ///   - product: The claimed product's coefficients, constant term
+    ///     first.
+    ///   - lhs: The first factor's coefficients.
+    ///   - rhs: The second factor's coefficients.
+    ///   - primeCount: The number of random primes, from 1 to 32.
+    /// - Returns: `false` if the product is certainly wrong.
+    public static func verifyPolynomialProduct(
+        _ product: [GMPInteger],
+        _ lhs: [GMPInteger],
+        _ rhs: [GMPInteger],
+        primeCount: Int = defaultPrimeCount
+    ) -> Bool {
+        let length = lhs.isEmpty || rhs.isEmpty
+            ? 0 : lhs.count + rhs.count - 1
+        guard product.count == length else {
+            return _record(.polynomialProduct, false)
+        }
+        let passed = _fields(primeCount).allSatisfy { field in
+            let x = field.reduce(UInt64.random(in: 0 ... UInt64.max))
+            func value(_ coefficients: [GMPInteger]) -> UInt64 {
+                coefficients.reversed().reduce(0) { sum, c in
+                    field.add(field.multiply(sum, x), field.residue(of: c))
+                }
+            }
+            return value(product) == field.multiply(value(lhs), value(rhs))
+        }
+        return _record(.polynomialProduct, passed)
+    }
+
+    /// Check a product of sparse polynomials by comparing values at a
+    /// random point modulo each prime.
+    ///
+    /// - Parameters:
+    ///   - product: The claimed product.
+    ///   - lhs: The first factor.
+    ///   - rhs: The second factor.
+    ///   - primeCount: The number of random primes, from 1 to 32.
+    /// - Returns: `false` if the product is certainly wrong.
+    public static func verifyPolynomialProduct(
+        _ product: SparsePolynomial,
+        _ lhs: SparsePolynomial,
+        _ rhs: SparsePolynomial,
+        primeCount: Int = defaultPrimeCount
+    ) -> Bool {
+        precondition(
+            lhs.variableCount == rhs.variableCount
+                && product.variableCount == lhs.variableCount,
+            "polynomials must have the same number of variables"
+        )
+        let passed = _fields(primeCount).allSatisfy { field in
+            let point = (0 ..< lhs.variableCount).map { _ in
+                field.reduce(UInt64.random(in: 0 ... UInt64.max))
+            }
+            func value(_ f: SparsePolynomial) -> UInt64 {
+                zip(f._monomials, f._coefficients).reduce(0) { sum, term in
+                    let exponents = f._unpack(term.0)
+                    var t = field.residue(of: term.1)
+                    for (x, e) in zip(point, exponents) where e > 0 {
+                        t = field.multiply(t, field.power(x, UInt64(e)))
+                    }
+                    return field.add(sum, t)
+                }
+            }
+            return value(product) == field.multiply(value(lhs), value(rhs))
+        }
+        return _record(.polynomialProduct, passed)
+    }
+
+    // MARK: - Primes
+
+    /// Random primes in `2^60 ..< 2^61`.
+    private static let _primes: [WordPrimeField] = {
+        var generator = SystemRandomNumberGenerator()
+        var primes: [WordPrimeField] = []
+        while primes.count < 32 {
+            let candidate = UInt64.random(
+                in: 1 << 60 ..< 1 << 61,
+                using: &generator
+            ) | 1
+            if GMPInteger(Int(candidate)).isProbablePrime() > 0,
+               !primes.contains(where: { $0.modulus == candidate })
+            {
+                primes.append(WordPrimeField(_prime: candidate))
+            }
+        }
+        return primes
+    }()
+
+    /// `count` distinct primes from a random position in the pool.
+    private static func _fields(_ count: Int) -> [WordPrimeField] {
+        precondition(
+            count >= 1 && count <= _primes.count,
+            "prime count must be between 1 and 32"
+        )
+        let start = Int.random(in: 0 ..< _primes.count)
+        return (0 ..< count).map { _primes[(start + $0) % _primes.count] }
+    }
+}
@@ -0,0 +1,386 @@
+import CKalliope
+
+/// A fixed-width signed integer with inline limb storage.
+///
+/// `WideInt` is a two's-complement view over a `WideUInt` of the same width:
+/// addition, subtraction and wrapping multiplication share the unsigned limb
+/// arithmetic, and only sign handling is layered on top. Like `WideUInt`,
+/// values are stored inline and never allocate.
+///
+/// Arithmetic operators follow Swift's fixed-width conventions: `+`, `-` and
+/// `*` trap on signed overflow, while `&+`, `&-` and `&*` wrap.
+public struct WideInt<Storage: WideLimbStorage> {
+    /// The two's-complement bit pattern of this value.
+    public var bitPattern: WideUInt<Storage>
+
+    // MARK: - Initialization
+
+    /// Create a value equal to zero.
+    ///
+    /// - Requires: None
+    /// - Guarantees: Returns a `WideInt` with every limb set to zero.
+    @inlinable
+    public init() {
+        bitPattern = WideUInt()
+    }
+
+    /// Create a value from a two's-complement bit pattern.
+    ///
+    /// - Parameter bitPattern: The bits to reinterpret as a signed value.
+    @inlinable
+    public init(bitPattern: WideUInt<Storage>) {
+        self.bitPattern = bitPattern
+    }
+
+    /// Create a value from a machine integer.
+    ///
+    /// - Parameter value: The value to convert.
+    ///
+    /// - Requires: None
+    /// - Guarantees: Returns a `WideInt` equal to `value`, sign-extended to
+    ///   the full width.
+    @inlinable
+    public init(_ value: Int) {
+        if value < 0 {
+            bitPattern = WideUInt() &- WideUInt(value.magnitude)
+        } else {
+            bitPattern = WideUInt(UInt(value))
+        }
+    }
+
+    /// Create a value from a `GMPInteger`, failing if it does not fit.
+    ///
+    /// - Parameter value: The integer to convert.
+    /// - Returns: A new `WideInt` equal to `value`, or `nil` if `value` is
+    ///   outside `min ... max`.
+    ///
+    /// - Requires: `value` must be properly initialized.
+    /// - Guarantees: If the result is not `nil`, converting it back to
+    ///   `GMPInteger` yields `value` exactly.
+    public init?(exactly value: GMPInteger) {
+        let magnitude = value.absoluteValue()
+        guard let bits = WideUInt<Storage>(exactly: magnitude) else {
+            return nil
+        }
+        let signBit = WideUInt<Storage>(1) << (WideUInt<Storage>.bitWidth - 1)
+        if value.isNegative {
+            guard bits <= signBit else {
+                return nil
+            }
+            bitPattern = WideUInt() &- bits
+        } else {
+            guard bits < signBit else {
+                return nil
+            }
+            bitPattern = bits
+        }
+    }
+
+    /// Create a value from the low `bitWidth` bits of a `GMPInteger`.
+    ///
+    /// - Parameter value: The integer to convert.
+    ///
+    /// - Requires: `value` must be properly initialized.
+    /// - Guarantees: Returns the value congruent to `value` modulo
+    ///   `2^bitWidth` in `min ... max`.
+    public init(truncatingIfNeeded value: GMPInteger) {
+        bitPattern = WideUInt(truncatingIfNeeded: value)
+    }
+
+    // MARK: - Properties
+
+    /// The number of bits in every value of this type.
+    @inlinable
+    public static var bitWidth: Int {
+        WideUInt<Storage>.bitWidth
+    }
+
+    /// The value zero.
+    @inlinable
+    public static var zero: WideInt {
+        WideInt()
+    }
+
+    /// The largest representable value, `2^(bitWidth - 1) - 1`.
+    @inlinable
+    public static var max: WideInt {
+        WideInt(bitPattern: WideUInt.max >> 1)
+    }
+
+    /// The smallest representable value, `-2^(bitWidth - 1)`.
+    @inlinable
+    public static var min: WideInt {
+        WideInt(bitPattern: WideUInt(1) << (bitWidth - 1))
+    }
+
+    /// Check if this value is negative.
+    @inlinable
+    public var isNegative: Bool {
+        bitPattern.testBit(Self.bitWidth - 1)
+    }
+
+    /// Check if this value is zero.
+    @inlinable
+    public var isZero: Bool {
+        bitPattern.isZero
+    }
+
+    /// The sign of this value: -1, 0 or 1.
+    @inlinable
+    public var sign: Int {
+        if isNegative {
+            return -1
+        }
+        return isZero ? 0 : 1
+    }
+
+    /// The absolute value of this value as an unsigned integer.
+    ///
+    /// Always representable, including for `min`.
+    @inlinable
+    public var magnitude: WideUInt<Storage> {
+        isNegative ? WideUInt() &- bitPattern : bitPattern
+    }
+
+    // MARK: - Arithmetic
+
+    /// Add another value, reporting signed overflow.
+    ///
+    /// - Parameter other: The value to add.
+    /// - Returns: The wrapped sum, and `true` if the exact sum is outside
+    ///   `min ... max`.
+    @inlinable
+    public func addingReportingOverflow(
+        _ other: WideInt
+    ) -> (partialValue: WideInt, overflow: Bool) {
+        let result = WideInt(bitPattern: bitPattern &+ other.bitPattern)
+        let overflow = isNegative == other.isNegative
+            && result.isNegative != isNegative
+        return (partialValue: result, overflow: overflow)
+    }
+
+    /// Subtract another value, reporting signed overflow.
+    ///
+    /// - Parameter other: The value to subtract.
+    /// - Returns: The wrapped difference, and `true` if the exact difference is
+    ///   outside `min ... max`.
+    @inlinable
+    public func subtractingReportingOverflow(
+        _ other: WideInt
+    ) -> (partialValue: WideInt, overflow: Bool) {
+        let result = WideInt(bitPattern: bitPattern &- other.bitPattern)
+        let overflow = isNegative != other.isNegative
+            && result.isNegative != isNegative
+        return (partialValue: result, overflow: overflow)
+    }
+
+    /// Multiply by another value, reporting signed overflow.
+    ///
+    /// - Parameter other: The value to multiply by.
+    /// - Returns: The wrapped product, and `true` if the exact product is
+    ///   outside `min ... max`.
+    ///
+    /// - Note: Wraps `mpn_mul_n` on the magnitudes.
+    @inlinable
+    public func multipliedReportingOverflow(
+        by other: WideInt
+    ) -> (partialValue: WideInt, overflow: Bool) {
+        let negative = isNegative != other.isNegative
+        let (high, low) = magnitude.multipliedFullWidth(by: other.magnitude)
+        let signBit = WideUInt<Storage>(1) << (Self.bitWidth - 1)
+        let fits = high.isZero && (low < signBit || negative && low == signBit)
+        let result = negative
+            ? WideInt(bitPattern: WideUInt() &- low)
+            : WideInt(bitPattern: low)
+        return (partialValue: result, overflow: !fits)
+    }
+
+    /// Divide by another value, returning the quotient and remainder.
+    ///
+    /// The quotient is truncated toward zero and the remainder takes the sign
+    /// of `self`, matching Swift's `/` and `%` on fixed-width integers.
+    ///
+    /// - Parameter divisor: The value to divide by. Must not be zero.
+    /// - Returns: The quotient and remainder.
+    ///
+    /// - Throws: `GMPError.divisionByZero` if `divisor` is zero.
+    /// - Throws: `GMPError.overflow` if `self` is `min` and `divisor` is -1.
+    @inlinable
+    public func quotientAndRemainder(
+        dividingBy divisor: WideInt
+    ) throws -> (quotient: WideInt, remainder: WideInt) {
+        if self == .min, divisor == WideInt(-1) {
+            throw GMPError.overflow
+        }
+        let (q, r) = try magnitude
+            .quotientAndRemainder(dividingBy: divisor.magnitude)
+        let quotient = isNegative != divisor.isNegative
+            ? WideInt(bitPattern: WideUInt() &- q)
+            : WideInt(bitPattern: q)
+        let remainder = isNegative
+            ? WideInt(bitPattern: WideUInt() &- r)
+            : WideInt(bitPattern: r)
+        return (quotient: quotient, remainder: remainder)
+    }
+
+    /// Reduce this value modulo a positive modulus.
+    ///
+    /// - Parameter modulus: The modulus. Must not be zero.
+    /// - Returns: The residue in `0 ..< modulus`.
+    @inlinable
+    public func modulo(_ modulus: WideUInt<Storage>) -> WideUInt<Storage> {
+        let residue = magnitude.modulo(modulus)
+        if isNegative, !residue.isZero {
+            return modulus &- residue
+        }
+        return residue
+    }
+
+    /// Shift right arithmetically by `count` bits, rounding toward negative
+    /// infinity.
+    ///
+    /// - Parameter count: The number of bits. Must be non-negative.
+    @inlinable
+    public func rightShifted(by count: Int) -> WideInt {
+        guard isNegative else {
+            return WideInt(bitPattern: bitPattern >> count)
+        }
+        // Shift the complement and complement back to fill with ones
+        return WideInt(bitPattern: ~(~bitPattern >> count))
+    }
+
+    // MARK: - Operator Overloads
+
+    /// Add two values, trapping on overflow.
+    @inlinable
+    public static func + (lhs: WideInt, rhs: WideInt) -> WideInt {
+        let (result, overflow) = lhs.addingReportingOverflow(rhs)
+        precondition(!overflow, "arithmetic overflow")
+        return result
+    }
+
+    /// Subtract two values, trapping on overflow.
+    @inlinable
+    public static func - (lhs: WideInt, rhs: WideInt) -> WideInt {
+        let (result, overflow) = lhs.subtractingReportingOverflow(rhs)
+        precondition(!overflow, "arithmetic overflow")
+        return result
+    }
+
+    /// Multiply two values, trapping on overflow.
+    @inlinable
+    public static func * (lhs: WideInt, rhs: WideInt) -> WideInt {
+        let (result, overflow) = lhs.multipliedReportingOverflow(by: rhs)
+        precondition(!overflow, "arithmetic overflow")
+        return result
+    }
+
+    /// Negate a value, trapping on overflow (negating `min`).
+    @inlinable
+    public static prefix func - (value: WideInt) -> WideInt {
+        WideInt() - value
+    }
+
+    /// Add two values, wrapping.
+    @inlinable
+    public static func &+ (lhs: WideInt, rhs: WideInt) -> WideInt {
+        WideInt(bitPattern: lhs.bitPattern &+ rhs.bitPattern)
+    }
+
+    /// Subtract two values, wrapping.
+    @inlinable
+    public static func &- (lhs: WideInt, rhs: WideInt) -> WideInt {
+        WideInt(bitPattern: lhs.bitPattern &- rhs.bitPattern)
+    }
+
+    /// Multiply two values, wrapping.
+    ///
+    /// The low half of a two's-complement product does not depend on the
+    /// signs, so this is the unsigned wrapping product.
+    @inlinable
+    public static func &* (lhs: WideInt, rhs: WideInt) -> WideInt {
+        WideInt(bitPattern: lhs.bitPattern &* rhs.bitPattern)
+    }
+
+    /// Divide two values, truncating toward zero. Traps on division by zero
+    /// or overflow.
+    @inlinable
+    public static func / (lhs: WideInt, rhs: WideInt) -> WideInt {
+        do {
+            return try lhs.quotientAndRemainder(dividingBy: rhs).quotient
+        } catch {
+            preconditionFailure("division by zero or overflow")
+        }
+    }
+
+    /// The remainder of truncating division. Traps on division by zero.
+    @inlinable
+    public static func % (lhs: WideInt, rhs: WideInt) -> WideInt {
+        precondition(!rhs.isZero, "division by zero")
+        if lhs == .min, rhs == WideInt(-1) {
+            return WideInt()
+        }
+        return try! lhs.quotientAndRemainder(dividingBy: rhs).remainder
+    }
+
+    /// Shift left by `rhs` bits, wrapping.
+    @inlinable
+    public static func << (lhs: WideInt, rhs: Int) -> WideInt {
+        WideInt(bitPattern: lhs.bitPattern << rhs)
+    }
+
+    /// Shift right arithmetically by `rhs` bits.
+    @inlinable
+    public static func >> (lhs: WideInt, rhs: Int) -> WideInt {
+        lhs.rightShifted(by: rhs)
+    }
+}
+
+// MARK: - Protocol Conformances
+
+extension WideInt: Hashable {}
+
+extension WideInt: Sendable {}
+
+extension WideInt: Comparable {
+    @inlinable
+    public static func < (lhs: WideInt, rhs: WideInt) -> Bool {
+        if lhs.isNegative != rhs.isNegative {
+            return lhs.isNegative
+        }
+        // Same sign: two's-complement patterns order like the values
+        return lhs.bitPattern < rhs.bitPattern
+    }
+}
+
+extension WideInt: ExpressibleByIntegerLiteral {
+    /// Create a value from an integer literal.
+    @inlinable
+    public init(integerLiteral value: Int) {
+        self.init(value)
+    }
+}
+
+extension WideInt: CustomStringConvertible {
+    /// The decimal representation of this value.
+    public var description: String {
+        GMPInteger(self).toString()
+    }
+}
+
+// MARK: - GMPInteger Conversion
+
+extension GMPInteger {
+    /// Create an integer from a fixed-width signed value.
+    ///
+    /// - Parameter value: The fixed-width value.
+    ///
+    /// - Requires: None
+    /// - Guarantees: Returns a `GMPInteger` equal to `value`.
+    public init<Storage>(_ value: WideInt<Storage>) {
+        self.init(value.magnitude)
+        if value.isNegative {
+            negate()
+        }
+    }
+}
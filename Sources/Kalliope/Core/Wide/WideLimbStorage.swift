@@ -0,0 +1,151 @@
+import CKalliope
+
+/// Inline limb storage for the fixed-width `WideUInt` and `WideInt` types.
+///
+/// Conforming types hold exactly `limbCount` GMP limbs (`mp_limb_t`, bridged
+/// as `UInt`) inline, with no heap allocation. The limbs are stored least
+/// significant first and are contiguous in memory, so they can be passed
+/// directly to GMP's low-level `mpn_*` functions.
+///
+/// - Note: Use the provided storage types (`Limbs4`, `Limbs8`, `Limbs16`,
+///   `Limbs32`, `Limbs64`) rather than conforming your own types. The wide
+///   integer types rely on the storage being a plain, contiguous run of
+///   limbs.
+public protocol WideLimbStorage: Hashable, Sendable {
+    /// The number of limbs held by this storage.
+    static var limbCount: Int { get }
+
+    /// Create storage with every limb set to zero.
+    init()
+}
+
+extension WideLimbStorage {
+    /// Execute a closure with the limbs of this storage, least significant
+    /// first.
+    ///
+    /// - Parameter body: A closure receiving a buffer of exactly `limbCount`
+    ///   limbs.
+    /// - Returns: The value returned by `body`.
+    @inlinable
+    func _withLimbs<R>(
+        _ body: (UnsafeBufferPointer<UInt>) throws -> R
+    ) rethrows -> R {
+        try withUnsafeBytes(of: self) { raw in
+            try body(raw.assumingMemoryBound(to: UInt.self))
+        }
+    }
+
+    /// Execute a closure with mutable access to the limbs of this storage,
+    /// least significant first.
+    ///
+    /// - Parameter body: A closure receiving a mutable buffer of exactly
+    ///   `limbCount` limbs.
+    /// - Returns: The value returned by `body`.
+    @inlinable
+    mutating func _withMutableLimbs<R>(
+        _ body: (UnsafeMutableBufferPointer<UInt>) throws -> R
+    ) rethrows -> R {
+        try withUnsafeMutableBytes(of: &self) { raw in
+            try body(raw.assumingMemoryBound(to: UInt.self))
+        }
+    }
+}
+
+/// Inline storage for four limbs (256 bits with 64-bit limbs).
+public struct Limbs4: WideLimbStorage {
+    @usableFromInline
+    var _limbs: (UInt, UInt, UInt, UInt)
+
+    /// The number of limbs held by this storage (4).
+    @inlinable
+    public static var limbCount: Int {
+        4
+    }
+
+    /// Create storage with every limb set to zero.
+    @inlinable
+    public init() {
+        _limbs = (0, 0, 0, 0)
+    }
+
+    public static func == (lhs: Limbs4, rhs: Limbs4) -> Bool {
+        lhs._limbs == rhs._limbs
+    }
+
+    public func hash(into hasher: inout Hasher) {
+        hasher.combine(_limbs.0)
+        hasher.combine(_limbs.1)
+        hasher.combine(_limbs.2)
+        hasher.combine(_limbs.3)
+    }
+}
+
+/// Inline storage made of two adjacent halves.
+///
+/// `LimbsPair<Half>` holds `2 * Half.limbCount` limbs: the low half followed
+/// by the high half. Both halves are plain limb runs, so the pair is itself a
+/// contiguous run of limbs. It is used to build the larger storage sizes.
+public struct LimbsPair<Half: WideLimbStorage>: WideLimbStorage {
+    @usableFromInline
+    var _low: Half
+
+    @usableFromInline
+    var _high: Half
+
+    /// The number of limbs held by this storage (`2 * Half.limbCount`).
+    @inlinable
+    public static var limbCount: Int {
+        2 * Half.limbCount
+    }
+
+    /// Create storage with every limb set to zero.
+    @inlinable
+    public init() {
+        _low = Half()
+        _high = Half()
+    }
+}
+
+/// Inline storage for eight limbs (512 bits with 64-bit limbs).
+public typealias Limbs8 = LimbsPair<Limbs4>
+
+/// Inline storage for sixteen limbs (1024 bits with 64-bit limbs).
+public typealias Limbs16 = LimbsPair<Limbs8>
+
+/// Inline storage for thirty-two limbs (2048 bits with 64-bit limbs).
+public typealias Limbs32 = LimbsPair<Limbs16>
+
+/// Inline storage for sixty-four limbs (4096 bits with 64-bit limbs).
+public typealias Limbs64 = LimbsPair<Limbs32>
+
+// MARK: - Common Widths
+
+/// An unsigned 256-bit integer (on platforms with 64-bit limbs).
+public typealias WideUInt256 = WideUInt<Limbs4>
+
+/// An unsigned 512-bit integer (on platforms with 64-bit limbs).
+public typealias WideUInt512 = WideUInt<Limbs8>
+
+/// An unsigned 1024-bit integer (on platforms with 64-bit limbs).
+public typealias WideUInt1024 = WideUInt<Limbs16>
+
+/// An unsigned 2048-bit integer (on platforms with 64-bit limbs).
+public typealias WideUInt2048 = WideUInt<Limbs32>
+
+/// An unsigned 4096-bit integer (on platforms with 64-bit limbs).
+public typealias WideUInt4096 = WideUInt<Limbs64>
+
+/// A signed 256-bit integer (on platforms with 64-bit limbs).
+public typealias WideInt256 = WideInt<Limbs4>
+
+/// A signed 512-bit integer (on platforms with 64-bit limbs).
+public typealias WideInt512 = WideInt<Limbs8>
+
+/// A signed 1024-bit integer (on platforms with 64-bit limbs).
+public typealias WideInt1024 = WideInt<Limbs16>
+
+/// A signed 2048-bit integer (on platforms with 64-bit limbs).
+public typealias WideInt2048 = WideInt<Limbs32>
+
+/// A signed 4096-bit integer (on platforms with 64-bit limbs).
+public typealias WideInt4096 = WideInt<Limbs64>
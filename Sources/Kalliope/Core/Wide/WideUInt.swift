@@ -0,0 +1,970 @@
+import CKalliope
+
+/// A fixed-width unsigned integer with inline limb storage.
+///
+/// `WideUInt` stores exactly `Storage.limbCount` limbs inline, so values
+/// never touch the heap: there is no dynamic sizing, no normalization and no
+/// `mpz_t` bookkeeping. Arithmetic, shifts and modular operations dispatch to
+/// GMP's low-level `mpn_*` functions with the operand width known at compile
+/// time. For small widths (up to `unrolledLimbLimit` limbs) addition,
+/// subtraction and wrapping multiplication use straight-line carry chains
+/// that the compiler fully unrolls instead of calling into GMP.
+///
+/// Use the width aliases for the common sizes:
+///
+/// ```swift
+/// let digest: WideUInt256 = ...
+/// let element = WideUInt1024(truncatingIfNeeded: someGMPInteger)
+/// let modulus: WideUInt4096 = ...
+/// ```
+///
+/// Arithmetic operators follow Swift's fixed-width conventions: `+`, `-` and
+/// `*` trap on overflow, while `&+`, `&-` and `&*` wrap modulo
+/// `2^bitWidth`.
+///
+/// - Note: Converting to `GMPInteger` copies the significant limbs only; no
+///   radix conversion is involved.
+public struct WideUInt<Storage: WideLimbStorage> {
+    /// The inline limbs, least significant first.
+    @usableFromInline
+    var _storage: Storage
+
+    /// The largest width (in limbs) handled by unrolled inline carry chains.
+    ///
+    /// Wider values call the corresponding `mpn_*` function instead.
+    @inlinable
+    public static var unrolledLimbLimit: Int {
+        4
+    }
+
+    // MARK: - Initialization
+
+    /// Create a value equal to zero.
+    ///
+    /// - Requires: None
+    /// - Guarantees: Returns a `WideUInt` with every limb set to zero. No
+    ///   memory is allocated.
+    @inlinable
+    public init() {
+        _storage = Storage()
+    }
+
+    /// Create a value from a single limb.
+    ///
+    /// - Parameter value: The value of the least significant limb.
+    ///
+    /// - Requires: None
+    /// - Guarantees: Returns a `WideUInt` equal to `value`.
+    @inlinable
+    public init(_ value: UInt) {
+        _storage = Storage()
+        _storage._withMutableLimbs { $0[0] = value }
+    }
+
+    /// Create a value from a `GMPInteger`, failing if it does not fit.
+    ///
+    /// - Parameter value: The integer to convert.
+    /// - Returns: A new `WideUInt` equal to `value`, or `nil` if `value` is
+    ///   negative or needs more than `limbCount` limbs.
+    ///
+    /// - Requires: `value` must be properly initialized.
+    /// - Guarantees: If the result is not `nil`, converting it back to
+    ///   `GMPInteger` yields `value` exactly.
+    public init?(exactly value: GMPInteger) {
+        guard !value.isNegative, value.limbCount <= Storage.limbCount else {
+            return nil
+        }
+        self.init(truncatingIfNeeded: value)
+    }
+
+    /// Create a value from the low `bitWidth` bits of a `GMPInteger`.
+    ///
+    /// Negative values are converted using two's complement, matching the
+    /// semantics of Swift's `init(truncatingIfNeeded:)` on fixed-width
+    /// integers.
+    ///
+    /// - Parameter value: The integer to convert.
+    ///
+    /// - Requires: `value` must be properly initialized.
+    /// - Guarantees: Returns `value mod 2^bitWidth`. Only the low
+    ///   `limbCount` limbs of `value` are read.
+    public init(truncatingIfNeeded value: GMPInteger) {
+        self.init()
+        let count = Swift.min(value.limbCount, Storage.limbCount)
+        if count > 0 {
+            let source = value.limbsRead
+            _storage._withMutableLimbs { limbs in
+                for i in 0 ..< count {
+                    limbs[i] = source[i]
+                }
+            }
+        }
+        if value.isNegative {
+            self = WideUInt() &- self
+        }
+    }
+
+    /// Create a value by parsing a string in the given base.
+    ///
+    /// - Parameters:
+    ///   - string: The string to parse.
+    ///   - base: The numeric base. Must be 0 or in the range 2-62.
+    /// - Returns: The parsed value, or `nil` if the string is not a valid
+    ///   non-negative number or does not fit in `bitWidth` bits.
+    public init?(_ string: String, base: Int = 10) {
+        guard let value = GMPInteger(string, base: base) else {
+            return nil
+        }
+        self.init(exactly: value)
+    }
+
+    // MARK: - Properties
+
+    /// The number of limbs in every value of this type.
+    @inlinable
+    public static var limbCount: Int {
+        Storage.limbCount
+    }
+
+    /// The number of bits in every value of this type.
+    @inlinable
+    public static var bitWidth: Int {
+        Storage.limbCount * UInt.bitWidth
+    }
+
+    /// The value zero.
+    @inlinable
+    public static var zero: WideUInt {
+        WideUInt()
+    }
+
+    /// The largest representable value, `2^bitWidth - 1`.
+    @inlinable
+    public static var max: WideUInt {
+        var result = WideUInt()
+        result._storage._withMutableLimbs { limbs in
+            for i in 0 ..< limbs.count {
+                limbs[i] = .max
+            }
+        }
+        return result
+    }
+
+    /// Get the limb at the specified index.
+    ///
+    /// - Parameter index: The limb index, 0 being least significant. Must be
+    ///   in `0 ..< limbCount`.
+    /// - Returns: The limb value.
+    @inlinable
+    public func limb(at index: Int) -> UInt {
+        precondition(
+            index >= 0 && index < Storage.limbCount,
+            "index must be in 0 ..< limbCount"
+        )
+        return _storage._withLimbs { $0[index] }
+    }
+
+    /// The number of limbs up to and including the most significant non-zero
+    /// limb. Zero for the value zero.
+    @inlinable
+    var _significantLimbCount: Int {
+        _storage._withLimbs { limbs in
+            var count = limbs.count
+            while count > 0, limbs[count - 1] == 0 {
+                count -= 1
+            }
+            return count
+        }
+    }
+
+    /// Check if this value is zero.
+    @inlinable
+    public var isZero: Bool {
+        _significantLimbCount == 0
+    }
+
+    /// The number of leading zero bits in this value.
+    @inlinable
+    public var leadingZeroBitCount: Int {
+        let count = _significantLimbCount
+        guard count > 0 else {
+            return Self.bitWidth
+        }
+        let top = _storage._withLimbs { $0[count - 1] }
+        return (Storage.limbCount - count) * UInt.bitWidth
+            + top.leadingZeroBitCount
+    }
+
+    /// The number of trailing zero bits in this value.
+    @inlinable
+    public var trailingZeroBitCount: Int {
+        _storage._withLimbs { limbs in
+            for i in 0 ..< limbs.count where limbs[i] != 0 {
+                return i * UInt.bitWidth + limbs[i].trailingZeroBitCount
+            }
+            return Self.bitWidth
+        }
+    }
+
+    /// The number of bits needed to represent this value. Zero for zero.
+    @inlinable
+    public var bitCount: Int {
+        Self.bitWidth - leadingZeroBitCount
+    }
+
+    /// The number of one bits in this value.
+    ///
+    /// - Note: Wraps `mpn_popcount`.
+    @inlinable
+    public var nonzeroBitCount: Int {
+        _storage._withLimbs { limbs in
+            Int(__gmpn_popcount(limbs.baseAddress, mp_size_t(limbs.count)))
+        }
+    }
+
+    /// Check if the bit at `index` is set.
+    ///
+    /// - Parameter index: The bit index. Must be in `0 ..< bitWidth`.
+    @inlinable
+    public func testBit(_ index: Int) -> Bool {
+        precondition(
+            index >= 0 && index < Self.bitWidth,
+            "index must be in 0 ..< bitWidth"
+        )
+        let limb = limb(at: index / UInt.bitWidth)
+        return (limb >> UInt(index % UInt.bitWidth)) & 1 == 1
+    }
+
+    // MARK: - Addition and Subtraction
+
+    /// Add another value, reporting whether the sum wrapped.
+    ///
+    /// - Parameter other: The value to add.
+    /// - Returns: The sum modulo `2^bitWidth`, and `true` if a carry out of the
+    ///   most significant limb occurred.
+    ///
+    /// - Note: Uses an unrolled carry chain up to `unrolledLimbLimit` limbs,
+    ///   `mpn_add_n` above.
+    @inlinable
+    public func addingReportingOverflow(
+        _ other: WideUInt
+    ) -> (partialValue: WideUInt, overflow: Bool) {
+        var result = WideUInt()
+        let carry: UInt = result._storage._withMutableLimbs { r in
+            _storage._withLimbs { a in
+                other._storage._withLimbs { b in
+                    let n = Storage.limbCount
+                    if n <= Self.unrolledLimbLimit {
+                        var carry: UInt = 0
+                        for i in 0 ..< n {
+                            let (s1, o1) = a[i].addingReportingOverflow(b[i])
+                            let (s2, o2) = s1.addingReportingOverflow(carry)
+                            r[i] = s2
+                            carry = (o1 || o2) ? 1 : 0
+                        }
+                        return carry
+                    }
+                    return __gmpn_add_n(
+                        r.baseAddress,
+                        a.baseAddress,
+                        b.baseAddress,
+                        mp_size_t(n)
+                    )
+                }
+            }
+        }
+        return (partialValue: result, overflow: carry != 0)
+    }
+
+    /// Subtract another value, reporting whether the difference wrapped.
+    ///
+    /// - Parameter other: The value to subtract.
+    /// - Returns: The difference modulo `2^bitWidth`, and `true` if a borrow
+    ///   out of the most significant limb occurred (i.e. `other > self`).
+    ///
+    /// - Note: Uses an unrolled borrow chain up to `unrolledLimbLimit` limbs,
+    ///   `mpn_sub_n` above.
+    @inlinable
+    public func subtractingReportingOverflow(
+        _ other: WideUInt
+    ) -> (partialValue: WideUInt, overflow: Bool) {
+        var result = WideUInt()
+        let borrow: UInt = result._storage._withMutableLimbs { r in
+            _storage._withLimbs { a in
+                other._storage._withLimbs { b in
+                    let n = Storage.limbCount
+                    if n <= Self.unrolledLimbLimit {
+                        var borrow: UInt = 0
+                        for i in 0 ..< n {
+                            let (d1, o1) = a[i]
+                                .subtractingReportingOverflow(b[i])
+                            let (d2, o2) = d1
+                                .subtractingReportingOverflow(borrow)
+                            r[i] = d2
+                            borrow = (o1 || o2) ? 1 : 0
+                        }
+                        return borrow
+                    }
+                    return __gmpn_sub_n(
+                        r.baseAddress,
+                        a.baseAddress,
+                        b.baseAddress,
+                        mp_size_t(n)
+                    )
+                }
+            }
+        }
+        return (partialValue: result, overflow: borrow != 0)
+    }
+
+    // MARK: - Multiplication
+
+    /// Multiply by another value, reporting whether the product was truncated.
+    ///
+    /// - Parameter other: The value to multiply by.
+    /// - Returns: The product modulo `2^bitWidth`, and `true` if the full
+    ///   product does not fit in `bitWidth` bits.
+    ///
+    /// - Note: Wraps `mpn_mul_n`.
+    @inlinable
+    public func multipliedReportingOverflow(
+        by other: WideUInt
+    ) -> (partialValue: WideUInt, overflow: Bool) {
+        let (high, low) = multipliedFullWidth(by: other)
+        return (partialValue: low, overflow: !high.isZero)
+    }
+
+    /// Multiply by another value, returning the double-width product.
+    ///
+    /// - Parameter other: The value to multiply by.
+    /// - Returns: The high and low halves of the exact `2 * bitWidth` bit
+    ///   product.
+    ///
+    /// - Requires: None
+    /// - Guarantees: `high * 2^bitWidth + low == self * other` exactly. The
+    ///   product is formed in stack scratch space; nothing is heap allocated
+    ///   for the supported widths.
+    ///
+    /// - Note: Wraps `mpn_mul_n` (or `mpn_sqr` when squaring a value with
+    ///   itself).
+    @inlinable
+    public func multipliedFullWidth(
+        by other: WideUInt
+    ) -> (high: WideUInt, low: WideUInt) {
+        let n = Storage.limbCount
+        var high = WideUInt()
+        var low = WideUInt()
+        withUnsafeTemporaryAllocation(
+            of: UInt.self,
+            capacity: 2 * n
+        ) { product in
+            let p = product.baseAddress!
+            _storage._withLimbs { a in
+                other._storage._withLimbs { b in
+                    if _storage == other._storage {
+                        __gmpn_sqr(p, a.baseAddress, mp_size_t(n))
+                    } else {
+                        __gmpn_mul_n(
+                            p,
+                            a.baseAddress,
+                            b.baseAddress,
+                            mp_size_t(n)
+                        )
+                    }
+                }
+            }
+            low._storage._withMutableLimbs { limbs in
+                for i in 0 ..< n {
+                    limbs[i] = p[i]
+                }
+            }
+            high._storage._withMutableLimbs { limbs in
+                for i in 0 ..< n {
+                    limbs[i] = p[n + i]
+                }
+            }
+        }
+        return (high: high, low: low)
+    }
+
+    /// Multiply by another value, keeping only the low `bitWidth` bits.
+    ///
+    /// Only the limb products that contribute to the low half are formed, so
+    /// this is roughly twice as fast as `multipliedFullWidth(by:)`.
+    @inlinable
+    func _wrappingMultiplied(by other: WideUInt) -> WideUInt {
+        let n = Storage.limbCount
+        guard n <= Self.unrolledLimbLimit else {
+            return multipliedFullWidth(by: other).low
+        }
+        var result = WideUInt()
+        result._storage._withMutableLimbs { r in
+            _storage._withLimbs { a in
+                other._storage._withLimbs { b in
+                    for i in 0 ..< n where a[i] != 0 {
+                        var carry: UInt = 0
+                        for j in 0 ..< (n - i) {
+                            let (hi, lo) = a[i].multipliedFullWidth(by: b[j])
+                            let (s1, o1) = lo.addingReportingOverflow(r[i + j])
+                            let (s2, o2) = s1.addingReportingOverflow(carry)
+                            r[i + j] = s2
+                            carry = hi &+ (o1 ? 1 : 0) &+ (o2 ? 1 : 0)
+                        }
+                    }
+                }
+            }
+        }
+        return result
+    }
+
+    // MARK: - Division
+
+    /// Divide by another value, returning the quotient and remainder.
+    ///
+    /// - Parameter divisor: The value to divide by. Must not be zero.
+    /// - Returns: The quotient and remainder of the truncating division.
+    ///
+    /// - Throws: `GMPError.divisionByZero` if `divisor` is zero.
+    ///
+    /// - Requires: None
+    /// - Guarantees: `quotient * divisor + remainder == self` and
+    ///   `remainder < divisor`.
+    ///
+    /// - Note: Wraps `mpn_divrem_1` for single-limb divisors and
+    ///   `mpn_tdiv_qr` otherwise.
+    @inlinable
+    public func quotientAndRemainder(
+        dividingBy divisor: WideUInt
+    ) throws -> (quotient: WideUInt, remainder: WideUInt) {
+        let dn = divisor._significantLimbCount
+        guard dn > 0 else {
+            throw GMPError.divisionByZero
+        }
+        let nn = _significantLimbCount
+        if nn < dn {
+            return (quotient: WideUInt(), remainder: self)
+        }
+        var quotient = WideUInt()
+        var remainder = WideUInt()
+        quotient._storage._withMutableLimbs { q in
+            remainder._storage._withMutableLimbs { r in
+                _storage._withLimbs { a in
+                    divisor._storage._withLimbs { d in
+                        if dn == 1 {
+                            r[0] = __gmpn_divrem_1(
+                                q.baseAddress,
+                                0,
+                                a.baseAddress,
+                                mp_size_t(nn),
+                                d[0]
+                            )
+                        } else {
+                            __gmpn_tdiv_qr(
+                                q.baseAddress,
+                                r.baseAddress,
+                                0,
+                                a.baseAddress,
+                                mp_size_t(nn),
+                                d.baseAddress,
+                                mp_size_t(dn)
+                            )
+                        }
+                    }
+                }
+            }
+        }
+        return (quotient: quotient, remainder: remainder)
+    }
+
+    // MARK: - Shifts
+
+    /// Shift left by `count` bits, discarding bits shifted out.
+    ///
+    /// - Parameter count: The number of bits. Must be non-negative. Counts of
+    ///   `bitWidth` or more produce zero.
+    ///
+    /// - Note: Wraps `mpn_lshift`.
+    @inlinable
+    public func leftShifted(by count: Int) -> WideUInt {
+        precondition(count >= 0, "count must be non-negative")
+        guard count < Self.bitWidth else {
+            return WideUInt()
+        }
+        let n = Storage.limbCount
+        let limbShift = count / UInt.bitWidth
+        let bitShift = count % UInt.bitWidth
+        var result = WideUInt()
+        result._storage._withMutableLimbs { r in
+            _storage._withLimbs { a in
+                if bitShift == 0 {
+                    for i in limbShift ..< n {
+                        r[i] = a[i - limbShift]
+                    }
+                } else {
+                    _ = __gmpn_lshift(
+                        r.baseAddress! + limbShift,
+                        a.baseAddress,
+                        mp_size_t(n - limbShift),
+                        UInt32(bitShift)
+                    )
+                }
+            }
+        }
+        return result
+    }
+
+    /// Shift right by `count` bits.
+    ///
+    /// - Parameter count: The number of bits. Must be non-negative. Counts of
+    ///   `bitWidth` or more produce zero.
+    ///
+    /// - Note: Wraps `mpn_rshift`.
+    @inlinable
+    public func rightShifted(by count: Int) -> WideUInt {
+        precondition(count >= 0, "count must be non-negative")
+        guard count < Self.bitWidth else {
+            return WideUInt()
+        }
+        let n = Storage.limbCount
+        let limbShift = count / UInt.bitWidth
+        let bitShift = count % UInt.bitWidth
+        var result = WideUInt()
+        result._storage._withMutableLimbs { r in
+            _storage._withLimbs { a in
+                if bitShift == 0 {
+                    for i in 0 ..< (n - limbShift) {
+                        r[i] = a[i + limbShift]
+                    }
+                } else {
+                    _ = __gmpn_rshift(
+                        r.baseAddress,
+                        a.baseAddress! + limbShift,
+                        mp_size_t(n - limbShift),
+                        UInt32(bitShift)
+                    )
+                }
+            }
+        }
+        return result
+    }
+
+    // MARK: - Comparison
+
+    /// Compare this value with another.
+    ///
+    /// - Parameter other: The value to compare with.
+    /// - Returns: -1 if `self < other`, 0 if equal, 1 if `self > other`.
+    ///
+    /// - Note: Compares from the most significant limb down, the same
+    ///   strategy as `mpn_cmp`.
+    @inlinable
+    public func compare(to other: WideUInt) -> Int {
+        _storage._withLimbs { a in
+            other._storage._withLimbs { b in
+                var i = a.count - 1
+                while i >= 0 {
+                    if a[i] != b[i] {
+                        return a[i] < b[i] ? -1 : 1
+                    }
+                    i -= 1
+                }
+                return 0
+            }
+        }
+    }
+
+    // MARK: - Modular Arithmetic
+
+    /// Reduce a limb run into `result`, which must hold at least `mn` limbs.
+    ///
+    /// - Parameters:
+    ///   - np: The dividend, `nn` limbs. Not modified.
+    ///   - nn: The number of dividend limbs (may include leading zeros).
+    ///   - mp: The modulus, `mn` limbs with a non-zero top limb.
+    ///   - mn: The number of modulus limbs.
+    ///   - rp: Receives the remainder, zero-padded to `mn` limbs.
+    ///   - qp: Scratch for the quotient, at least `nn` limbs.
+    @inlinable
+    static func _reduce(
+        _ np: UnsafePointer<UInt>,
+        _ nn: Int,
+        _ mp: UnsafePointer<UInt>,
+        _ mn: Int,
+        _ rp: UnsafeMutablePointer<UInt>,
+        _ qp: UnsafeMutablePointer<UInt>
+    ) {
+        var nn = nn
+        while nn > 0, np[nn - 1] == 0 {
+            nn -= 1
+        }
+        if nn < mn {
+            for i in 0 ..< mn {
+                rp[i] = i < nn ? np[i] : 0
+            }
+            return
+        }
+        if mn == 1 {
+            rp[0] = __gmpn_divrem_1(qp, 0, np, mp_size_t(nn), mp[0])
+            return
+        }
+        __gmpn_tdiv_qr(qp, rp, 0, np, mp_size_t(nn), mp, mp_size_t(mn))
+    }
+
+    /// Reduce this value modulo `modulus`.
+    ///
+    /// - Parameter modulus: The modulus. Must not be zero.
+    /// - Returns: `self mod modulus`.
+    @inlinable
+    public func modulo(_ modulus: WideUInt) -> WideUInt {
+        precondition(!modulus.isZero, "modulus must not be zero")
+        if self < modulus {
+            return self
+        }
+        // Safe to force try since modulus is non-zero
+        return try! quotientAndRemainder(dividingBy: modulus).remainder
+    }
+
+    /// Add another value modulo `modulus`.
+    ///
+    /// - Parameters:
+    ///   - other: The value to add.
+    ///   - modulus: The modulus. Must not be zero.
+    /// - Returns: `(self + other) mod modulus`.
+    @inlinable
+    public func adding(_ other: WideUInt, modulo modulus: WideUInt) -> WideUInt {
+        let a = modulo(modulus)
+        let b = other.modulo(modulus)
+        let (sum, carry) = a.addingReportingOverflow(b)
+        if carry || sum >= modulus {
+            return sum &- modulus
+        }
+        return sum
+    }
+
+    /// Subtract another value modulo `modulus`.
+    ///
+    /// - Parameters:
+    ///   - other: The value to subtract.
+    ///   - modulus: The modulus. Must not be zero.
+    /// - Returns: `(self - other) mod modulus`, in `0 ..< modulus`.
+    @inlinable
+    public func subtracting(
+        _ other: WideUInt,
+        modulo modulus: WideUInt
+    ) -> WideUInt {
+        let a = modulo(modulus)
+        let b = other.modulo(modulus)
+        let (difference, borrow) = a.subtractingReportingOverflow(b)
+        return borrow ? difference &+ modulus : difference
+    }
+
+    /// Multiply by another value modulo `modulus`.
+    ///
+    /// - Parameters:
+    ///   - other: The value to multiply by.
+    ///   - modulus: The modulus. Must not be zero.
+    /// - Returns: `(self * other) mod modulus`.
+    ///
+    /// - Note: Wraps `mpn_mul_n` and `mpn_tdiv_qr`, using stack scratch.
+    @inlinable
+    public func multiplied(
+        by other: WideUInt,
+        modulo modulus: WideUInt
+    ) -> WideUInt {
+        let mn = modulus._significantLimbCount
+        precondition(mn > 0, "modulus must not be zero")
+        let n = Storage.limbCount
+        var result = WideUInt()
+        withUnsafeTemporaryAllocation(
+            of: UInt.self,
+            capacity: 4 * n + 1
+        ) { scratch in
+            let product = scratch.baseAddress!
+            let quotient = product + 2 * n
+            _storage._withLimbs { a in
+                other._storage._withLimbs { b in
+                    __gmpn_mul_n(
+                        product,
+                        a.baseAddress,
+                        b.baseAddress,
+                        mp_size_t(n)
+                    )
+                }
+            }
+            result._storage._withMutableLimbs { r in
+                modulus._storage._withLimbs { m in
+                    Self._reduce(
+                        product,
+                        2 * n,
+                        m.baseAddress!,
+                        mn,
+                        r.baseAddress!,
+                        quotient
+                    )
+                }
+            }
+        }
+        return result
+    }
+
+    /// Raise this value to `exponent` modulo `modulus`.
+    ///
+    /// Uses left-to-right binary exponentiation over the exponent bits. All
+    /// intermediate products live in one stack scratch block sized from the
+    /// width, so the whole exponentiation performs no heap allocation.
+    ///
+    /// - Parameters:
+    ///   - exponent: The exponent.
+    ///   - modulus: The modulus. Must not be zero.
+    /// - Returns: `self^exponent mod modulus`. `0^0` yields `1 mod modulus`.
+    ///
+    /// - Note: Wraps `mpn_sqr`, `mpn_mul_n` and `mpn_tdiv_qr`. This is not a
+    ///   constant-time routine; use `raisedToPowerSecure` for secrets.
+    @inlinable
+    public func raisedToPower(
+        _ exponent: WideUInt,
+        modulo modulus: WideUInt
+    ) -> WideUInt {
+        let mn = modulus._significantLimbCount
+        precondition(mn > 0, "modulus must not be zero")
+        var result = WideUInt()
+        if modulus == WideUInt(1) {
+            return result
+        }
+        let base = modulo(modulus)
+        let exponentBits = exponent.bitCount
+        let n = Storage.limbCount
+        withUnsafeTemporaryAllocation(
+            of: UInt.self,
+            capacity: 4 * n + 1
+        ) { scratch in
+            let product = scratch.baseAddress!
+            let quotient = product + 2 * n
+            result._storage._withMutableLimbs { r in
+                r[0] = 1
+                let rp = r.baseAddress!
+                base._storage._withLimbs { b in
+                    modulus._storage._withLimbs { m in
+                        exponent._storage._withLimbs { e in
+                            var bit = exponentBits - 1
+                            while bit >= 0 {
+                                __gmpn_sqr(product, rp, mp_size_t(mn))
+                                Self._reduce(
+                                    product,
+                                    2 * mn,
+                                    m.baseAddress!,
+                                    mn,
+                                    rp,
+                                    quotient
+                                )
+                                let limb = e[bit / UInt.bitWidth]
+                                if (limb >> UInt(bit % UInt.bitWidth)) & 1
+                                    == 1
+                                {
+                                    __gmpn_mul_n(
+                                        product,
+                                        rp,
+                                        b.baseAddress,
+                                        mp_size_t(mn)
+                                    )
+                                    Self._reduce(
+                                        product,
+                                        2 * mn,
+                                        m.baseAddress!,
+                                        mn,
+                                        rp,
+                                        quotient
+                                    )
+                                }
+                                bit -= 1
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        return result
+    }
+
+    // MARK: - Operator Overloads
+
+    /// Add two values, trapping on overflow.
+    @inlinable
+    public static func + (lhs: WideUInt, rhs: WideUInt) -> WideUInt {
+        let (result, overflow) = lhs.addingReportingOverflow(rhs)
+        precondition(!overflow, "arithmetic overflow")
+        return result
+    }
+
+    /// Subtract two values, trapping on overflow.
+    @inlinable
+    public static func - (lhs: WideUInt, rhs: WideUInt) -> WideUInt {
+        let (result, overflow) = lhs.subtractingReportingOverflow(rhs)
+        precondition(!overflow, "arithmetic overflow")
+        return result
+    }
+
+    /// Multiply two values, trapping on overflow.
+    @inlinable
+    public static func * (lhs: WideUInt, rhs: WideUInt) -> WideUInt {
+        let (result, overflow) = lhs.multipliedReportingOverflow(by: rhs)
+        precondition(!overflow, "arithmetic overflow")
+        return result
+    }
+
+    /// Add two values, wrapping modulo `2^bitWidth`.
+    @inlinable
+    public static func &+ (lhs: WideUInt, rhs: WideUInt) -> WideUInt {
+        lhs.addingReportingOverflow(rhs).partialValue
+    }
+
+    /// Subtract two values, wrapping modulo `2^bitWidth`.
+    @inlinable
+    public static func &- (lhs: WideUInt, rhs: WideUInt) -> WideUInt {
+        lhs.subtractingReportingOverflow(rhs).partialValue
+    }
+
+    /// Multiply two values, wrapping modulo `2^bitWidth`.
+    @inlinable
+    public static func &* (lhs: WideUInt, rhs: WideUInt) -> WideUInt {
+        lhs._wrappingMultiplied(by: rhs)
+    }
+
+    /// Divide two values, truncating. Traps if `rhs` is zero.
+    @inlinable
+    public static func / (lhs: WideUInt, rhs: WideUInt) -> WideUInt {
+        precondition(!rhs.isZero, "division by zero")
+        return try! lhs.quotientAndRemainder(dividingBy: rhs).quotient
+    }
+
+    /// The remainder of dividing two values. Traps if `rhs` is zero.
+    @inlinable
+    public static func % (lhs: WideUInt, rhs: WideUInt) -> WideUInt {
+        precondition(!rhs.isZero, "division by zero")
+        return try! lhs.quotientAndRemainder(dividingBy: rhs).remainder
+    }
+
+    /// Shift left by `rhs` bits.
+    @inlinable
+    public static func << (lhs: WideUInt, rhs: Int) -> WideUInt {
+        lhs.leftShifted(by: rhs)
+    }
+
+    /// Shift right by `rhs` bits.
+    @inlinable
+    public static func >> (lhs: WideUInt, rhs: Int) -> WideUInt {
+        lhs.rightShifted(by: rhs)
+    }
+
+    /// Bitwise AND of two values.
+    @inlinable
+    public static func & (lhs: WideUInt, rhs: WideUInt) -> WideUInt {
+        lhs._combined(with: rhs) { $0 & $1 }
+    }
+
+    /// Bitwise OR of two values.
+    @inlinable
+    public static func | (lhs: WideUInt, rhs: WideUInt) -> WideUInt {
+        lhs._combined(with: rhs) { $0 | $1 }
+    }
+
+    /// Bitwise XOR of two values.
+    @inlinable
+    public static func ^ (lhs: WideUInt, rhs: WideUInt) -> WideUInt {
+        lhs._combined(with: rhs) { $0 ^ $1 }
+    }
+
+    /// Bitwise complement of a value.
+    @inlinable
+    public static prefix func ~ (value: WideUInt) -> WideUInt {
+        value._combined(with: value) { a, _ in ~a }
+    }
+
+    /// Combine two values limb by limb.
+    @inlinable
+    func _combined(
+        with other: WideUInt,
+        _ operation: (UInt, UInt) -> UInt
+    ) -> WideUInt {
+        var result = WideUInt()
+        result._storage._withMutableLimbs { r in
+            _storage._withLimbs { a in
+                other._storage._withLimbs { b in
+                    for i in 0 ..< r.count {
+                        r[i] = operation(a[i], b[i])
+                    }
+                }
+            }
+        }
+        return result
+    }
+}
+
+// MARK: - Protocol Conformances
+
+extension WideUInt: Equatable {
+    @inlinable
+    public static func == (lhs: WideUInt, rhs: WideUInt) -> Bool {
+        lhs._storage == rhs._storage
+    }
+}
+
+extension WideUInt: Hashable {
+    public func hash(into hasher: inout Hasher) {
+        hasher.combine(_storage)
+    }
+}
+
+extension WideUInt: Comparable {
+    @inlinable
+    public static func < (lhs: WideUInt, rhs: WideUInt) -> Bool {
+        lhs.compare(to: rhs) < 0
+    }
+}
+
+extension WideUInt: Sendable {}
+
+extension WideUInt: ExpressibleByIntegerLiteral {
+    /// Create a value from an integer literal.
+    @inlinable
+    public init(integerLiteral value: UInt) {
+        self.init(value)
+    }
+}
+
+extension WideUInt: CustomStringConvertible {
+    /// The decimal representation of this value.
+    public var description: String {
+        GMPInteger(self).toString()
+    }
+}
+
+// MARK: - GMPInteger Conversion
+
+extension GMPInteger {
+    /// Create an integer from a fixed-width unsigned value.
+    ///
+    /// Only the significant limbs are copied; no radix conversion or
+    /// normalization pass is needed.
+    ///
+    /// - Parameter value: The fixed-width value.
+    ///
+    /// - Requires: None
+    /// - Guarantees: Returns a `GMPInteger` equal to `value`.
+    ///
+    /// - Note: Uses `mpz_limbs_write` and `mpz_limbs_finish`.
+    public init<Storage>(_ value: WideUInt<Storage>) {
+        self.init()
+        let count = value._significantLimbCount
+        guard count > 0 else {
+            return
+        }
+        let destination = limbsWrite(count: count)
+        value._storage._withLimbs { limbs in
+            for i in 0 ..< count {
+                destination[i] = limbs[i]
+            }
+        }
+        limbsFinish(size: count)
+    }
+}
@@ -12,9 +12,11 @@ extension GMPRational {
     /// - Guarantees: Returns -1, 0, or 1. Returns 0 if and only if `self ==
     /// other`.
     ///
+    /// - Note: Operands with many limbs are first compared by magnitude
+    ///   estimates; only values that agree closely reach `mpq_cmp`.
     /// - Note: Wraps `mpq_cmp`.
     public func compare(to other: GMPRational) -> Int {
-        Int(__gmpq_cmp(&_storage.value, &other._storage.value))
+        GMPRational._compare(self, other)
     }
 
     /// Compare this rational with a `GMPInteger`.
@@ -156,7 +158,7 @@ extension GMPRational: Comparable {
     /// - Requires: Both rationals must be properly initialized.
     /// - Guarantees: Returns `true` if and only if `lhs.compare(to: rhs) < 0`.
     public static func < (lhs: GMPRational, rhs: GMPRational) -> Bool {
-        __gmpq_cmp(&lhs._storage.value, &rhs._storage.value) < 0
+        _compare(lhs, rhs) < 0
     }
 
     /// Less-than-or-equal comparison operator.
@@ -169,7 +171,7 @@ extension GMPRational: Comparable {
     /// - Requires: Both rationals must be properly initialized.
     /// - Guarantees: Returns `true` if and only if `lhs.compare(to: rhs) <= 0`.
     public static func <= (lhs: GMPRational, rhs: GMPRational) -> Bool {
-        __gmpq_cmp(&lhs._storage.value, &rhs._storage.value) <= 0
+        _compare(lhs, rhs) <= 0
     }
 
     /// Greater-than comparison operator.
@@ -182,7 +184,7 @@ extension GMPRational: Comparable {
     /// - Requires: Both rationals must be properly initialized.
     /// - Guarantees: Returns `true` if and only if `lhs.compare(to: rhs) > 0`.
     public static func > (lhs: GMPRational, rhs: GMPRational) -> Bool {
-        __gmpq_cmp(&lhs._storage.value, &rhs._storage.value) > 0
+        _compare(lhs, rhs) > 0
     }
 
     /// Greater-than-or-equal comparison operator.
@@ -195,7 +197,7 @@ extension GMPRational: Comparable {
     /// - Requires: Both rationals must be properly initialized.
     /// - Guarantees: Returns `true` if and only if `lhs.compare(to: rhs) >= 0`.
     public static func >= (lhs: GMPRational, rhs: GMPRational) -> Bool {
-        __gmpq_cmp(&lhs._storage.value, &rhs._storage.value) >= 0
+        _compare(lhs, rhs) >= 0
     }
 }
 
@@ -0,0 +1,45 @@
+// Measures Kalliope and Linus strategy cutovers on this machine and writes a
+// tuning profile.
+//
+//     swift run -c release KalliopeTune [profile.json]
+//
+// Load the profile by setting KALLIOPE_TUNING_PROFILE to its path.
+
+import Foundation
+import Kalliope
+import Linus
+
+let arguments = CommandLine.arguments.dropFirst()
+guard arguments.count <= 1 else {
+    FileHandle.standardError.write(Data("usage: KalliopeTune [path]\n".utf8))
+    exit(2)
+}
+let path = arguments.first ?? "kalliope-tuning.json"
+
+print("Tuning on \(GMPTuningProfile.currentMachine)")
+let tuner = GMPCutoverTuner(benchmarks: GMPCutoverBenchmark.all)
+let profile = tuner.run { result in
+    print("\n\(result.parameter.name)")
+    print("         work      basic ns    guarded ns")
+    for m in result.measurements {
+        let row = [m.work, Int(m.basicNanoseconds), Int(m.guardedNanoseconds)]
+        let cells = row.map { value in
+            let text = String(value)
+            return String(repeating: " ", count: max(0, 13 - text.count))
+                + text
+        }
+        print(cells.joined(separator: " "))
+    }
+    let threshold = result.threshold == .max
+        ? "never"
+        : String(result.threshold)
+    print("threshold: \(threshold) (default \(result.parameter.defaultValue))")
+}
+
+do {
+    try profile.write(to: path)
+    print("\nWrote \(path)")
+} catch {
+    FileHandle.standardError.write(Data("cannot write \(path)\n".utf8))
+    exit(1)
+}
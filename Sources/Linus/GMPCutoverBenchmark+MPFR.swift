@@ -0,0 +1,47 @@
+// Import CKalliope first so gmp.h is available when CLinus imports mpfr.h
+import CKalliope
+import CLinus
+import CLinusBridge
+import Kalliope
+
+extension GMPTuningParameter {
+    /// The minimum number of multiply-adds before an `MPFRMatrix` kernel is
+    /// split across cores.
+    public static let mpfrMatrixParallelThreshold = GMPTuningParameter(
+        "MPFRMatrix.parallelThreshold",
+        default: 4096
+    )
+}
+
+extension GMPCutoverBenchmark {
+    /// Products of square `MPFRMatrix` values at 256 bits.
+    public static var mpfrMatrixMultiplication: GMPCutoverBenchmark {
+        GMPCutoverBenchmark(
+            parameter: .mpfrMatrixParallelThreshold,
+            scales: [4, 6, 8, 12, 16, 24, 32, 48, 64]
+        ) { n in
+            let entries = (0 ..< n).map { i in
+                (0 ..< n).map { j in
+                    let value = Double(i + 2 * j + 1).squareRoot()
+                    return MPFRFloat(value, precision: 256)
+                }
+            }
+            let matrix = MPFRMatrix(entries)
+            return (n * n * n, { _ = matrix * matrix })
+        }
+    }
+
+    /// The benchmarks for every Kalliope and Linus tuning parameter.
+    public static var all: [GMPCutoverBenchmark] {
+        [
+            .integerMatrixRowOperations,
+            .continuedFractionExpansion,
+            .discreteLogarithm,
+            .sparsePolynomialMultiplication,
+            .realRootTaylorShift,
+            .wordPrimePolynomialMultiplication,
+            .numberTheoreticTransformProduct,
+            .mpfrMatrixMultiplication,
+        ]
+    }
+}
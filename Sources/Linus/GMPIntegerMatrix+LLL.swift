@@ -0,0 +1,436 @@
+// Import CKalliope first so gmp.h is available when CLinus imports mpfr.h
+import CKalliope
+import CLinus
+import CLinusBridge
+import Kalliope
+
+// MARK: - Lattice Reduction Types
+
+/// The floating-point type used for Gram-Schmidt data during lattice
+/// reduction.
+public enum GramSchmidtPrecision: Equatable, Sendable {
+    /// Hardware `Double` (53 bits).
+    case double
+
+    /// `DoubleDouble` (about 106 bits).
+    case doubleDouble
+
+    /// `MPFRFloat` with the given precision in bits.
+    case mpfr(bits: Int)
+}
+
+/// Statistics describing a lattice reduction run.
+public struct LatticeReductionReport: Equatable, Sendable {
+    /// The number of Lovász swaps performed.
+    public internal(set) var swapCount: Int = 0
+
+    /// The number of size-reduction row updates applied to the basis.
+    public internal(set) var sizeReductionCount: Int = 0
+
+    /// The number of times the Gram-Schmidt precision was raised.
+    public internal(set) var precisionEscalations: Int = 0
+
+    /// The precision that completed the reduction.
+    public internal(set) var finalPrecision: GramSchmidtPrecision = .double
+}
+
+// MARK: - LLL Reduction
+
+/// LLL lattice basis reduction for `GMPIntegerMatrix`.
+///
+/// The rows of the matrix are the basis vectors. Reduction follows the L²
+/// algorithm of Nguyen and Stehlé: the basis and its Gram matrix stay exact,
+/// while the Gram-Schmidt coefficients are recomputed from the exact Gram
+/// matrix in floating point (Cholesky factorization), and size reduction is
+/// done lazily, applying all rounded coefficients for a row in one in-place
+/// `subtractProduct` pass.
+///
+/// The floating-point type is chosen adaptively: reduction starts with the
+/// cheapest type whose exponent range and precision are plausible for the
+/// input, and restarts from the current (partially reduced, still exact)
+/// basis with more precision whenever the approximation visibly breaks down
+/// (non-finite or non-positive squared norms, or size reduction that stops
+/// making progress).
+extension GMPIntegerMatrix {
+    /// LLL-reduce the rows of this matrix in place.
+    ///
+    /// - Parameters:
+    ///   - delta: The Lovász parameter. Must be in `(0.25, 1)`. Defaults to
+    ///     `0.99`.
+    ///   - eta: The size-reduction parameter. Must be in `[0.5, sqrt(delta))`.
+    ///     Defaults to `0.51`.
+    ///   - startingPrecision: The Gram-Schmidt precision to start with. If
+    ///     `nil`, it is chosen from the dimension and entry sizes. Precision
+    ///     is raised automatically if it proves insufficient.
+    /// - Returns: Statistics about the run.
+    ///
+    /// - Requires: The rows must be linearly independent.
+    /// - Guarantees: The rows span the same lattice as before and satisfy the
+    ///   `(delta, eta)` LLL conditions (up to the floating-point accuracy of
+    ///   the final precision). The row-update and Gram-update work is spread
+    ///   across cores for large bases.
+    @discardableResult
+    public mutating func reduceLLL(
+        delta: Double = 0.99,
+        eta: Double = 0.51,
+        startingPrecision: GramSchmidtPrecision? = nil
+    ) -> LatticeReductionReport {
+        precondition(delta > 0.25 && delta < 1, "delta must be in (0.25, 1)")
+        precondition(
+            eta >= 0.5 && eta * eta < delta,
+            "eta must be in [0.5, sqrt(delta))"
+        )
+        var report = LatticeReductionReport()
+        let d = rowCount
+        guard d > 1 else {
+            return report
+        }
+
+        var gram = self.gramMatrix.rows
+        let gramBits = (0 ..< d).reduce(0) {
+            Swift.max($0, gram[$1][$1].bitCount)
+        }
+        let baseMPFRBits = Swift.max(64, Int(1.6 * Double(d)) + 40)
+        var precision = startingPrecision
+            ?? Self._initialPrecision(dimension: d, gramBits: gramBits)
+
+        while true {
+            let context = _L2Context(
+                delta: delta,
+                eta: eta,
+                gramBits: gramBits
+            )
+            let succeeded = switch precision {
+            case .double:
+                context.run(
+                    Double.self,
+                    precision: 53,
+                    basis: &self,
+                    gram: &gram,
+                    report: &report
+                )
+            case .doubleDouble:
+                context.run(
+                    DoubleDouble.self,
+                    precision: 106,
+                    basis: &self,
+                    gram: &gram,
+                    report: &report
+                )
+            case let .mpfr(bits):
+                context.run(
+                    MPFRFloat.self,
+                    precision: bits,
+                    basis: &self,
+                    gram: &gram,
+                    report: &report
+                )
+            }
+            if succeeded {
+                report.finalPrecision = precision
+                return report
+            }
+
+            report.precisionEscalations += 1
+            switch precision {
+            case .double where gramBits < Self._doubleGramBitLimit:
+                precision = .doubleDouble
+            case .double, .doubleDouble:
+                precision = .mpfr(bits: baseMPFRBits)
+            case let .mpfr(bits):
+                precondition(
+                    bits < 16 * baseMPFRBits,
+                    "lattice basis rows must be linearly independent"
+                )
+                precision = .mpfr(bits: 2 * bits)
+            }
+        }
+    }
+
+    /// Check whether the rows satisfy the LLL conditions, using exact
+    /// rational Gram-Schmidt orthogonalization.
+    ///
+    /// - Parameters:
+    ///   - delta: The Lovász parameter. Defaults to `0.99`.
+    ///   - eta: The size-reduction parameter. Defaults to `0.51`.
+    /// - Returns: `true` if every `|mu[i][j]| <= eta` and every consecutive
+    ///   pair satisfies the Lovász condition.
+    ///
+    /// - Requires: The rows must be linearly independent.
+    ///
+    /// - Note: Runs in `O(d^3)` rational operations; intended for
+    ///   verification rather than inner loops.
+    public func isLLLReduced(
+        delta: Double = 0.99,
+        eta: Double = 0.51
+    ) -> Bool {
+        let d = rowCount
+        let gram = gramMatrix
+        let exactDelta = GMPRational(delta)
+        let exactEta = GMPRational(eta)
+        var r = [[GMPRational]](repeating: [], count: d)
+        var mu = [[GMPRational]](repeating: [], count: d)
+        for i in 0 ..< d {
+            for j in 0 ... i {
+                var value = GMPRational(gram[i, j])
+                for k in 0 ..< j {
+                    value -= mu[j][k] * r[i][k]
+                }
+                r[i].append(value)
+                if j < i {
+                    // Safe to force try: r[j][j] > 0 for independent rows
+                    let coefficient = try! value / r[j][j]
+                    if coefficient.absoluteValue() > exactEta {
+                        return false
+                    }
+                    mu[i].append(coefficient)
+                }
+            }
+            if i > 0 {
+                let previous = r[i - 1][i - 1]
+                let m = mu[i][i - 1]
+                if exactDelta * previous > r[i][i] + m * m * previous {
+                    return false
+                }
+            }
+        }
+        return true
+    }
+
+    /// Gram entries with more bits than this overflow `Double` arithmetic.
+    static var _doubleGramBitLimit: Int {
+        960
+    }
+
+    /// Choose the starting Gram-Schmidt precision.
+    ///
+    /// Hardware types are only usable while the Gram entries fit the
+    /// `Double` exponent range. Within that range, `Double` is tried first
+    /// for moderate dimensions and `DoubleDouble` for larger ones; these are
+    /// heuristic choices that the escalation in `reduceLLL` corrects.
+    static func _initialPrecision(
+        dimension: Int,
+        gramBits: Int
+    ) -> GramSchmidtPrecision {
+        guard gramBits < _doubleGramBitLimit else {
+            let bits = Swift.max(64, Int(1.6 * Double(dimension)) + 40)
+            return .mpfr(bits: bits)
+        }
+        if dimension <= 100 {
+            return .double
+        }
+        if dimension <= 200 {
+            return .doubleDouble
+        }
+        return .mpfr(bits: Int(1.6 * Double(dimension)) + 40)
+    }
+}
+
+// MARK: - L² Core
+
+/// Parameters shared by every precision tier of one reduction.
+struct _L2Context {
+    let delta: Double
+    let eta: Double
+    let gramBits: Int
+
+    /// Run L² with the given scalar type.
+    ///
+    /// - Returns: `false` if the precision proved insufficient. The basis and
+    ///   Gram matrix are left consistent in either case, so the caller can
+    ///   retry from where this attempt stopped.
+    func run<Scalar: GramSchmidtScalar>(
+        _: Scalar.Type,
+        precision: Int,
+        basis: inout GMPIntegerMatrix,
+        gram: inout [[GMPInteger]],
+        report: inout LatticeReductionReport
+    ) -> Bool {
+        var reducer = _L2Reducer<Scalar>(
+            context: self,
+            precision: precision,
+            dimension: basis.rowCount
+        )
+        return reducer.reduce(&basis, gram: &gram, report: &report)
+    }
+}
+
+/// The L² reduction loop for one scalar type.
+struct _L2Reducer<Scalar: GramSchmidtScalar> {
+    let precision: Int
+    let delta: Scalar
+    let eta: Double
+    let zero: Scalar
+
+    /// The most lazy size-reduction passes allowed for one row before the
+    /// precision is declared insufficient.
+    let maximumPasses: Int
+
+    /// The most main-loop iterations allowed before the precision is
+    /// declared insufficient.
+    let maximumIterations: Int
+
+    /// `r[i][j]` for `j <= i`: Gram-Schmidt inner products.
+    var r: [[Scalar]]
+
+    /// `mu[i][j]` for `j < i`: Gram-Schmidt coefficients.
+    var mu: [[Scalar]]
+
+    init(context: _L2Context, precision: Int, dimension: Int) {
+        self.precision = precision
+        delta = Scalar(converting: context.delta, precision: precision)
+        eta = context.eta
+        zero = Scalar(converting: 0.0, precision: precision)
+        // Each pass fixes roughly (precision - log d) bits of the coefficients
+        let usefulBits = Swift.max(8, precision / 2)
+        maximumPasses = 8 + 2 * (context.gramBits / usefulBits)
+        maximumIterations = 1000
+            + 4 * dimension * dimension * (context.gramBits + 2)
+        r = [[Scalar]](repeating: [], count: dimension)
+        mu = [[Scalar]](repeating: [], count: dimension)
+    }
+
+    mutating func reduce(
+        _ basis: inout GMPIntegerMatrix,
+        gram: inout [[GMPInteger]],
+        report: inout LatticeReductionReport
+    ) -> Bool {
+        let d = basis.rowCount
+        guard _computeFirstRow(gram) else {
+            return false
+        }
+        var k = 1
+        var iterations = 0
+        while k < d {
+            iterations += 1
+            guard iterations <= maximumIterations,
+                  _sizeReduce(k, &basis, &gram, &report)
+            else {
+                return false
+            }
+            let previous = r[k - 1][k - 1]
+            let m = mu[k][k - 1]
+            if r[k][k] + m * m * previous < delta * previous {
+                // Lovász condition fails: swap and step back
+                basis.swapRows(k - 1, k)
+                gram.swapAt(k - 1, k)
+                for i in 0 ..< d {
+                    gram[i].swapAt(k - 1, k)
+                }
+                report.swapCount += 1
+                k = Swift.max(k - 1, 1)
+                if k == 1, !_computeFirstRow(gram) {
+                    return false
+                }
+            } else {
+                k += 1
+            }
+        }
+        return true
+    }
+
+    private mutating func _computeFirstRow(_ gram: [[GMPInteger]]) -> Bool {
+        let r00 = Scalar(converting: gram[0][0], precision: precision)
+        r[0] = [r00]
+        return r00.isFinite && zero < r00
+    }
+
+    /// Recompute `r[k]` and `mu[k]` from the exact Gram matrix (Cholesky
+    /// factorization step).
+    ///
+    /// - Returns: `false` if any value is non-finite or the squared norm is
+    ///   not positive.
+    private mutating func _computeRow(
+        _ k: Int,
+        _ gram: [[GMPInteger]]
+    ) -> Bool {
+        var rk = [Scalar]()
+        var muk = [Scalar]()
+        rk.reserveCapacity(k + 1)
+        muk.reserveCapacity(k)
+        for j in 0 ..< k {
+            var value = Scalar(converting: gram[k][j], precision: precision)
+            for i in 0 ..< j {
+                value = value - mu[j][i] * rk[i]
+            }
+            let coefficient = value / r[j][j]
+            guard coefficient.isFinite else {
+                return false
+            }
+            rk.append(value)
+            muk.append(coefficient)
+        }
+        var norm = Scalar(converting: gram[k][k], precision: precision)
+        for i in 0 ..< k {
+            norm = norm - muk[i] * rk[i]
+        }
+        rk.append(norm)
+        r[k] = rk
+        mu[k] = muk
+        return norm.isFinite && zero < norm
+    }
+
+    /// Lazily size-reduce row `k` against rows `0 ..< k`.
+    private mutating func _sizeReduce(
+        _ k: Int,
+        _ basis: inout GMPIntegerMatrix,
+        _ gram: inout [[GMPInteger]],
+        _ report: inout LatticeReductionReport
+    ) -> Bool {
+        var passes = 0
+        while true {
+            guard _computeRow(k, gram) else {
+                return false
+            }
+            if mu[k].allSatisfy({ $0.doubleValue.magnitude <= eta }) {
+                return true
+            }
+            passes += 1
+            guard passes <= maximumPasses else {
+                return false
+            }
+
+            // Round from the last coefficient down, updating the remaining
+            // approximate coefficients as each multiple is removed
+            var muk = mu[k]
+            var sources = [Int]()
+            var coefficients = [GMPInteger]()
+            for j in stride(from: k - 1, through: 0, by: -1) {
+                let x = muk[j].roundedToGMPInteger()
+                if x.isZero {
+                    continue
+                }
+                let xs = Scalar(converting: x, precision: precision)
+                muk[j] = muk[j] - xs
+                for i in 0 ..< j {
+                    muk[i] = muk[i] - xs * mu[j][i]
+                }
+                sources.append(j)
+                coefficients.append(x)
+            }
+            guard !sources.isEmpty else {
+                // Coefficients above eta that all round to zero cannot be
+                // reduced further at this precision
+                return false
+            }
+
+            basis.subtractLinearCombination(
+                ofRows: sources,
+                coefficients: coefficients,
+                fromRow: k
+            )
+            report.sizeReductionCount += 1
+
+            // Refresh the exact Gram row and column of k
+            let d = basis.rowCount
+            let products = basis.dotProducts(
+                ofRow: k,
+                withRows: Array(0 ..< d)
+            )
+            for i in 0 ..< d {
+                gram[k][i] = products[i]
+                gram[i][k] = products[i]
+            }
+        }
+    }
+}
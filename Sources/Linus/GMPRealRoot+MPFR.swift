@@ -0,0 +1,37 @@
+// Import CKalliope first so gmp.h is available when CLinus imports mpfr.h
+import CKalliope
+import CLinus
+import CLinusBridge
+import Kalliope
+
+extension GMPRealRoot {
+    /// The root rounded to an `MPFRFloat`, within one ulp.
+    ///
+    /// The isolating interval is refined until its width is below a
+    /// quarter ulp at the endpoint nearer zero, and its midpoint is then
+    /// rounded to nearest. Exact roots are rounded correctly.
+    ///
+    /// - Parameter precision: The precision of the result in bits.
+    public func value(precision: Int) -> MPFRFloat {
+        var root = self
+        while !root.isExact {
+            let near = root.lower.sign >= 0 ? root.lower : root.upper
+            if near.sign == 0 {
+                // Move the interval away from zero to bound the magnitude
+                let width = root.upper - root.lower
+                root = root.refined(
+                    bits: width.denominator.bitCount
+                        - width.numerator.bitCount + 2
+                )
+                continue
+            }
+            // |root| > |near| ≥ 2^magnitude
+            let magnitude = near.numerator.absoluteValue().bitCount
+                - near.denominator.bitCount - 1
+            root = root.refined(bits: precision - magnitude + 2)
+            let sum = MPFRFloat(root.lower + root.upper, precision: precision)
+            return sum.dividedByPowerOf2(1).result
+        }
+        return MPFRFloat(root.lower, precision: precision)
+    }
+}
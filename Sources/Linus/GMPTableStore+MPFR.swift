@@ -0,0 +1,200 @@
+// Import CKalliope first so gmp.h is available when CLinus imports mpfr.h
+import CKalliope
+import CLinus
+import CLinusBridge
+import Kalliope
+
+extension GMPTableKind {
+    /// MPFR floats, read as `MPFRFloatTable`.
+    ///
+    /// The payload is `count` index entries of four `Int64`s (precision,
+    /// exponent, signed MPFR custom kind, limb offset into the limb
+    /// region), followed by the limb region. Only regular values have
+    /// limbs.
+    public static let mpfrFloats = GMPTableKind(rawValue: 0x100)
+}
+
+/// The size of one `MPFRFloatTable` index entry, in `Int64`s.
+private let _floatIndexStride = 4
+
+// MARK: - Float Tables
+
+/// A read-only view of an MPFR float table in a `GMPTableStore`.
+///
+/// Elements are not copied out of the mapping: `withElement(at:_:)` wraps
+/// an element's significand in place with MPFR's custom interface.
+/// Subscripting makes an ordinary `MPFRFloat` copy.
+public struct MPFRFloatTable: RandomAccessCollection {
+    /// The store, kept alive by this view.
+    public let store: GMPTableStore
+
+    /// The number of elements.
+    public let count: Int
+
+    let _index: UnsafePointer<Int64>
+    let _limbs: UnsafePointer<mp_limb_t>
+    let _limbCount: Int
+
+    init(store: GMPTableStore, count: Int, payload: UnsafeRawBufferPointer) {
+        self.store = store
+        self.count = count
+        let base = payload.baseAddress!
+        let indexBytes = count * _floatIndexStride * 8
+        _index = base.assumingMemoryBound(to: Int64.self)
+        _limbs = (base + indexBytes).assumingMemoryBound(to: mp_limb_t.self)
+        _limbCount = (payload.count - indexBytes)
+            / MemoryLayout<mp_limb_t>.size
+    }
+
+    public var startIndex: Int {
+        0
+    }
+
+    public var endIndex: Int {
+        count
+    }
+
+    /// The precision of the element at `index`, in bits.
+    public func precision(at index: Int) -> Int {
+        precondition(index >= 0 && index < count, "index out of range")
+        return Int(_index[_floatIndexStride * index])
+    }
+
+    /// Execute a closure with a read-only `mpfr_t` for an element.
+    ///
+    /// The `mpfr_t` points directly at the mapped significand. It may be
+    /// passed as an input to any MPFR function but must not be modified or
+    /// used after the closure returns.
+    ///
+    /// - Parameters:
+    ///   - index: The element index.
+    ///   - body: A closure that receives the pointer and returns a value.
+    /// - Returns: The value returned by the closure.
+    ///
+    /// - Requires: `0 <= index < count`.
+    /// - Wraps: `mpfr_custom_init_set`
+    public func withElement<T>(
+        at index: Int,
+        _ body: (UnsafePointer<__mpfr_struct>) throws -> T
+    ) rethrows -> T {
+        precondition(index >= 0 && index < count, "index out of range")
+        let entry = _index + _floatIndexStride * index
+        let precision = mpfr_prec_t(entry[0])
+        let exponent = mpfr_exp_t(entry[1])
+        let kind = Int32(entry[2])
+        let offset = Int(entry[3])
+        let isRegular = abs(kind) == Int32(MPFR_REGULAR_KIND.rawValue)
+        let limbs = isRegular
+            ? Int(mpfr_custom_get_size(precision))
+            / MemoryLayout<mp_limb_t>.size
+            : 0
+        precondition(
+            precision >= clinus_get_prec_min()
+                && precision <= clinus_get_prec_max()
+                && offset >= 0 && offset <= _limbCount - limbs,
+            "table element out of range"
+        )
+        var view = __mpfr_struct()
+        // MPFR only reads the significand of an input operand
+        mpfr_custom_init_set(
+            &view,
+            kind,
+            exponent,
+            precision,
+            UnsafeMutablePointer(mutating: _limbs + offset)
+        )
+        return try withExtendedLifetime(store) {
+            try body(&view)
+        }
+    }
+
+    /// The element at `index`, copied into a new `MPFRFloat` at its stored
+    /// precision.
+    public subscript(index: Int) -> MPFRFloat {
+        withElement(at: index) { element in
+            let result = MPFRFloat(precision: Int(mpfr_get_prec(element)))
+            mpfr_set(&result._storage.value, element, MPFR_RNDN)
+            return result
+        }
+    }
+}
+
+extension GMPTableStore {
+    /// A table of MPFR floats.
+    ///
+    /// - Parameter name: The table name.
+    /// - Returns: A view of the table, or `nil` if there is no float table
+    ///   with this name.
+    public func floats(named name: String) -> MPFRFloatTable? {
+        guard let table = rawTable(named: name, kind: .mpfrFloats),
+              table.count <= table.payload.count / (_floatIndexStride * 8)
+        else {
+            return nil
+        }
+        return MPFRFloatTable(
+            store: self,
+            count: table.count,
+            payload: table.payload
+        )
+    }
+}
+
+extension GMPTableStoreBuilder {
+    /// Add a table of MPFR floats, each kept at its own precision.
+    ///
+    /// - Parameters:
+    ///   - name: The table name.
+    ///   - floats: The values.
+    public mutating func add(_ name: String, floats: [MPFRFloat]) {
+        var index = [Int64]()
+        index.reserveCapacity(_floatIndexStride * floats.count)
+        var limbs = [mp_limb_t]()
+        for value in floats {
+            value.withCPointer { ptr in
+                let precision = mpfr_get_prec(ptr)
+                let kind = mpfr_custom_get_kind(ptr)
+                let isRegular = mpfr_regular_p(ptr) != 0
+                index.append(Int64(precision))
+                index.append(isRegular ? Int64(mpfr_custom_get_exp(ptr)) : 0)
+                index.append(Int64(kind))
+                index.append(Int64(limbs.count))
+                guard isRegular else {
+                    return
+                }
+                let count = Int(mpfr_custom_get_size(precision))
+                    / MemoryLayout<mp_limb_t>.size
+                let significand = mpfr_custom_get_significand(ptr)!
+                    .assumingMemoryBound(to: mp_limb_t.self)
+                limbs.append(
+                    contentsOf: UnsafeBufferPointer(
+                        start: significand,
+                        count: count
+                    )
+                )
+            }
+        }
+        var payload = [UInt8]()
+        index.withUnsafeBytes { payload.append(contentsOf: $0) }
+        limbs.withUnsafeBytes { payload.append(contentsOf: $0) }
+        addRaw(name, kind: .mpfrFloats, count: floats.count, payload: payload)
+    }
+
+    /// Add π and log 2 at `precision` as a float table, with π at index 0
+    /// and log 2 at index 1.
+    ///
+    /// - Parameters:
+    ///   - name: The table name. Defaults to `"constants"`.
+    ///   - precision: The precision in bits.
+    public mutating func addConstants(
+        _ name: String = "constants",
+        precision: Int
+    ) {
+        add(
+            name,
+            floats: [
+                MPFRFloat.pi(precision: precision).result,
+                MPFRFloat.log2(precision: precision).result,
+            ]
+        )
+    }
+}
@@ -0,0 +1,121 @@
+// Import CKalliope first so gmp.h is available when CLinus imports mpfr.h
+import CKalliope
+import CLinus
+import CLinusBridge
+import Kalliope
+
+// MARK: - Gram-Schmidt Scalars
+
+/// A floating-point type usable for approximate Gram-Schmidt data in lattice
+/// reduction.
+///
+/// Lattice reduction keeps the basis exact (`GMPInteger`) and only
+/// approximates the Gram-Schmidt coefficients. Conforming types supply the
+/// handful of operations that approximation needs, so the same reduction
+/// loop runs on `Double`, `DoubleDouble` or `MPFRFloat` and the cheapest type
+/// that is accurate enough can be chosen at run time.
+public protocol GramSchmidtScalar {
+    /// Convert an exact integer, rounding to the working precision.
+    ///
+    /// - Parameters:
+    ///   - value: The integer to convert.
+    ///   - precision: The working precision in bits. Fixed-precision types
+    ///     ignore it.
+    init(converting value: GMPInteger, precision: Int)
+
+    /// Convert a `Double` at the working precision.
+    ///
+    /// - Parameters:
+    ///   - value: The value to convert.
+    ///   - precision: The working precision in bits. Fixed-precision types
+    ///     ignore it.
+    init(converting value: Double, precision: Int)
+
+    static func + (lhs: Self, rhs: Self) -> Self
+    static func - (lhs: Self, rhs: Self) -> Self
+    static func * (lhs: Self, rhs: Self) -> Self
+    static func / (lhs: Self, rhs: Self) -> Self
+    static func < (lhs: Self, rhs: Self) -> Bool
+
+    /// Whether the value is neither infinite nor NaN.
+    var isFinite: Bool { get }
+
+    /// The nearest `Double`, used for threshold tests.
+    var doubleValue: Double { get }
+
+    /// The nearest integer.
+    ///
+    /// - Requires: The value must be finite.
+    func roundedToGMPInteger() -> GMPInteger
+}
+
+extension Double: GramSchmidtScalar {
+    public init(converting value: GMPInteger, precision _: Int) {
+        self = value.toDouble()
+    }
+
+    public init(converting value: Double, precision _: Int) {
+        self = value
+    }
+
+    public var doubleValue: Double {
+        self
+    }
+
+    public func roundedToGMPInteger() -> GMPInteger {
+        GMPInteger(rounded())
+    }
+}
+
+extension DoubleDouble: GramSchmidtScalar {
+    public init(converting value: GMPInteger, precision _: Int) {
+        self.init(value)
+    }
+
+    public init(converting value: Double, precision _: Int) {
+        self.init(value)
+    }
+
+    public var doubleValue: Double {
+        toDouble()
+    }
+}
+
+extension MPFRFloat: GramSchmidtScalar {
+    public init(converting value: GMPInteger, precision: Int) {
+        self.init(value, precision: precision)
+    }
+
+    public init(converting value: Double, precision: Int) {
+        self.init(value, precision: precision)
+    }
+
+    /// Whether the value is neither infinite nor NaN.
+    ///
+    /// - Note: Same as `isRegular`.
+    public var isFinite: Bool {
+        isRegular
+    }
+
+    public var doubleValue: Double {
+        toDouble()
+    }
+
+    /// Round to the nearest integer, ties to even.
+    ///
+    /// - Returns: The nearest `GMPInteger`.
+    ///
+    /// - Requires: The value must be finite.
+    ///
+    /// - Wraps: `mpfr_get_z`
+    public func roundedToGMPInteger() -> GMPInteger {
+        precondition(isFinite, "value must be finite")
+        var result = GMPInteger()
+        withCPointer { x in
+            result.withMutableCPointer { z in
+                _ = mpfr_get_z(z, x, MPFR_RNDN)
+            }
+        }
+        return result
+    }
+}
@@ -0,0 +1,550 @@
+// Import CKalliope first so gmp.h is available when CLinus imports mpfr.h
+import CKalliope
+import CLinus
+import CLinusBridge
+import Foundation
+import Kalliope
+
+// MARK: - Hypergeometric Functions
+
+/// The generalized hypergeometric function
+/// `pFq(a₁, ..., a_p; b₁, ..., b_q; z) = Σ (a₁)ₖ...(a_p)ₖ / ((b₁)ₖ...(b_q)ₖ)
+/// · zᵏ/k!` with rational parameters.
+///
+/// The ratio of consecutive terms is `z · p(k)/q(k)` for integer
+/// polynomials `p` and `q`, so the series is summed without a
+/// full-precision multiply and divide per term:
+///
+/// - For a floating-point `z`, rectangular splitting groups the terms into
+///   blocks of `m ≈ √n`. Within a block every term is a precomputed power
+///   `zⁱ` times an exact integer, which costs `O(precision)`; only the
+///   `n/m` block boundaries need a full multiplication. The powers of `z`
+///   are kept in a process-wide cache managed by `GMPCacheRegistry`, so
+///   repeated evaluations at the same `z` (with different parameters, or
+///   to the same precision) reuse them.
+/// - For a rational `z` of small height, binary splitting sums the series
+///   exactly as one fraction with a product tree of integers and divides
+///   once.
+///
+/// The number of terms follows from a bound on the tail: once every later
+/// term ratio is below some `ρ < 1`, the tail is at most `|tₙ|/(1 - ρ)`.
+/// Cancellation is absorbed by raising the working precision by the size
+/// of the largest term, so the result has an absolute error of about
+/// `2^-precision` times `max(1, |value|)`.
+///
+/// ```swift
+/// // erf(x) = 2x/√π · 1F1(1/2; 3/2; -x²)
+/// let f = HypergeometricFunction(upper: [0.5], lower: [1.5])
+/// let value = f.value(at: -x * x, precision: 256)
+/// ```
+public struct HypergeometricFunction {
+    /// The upper parameters `a₁, ..., a_p`.
+    public let upper: [GMPRational]
+
+    /// The lower parameters `b₁, ..., b_q`.
+    public let lower: [GMPRational]
+
+    /// Extra bits carried beyond the requested precision.
+    static let guardBits = 16
+
+    /// `(αᵢ, dᵢ)` with `aᵢ = αᵢ/dᵢ`.
+    private let _upperFactors: [(GMPInteger, GMPInteger)]
+
+    /// `(βⱼ, eⱼ)` with `bⱼ = βⱼ/eⱼ`.
+    private let _lowerFactors: [(GMPInteger, GMPInteger)]
+
+    /// `Π eⱼ` and `Π dᵢ`, the constant factors of `p` and `q`.
+    private let _upperScale: GMPInteger
+    private let _lowerScale: GMPInteger
+
+    /// The number of nonzero terms if an upper parameter is a non-positive
+    /// integer, otherwise `nil`.
+    private let _terminatingCount: Int?
+
+    /// Create the function with the given parameters.
+    ///
+    /// - Parameters:
+    ///   - upper: The upper parameters.
+    ///   - lower: The lower parameters. None may be a non-positive integer.
+    public init(upper: [GMPRational], lower: [GMPRational]) {
+        precondition(
+            !lower.contains {
+                $0.denominator == 1 && $0.numerator.sign <= 0
+            },
+            "lower parameters must not be non-positive integers"
+        )
+        self.upper = upper
+        self.lower = lower
+        _upperFactors = upper.map { ($0.numerator, $0.denominator) }
+        _lowerFactors = lower.map { ($0.numerator, $0.denominator) }
+        _upperScale = lower.reduce(GMPInteger(1)) { $0 * $1.denominator }
+        _lowerScale = upper.reduce(GMPInteger(1)) { $0 * $1.denominator }
+        _terminatingCount = upper
+            .filter { $0.denominator == 1 && $0.numerator.sign <= 0 }
+            .map { 1 - $0.numerator.toInt() }
+            .min()
+    }
+
+    /// `p(k)` and `q(k)`, the numerator and denominator of the ratio of
+    /// term `k + 1` to term `k`, without the factor `z`.
+    func _ratio(_ k: Int) -> (p: GMPInteger, q: GMPInteger) {
+        var p = _upperScale
+        for (alpha, d) in _upperFactors {
+            p = p * (alpha + d * k)
+        }
+        var q = _lowerScale * (k + 1)
+        for (beta, e) in _lowerFactors {
+            q = q * (beta + e * k)
+        }
+        return (p, q)
+    }
+
+    // MARK: - Evaluation
+
+    /// The value at a floating-point argument, by rectangular splitting.
+    ///
+    /// - Parameters:
+    ///   - z: The argument. Must be finite, and `|z| < 1` when `p = q + 1`,
+    ///     unless the series terminates.
+    ///   - precision: The precision of the result. Defaults to the precision
+    ///     of `z`.
+    /// - Returns: The value, rounded to `precision`.
+    ///
+    /// - Requires: `p <= q + 1` unless the series terminates.
+    public func value(at z: MPFRFloat, precision: Int? = nil) -> MPFRFloat {
+        precondition(z.isRegular || z.isZero, "z must be finite")
+        let precision = precision ?? z.precision
+        let (count, largest) = _termCount(
+            log2Z: Self._log2Magnitude(z),
+            bits: precision + Self.guardBits
+        )
+        let working = precision + Self.guardBits
+            + Swift.max(0, Int(largest.rounded(.up)))
+            + (Int.bitWidth - count.leadingZeroBitCount)
+        let sum = _rectangularSum(z, count: count, precision: working)
+        var result = MPFRFloat(precision: precision)
+        result.set(sum)
+        return result
+    }
+
+    /// The value at a rational argument.
+    ///
+    /// Binary splitting is used when `z` is small against the precision;
+    /// otherwise `z` is rounded and summed by rectangular splitting.
+    ///
+    /// - Parameters:
+    ///   - z: The argument, with `|z| < 1` when `p = q + 1`, unless the
+    ///     series terminates.
+    ///   - precision: The precision of the result.
+    /// - Returns: The value, rounded to `precision`.
+    ///
+    /// - Requires: `p <= q + 1` unless the series terminates.
+    public func value(at z: GMPRational, precision: Int) -> MPFRFloat {
+        let height = Swift.max(z.numerator.bitCount, z.denominator.bitCount)
+        guard height * 16 <= precision else {
+            var rounded = MPFRFloat(
+                precision: precision + Self.guardBits + height
+            )
+            rounded.set(z)
+            return value(at: rounded, precision: precision)
+        }
+        var estimate = MPFRFloat(precision: 64)
+        estimate.set(z)
+        let (count, _) = _termCount(
+            log2Z: Self._log2Magnitude(estimate),
+            bits: precision + Self.guardBits
+        )
+        let (_, q, t) = _binarySplit(
+            0 ..< count,
+            numerator: z.numerator,
+            denominator: z.denominator
+        )
+        var numerator = MPFRFloat(precision: precision + Self.guardBits)
+        numerator.set(t)
+        var denominator = MPFRFloat(precision: precision + Self.guardBits)
+        denominator.set(q)
+        var result = MPFRFloat(precision: precision)
+        result.set(numerator / denominator)
+        return result
+    }
+
+    /// Discard the cached powers of every argument.
+    public static func clearCache() {
+        _HypergeometricPowerCache.shared.removeAll()
+    }
+
+    // MARK: - Term Count
+
+    /// `log₂|x|`, or `-∞` for zero.
+    static func _log2Magnitude(_ x: MPFRFloat) -> Double {
+        guard !x.isZero else {
+            return -.infinity
+        }
+        var exponent = 0
+        let significand = x.withCPointer { value in
+            mpfr_get_d_2exp(&exponent, value, MPFR_RNDN)
+        }
+        return log2(abs(significand)) + Double(exponent)
+    }
+
+    /// The number of terms that bring the tail below `2^-bits`, and
+    /// `log₂` of the largest term.
+    ///
+    /// For `k ≥ N > max|bⱼ|`, each term ratio is at most
+    /// `ρ = |z| · Π(1 + |aᵢ|/N) / Π(1 - |bⱼ|/N) · N^(p-q-1)`, since
+    /// `|aᵢ + k| ≤ k(1 + |aᵢ|/N)`, `|bⱼ + k| ≥ k(1 - |bⱼ|/N)` and
+    /// `p ≤ q + 1`.
+    func _termCount(log2Z: Double, bits: Int) -> (Int, Double) {
+        let a = upper.map { $0.toDouble() }
+        let b = lower.map { $0.toDouble() }
+        let limit = _terminatingCount ?? Int.max
+        if _terminatingCount == nil {
+            precondition(
+                upper.count <= lower.count + 1,
+                "the series diverges when p > q + 1"
+            )
+            precondition(
+                upper.count <= lower.count || log2Z < 0,
+                "the series diverges when p = q + 1 and |z| >= 1"
+            )
+        }
+        let target = -Double(bits)
+        let minimum = (b.map(abs).max() ?? 0).rounded(.down) + 1
+        let excess = Double(upper.count - lower.count - 1)
+        var log2Term = 0.0
+        var largest = 0.0
+        var k = 0
+        while k < limit {
+            let n = Double(k)
+            if n >= minimum, k > 0 {
+                var log2Rho = log2Z + excess * log2(n)
+                for x in a {
+                    log2Rho += log2(1 + abs(x) / n)
+                }
+                for x in b {
+                    log2Rho -= log2(1 - abs(x) / n)
+                }
+                if log2Rho < 0,
+                   log2Term - log2(1 - exp2(log2Rho)) <= target
+                {
+                    break
+                }
+            }
+            precondition(k < 1 << 26, "the series converges too slowly")
+            var log2Ratio = log2Z - log2(n + 1)
+            for x in a {
+                log2Ratio += log2(abs(x + n))
+            }
+            for x in b {
+                log2Ratio -= log2(abs(x + n))
+            }
+            log2Term += log2Ratio
+            largest = Swift.max(largest, log2Term)
+            k += 1
+        }
+        return (k, largest)
+    }
+
+    // MARK: - Rectangular Splitting
+
+    /// `Σ_{k<count} tₖ` with `t₀ = 1`, at `precision` bits.
+    ///
+    /// With `m` powers of `z`, block `j` covers terms `jm ..< jm + m`.
+    /// Scaled by `D = Π q(l)` over the block, its terms relative to the
+    /// first are `Nᵢ zⁱ` with `Nᵢ = Π_{l<i} p(l) · Π_{l≥i} q(l)`, and the
+    /// next block starts `P zᵐ / D` later, `P = Π p(l)`. Blocks are
+    /// combined by Horner's rule from the last.
+    func _rectangularSum(
+        _ z: MPFRFloat,
+        count: Int,
+        precision: Int
+    ) -> MPFRFloat {
+        var m = 1
+        while m * m < count {
+            m += 1
+        }
+        let powers = _HypergeometricPowerCache.shared.powers(
+            of: z,
+            count: m + 1,
+            precision: precision
+        )
+        let scratch = _MPFRBuffer(count: 3, precision: precision)
+        let accumulator = scratch[0]
+        let sum = scratch[1]
+        let term = scratch[2]
+        let blockCount = (count + m - 1) / m
+        for j in stride(from: blockCount - 1, through: 0, by: -1) {
+            let low = j * m
+            let length = Swift.min(count, low + m) - low
+            let ratios = (low ..< low + length).map { _ratio($0) }
+            var suffix = [GMPInteger](repeating: 1, count: length + 1)
+            for i in stride(from: length - 1, through: 0, by: -1) {
+                suffix[i] = suffix[i + 1] * ratios[i].q
+            }
+            var prefix = GMPInteger(1)
+            mpfr_set_zero(sum, 1)
+            for i in 0 ..< length {
+                (prefix * suffix[i]).withCPointer { n in
+                    _ = mpfr_mul_z(term, powers[i], n, MPFR_RNDN)
+                }
+                mpfr_add(sum, sum, term, MPFR_RNDN)
+                prefix = prefix * ratios[i].p
+            }
+            if j == blockCount - 1 {
+                mpfr_set(accumulator, sum, MPFR_RNDN)
+            } else {
+                mpfr_mul(accumulator, accumulator, powers[m], MPFR_RNDN)
+                prefix.withCPointer { p in
+                    _ = mpfr_mul_z(accumulator, accumulator, p, MPFR_RNDN)
+                }
+                mpfr_add(accumulator, accumulator, sum, MPFR_RNDN)
+            }
+            suffix[0].withCPointer { d in
+                _ = mpfr_div_z(accumulator, accumulator, d, MPFR_RNDN)
+            }
+        }
+        return scratch.float(at: 0)
+    }
+
+    // MARK: - Binary Splitting
+
+    /// `(P, Q, T)` for the terms in `range`, with `z = u/v`: `P` and `Q`
+    /// are the products of `u·p(k)` and `v·q(k)`, and `T/Q` is the sum of
+    /// the terms relative to the first.
+    ///
+    /// The top of the product tree is split across cores.
+    func _binarySplit(
+        _ range: Range<Int>,
+        numerator u: GMPInteger,
+        denominator v: GMPInteger
+    ) -> (GMPInteger, GMPInteger, GMPInteger) {
+        let cores = ProcessInfo.processInfo.activeProcessorCount
+        guard range.count >= 64 * cores, cores > 1 else {
+            return _binarySplitSerial(range, numerator: u, denominator: v)
+        }
+        var parts = [(GMPInteger, GMPInteger, GMPInteger)?](
+            repeating: nil,
+            count: cores
+        )
+        parts.withUnsafeMutableBufferPointer { buffer in
+            DispatchQueue.concurrentPerform(iterations: cores) { i in
+                let lower = range.lowerBound + i * range.count / cores
+                let upper = range.lowerBound + (i + 1) * range.count / cores
+                buffer[i] = _binarySplitSerial(
+                    lower ..< upper,
+                    numerator: u,
+                    denominator: v
+                )
+            }
+        }
+        var (p, q, t) = parts[0]!
+        for part in parts.dropFirst() {
+            let (p2, q2, t2) = part!
+            t = t * q2 + p * t2
+            p = p * p2
+            q = q * q2
+        }
+        return (p, q, t)
+    }
+
+    private func _binarySplitSerial(
+        _ range: Range<Int>,
+        numerator u: GMPInteger,
+        denominator v: GMPInteger
+    ) -> (GMPInteger, GMPInteger, GMPInteger) {
+        if range.count == 1 {
+            let (p, q) = _ratio(range.lowerBound)
+            let scaled = q * v
+            return (p * u, scaled, scaled)
+        }
+        let middle = range.lowerBound + range.count / 2
+        let (p1, q1, t1) = _binarySplitSerial(
+            range.lowerBound ..< middle,
+            numerator: u,
+            denominator: v
+        )
+        let (p2, q2, t2) = _binarySplitSerial(
+            middle ..< range.upperBound,
+            numerator: u,
+            denominator: v
+        )
+        return (p1 * p2, q1 * q2, t1 * q2 + p1 * t2)
+    }
+}
+
+// MARK: - Power Cache
+
+/// Powers `z⁰ ..< zᶜᵒᵘⁿᵗ` of one argument at one precision.
+final class _HypergeometricPowers: @unchecked Sendable {
+    let buffer: _MPFRBuffer
+
+    var count: Int {
+        buffer.count
+    }
+
+    var precision: Int {
+        Int(buffer.precision)
+    }
+
+    /// The approximate memory held, in bytes.
+    var byteCount: Int {
+        // Significand limbs plus the `mpfr_t` header
+        count * (Int(mpfr_custom_get_size(buffer.precision)) + 32)
+    }
+
+    init(of z: MPFRFloat, count: Int, precision: Int) {
+        buffer = _MPFRBuffer(count: count, precision: precision)
+        mpfr_set_ui(buffer[0], 1, MPFR_RNDN)
+        if count > 1 {
+            buffer.store(z, at: 1)
+        }
+        for i in stride(from: 2, to: count, by: 1) {
+            mpfr_mul(buffer[i], buffer[i - 1], buffer[1], MPFR_RNDN)
+        }
+    }
+
+    subscript(index: Int) -> UnsafeMutablePointer<__mpfr_struct> {
+        buffer[index]
+    }
+}
+
+/// The process-wide cache of argument powers for rectangular splitting,
+/// keyed by the exact argument.
+///
+/// An entry serves any request for at most as many powers at at most its
+/// precision; a larger request replaces it. The cache is managed by
+/// `GMPCacheRegistry.shared`.
+final class _HypergeometricPowerCache: GMPManagedCache, @unchecked Sendable {
+    /// The shared cache, registered with the shared registry.
+    static let shared: _HypergeometricPowerCache = {
+        let cache = _HypergeometricPowerCache()
+        GMPCacheRegistry.shared.register(cache)
+        return cache
+    }()
+
+    /// The exact argument, as `mantissa · 2^exponent` with `mantissa` odd
+    /// (or zero), whatever the precision of the float it came from.
+    struct Key: Hashable {
+        let mantissa: GMPInteger
+        let exponent: Int
+    }
+
+    /// A cached power table with its accounting.
+    struct Entry {
+        let powers: _HypergeometricPowers
+        let byteCount: Int
+
+        /// The time taken to compute the table, in nanoseconds.
+        let cost: Double
+
+        var priority: Double
+    }
+
+    /// Guards `entries`.
+    private let lock = NSLock()
+
+    /// The cached tables.
+    private var entries: [Key: Entry] = [:]
+
+    let cacheName = "HypergeometricFunction.powers"
+
+    /// Powers `z⁰ ..< z^count` at `precision` bits or more.
+    ///
+    /// Computation happens outside the lock; if two threads race on the
+    /// same argument, the larger table is kept.
+    func powers(
+        of z: MPFRFloat,
+        count: Int,
+        precision: Int
+    ) -> _HypergeometricPowers {
+        var mantissa = GMPInteger()
+        var exponent = 0
+        if !z.isZero {
+            z.withCPointer { x in
+                mantissa.withMutableCPointer { m in
+                    exponent = Int(mpfr_get_z_2exp(m, x))
+                }
+            }
+            // The mantissa carries z's precision as trailing zeros; strip
+            // them so equal values at different precisions share a key
+            let zeros = mantissa.scan1(startingFrom: 0)!
+            mantissa = mantissa.rightShifted(by: zeros)
+            exponent += zeros
+        }
+        let key = Key(mantissa: mantissa, exponent: exponent)
+        let registry = GMPCacheRegistry.shared
+        lock.lock()
+        let cached = entries[key]
+        lock.unlock()
+        if let cached, cached.powers.count >= count,
+           cached.powers.precision >= precision
+        {
+            let priority = registry.priority(
+                cost: cached.cost,
+                byteCount: cached.byteCount
+            )
+            lock.lock()
+            entries[key]?.priority = priority
+            lock.unlock()
+            return cached.powers
+        }
+        let start = DispatchTime.now().uptimeNanoseconds
+        let computed = _HypergeometricPowers(
+            of: z,
+            count: Swift.max(count, cached?.powers.count ?? 0),
+            precision: Swift.max(precision, cached?.powers.precision ?? 0)
+        )
+        let cost = Double(DispatchTime.now().uptimeNanoseconds - start)
+        let byteCount = computed.byteCount
+        lock.lock()
+        if let existing = entries[key],
+           existing.powers.count >= computed.count,
+           existing.powers.precision >= computed.precision
+        {
+            lock.unlock()
+            return existing.powers
+        }
+        entries[key] = Entry(
+            powers: computed,
+            byteCount: byteCount,
+            cost: cost,
+            priority: registry.priority(cost: cost, byteCount: byteCount)
+        )
+        lock.unlock()
+        registry.didGrow()
+        return computed
+    }
+
+    /// Remove every cached table.
+    func removeAll() {
+        lock.lock()
+        defer { lock.unlock() }
+        entries.removeAll()
+    }
+
+    // MARK: - GMPManagedCache
+
+    func cacheEntries() -> [GMPCacheEntry] {
+        lock.lock()
+        defer { lock.unlock() }
+        return entries.map { key, entry in
+            GMPCacheEntry(
+                key: key,
+                byteCount: entry.byteCount,
+                priority: entry.priority
+            )
+        }
+    }
+
+    func evictCacheEntries(_ keys: [AnyHashable]) {
+        lock.lock()
+        defer { lock.unlock() }
+        for case let key as Key in keys {
+            entries[key] = nil
+        }
+    }
+
+    func removeAllCacheEntries() {
+        removeAll()
+    }
+}
@@ -0,0 +1,185 @@
+// Import CKalliope first so gmp.h is available when CLinus imports mpfr.h
+import CKalliope
+import CLinus
+import CLinusBridge
+import Foundation
+import Kalliope
+
+/// A contiguous block of MPFR values sharing one precision.
+///
+/// Numerical kernels (matrix updates, recurrences) perform many operations on
+/// a fixed set of values. Going through `MPFRFloat` for each of them costs an
+/// allocation per intermediate result; this buffer instead lays out all
+/// `mpfr_t` headers in one array and all significands in one block, using
+/// MPFR's custom interface. After initialization nothing is allocated, and
+/// kernels call `mpfr_*` directly on `self[i]`.
+///
+/// - Note: The significands are not owned by MPFR, so values must never be
+///   cleared, re-initialized or set to a different precision. `mpfr_swap`
+///   between two values of the same buffer (or of buffers with the same
+///   precision that outlive the swap) is allowed.
+final class _MPFRBuffer {
+    /// The number of values.
+    let count: Int
+
+    /// The precision of every value, in bits.
+    let precision: mpfr_prec_t
+
+    /// The `mpfr_t` headers, `count` of them.
+    private let values: UnsafeMutablePointer<__mpfr_struct>
+
+    /// The significand block shared by all values.
+    private let significands: UnsafeMutableRawPointer
+
+    /// Create a buffer of zeros.
+    ///
+    /// - Parameters:
+    ///   - count: The number of values. Must be non-negative.
+    ///   - precision: The precision in bits. Must be between MPFR_PREC_MIN
+    ///     and MPFR_PREC_MAX.
+    ///
+    /// - Requires: `count >= 0` and `precision` must be a valid precision.
+    /// - Guarantees: Every value is +0 at the given precision.
+    init(count: Int, precision: Int) {
+        precondition(count >= 0, "count must be non-negative")
+        let precMin = Int(clinus_get_prec_min())
+        let precMax = Int(clinus_get_prec_max())
+        precondition(
+            precision >= precMin && precision <= precMax,
+            "precision must be between MPFR_PREC_MIN and MPFR_PREC_MAX"
+        )
+        self.count = count
+        self.precision = mpfr_prec_t(precision)
+        let stride = Int(mpfr_custom_get_size(self.precision))
+        values = .allocate(capacity: Swift.max(count, 1))
+        significands = .allocate(
+            byteCount: Swift.max(count * stride, 1),
+            alignment: MemoryLayout<mp_limb_t>.alignment
+        )
+        for i in 0 ..< count {
+            let significand = significands + i * stride
+            mpfr_custom_init(significand, self.precision)
+            mpfr_custom_init_set(
+                values + i,
+                Int32(MPFR_ZERO_KIND.rawValue),
+                0,
+                self.precision,
+                significand
+            )
+        }
+    }
+
+    /// Create an independent copy of another buffer.
+    ///
+    /// - Parameter other: The buffer to copy.
+    convenience init(copying other: _MPFRBuffer) {
+        self.init(count: other.count, precision: Int(other.precision))
+        for i in 0 ..< count {
+            _ = mpfr_set(values + i, other.values + i, MPFR_RNDN)
+        }
+    }
+
+    deinit {
+        values.deallocate()
+        significands.deallocate()
+    }
+
+    /// The value at `index`.
+    ///
+    /// - Requires: `0 <= index < count`.
+    subscript(index: Int) -> UnsafeMutablePointer<__mpfr_struct> {
+        values + index
+    }
+
+    /// Copy a float into the buffer, rounding to the buffer's precision.
+    ///
+    /// - Parameters:
+    ///   - value: The float to copy.
+    ///   - index: The destination index.
+    func store(_ value: MPFRFloat, at index: Int) {
+        _ = mpfr_set(values + index, &value._storage.value, MPFR_RNDN)
+    }
+
+    /// Copy a value out of the buffer.
+    ///
+    /// - Parameters:
+    ///   - index: The source index.
+    ///   - precision: The precision of the result. Defaults to the buffer's
+    ///     precision.
+    /// - Returns: A new `MPFRFloat`, rounded to nearest if `precision` is
+    ///   lower than the buffer's.
+    func float(at index: Int, precision: Int? = nil) -> MPFRFloat {
+        let result = MPFRFloat(precision: precision ?? Int(self.precision))
+        _ = mpfr_set(&result._storage.value, values + index, MPFR_RNDN)
+        return result
+    }
+
+    /// Build a table of pointers to the values of a row-major matrix, in the
+    /// layout `mpfr_dot` expects.
+    ///
+    /// - Parameters:
+    ///   - rows: The number of matrix rows.
+    ///   - columns: The number of matrix columns.
+    ///   - columnMajor: If `true`, the table lists each column's entries
+    ///     consecutively; otherwise each row's.
+    /// - Returns: A table of `rows * columns` pointers. The caller owns it
+    ///   and must deallocate it; it stays valid while the buffer is alive.
+    ///
+    /// - Requires: `rows * columns == count`.
+    func pointerTable(
+        rows: Int,
+        columns: Int,
+        columnMajor: Bool
+    ) -> UnsafeMutablePointer<mpfr_ptr?> {
+        precondition(rows * columns == count, "shape must match the count")
+        let table = UnsafeMutablePointer<mpfr_ptr?>.allocate(
+            capacity: Swift.max(count, 1)
+        )
+        for i in 0 ..< rows {
+            for j in 0 ..< columns {
+                let index = columnMajor ? j * rows + i : i * columns + j
+                (table + index).initialize(to: values + (i * columns + j))
+            }
+        }
+        return table
+    }
+
+    /// Set every value to +0.
+    func zero() {
+        for i in 0 ..< count {
+            mpfr_set_zero(values + i, 1)
+        }
+    }
+}
+
+// MARK: - Chunked Execution
+
+/// Run `body` over `range` split into contiguous chunks, one per active
+/// processor, concurrently when requested and the range is large enough.
+///
+/// - Parameters:
+///   - range: The indices to cover.
+///   - concurrently: Whether chunks may run on several threads.
+///   - body: Called once per chunk with a non-empty subrange. Chunks are
+///     disjoint, so `body` may write to per-index storage without locking.
+func _forEachChunk(
+    _ range: Range<Int>,
+    concurrently: Bool,
+    _ body: (Range<Int>) -> Void
+) {
+    let count = range.count
+    let chunkCount = concurrently && count >= 8
+        ? Swift.min(count, ProcessInfo.processInfo.activeProcessorCount)
+        : 1
+    guard chunkCount > 1 else {
+        if count > 0 {
+            body(range)
+        }
+        return
+    }
+    DispatchQueue.concurrentPerform(iterations: chunkCount) { chunk in
+        let lower = range.lowerBound + chunk * count / chunkCount
+        let upper = range.lowerBound + (chunk + 1) * count / chunkCount
+        body(lower ..< upper)
+    }
+}
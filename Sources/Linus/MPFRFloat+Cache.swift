@@ -0,0 +1,31 @@
+// Import CKalliope first so gmp.h is available when CLinus imports mpfr.h
+import CKalliope
+import CLinus
+import CLinusBridge
+import Kalliope
+
+extension MPFRFloat {
+    /// Free MPFR's internal caches: the cached values of π, log 2, Euler's
+    /// and Catalan's constants and the tables used by some functions.
+    ///
+    /// The caches are recomputed on demand. With a thread-safe MPFR, the
+    /// calling thread's caches and the global ones are freed; caches of
+    /// other threads are freed when those threads call this function or
+    /// exit.
+    ///
+    /// `GMPCacheRegistry.shared.trimAll()` calls this once Linus has used a
+    /// cached constant or tanh-sinh nodes.
+    ///
+    /// - Wraps: `mpfr_free_cache2`
+    public static func freeCache() {
+        let scope = MPFR_FREE_LOCAL_CACHE.rawValue
+            | MPFR_FREE_GLOBAL_CACHE.rawValue
+        mpfr_free_cache2(mpfr_free_cache_t(rawValue: scope))
+    }
+
+    /// Registers `freeCache()` as a trim handler of the shared registry.
+    static let _cacheTrimHandler: Void = GMPCacheRegistry.shared
+        .addTrimHandler(named: "mpfr_free_cache") {
+            MPFRFloat.freeCache()
+        }
+}
@@ -0,0 +1,48 @@
+// Import CKalliope first so gmp.h is available when CLinus imports mpfr.h
+import CKalliope
+import CLinus
+import CLinusBridge
+import Kalliope
+
+extension ContinuedFraction {
+    /// Create the continued fraction of the exact value of a float.
+    ///
+    /// The significand and exponent are read directly, so no `mpq_t` is
+    /// built and no GCD is computed.
+    ///
+    /// - Parameter value: The value.
+    ///
+    /// - Requires: `value` must not be NaN or infinite.
+    /// - Wraps: `mpfr_get_z_2exp`
+    public init(_ value: MPFRFloat) {
+        precondition(
+            !value.isNaN && !value.isInfinity,
+            "value must be finite"
+        )
+        var mantissa = GMPInteger()
+        var exponent = 0
+        value.withCPointer { x in
+            mantissa.withMutableCPointer { z in
+                exponent = Int(mpfr_get_z_2exp(z, x))
+            }
+        }
+        self.init(mantissa: mantissa, exponent: exponent)
+    }
+}
+
+extension MPFRFloat {
+    /// The closest rational to this value with denominator at most
+    /// `maxDenominator`.
+    ///
+    /// - Parameter maxDenominator: The largest allowed denominator.
+    /// - Returns: The best approximation, in lowest terms.
+    ///
+    /// - Requires: The value must be finite and `maxDenominator >= 1`.
+    public func bestRationalApproximation(
+        maxDenominator: GMPInteger
+    ) -> GMPRational {
+        ContinuedFraction(self).bestApproximation(
+            maxDenominator: maxDenominator
+        )
+    }
+}
@@ -0,0 +1,687 @@
+// Import CKalliope first so gmp.h is available when CLinus imports mpfr.h
+import CKalliope
+import CLinus
+import CLinusBridge
+import Kalliope
+
+// MARK: - Integer Relation Types
+
+/// An integer relation among floating-point values.
+///
+/// The coefficients `m` satisfy `m[0] * x[0] + ... + m[n-1] * x[n-1] ≈ 0` for
+/// the values `x` passed to `MPFRFloat.integerRelation(among:)`.
+public struct IntegerRelation {
+    /// The relation coefficients, in input order. Not all zero; the first
+    /// nonzero coefficient is positive.
+    public let coefficients: [GMPInteger]
+
+    /// `m[0] * x[0] + ... + m[n-1] * x[n-1]`, evaluated at the working
+    /// precision. A genuine relation leaves a residual near
+    /// `2^-precision * max|m|`; a much larger one means the inputs were not
+    /// accurate enough to trust the relation.
+    public let residual: MPFRFloat
+
+    /// The number of PSLQ iterations performed.
+    public let iterations: Int
+}
+
+// MARK: - PSLQ
+
+/// Integer relation detection with the PSLQ algorithm of Ferguson and
+/// Bailey.
+///
+/// The search runs at two levels. The full-precision state (the normalized
+/// vector `y`, the lower-trapezoidal matrix `H` and the exact unimodular
+/// matrix `B`) lives in contiguous, preallocated buffers (`_MPFRBuffer` and a
+/// flat `[GMPInteger]`). Most iterations, however, run in hardware `Double`
+/// on a scaled copy of `y` and `H`, accumulating their effect in small
+/// integer matrices. When the `Double` copy loses accuracy, or its integer
+/// matrices approach 2^50, the accumulated transformation is applied to the
+/// full-precision state in one pass and `H` is re-triangularized. Only when a
+/// `Double` step cannot make progress does a single iteration run at full
+/// precision.
+extension MPFRFloat {
+    /// Search for an integer relation among the given values.
+    ///
+    /// The working precision is the smallest precision among `values`. A
+    /// relation can only be recognized if its coefficients are comfortably
+    /// shorter than that precision: with `d` significant bits and `n` values,
+    /// relations with coefficients up to about `2^(d / n)` are in reach.
+    ///
+    /// - Parameters:
+    ///   - values: The values. Must contain at least two elements, all
+    ///     finite.
+    ///   - maximumNorm: Stop once PSLQ proves that every relation has a
+    ///     Euclidean norm above this bound. Defaults to no bound.
+    ///   - maximumIterations: Stop after this many iterations. Defaults to
+    ///     `1_000_000`.
+    /// - Returns: The relation found, or `nil` if the search stopped because
+    ///   of the norm bound, the iteration limit, or because the working
+    ///   precision was exhausted.
+    ///
+    /// - Requires: `values.count >= 2`, every value finite,
+    ///   `maximumIterations >= 0`.
+    /// - Guarantees: A returned relation has at least one nonzero
+    ///   coefficient. If a value is exactly zero, the corresponding unit
+    ///   vector is returned without iterating.
+    public static func integerRelation(
+        among values: [MPFRFloat],
+        maximumNorm: Double = .infinity,
+        maximumIterations: Int = 1_000_000
+    ) -> IntegerRelation? {
+        precondition(values.count >= 2, "at least two values are required")
+        precondition(values.allSatisfy(\.isRegular), "values must be finite")
+        precondition(
+            maximumIterations >= 0,
+            "maximumIterations must be non-negative"
+        )
+        let precision = values.map(\.precision).min()!
+        if let zeroIndex = values.firstIndex(where: \.isZero) {
+            var coefficients = values.indices.map { _ in GMPInteger(0) }
+            coefficients[zeroIndex] = GMPInteger(1)
+            return IntegerRelation(
+                coefficients: coefficients,
+                residual: MPFRFloat(0, precision: precision),
+                iterations: 0
+            )
+        }
+
+        let search = _PSLQ(values: values, precision: precision)
+        guard let column = search.run(
+            maximumNorm: maximumNorm,
+            maximumIterations: maximumIterations
+        ) else {
+            return nil
+        }
+        return search.relation(column: column)
+    }
+}
+
+// MARK: - PSLQ State
+
+/// The state of one PSLQ search.
+///
+/// Index conventions follow Ferguson and Bailey: `H` has `n` rows and
+/// `n - 1` columns and is stored row-major; `B` and the `Double`-level
+/// matrices are `n × n`, row-major.
+final class _PSLQ {
+    /// The PSLQ parameter γ, slightly above `sqrt(4/3)`.
+    static let gamma = 1.1548
+
+    /// `Double`-level integer matrices are kept below this magnitude so every
+    /// entry and every update is exact.
+    static let doubleEntryLimit = 0x1p50
+
+    /// Leave the `Double` level once `min|y|` (relative to `max|y|` at
+    /// export) drops below this; beyond it `Double` has too few correct bits.
+    static let doubleExitThreshold = 0x1p-40
+
+    /// The number of `Double` iterations between full-precision updates.
+    static let innerIterationLimit = 256
+
+    /// The vector length.
+    let n: Int
+
+    /// The number of columns of `H`.
+    let c: Int
+
+    /// The working precision in bits.
+    let precision: Int
+
+    /// Bits of slack in relation detection and precision exhaustion tests.
+    let guardBits: Int
+
+    /// The inputs at working precision.
+    private let x: _MPFRBuffer
+
+    /// The full-precision `y`, `H` and their update targets.
+    private var y: _MPFRBuffer
+    private var h: _MPFRBuffer
+    private var yNext: _MPFRBuffer
+    private var hNext: _MPFRBuffer
+
+    /// Full-precision temporaries.
+    private let scratch: _MPFRBuffer
+
+    /// The exact unimodular matrix `B`; relations are its columns.
+    private var b: [GMPInteger]
+
+    /// A row of `B` under construction.
+    private var bRow: [GMPInteger]
+
+    /// An integer temporary for reduction quotients.
+    private var quotient = GMPInteger()
+
+    /// The `Double`-level block: `y`, `H`, `A`, `B` and snapshots of `A` and
+    /// `B`.
+    private let doubles: UnsafeMutablePointer<Double>
+    private let yd: UnsafeMutablePointer<Double>
+    private let hd: UnsafeMutablePointer<Double>
+    private let ad: UnsafeMutablePointer<Double>
+    private let bd: UnsafeMutablePointer<Double>
+    private let adSaved: UnsafeMutablePointer<Double>
+    private let bdSaved: UnsafeMutablePointer<Double>
+
+    /// The number of iterations performed.
+    private(set) var iterations = 0
+
+    /// Set up `y`, `H` and `B` for the given nonzero values.
+    init(values: [MPFRFloat], precision: Int) {
+        let n = values.count
+        let c = n - 1
+        self.n = n
+        self.c = c
+        self.precision = precision
+        guardBits = Swift.max(16, precision / 16)
+        x = _MPFRBuffer(count: n, precision: precision)
+        y = _MPFRBuffer(count: n, precision: precision)
+        yNext = _MPFRBuffer(count: n, precision: precision)
+        h = _MPFRBuffer(count: n * c, precision: precision)
+        hNext = _MPFRBuffer(count: n * c, precision: precision)
+        scratch = _MPFRBuffer(count: 6, precision: precision)
+        b = (0 ..< n * n).map { GMPInteger($0 % (n + 1) == 0 ? 1 : 0) }
+        bRow = (0 ..< n).map { _ in GMPInteger() }
+
+        let doubleCount = n + n * c + 4 * n * n
+        let doubles = UnsafeMutablePointer<Double>.allocate(
+            capacity: doubleCount
+        )
+        doubles.initialize(repeating: 0, count: doubleCount)
+        self.doubles = doubles
+        yd = doubles
+        hd = doubles + n
+        ad = doubles + n + n * c
+        bd = doubles + n + n * c + n * n
+        adSaved = doubles + n + n * c + 2 * n * n
+        bdSaved = doubles + n + n * c + 3 * n * n
+
+        for i in 0 ..< n {
+            x.store(values[i], at: i)
+        }
+        _initialize()
+    }
+
+    deinit {
+        doubles.deallocate()
+    }
+
+    // MARK: - Full Precision
+
+    /// Compute the initial `y` and `H` from `x` and fully reduce `H`.
+    private func _initialize() {
+        // s[k] = sqrt(x[k]^2 + ... + x[n-1]^2)
+        let s = _MPFRBuffer(count: n, precision: precision)
+        let sum = scratch[0]
+        let term = scratch[1]
+        mpfr_set_zero(sum, 1)
+        for k in stride(from: n - 1, through: 0, by: -1) {
+            mpfr_sqr(term, x[k], MPFR_RNDN)
+            mpfr_add(sum, sum, term, MPFR_RNDN)
+            mpfr_sqrt(s[k], sum, MPFR_RNDN)
+        }
+        // Normalize so that |y| = 1
+        for k in 0 ..< n {
+            mpfr_div(y[k], x[k], s[0], MPFR_RNDN)
+        }
+        for k in stride(from: n - 1, through: 0, by: -1) {
+            mpfr_div(s[k], s[k], s[0], MPFR_RNDN)
+        }
+        for i in 0 ..< n {
+            for j in 0 ..< c {
+                let entry = h[i * c + j]
+                if j > i {
+                    mpfr_set_zero(entry, 1)
+                } else if j == i {
+                    mpfr_div(entry, s[i + 1], s[i], MPFR_RNDN)
+                } else {
+                    mpfr_mul(term, s[j], s[j + 1], MPFR_RNDN)
+                    mpfr_mul(entry, y[i], y[j], MPFR_RNDN)
+                    mpfr_div(entry, entry, term, MPFR_RNDN)
+                    mpfr_neg(entry, entry, MPFR_RNDN)
+                }
+            }
+        }
+        _reduce(rows: 1 ..< n, columnLimit: c - 1)
+    }
+
+    /// Hermite-reduce rows of `H`, updating `y` and `B` to match.
+    ///
+    /// - Parameters:
+    ///   - rows: The rows to reduce.
+    ///   - columnLimit: Reduce row `i` against columns
+    ///     `min(i - 1, columnLimit)` down to `0`.
+    private func _reduce(rows: Range<Int>, columnLimit: Int) {
+        let q = scratch[0]
+        for i in rows {
+            let top = Swift.min(i - 1, columnLimit)
+            for j in stride(from: top, through: 0, by: -1) {
+                let pivot = h[j * c + j]
+                guard mpfr_zero_p(pivot) == 0 else {
+                    continue
+                }
+                mpfr_div(q, h[i * c + j], pivot, MPFR_RNDN)
+                mpfr_rint(q, q, MPFR_RNDN)
+                guard mpfr_zero_p(q) == 0 else {
+                    continue
+                }
+                // y[j] += q * y[i]
+                mpfr_fma(y[j], q, y[i], y[j], MPFR_RNDN)
+                // B[:, j] += q * B[:, i]
+                quotient.withMutableCPointer { z in
+                    _ = mpfr_get_z(z, q, MPFR_RNDN)
+                }
+                for k in 0 ..< n {
+                    let source = b[k * n + i]
+                    b[k * n + j].addProduct(source, quotient)
+                }
+                // H[i, 0...j] -= q * H[j, 0...j]
+                mpfr_neg(q, q, MPFR_RNDN)
+                for k in 0 ... j {
+                    let entry = h[i * c + k]
+                    mpfr_fma(entry, q, h[j * c + k], entry, MPFR_RNDN)
+                }
+            }
+        }
+    }
+
+    /// Rotate columns `p` and `q` of `H` so that `H[pivotRow, q]` becomes
+    /// zero. Rows above `pivotRow` are zero in both columns and untouched.
+    private func _rotateColumns(_ p: Int, _ q: Int, pivotRow: Int) {
+        let norm = scratch[1]
+        let cosine = scratch[2]
+        let sine = scratch[3]
+        let u = scratch[4]
+        let v = scratch[5]
+        mpfr_hypot(
+            norm,
+            h[pivotRow * c + p],
+            h[pivotRow * c + q],
+            MPFR_RNDN
+        )
+        guard mpfr_zero_p(norm) == 0 else {
+            return
+        }
+        mpfr_div(cosine, h[pivotRow * c + p], norm, MPFR_RNDN)
+        mpfr_div(sine, h[pivotRow * c + q], norm, MPFR_RNDN)
+        for i in pivotRow ..< n {
+            let a = h[i * c + p]
+            let bb = h[i * c + q]
+            mpfr_fmma(u, cosine, a, sine, bb, MPFR_RNDN)
+            mpfr_fmms(v, cosine, bb, sine, a, MPFR_RNDN)
+            mpfr_swap(a, u)
+            mpfr_swap(bb, v)
+        }
+        // Exact zero, rather than rounding noise, above the diagonal
+        mpfr_set_zero(h[pivotRow * c + q], 1)
+    }
+
+    /// Choose the row to swap: the `m` maximizing `γ^(m+1) |H[m, m]|`.
+    private func _selectFull() -> Int {
+        var maximumExponent = Int.min
+        for i in 0 ..< c where mpfr_regular_p(h[i * c + i]) != 0 {
+            maximumExponent = Swift.max(
+                maximumExponent,
+                Int(mpfr_get_exp(h[i * c + i]))
+            )
+        }
+        guard maximumExponent != Int.min else {
+            return 0
+        }
+        var best = -1.0
+        var selected = 0
+        var weight = 1.0
+        for i in 0 ..< c {
+            weight *= Self.gamma
+            let entry = h[i * c + i]
+            guard mpfr_regular_p(entry) != 0 else {
+                continue
+            }
+            var exponent = 0
+            let significand = mpfr_get_d_2exp(&exponent, entry, MPFR_RNDN)
+            let score = weight * Double(
+                sign: .plus,
+                exponent: exponent - maximumExponent,
+                significand: significand.magnitude
+            )
+            if score > best {
+                best = score
+                selected = i
+            }
+        }
+        return selected
+    }
+
+    /// Perform one PSLQ iteration at full precision.
+    private func _iterateFull() {
+        let m = _selectFull()
+        mpfr_swap(y[m], y[m + 1])
+        for k in 0 ..< c {
+            mpfr_swap(h[m * c + k], h[(m + 1) * c + k])
+        }
+        for k in 0 ..< n {
+            b.swapAt(k * n + m, k * n + m + 1)
+        }
+        if m < c - 1 {
+            _rotateColumns(m, m + 1, pivotRow: m)
+        }
+        _reduce(rows: (m + 1) ..< n, columnLimit: m + 1)
+    }
+
+    /// Apply the `Double`-level transformation to the full-precision state:
+    /// `y ← y·B_d`, `B ← B·B_d`, `H ← A_d·H`, then restore the
+    /// lower-trapezoidal shape of `H` with Givens rotations and reduce.
+    private func _applyDoubleUpdate() {
+        let term = scratch[0]
+        for j in 0 ..< n {
+            let target = yNext[j]
+            mpfr_set_zero(target, 1)
+            for i in 0 ..< n where bd[i * n + j] != 0 {
+                mpfr_mul_si(term, y[i], Int(bd[i * n + j]), MPFR_RNDN)
+                mpfr_add(target, target, term, MPFR_RNDN)
+            }
+        }
+        swap(&y, &yNext)
+
+        for i in 0 ..< n {
+            for k in 0 ..< c {
+                let target = hNext[i * c + k]
+                mpfr_set_zero(target, 1)
+                // H is lower trapezoidal: H[l, k] == 0 for l < k
+                for l in k ..< n where ad[i * n + l] != 0 {
+                    let multiplier = Int(ad[i * n + l])
+                    mpfr_mul_si(term, h[l * c + k], multiplier, MPFR_RNDN)
+                    mpfr_add(target, target, term, MPFR_RNDN)
+                }
+            }
+        }
+        swap(&h, &hNext)
+
+        for row in 0 ..< n {
+            for j in 0 ..< n {
+                bRow[j].set(0)
+                for i in 0 ..< n where bd[i * n + j] != 0 {
+                    bRow[j].addProduct(b[row * n + i], Int(bd[i * n + j]))
+                }
+            }
+            for j in 0 ..< n {
+                swap(&b[row * n + j], &bRow[j])
+            }
+        }
+
+        for i in 0 ..< c {
+            for j in (i + 1) ..< c where mpfr_zero_p(h[i * c + j]) == 0 {
+                _rotateColumns(i, j, pivotRow: i)
+            }
+        }
+        _reduce(rows: 1 ..< n, columnLimit: c - 1)
+    }
+
+    // MARK: - Double Level
+
+    /// Load scaled copies of `y` and `H` into the `Double` block and reset
+    /// `A_d` and `B_d` to the identity.
+    ///
+    /// - Returns: `false` if `y` spans too wide a range for `Double`, in
+    ///   which case the `Double` level cannot help.
+    private func _exportToDouble() -> Bool {
+        func maximumExponent(
+            _ buffer: _MPFRBuffer,
+            _ range: Range<Int>
+        ) -> Int {
+            var result = Int.min
+            for i in range where mpfr_regular_p(buffer[i]) != 0 {
+                result = Swift.max(result, Int(mpfr_get_exp(buffer[i])))
+            }
+            return result
+        }
+        func scaled(
+            _ value: UnsafeMutablePointer<__mpfr_struct>,
+            by shift: Int
+        ) -> Double {
+            guard mpfr_regular_p(value) != 0 else {
+                return 0
+            }
+            var exponent = 0
+            let significand = mpfr_get_d_2exp(&exponent, value, MPFR_RNDN)
+            return Double(
+                sign: .plus,
+                exponent: exponent - shift,
+                significand: significand
+            )
+        }
+
+        let yShift = maximumExponent(y, 0 ..< n)
+        let hShift = maximumExponent(h, 0 ..< n * c)
+        var minimum = Double.infinity
+        for i in 0 ..< n {
+            yd[i] = scaled(y[i], by: yShift)
+            minimum = Swift.min(minimum, yd[i].magnitude)
+        }
+        guard minimum >= Self.doubleExitThreshold else {
+            return false
+        }
+        for i in 0 ..< n * c {
+            hd[i] = scaled(h[i], by: hShift)
+        }
+        for i in 0 ..< n {
+            for j in 0 ..< n {
+                ad[i * n + j] = i == j ? 1 : 0
+                bd[i * n + j] = i == j ? 1 : 0
+            }
+        }
+        return true
+    }
+
+    /// Perform one PSLQ iteration on the `Double` block.
+    ///
+    /// - Returns: `false` if the iteration would push `A_d` or `B_d` past
+    ///   `doubleEntryLimit`. `A_d` and `B_d` are then restored to their state
+    ///   before the call; `y_d` and `H_d` are left inconsistent and must be
+    ///   re-exported.
+    private func _iterateDouble() -> Bool {
+        adSaved.update(from: ad, count: n * n)
+        bdSaved.update(from: bd, count: n * n)
+
+        var m = 0
+        var best = -1.0
+        var weight = 1.0
+        for i in 0 ..< c {
+            weight *= Self.gamma
+            let score = weight * hd[i * c + i].magnitude
+            if score > best {
+                best = score
+                m = i
+            }
+        }
+
+        Self._swap(yd, m, m + 1)
+        for k in 0 ..< c {
+            Self._swap(hd, m * c + k, (m + 1) * c + k)
+        }
+        for k in 0 ..< n {
+            Self._swap(ad, m * n + k, (m + 1) * n + k)
+            Self._swap(bd, k * n + m, k * n + m + 1)
+        }
+
+        if m < c - 1 {
+            let a = hd[m * c + m]
+            let bb = hd[m * c + m + 1]
+            let norm = (a * a + bb * bb).squareRoot()
+            if norm != 0 {
+                let cosine = a / norm
+                let sine = bb / norm
+                for i in m ..< n {
+                    let u = hd[i * c + m]
+                    let v = hd[i * c + m + 1]
+                    hd[i * c + m] = cosine * u + sine * v
+                    hd[i * c + m + 1] = cosine * v - sine * u
+                }
+                hd[m * c + m + 1] = 0
+            }
+        }
+
+        let limit = Self.doubleEntryLimit
+        for i in (m + 1) ..< n {
+            let top = Swift.min(i - 1, m + 1)
+            for j in stride(from: top, through: 0, by: -1) {
+                let pivot = hd[j * c + j]
+                guard pivot != 0 else {
+                    continue
+                }
+                let q = (hd[i * c + j] / pivot).rounded()
+                guard q != 0 else {
+                    continue
+                }
+                guard q.magnitude <= limit else {
+                    _restoreDouble()
+                    return false
+                }
+                yd[j] += q * yd[i]
+                for k in 0 ... j {
+                    hd[i * c + k] -= q * hd[j * c + k]
+                }
+                var growth = 0.0
+                for k in 0 ..< n {
+                    ad[i * n + k] -= q * ad[j * n + k]
+                    bd[k * n + j] += q * bd[k * n + i]
+                    growth = Swift.max(
+                        growth,
+                        ad[i * n + k].magnitude,
+                        bd[k * n + j].magnitude
+                    )
+                }
+                guard growth <= limit else {
+                    _restoreDouble()
+                    return false
+                }
+            }
+        }
+        return true
+    }
+
+    /// Exchange two entries of the `Double` block.
+    private static func _swap(
+        _ block: UnsafeMutablePointer<Double>,
+        _ i: Int,
+        _ j: Int
+    ) {
+        let value = block[i]
+        block[i] = block[j]
+        block[j] = value
+    }
+
+    /// Undo the current `Double` iteration's changes to `A_d` and `B_d`.
+    private func _restoreDouble() {
+        ad.update(from: adSaved, count: n * n)
+        bd.update(from: bdSaved, count: n * n)
+    }
+
+    // MARK: - Driver
+
+    /// The largest bit count among the entries of `B`.
+    private var _maximumBBits: Int {
+        b.reduce(0) { Swift.max($0, $1.bitCount) }
+    }
+
+    /// The column of `B` holding a detected relation, if any: the index of
+    /// the smallest `|y[j]|` when it has fallen to the rounding-noise level
+    /// `2^(bits(B) + guardBits - precision)`.
+    private func _detectedRelation(maximumBBits: Int) -> Int? {
+        let threshold = maximumBBits + guardBits - precision
+        var selected: Int?
+        var smallest = Int.max
+        for j in 0 ..< n {
+            if mpfr_zero_p(y[j]) != 0 {
+                return j
+            }
+            let exponent = Int(mpfr_get_exp(y[j]))
+            if exponent <= threshold, exponent < smallest {
+                smallest = exponent
+                selected = j
+            }
+        }
+        return selected
+    }
+
+    /// The Ferguson–Bailey lower bound `1 / max|H[j, j]|` on the norm of any
+    /// relation.
+    private var _normLowerBound: Double {
+        var largest: UnsafeMutablePointer<__mpfr_struct>?
+        for j in 0 ..< c {
+            let entry = h[j * c + j]
+            if largest.map({ mpfr_cmpabs(entry, $0) > 0 }) ?? true {
+                largest = entry
+            }
+        }
+        guard let largest else {
+            return .infinity
+        }
+        return 1 / mpfr_get_d(largest, MPFR_RNDN).magnitude
+    }
+
+    /// Iterate until a relation is detected or a stopping condition holds.
+    ///
+    /// - Returns: The column of `B` holding the relation, or `nil`.
+    func run(maximumNorm: Double, maximumIterations: Int) -> Int? {
+        while true {
+            let maximumBBits = _maximumBBits
+            if let column = _detectedRelation(maximumBBits: maximumBBits) {
+                return column
+            }
+            guard maximumBBits + 2 * guardBits < precision,
+                  _normLowerBound <= maximumNorm,
+                  iterations < maximumIterations
+            else {
+                return nil
+            }
+
+            var inner = 0
+            if _exportToDouble() {
+                while inner < Self.innerIterationLimit,
+                      iterations + inner < maximumIterations,
+                      _iterateDouble()
+                {
+                    inner += 1
+                    let smallest = (0 ..< n).reduce(Double.infinity) {
+                        Swift.min($0, yd[$1].magnitude)
+                    }
+                    if smallest < Self.doubleExitThreshold {
+                        break
+                    }
+                }
+            }
+            if inner == 0 {
+                _iterateFull()
+                iterations += 1
+            } else {
+                _applyDoubleUpdate()
+                iterations += inner
+            }
+        }
+    }
+
+    /// Package column `column` of `B` as a relation, with its residual
+    /// against the original inputs.
+    func relation(column: Int) -> IntegerRelation {
+        var coefficients = (0 ..< n).map { b[$0 * n + column] }
+        if let first = coefficients.first(where: { !$0.isZero }),
+           first.isNegative
+        {
+            coefficients = coefficients.map { $0.negated() }
+        }
+        let sum = scratch[0]
+        let term = scratch[1]
+        mpfr_set_zero(sum, 1)
+        for i in 0 ..< n {
+            coefficients[i].withCPointer { z in
+                _ = mpfr_mul_z(term, x[i], z, MPFR_RNDN)
+            }
+            mpfr_add(sum, sum, term, MPFR_RNDN)
+        }
+        return IntegerRelation(
+            coefficients: coefficients,
+            residual: scratch.float(at: 0),
+            iterations: iterations
+        )
+    }
+}
@@ -226,12 +226,18 @@ extension MPFRFloat {
         let result =
             MPFRFloat(precision: precision) // Mutated through pointer below
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_pow(
-            &result._storage.value,
-            &_storage.value,
-            &other._storage.value,
-            rnd
-        )
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_pow",
+            size: precision
+        ) {
+            mpfr_pow(
+                &result._storage.value,
+                &_storage.value,
+                &other._storage.value,
+                rnd
+            )
+        }
         return (result: result, ternary: Int(ternary))
     }
 
@@ -285,7 +291,13 @@ extension MPFRFloat {
         let result =
             MPFRFloat(precision: precision) // Mutated through pointer below
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_exp(&result._storage.value, &_storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_exp",
+            size: precision
+        ) {
+            mpfr_exp(&result._storage.value, &_storage.value, rnd)
+        }
 
         // Check flags after operation and throw if exceptions occurred
         try Self.checkFlagsAndThrow()
@@ -316,7 +328,13 @@ extension MPFRFloat {
         let result =
             MPFRFloat(precision: precision) // Mutated through pointer below
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_log(&result._storage.value, &_storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_log",
+            size: precision
+        ) {
+            mpfr_log(&result._storage.value, &_storage.value, rnd)
+        }
 
         // Check flags after operation and throw if exceptions occurred
         try Self.checkFlagsAndThrow()
@@ -346,7 +364,13 @@ extension MPFRFloat {
         let result =
             MPFRFloat(precision: precision) // Mutated through pointer below
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_log2(&result._storage.value, &_storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_log2",
+            size: precision
+        ) {
+            mpfr_log2(&result._storage.value, &_storage.value, rnd)
+        }
 
         // Check flags after operation and throw if exceptions occurred
         try Self.checkFlagsAndThrow()
@@ -376,7 +400,13 @@ extension MPFRFloat {
         let result =
             MPFRFloat(precision: precision) // Mutated through pointer below
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_log10(&result._storage.value, &_storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_log10",
+            size: precision
+        ) {
+            mpfr_log10(&result._storage.value, &_storage.value, rnd)
+        }
 
         // Check flags after operation and throw if exceptions occurred
         try Self.checkFlagsAndThrow()
@@ -402,7 +432,13 @@ extension MPFRFloat {
         let result =
             MPFRFloat(precision: precision) // Mutated through pointer below
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_sin(&result._storage.value, &_storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_sin",
+            size: precision
+        ) {
+            mpfr_sin(&result._storage.value, &_storage.value, rnd)
+        }
         return (result: result, ternary: Int(ternary))
     }
 
@@ -422,7 +458,13 @@ extension MPFRFloat {
         let result =
             MPFRFloat(precision: precision) // Mutated through pointer below
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_cos(&result._storage.value, &_storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_cos",
+            size: precision
+        ) {
+            mpfr_cos(&result._storage.value, &_storage.value, rnd)
+        }
         return (result: result, ternary: Int(ternary))
     }
 
@@ -444,12 +486,18 @@ extension MPFRFloat {
         let cosResult =
             MPFRFloat(precision: precision) // Mutated through pointer below
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_sin_cos(
-            &sinResult._storage.value,
-            &cosResult._storage.value,
-            &_storage.value,
-            rnd
-        )
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_sin_cos",
+            size: precision
+        ) {
+            mpfr_sin_cos(
+                &sinResult._storage.value,
+                &cosResult._storage.value,
+                &_storage.value,
+                rnd
+            )
+        }
         return (sin: sinResult, cos: cosResult, ternary: Int(ternary))
     }
 
@@ -469,7 +517,13 @@ extension MPFRFloat {
         let result =
             MPFRFloat(precision: precision) // Mutated through pointer below
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_tan(&result._storage.value, &_storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_tan",
+            size: precision
+        ) {
+            mpfr_tan(&result._storage.value, &_storage.value, rnd)
+        }
         return (result: result, ternary: Int(ternary))
     }
 
@@ -490,7 +544,13 @@ extension MPFRFloat {
         let result =
             MPFRFloat(precision: precision) // Mutated through pointer below
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_asin(&result._storage.value, &_storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_asin",
+            size: precision
+        ) {
+            mpfr_asin(&result._storage.value, &_storage.value, rnd)
+        }
         return (result: result, ternary: Int(ternary))
     }
 
@@ -511,7 +571,13 @@ extension MPFRFloat {
         let result =
             MPFRFloat(precision: precision) // Mutated through pointer below
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_acos(&result._storage.value, &_storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_acos",
+            size: precision
+        ) {
+            mpfr_acos(&result._storage.value, &_storage.value, rnd)
+        }
         return (result: result, ternary: Int(ternary))
     }
 
@@ -531,7 +597,13 @@ extension MPFRFloat {
         let result =
             MPFRFloat(precision: precision) // Mutated through pointer below
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_atan(&result._storage.value, &_storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_atan",
+            size: precision
+        ) {
+            mpfr_atan(&result._storage.value, &_storage.value, rnd)
+        }
         return (result: result, ternary: Int(ternary))
     }
 
@@ -559,12 +631,18 @@ extension MPFRFloat {
         let result =
             MPFRFloat(precision: precision) // Mutated through pointer below
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_atan2(
-            &result._storage.value,
-            &_storage.value,
-            &x._storage.value,
-            rnd
-        )
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_atan2",
+            size: precision
+        ) {
+            mpfr_atan2(
+                &result._storage.value,
+                &_storage.value,
+                &x._storage.value,
+                rnd
+            )
+        }
         return (result: result, ternary: Int(ternary))
     }
 
@@ -586,7 +664,13 @@ extension MPFRFloat {
         let result =
             MPFRFloat(precision: precision) // Mutated through pointer below
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_sinh(&result._storage.value, &_storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_sinh",
+            size: precision
+        ) {
+            mpfr_sinh(&result._storage.value, &_storage.value, rnd)
+        }
         return (result: result, ternary: Int(ternary))
     }
 
@@ -606,7 +690,13 @@ extension MPFRFloat {
         let result =
             MPFRFloat(precision: precision) // Mutated through pointer below
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_cosh(&result._storage.value, &_storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_cosh",
+            size: precision
+        ) {
+            mpfr_cosh(&result._storage.value, &_storage.value, rnd)
+        }
         return (result: result, ternary: Int(ternary))
     }
 
@@ -628,12 +718,18 @@ extension MPFRFloat {
         // Mutated through pointer below
         let coshResult = MPFRFloat(precision: precision)
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_sinh_cosh(
-            &sinhResult._storage.value,
-            &coshResult._storage.value,
-            &_storage.value,
-            rnd
-        )
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_sinh_cosh",
+            size: precision
+        ) {
+            mpfr_sinh_cosh(
+                &sinhResult._storage.value,
+                &coshResult._storage.value,
+                &_storage.value,
+                rnd
+            )
+        }
         return (sinh: sinhResult, cosh: coshResult, ternary: Int(ternary))
     }
 
@@ -653,7 +749,13 @@ extension MPFRFloat {
         let result =
             MPFRFloat(precision: precision) // Mutated through pointer below
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_tanh(&result._storage.value, &_storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_tanh",
+            size: precision
+        ) {
+            mpfr_tanh(&result._storage.value, &_storage.value, rnd)
+        }
         return (result: result, ternary: Int(ternary))
     }
 
@@ -679,7 +781,13 @@ extension MPFRFloat {
         let result =
             MPFRFloat(precision: precision) // Mutated through pointer below
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_asinh(&result._storage.value, &_storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_asinh",
+            size: precision
+        ) {
+            mpfr_asinh(&result._storage.value, &_storage.value, rnd)
+        }
 
         // Check flags after operation and throw if exceptions occurred
         try Self.checkFlagsAndThrow()
@@ -710,7 +818,13 @@ extension MPFRFloat {
         let result =
             MPFRFloat(precision: precision) // Mutated through pointer below
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_acosh(&result._storage.value, &_storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_acosh",
+            size: precision
+        ) {
+            mpfr_acosh(&result._storage.value, &_storage.value, rnd)
+        }
 
         // Check flags after operation and throw if exceptions occurred
         try Self.checkFlagsAndThrow()
@@ -741,7 +855,13 @@ extension MPFRFloat {
         let result =
             MPFRFloat(precision: precision) // Mutated through pointer below
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_atanh(&result._storage.value, &_storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_atanh",
+            size: precision
+        ) {
+            mpfr_atanh(&result._storage.value, &_storage.value, rnd)
+        }
 
         // Check flags after operation and throw if exceptions occurred
         try Self.checkFlagsAndThrow()
@@ -1146,6 +1266,7 @@ extension MPFRFloat {
         precision: Int? = nil,
         rounding: MPFRRoundingMode = .nearest
     ) -> (result: MPFRFloat, ternary: Int) {
+        _ = _cacheTrimHandler // MPFR caches the constant
         let result: MPFRFloat
         if let prec = precision {
             let precMin = Int(clinus_get_prec_min())
@@ -1160,7 +1281,13 @@ extension MPFRFloat {
             result = MPFRFloat(precision: Int(defaultPrec))
         }
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_const_pi(&result._storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_const_pi",
+            size: result.precision
+        ) {
+            mpfr_const_pi(&result._storage.value, rnd)
+        }
         return (result: result, ternary: Int(ternary))
     }
 
@@ -1180,6 +1307,7 @@ extension MPFRFloat {
         precision: Int? = nil,
         rounding: MPFRRoundingMode = .nearest
     ) -> (result: MPFRFloat, ternary: Int) {
+        _ = _cacheTrimHandler // MPFR caches the constant
         let result: MPFRFloat
         if let prec = precision {
             let precMin = Int(clinus_get_prec_min())
@@ -1194,7 +1322,13 @@ extension MPFRFloat {
             result = MPFRFloat(precision: Int(defaultPrec))
         }
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_const_euler(&result._storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_const_euler",
+            size: result.precision
+        ) {
+            mpfr_const_euler(&result._storage.value, rnd)
+        }
         return (result: result, ternary: Int(ternary))
     }
 
@@ -1215,6 +1349,7 @@ extension MPFRFloat {
         precision: Int? = nil,
         rounding: MPFRRoundingMode = .nearest
     ) -> (result: MPFRFloat, ternary: Int) {
+        _ = _cacheTrimHandler // MPFR caches the constant
         let result: MPFRFloat
         if let prec = precision {
             let precMin = Int(clinus_get_prec_min())
@@ -1229,7 +1364,13 @@ extension MPFRFloat {
             result = MPFRFloat(precision: Int(defaultPrec))
         }
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_const_catalan(&result._storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_const_catalan",
+            size: result.precision
+        ) {
+            mpfr_const_catalan(&result._storage.value, rnd)
+        }
         return (result: result, ternary: Int(ternary))
     }
 
@@ -1251,6 +1392,7 @@ extension MPFRFloat {
         precision: Int? = nil,
         rounding: MPFRRoundingMode = .nearest
     ) -> (result: MPFRFloat, ternary: Int) {
+        _ = _cacheTrimHandler // MPFR caches the constant
         let result: MPFRFloat
         if let prec = precision {
             let precMin = Int(clinus_get_prec_min())
@@ -1265,7 +1407,13 @@ extension MPFRFloat {
             result = MPFRFloat(precision: Int(defaultPrec))
         }
         let rnd = rounding.toMPFRRoundingMode()
-        let ternary = mpfr_const_log2(&result._storage.value, rnd)
+        let ternary = GMPTracer._trace(
+            .transcendental,
+            "mpfr_const_log2",
+            size: result.precision
+        ) {
+            mpfr_const_log2(&result._storage.value, rnd)
+        }
         return (result: result, ternary: Int(ternary))
     }
 }
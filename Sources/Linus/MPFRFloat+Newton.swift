@@ -0,0 +1,455 @@
+// Import CKalliope first so gmp.h is available when CLinus imports mpfr.h
+import CKalliope
+import CLinus
+import CLinusBridge
+import Kalliope
+
+// MARK: - Root Finding Results
+
+/// A root computed by `MPFRFloat.newtonRoot(seed:precision:...)`.
+public struct NewtonRoot {
+    /// The root, at the requested precision.
+    public let root: MPFRFloat
+
+    /// The radius of the interval `[root - errorBound, root + errorBound]`
+    /// that was checked for a sign change.
+    public let errorBound: MPFRFloat
+
+    /// Whether the function changes sign across `root ± errorBound`. For a
+    /// continuous function this proves that the interval contains a zero.
+    /// Roots of even multiplicity never verify.
+    public let isVerified: Bool
+
+    /// The number of function evaluations spent on iteration (excluding
+    /// verification).
+    public let iterations: Int
+
+    /// Whether the bracketing fallback was needed to reach the basin of
+    /// convergence.
+    public let usedBracketing: Bool
+}
+
+/// A solution computed by `MPFRFloat.newtonSolve(seed:precision:...)`.
+public struct NewtonSystemSolution {
+    /// The solution vector, at the requested precision.
+    public let solution: [MPFRFloat]
+
+    /// `max |F_i(solution)|` at the requested precision.
+    public let residualNorm: MPFRFloat
+
+    /// `max |Δx_i|` of the final Newton step, an estimate of the error.
+    public let lastStepNorm: MPFRFloat
+
+    /// The number of system evaluations spent on iteration.
+    public let iterations: Int
+}
+
+// MARK: - Newton's Method with Precision Doubling
+
+/// Newton's method for `MPFRFloat`-valued functions.
+///
+/// Newton's method doubles the number of correct bits per step, so running
+/// every step at the target precision wastes nearly all the work. These
+/// solvers first converge at 64 bits from a `Double` seed, then raise the
+/// working precision along a schedule that roughly doubles each time
+/// (`target`, `target / 2 + guard`, ... down to 64), taking one Newton step
+/// per precision. The iterate is one `MPFRFloat` whose precision is raised
+/// in place with `roundToPrecision(_:)`, and derivatives are evaluated at
+/// about half the current precision, which is all a Newton step needs. Only
+/// the last step or two touch the full target precision.
+///
+/// The callbacks receive arguments at the current working precision and
+/// should compute at `x.precision` (or higher).
+extension MPFRFloat {
+    /// The precision of the initial iterations.
+    static let _newtonBasePrecision = 64
+
+    /// Extra bits carried at each intermediate precision.
+    static let _newtonGuardBits = 16
+
+    /// The iteration limit at the base precision.
+    static let _newtonBaseIterations = 64
+
+    /// Find a root of a real function.
+    ///
+    /// - Parameters:
+    ///   - seed: The starting point.
+    ///   - precision: The target precision in bits.
+    ///   - bracket: An interval on which `function` changes sign. When
+    ///     given, the solver falls back to the Illinois variant of regula
+    ///     falsi if Newton's method diverges, stalls or leaves the bracket
+    ///     at the base precision.
+    ///   - function: The function `f`.
+    ///   - derivative: The derivative `f′`.
+    /// - Returns: The root with its verification status.
+    /// - Throws: `RootFindingError.singularDerivative` or
+    ///   `RootFindingError.noConvergence` if Newton's method fails and no
+    ///   bracket is given (or it fails again after bracketing);
+    ///   `RootFindingError.invalidBracket` if the bracket does not straddle a
+    ///   sign change.
+    ///
+    /// - Requires: `seed` and the bracket bounds must be finite. `precision`
+    ///   must be a valid MPFR precision.
+    /// - Guarantees: `root.precision == precision`. If `isVerified` is `true`
+    ///   and `function` is continuous, a zero lies within `errorBound` of
+    ///   `root`.
+    public static func newtonRoot(
+        seed: Double,
+        precision: Int,
+        bracket: ClosedRange<Double>? = nil,
+        function: (MPFRFloat) -> MPFRFloat,
+        derivative: (MPFRFloat) -> MPFRFloat
+    ) throws -> NewtonRoot {
+        precondition(seed.isFinite, "seed must be finite")
+        let base = _newtonBasePrecision
+        var iterations = 0
+        var usedBracketing = false
+
+        // Converge at the base precision, falling back to the bracket
+        var x = MPFRFloat(seed, precision: base)
+        var failure = RootFindingError.noConvergence
+        var converged = false
+        for _ in 0 ..< _newtonBaseIterations {
+            let fx = function(x)
+            let dfx = derivative(x)
+            iterations += 1
+            guard fx.isRegular, dfx.isRegular else {
+                break
+            }
+            if fx.isZero {
+                converged = true
+                break
+            }
+            guard !dfx.isZero else {
+                failure = .singularDerivative
+                break
+            }
+            let step = fx / dfx
+            x -= step
+            if let bracket, !bracket.contains(x.toDouble()) {
+                break
+            }
+            if _isNegligible(step, relativeTo: x, bits: base - 4) {
+                converged = true
+                break
+            }
+        }
+        if !converged {
+            guard let bracket else {
+                throw failure
+            }
+            let (bracketed, evaluations) = try _illinois(
+                bracket: bracket,
+                precision: base,
+                function: function
+            )
+            x = bracketed
+            iterations += evaluations
+            usedBracketing = true
+        }
+
+        // One Newton step per precision, roughly doubling each time
+        var lastStep = MPFRFloat(0, precision: base)
+        var halfX = MPFRFloat(precision: base)
+        for working in _newtonPrecisionSchedule(target: precision) {
+            x.roundToPrecision(working)
+            halfX.precision = Swift.max(base, working / 2 + _newtonGuardBits)
+            halfX.set(x)
+            let fx = function(x)
+            let dfx = derivative(halfX)
+            iterations += 1
+            guard fx.isRegular, dfx.isRegular else {
+                throw RootFindingError.noConvergence
+            }
+            if fx.isZero {
+                lastStep = MPFRFloat(0, precision: working)
+                continue
+            }
+            guard !dfx.isZero else {
+                throw RootFindingError.singularDerivative
+            }
+            lastStep = fx / dfx
+            x -= lastStep
+        }
+        x.roundToPrecision(precision)
+
+        // Check for a sign change across a small interval around x
+        var radius = lastStep.absoluteValue().result
+            .multipliedByPowerOf2(2).result
+        let relative = x.absoluteValue().result
+            .dividedByPowerOf2(Swift.max(1, precision - 4)).result
+        if radius < relative {
+            radius = relative
+        }
+        radius.roundToPrecision(precision)
+        var isVerified = false
+        if !radius.isZero {
+            let below = function(x - radius)
+            let above = function(x + radius)
+            isVerified = below.isRegular && above.isRegular
+                && (below.isZero || above.isZero
+                    || below.isNegative != above.isNegative)
+        } else {
+            isVerified = function(x).isZero
+        }
+        return NewtonRoot(
+            root: x,
+            errorBound: radius,
+            isVerified: isVerified,
+            iterations: iterations,
+            usedBracketing: usedBracketing
+        )
+    }
+
+    /// Solve a square system of equations `F(x) = 0`.
+    ///
+    /// Suitable for polynomial systems and other smooth systems with a
+    /// nonsingular Jacobian at the solution. Each step solves `J Δx = F` by
+    /// Gaussian elimination with partial pivoting at the working precision.
+    ///
+    /// - Parameters:
+    ///   - seed: The starting point.
+    ///   - precision: The target precision in bits.
+    ///   - system: The function `F`, returning one value per unknown.
+    ///   - jacobian: The Jacobian of `F`: row `i` holds the partial
+    ///     derivatives of `F_i`.
+    /// - Returns: The solution with its residual and final step size.
+    /// - Throws: `RootFindingError.singularDerivative` if the Jacobian is
+    ///   singular at an iterate; `RootFindingError.noConvergence` if the
+    ///   iteration does not settle at the base precision or produces
+    ///   non-finite values.
+    ///
+    /// - Requires: `seed` must be non-empty with finite entries. `system`
+    ///   and `jacobian` must return `seed.count` values and a
+    ///   `seed.count × seed.count` matrix.
+    /// - Guarantees: Every solution entry has precision `precision`.
+    public static func newtonSolve(
+        seed: [Double],
+        precision: Int,
+        system: ([MPFRFloat]) -> [MPFRFloat],
+        jacobian: ([MPFRFloat]) -> [[MPFRFloat]]
+    ) throws -> NewtonSystemSolution {
+        precondition(!seed.isEmpty, "seed must not be empty")
+        precondition(seed.allSatisfy(\.isFinite), "seed must be finite")
+        let base = _newtonBasePrecision
+        var iterations = 0
+
+        func step(_ x: [MPFRFloat]) throws -> [MPFRFloat] {
+            let values = system(x)
+            let matrix = jacobian(x)
+            precondition(
+                values.count == x.count && matrix.count == x.count
+                    && matrix.allSatisfy { $0.count == x.count },
+                "system and jacobian must match the number of unknowns"
+            )
+            iterations += 1
+            guard values.allSatisfy(\.isRegular) else {
+                throw RootFindingError.noConvergence
+            }
+            return try _solveLinearSystem(matrix, values)
+        }
+
+        var x = seed.map { MPFRFloat($0, precision: base) }
+        var converged = false
+        for _ in 0 ..< _newtonBaseIterations {
+            let delta = try step(x)
+            for i in x.indices {
+                x[i] -= delta[i]
+            }
+            guard x.allSatisfy(\.isRegular) else {
+                throw RootFindingError.noConvergence
+            }
+            if _isNegligible(delta, relativeTo: x, bits: base - 4) {
+                converged = true
+                break
+            }
+        }
+        guard converged else {
+            throw RootFindingError.noConvergence
+        }
+
+        var lastStepNorm = MPFRFloat(0, precision: base)
+        for working in _newtonPrecisionSchedule(target: precision) {
+            for i in x.indices {
+                x[i].roundToPrecision(working)
+            }
+            let delta = try step(x)
+            for i in x.indices {
+                x[i] -= delta[i]
+            }
+            lastStepNorm = _maximumMagnitude(delta)
+        }
+        for i in x.indices {
+            x[i].roundToPrecision(precision)
+        }
+        return NewtonSystemSolution(
+            solution: x,
+            residualNorm: _maximumMagnitude(system(x)),
+            lastStepNorm: lastStepNorm,
+            iterations: iterations
+        )
+    }
+
+    // MARK: - Helpers
+
+    /// The working precisions after the base stage, ending at `target`.
+    ///
+    /// Each entry is about half the next one plus guard bits, so one Newton
+    /// step per entry carries the accuracy from the base precision to the
+    /// target.
+    static func _newtonPrecisionSchedule(target: Int) -> [Int] {
+        var schedule = [target]
+        while true {
+            let next = schedule[schedule.count - 1] / 2 + _newtonGuardBits
+            guard next > _newtonBasePrecision,
+                  next < schedule[schedule.count - 1]
+            else {
+                break
+            }
+            schedule.append(next)
+        }
+        return schedule.reversed()
+    }
+
+    /// Whether `|step| <= 2^-bits · |x|`.
+    static func _isNegligible(
+        _ step: MPFRFloat,
+        relativeTo x: MPFRFloat,
+        bits: Int
+    ) -> Bool {
+        step.isZero
+            || step.absoluteValue().result
+            <= x.absoluteValue().result.dividedByPowerOf2(bits).result
+    }
+
+    /// Whether `max|step_i| <= 2^-bits · max|x_i|`.
+    static func _isNegligible(
+        _ step: [MPFRFloat],
+        relativeTo x: [MPFRFloat],
+        bits: Int
+    ) -> Bool {
+        _isNegligible(
+            _maximumMagnitude(step),
+            relativeTo: _maximumMagnitude(x),
+            bits: bits
+        )
+    }
+
+    /// `max |values_i|`.
+    static func _maximumMagnitude(_ values: [MPFRFloat]) -> MPFRFloat {
+        var result = values[0].absoluteValue().result
+        for value in values.dropFirst() {
+            let magnitude = value.absoluteValue().result
+            if result < magnitude {
+                result = magnitude
+            }
+        }
+        return result
+    }
+
+    /// Find a sign change of `function` in `bracket` to about `precision`
+    /// bits with the Illinois variant of regula falsi.
+    ///
+    /// - Returns: The approximate root and the number of evaluations.
+    static func _illinois(
+        bracket: ClosedRange<Double>,
+        precision: Int,
+        function: (MPFRFloat) -> MPFRFloat
+    ) throws -> (MPFRFloat, Int) {
+        precondition(
+            bracket.lowerBound.isFinite && bracket.upperBound.isFinite,
+            "bracket must be finite"
+        )
+        var a = MPFRFloat(bracket.lowerBound, precision: precision)
+        var b = MPFRFloat(bracket.upperBound, precision: precision)
+        var fa = function(a)
+        var fb = function(b)
+        var evaluations = 2
+        guard fa.isRegular, fb.isRegular else {
+            throw RootFindingError.invalidBracket
+        }
+        if fa.isZero {
+            return (a, evaluations)
+        }
+        if fb.isZero {
+            return (b, evaluations)
+        }
+        guard fa.isNegative != fb.isNegative else {
+            throw RootFindingError.invalidBracket
+        }
+        for _ in 0 ..< 8 * precision {
+            let c = b - fb * (b - a) / (fb - fa)
+            let fc = function(c)
+            evaluations += 1
+            guard fc.isRegular else {
+                throw RootFindingError.noConvergence
+            }
+            if fc.isNegative == fb.isNegative {
+                // The same endpoint moved twice in a row: halve the stale
+                // one's value so the next secant lands on its side
+                fa = fa.dividedByPowerOf2(1).result
+            } else {
+                a = b
+                fa = fb
+            }
+            b = c
+            fb = fc
+            let scale = a.absoluteValue().result < b.absoluteValue().result
+                ? b : a
+            if fb.isZero
+                || _isNegligible(b - a, relativeTo: scale, bits: precision - 4)
+            {
+                return (b, evaluations)
+            }
+        }
+        throw RootFindingError.noConvergence
+    }
+
+    /// Solve `matrix · x = rhs` by Gaussian elimination with partial
+    /// pivoting at the precision of the entries.
+    ///
+    /// - Throws: `RootFindingError.singularDerivative` if a pivot is zero
+    ///   or not finite.
+    static func _solveLinearSystem(
+        _ matrix: [[MPFRFloat]],
+        _ rhs: [MPFRFloat]
+    ) throws -> [MPFRFloat] {
+        let n = rhs.count
+        var a = matrix
+        var b = rhs
+        for column in 0 ..< n {
+            var pivot = column
+            var largest = a[column][column].absoluteValue().result
+            for row in (column + 1) ..< n {
+                let magnitude = a[row][column].absoluteValue().result
+                if largest < magnitude {
+                    largest = magnitude
+                    pivot = row
+                }
+            }
+            guard largest.isRegular, !largest.isZero else {
+                throw RootFindingError.singularDerivative
+            }
+            if pivot != column {
+                a.swapAt(pivot, column)
+                b.swapAt(pivot, column)
+            }
+            for row in (column + 1) ..< n where !a[row][column].isZero {
+                let factor = a[row][column] / a[column][column]
+                for k in column ..< n {
+                    a[row][k] -= factor * a[column][k]
+                }
+                b[row] -= factor * b[column]
+            }
+        }
+        var x = b
+        for row in stride(from: n - 1, through: 0, by: -1) {
+            var sum = b[row]
+            for k in (row + 1) ..< n {
+                sum -= a[row][k] * x[k]
+            }
+            x[row] = sum / a[row][row]
+        }
+        return x
+    }
+}
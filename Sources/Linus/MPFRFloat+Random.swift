@@ -0,0 +1,143 @@
+// Import CKalliope first so gmp.h is available when CLinus imports mpfr.h
+import CKalliope
+import CLinus
+import CLinusBridge
+import Kalliope
+
+/// A distribution for MPFR random sampling.
+public enum MPFRRandomDistribution: Sendable {
+    /// Uniform on [0, 1) with `precision` random bits: every sample is an
+    /// exact multiple of 2^-precision. Wraps `mpfr_urandomb`.
+    case uniformBits
+
+    /// Uniform on [0, 1], correctly rounded to nearest from a uniform real
+    /// in [0, 1). Rounding may produce exactly 1. Wraps `mpfr_urandom`.
+    case uniform
+
+    /// Standard normal (mean 0, variance 1), correctly rounded to nearest.
+    /// Wraps `mpfr_nrandom`.
+    case normal
+
+    /// Standard exponential (rate 1), correctly rounded to nearest. Wraps
+    /// `mpfr_erandom`.
+    case exponential
+}
+
+// MARK: - Random Sampling
+
+/// Random sampling for `MPFRFloat`.
+///
+/// - Warning: **Not Cryptographically Secure**: These methods draw from
+///   GMP's pseudorandom generators and must not be used for cryptographic
+///   purposes.
+extension MPFRFloat {
+    /// Draw one sample into `rop` from `distribution`.
+    static func _sample(
+        _ rop: UnsafeMutablePointer<__mpfr_struct>,
+        _ distribution: MPFRRandomDistribution,
+        _ state: UnsafeMutablePointer<gmp_randstate_t>
+    ) {
+        switch distribution {
+        case .uniformBits:
+            // Only fails if the exponent range excludes [1/2, 1), which the
+            // default range never does
+            _ = mpfr_urandomb(rop, state)
+        case .uniform:
+            mpfr_urandom(rop, state, MPFR_RNDN)
+        case .normal:
+            mpfr_nrandom(rop, state, MPFR_RNDN)
+        case .exponential:
+            mpfr_erandom(rop, state, MPFR_RNDN)
+        }
+    }
+
+    /// Generate a random float.
+    ///
+    /// The sample is drawn from `state`, which advances in place like the
+    /// `random(...using:)` functions of `GMPInteger` and `GMPFloat`.
+    ///
+    /// - Parameters:
+    ///   - distribution: The distribution to sample.
+    ///   - precision: The precision of the result, in bits.
+    ///   - state: The random number generator state.
+    /// - Returns: A new `MPFRFloat` drawn from `distribution`.
+    ///
+    /// - Requires: `precision` must be a valid MPFR precision.
+    /// - Wraps: `mpfr_urandomb`, `mpfr_urandom`, `mpfr_nrandom`,
+    ///   `mpfr_erandom`
+    public static func random(
+        _ distribution: MPFRRandomDistribution = .uniform,
+        precision: Int,
+        using state: GMPRandomState
+    ) -> MPFRFloat {
+        // Mutated through pointer below
+        let result = MPFRFloat(precision: precision)
+        state.withMutableCPointer { statePtr in
+            _sample(&result._storage.value, distribution, statePtr)
+        }
+        return result
+    }
+}
+
+extension MPFRMatrix {
+    /// The number of samples drawn from each independent stream by
+    /// `random(rows:columns:precision:distribution:using:)`.
+    static let randomChunkSize = 1 << 12
+
+    /// Generate a matrix of random samples.
+    ///
+    /// The entries are split into fixed chunks of `randomChunkSize` in
+    /// row-major order. Each chunk draws from its own Mersenne Twister
+    /// stream, seeded with 128 bits drawn from `state`, so chunks are filled
+    /// concurrently without sharing a generator. Because the chunking does
+    /// not depend on the number of cores, the result depends only on
+    /// `state` and the arguments.
+    ///
+    /// Use an `n x 1` matrix for a contiguous vector of samples.
+    ///
+    /// - Parameters:
+    ///   - rows: The number of rows.
+    ///   - columns: The number of columns.
+    ///   - precision: The precision of every entry, in bits.
+    ///   - distribution: The distribution to sample.
+    ///   - state: The random number generator state. One seed per chunk is
+    ///     drawn from it.
+    /// - Returns: A `rows x columns` matrix of independent samples.
+    ///
+    /// - Requires: `rows >= 0`, `columns >= 0`, and `precision` must be a
+    ///   valid MPFR precision.
+    public static func random(
+        rows: Int,
+        columns: Int,
+        precision: Int,
+        distribution: MPFRRandomDistribution = .uniform,
+        using state: GMPRandomState
+    ) -> MPFRMatrix {
+        let result = MPFRMatrix(
+            rows: rows,
+            columns: columns,
+            precision: precision
+        )
+        let count = rows * columns
+        let chunkSize = randomChunkSize
+        let seeds = (0 ..< (count + chunkSize - 1) / chunkSize).map { _ in
+            GMPInteger.random(bits: 128, using: state)
+        }
+        let storage = result._storage
+        _forEachChunk(
+            0 ..< seeds.count,
+            concurrently: count >= parallelThreshold
+        ) { chunks in
+            for chunk in chunks {
+                let stream = GMPRandomState(mersenneTwister: seeds[chunk])
+                let end = Swift.min((chunk + 1) * chunkSize, count)
+                stream.withMutableCPointer { statePtr in
+                    for i in (chunk * chunkSize) ..< end {
+                        MPFRFloat._sample(storage[i], distribution, statePtr)
+                    }
+                }
+            }
+        }
+        return result
+    }
+}
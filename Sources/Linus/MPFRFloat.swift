@@ -222,6 +222,48 @@ public struct MPFRFloat {
         }
     }
 
+    /// Change the precision of this float in place, keeping its value.
+    ///
+    /// Unlike setting `precision`, which discards the value, this rounds the
+    /// current value to the new precision. The existing significand is
+    /// reused when shrinking and reallocated in place when growing, so a
+    /// single variable can serve as the register for a computation whose
+    /// precision changes step by step.
+    ///
+    /// - Parameters:
+    ///   - precision: The new precision in bits.
+    ///   - rounding: The rounding mode to use when shrinking. Defaults to
+    ///     `.nearest`.
+    /// - Returns: A ternary value: 0 if exact, positive if rounded up,
+    ///   negative if rounded down.
+    ///
+    /// - Wraps: `mpfr_prec_round`
+    ///
+    /// - Requires: `precision` must be between MPFR_PREC_MIN and
+    ///   MPFR_PREC_MAX.
+    /// - Guarantees: After this call, `self.precision == precision` and the
+    ///   value is the old value rounded to the new precision (exact when
+    ///   growing).
+    @discardableResult
+    public mutating func roundToPrecision(
+        _ precision: Int,
+        rounding: MPFRRoundingMode = .nearest
+    ) -> Int {
+        let precMin = Int(clinus_get_prec_min())
+        let precMax = Int(clinus_get_prec_max())
+        precondition(
+            precision >= precMin && precision <= precMax,
+            "precision must be between MPFR_PREC_MIN and MPFR_PREC_MAX"
+        )
+        _ensureUnique()
+        let rnd = rounding.toMPFRRoundingMode()
+        return Int(mpfr_prec_round(
+            &_storage.value,
+            mpfr_prec_t(precision),
+            rnd
+        ))
+    }
+
     /// Check if this float is NaN (Not-a-Number).
     ///
     /// - Returns: `true` if `self` is NaN, `false` otherwise.
@@ -0,0 +1,562 @@
+// Import CKalliope first so gmp.h is available when CLinus imports mpfr.h
+import CKalliope
+import CLinus
+import CLinusBridge
+import Kalliope
+
+/// A dense matrix of `MPFRFloat` entries sharing one precision.
+///
+/// Entries are stored row-major in a single `_MPFRBuffer`: one array of
+/// `mpfr_t` headers and one block of significands, so kernels run without
+/// allocating per element. The matrix has value semantics with
+/// copy-on-write storage.
+///
+/// The kernels round once per dot product: products are computed with
+/// `mpfr_dot`, which forms the exact sum of products and rounds it once,
+/// rather than accumulating a rounded temporary per multiply-add. Products
+/// are computed in tiles of `tileSize × tileSize` result entries, so the
+/// operand rows and columns of a tile are reused while they are in cache,
+/// and tiles (for products) or rows and columns (for LU and solves) are
+/// spread across cores once the work exceeds `parallelThreshold`.
+public struct MPFRMatrix {
+    /// The number of rows.
+    public let rowCount: Int
+
+    /// The number of columns.
+    public let columnCount: Int
+
+    /// The entries, row-major.
+    var _storage: _MPFRBuffer
+
+    /// The tile edge used by `multiplied(by:)`.
+    static let tileSize = 16
+
+    /// The minimum number of multiply-adds before a kernel is split across
+    /// cores.
+    ///
+    /// Tuned by `GMPTuningParameter.mpfrMatrixParallelThreshold`.
+    public static var parallelThreshold: Int {
+        GMPTuningParameter.mpfrMatrixParallelThreshold.value
+    }
+
+    /// Ensure this matrix has unique storage before mutation.
+    mutating func _ensureUnique() {
+        if !isKnownUniquelyReferenced(&_storage) {
+            _storage = _MPFRBuffer(copying: _storage)
+        }
+    }
+
+    // MARK: - Initialization
+
+    /// Create a zero matrix.
+    ///
+    /// - Parameters:
+    ///   - rows: The number of rows. Must be non-negative.
+    ///   - columns: The number of columns. Must be non-negative.
+    ///   - precision: The precision of every entry, in bits.
+    ///
+    /// - Requires: `rows >= 0`, `columns >= 0`, and `precision` must be a
+    ///   valid MPFR precision.
+    /// - Guarantees: Every entry is +0.
+    public init(rows: Int, columns: Int, precision: Int) {
+        precondition(rows >= 0 && columns >= 0, "dimensions must be >= 0")
+        rowCount = rows
+        columnCount = columns
+        _storage = _MPFRBuffer(count: rows * columns, precision: precision)
+    }
+
+    /// Create a matrix from nested rows.
+    ///
+    /// - Parameters:
+    ///   - rows: The rows. All rows must have the same length.
+    ///   - precision: The precision of the matrix. Defaults to the largest
+    ///     precision among the entries (or 53 bits if there are none).
+    ///
+    /// - Requires: All rows must have the same length.
+    /// - Guarantees: Entries are rounded to nearest at `precision`.
+    public init(_ rows: [[MPFRFloat]], precision: Int? = nil) {
+        let columns = rows.first?.count ?? 0
+        precondition(
+            rows.allSatisfy { $0.count == columns },
+            "all rows must have the same length"
+        )
+        let precision = precision
+            ?? rows.joined().map(\.precision).max()
+            ?? 53
+        self.init(rows: rows.count, columns: columns, precision: precision)
+        for (i, row) in rows.enumerated() {
+            for (j, value) in row.enumerated() {
+                _storage.store(value, at: i * columns + j)
+            }
+        }
+    }
+
+    /// Create an identity matrix.
+    ///
+    /// - Parameters:
+    ///   - n: The dimension.
+    ///   - precision: The precision in bits.
+    /// - Returns: The `n × n` identity matrix.
+    public static func identity(_ n: Int, precision: Int) -> MPFRMatrix {
+        let result = MPFRMatrix(rows: n, columns: n, precision: precision)
+        for i in 0 ..< n {
+            mpfr_set_ui(result._storage[i * n + i], 1, MPFR_RNDN)
+        }
+        return result
+    }
+
+    // MARK: - Properties
+
+    /// The precision of every entry, in bits.
+    public var precision: Int {
+        Int(_storage.precision)
+    }
+
+    /// Whether the matrix is square.
+    public var isSquare: Bool {
+        rowCount == columnCount
+    }
+
+    /// The entry at `row`, `column`.
+    ///
+    /// Setting rounds the new value to the matrix precision.
+    public subscript(row: Int, column: Int) -> MPFRFloat {
+        get {
+            _checkIndex(row, column)
+            return _storage.float(at: row * columnCount + column)
+        }
+        set {
+            _checkIndex(row, column)
+            _ensureUnique()
+            _storage.store(newValue, at: row * columnCount + column)
+        }
+    }
+
+    /// The rows as nested arrays.
+    public var rows: [[MPFRFloat]] {
+        (0 ..< rowCount).map { i in
+            (0 ..< columnCount).map { j in
+                _storage.float(at: i * columnCount + j)
+            }
+        }
+    }
+
+    /// The transpose.
+    public var transposed: MPFRMatrix {
+        let result = MPFRMatrix(
+            rows: columnCount,
+            columns: rowCount,
+            precision: precision
+        )
+        for i in 0 ..< rowCount {
+            for j in 0 ..< columnCount {
+                mpfr_set(
+                    result._storage[j * rowCount + i],
+                    _storage[i * columnCount + j],
+                    MPFR_RNDN
+                )
+            }
+        }
+        return result
+    }
+
+    private func _checkIndex(_ row: Int, _ column: Int) {
+        precondition(row >= 0 && row < rowCount, "row index out of range")
+        precondition(
+            column >= 0 && column < columnCount,
+            "column index out of range"
+        )
+    }
+
+    // MARK: - Products
+
+    /// Multiply two matrices.
+    ///
+    /// Every entry is one `mpfr_dot` of a row of `self` with a column of
+    /// `other`, rounded once to `self.precision`. Result tiles are computed
+    /// concurrently when the product is large enough.
+    ///
+    /// - Parameter other: The right-hand factor.
+    /// - Returns: The product, at `self.precision`.
+    ///
+    /// - Requires: `columnCount == other.rowCount`.
+    /// - Wraps: `mpfr_dot`
+    public func multiplied(by other: MPFRMatrix) -> MPFRMatrix {
+        precondition(
+            columnCount == other.rowCount,
+            "column count must equal the other matrix's row count"
+        )
+        let m = rowCount
+        let n = other.columnCount
+        let k = columnCount
+        let result = MPFRMatrix(rows: m, columns: n, precision: precision)
+        guard m > 0, n > 0, k > 0 else {
+            return result
+        }
+        let left = _storage.pointerTable(
+            rows: m,
+            columns: k,
+            columnMajor: false
+        )
+        let right = other._storage.pointerTable(
+            rows: k,
+            columns: n,
+            columnMajor: true
+        )
+        defer {
+            left.deallocate()
+            right.deallocate()
+        }
+        let tile = Self.tileSize
+        let tileRows = (m + tile - 1) / tile
+        let tileColumns = (n + tile - 1) / tile
+        let target = result._storage
+        _forEachChunk(
+            0 ..< tileRows * tileColumns,
+            concurrently: m * n * k >= Self.parallelThreshold
+        ) { tiles in
+            for t in tiles {
+                let rowStart = (t / tileColumns) * tile
+                let columnStart = (t % tileColumns) * tile
+                for i in rowStart ..< Swift.min(rowStart + tile, m) {
+                    for j in columnStart ..< Swift.min(columnStart + tile, n) {
+                        mpfr_dot(
+                            target[i * n + j],
+                            left + i * k,
+                            right + j * k,
+                            UInt(k),
+                            MPFR_RNDN
+                        )
+                    }
+                }
+            }
+        }
+        return result
+    }
+
+    /// Multiply two matrices.
+    ///
+    /// - Requires: `lhs.columnCount == rhs.rowCount`.
+    public static func * (lhs: MPFRMatrix, rhs: MPFRMatrix) -> MPFRMatrix {
+        lhs.multiplied(by: rhs)
+    }
+
+    /// Multiply this matrix by a vector.
+    ///
+    /// - Parameter vector: The vector, of length `columnCount`.
+    /// - Returns: The product, of length `rowCount`, at `self.precision`.
+    public func multiplied(by vector: [MPFRFloat]) -> [MPFRFloat] {
+        precondition(
+            vector.count == columnCount,
+            "vector length must equal the column count"
+        )
+        let column = MPFRMatrix(
+            vector.map { [$0] },
+            precision: vector.map(\.precision).max()
+        )
+        let product = multiplied(by: column)
+        return (0 ..< rowCount).map { product._storage.float(at: $0) }
+    }
+
+    // MARK: - LU Decomposition
+
+    /// Compute the LU decomposition with partial pivoting, `P A = L U`.
+    ///
+    /// Uses the Crout (left-looking) ordering, so every entry of `L` and `U`
+    /// is its original value minus one `mpfr_dot`: each entry is rounded
+    /// twice in total, independent of the dimension. At each step the
+    /// candidate pivot column and the new row of `U` are computed
+    /// concurrently across rows and columns when large enough.
+    ///
+    /// - Returns: The decomposition.
+    /// - Throws: `MPFRError.divideByZero` if the matrix is singular at the
+    ///   working precision (a pivot column is entirely zero).
+    ///
+    /// - Requires: The matrix must be square.
+    /// - Wraps: `mpfr_dot`
+    public func luDecomposition() throws -> MPFRLUDecomposition {
+        precondition(isSquare, "matrix must be square")
+        let n = rowCount
+        var factors = self
+        factors._ensureUnique()
+        let a = factors._storage
+        var permutation = Array(0 ..< n)
+        var sign = 1
+        guard n > 0 else {
+            return MPFRLUDecomposition(
+                factors: factors,
+                permutation: permutation,
+                permutationSign: sign
+            )
+        }
+        let rows = a.pointerTable(rows: n, columns: n, columnMajor: false)
+        let columns = a.pointerTable(rows: n, columns: n, columnMajor: true)
+        let scratch = _MPFRBuffer(count: n, precision: precision)
+        defer {
+            rows.deallocate()
+            columns.deallocate()
+        }
+
+        for k in 0 ..< n {
+            let concurrently = (n - k) * k >= Self.parallelThreshold
+            if k > 0 {
+                // a[i][k] -= L[i][0..<k] · U[0..<k][k] for i >= k
+                _forEachChunk(k ..< n, concurrently: concurrently) { range in
+                    for i in range {
+                        mpfr_dot(
+                            scratch[i],
+                            rows + i * n,
+                            columns + k * n,
+                            UInt(k),
+                            MPFR_RNDN
+                        )
+                        let entry = a[i * n + k]
+                        mpfr_sub(entry, entry, scratch[i], MPFR_RNDN)
+                    }
+                }
+            }
+
+            var pivot = k
+            for i in (k + 1) ..< n
+                where mpfr_cmpabs(a[i * n + k], a[pivot * n + k]) > 0
+            {
+                pivot = i
+            }
+            guard mpfr_zero_p(a[pivot * n + k]) == 0,
+                  mpfr_number_p(a[pivot * n + k]) != 0
+            else {
+                throw MPFRError.divideByZero
+            }
+            if pivot != k {
+                for j in 0 ..< n {
+                    mpfr_swap(a[pivot * n + j], a[k * n + j])
+                }
+                permutation.swapAt(pivot, k)
+                sign = -sign
+            }
+
+            if k > 0 {
+                // a[k][j] -= L[k][0..<k] · U[0..<k][j] for j > k
+                _forEachChunk(
+                    (k + 1) ..< n,
+                    concurrently: concurrently
+                ) { range in
+                    for j in range {
+                        mpfr_dot(
+                            scratch[j],
+                            rows + k * n,
+                            columns + j * n,
+                            UInt(k),
+                            MPFR_RNDN
+                        )
+                        let entry = a[k * n + j]
+                        mpfr_sub(entry, entry, scratch[j], MPFR_RNDN)
+                    }
+                }
+            }
+
+            let diagonal = a[k * n + k]
+            for i in (k + 1) ..< n {
+                mpfr_div(a[i * n + k], a[i * n + k], diagonal, MPFR_RNDN)
+            }
+        }
+        return MPFRLUDecomposition(
+            factors: factors,
+            permutation: permutation,
+            permutationSign: sign
+        )
+    }
+
+    /// Solve `self · X = rhs`.
+    ///
+    /// - Parameter rhs: The right-hand sides, one per column.
+    /// - Returns: The solution, at `self.precision`.
+    /// - Throws: `MPFRError.divideByZero` if the matrix is singular.
+    ///
+    /// - Requires: The matrix must be square and
+    ///   `rhs.rowCount == rowCount`.
+    public func solve(_ rhs: MPFRMatrix) throws -> MPFRMatrix {
+        try luDecomposition().solve(rhs)
+    }
+
+    /// Solve `self · x = rhs`.
+    ///
+    /// - Parameter rhs: The right-hand side.
+    /// - Returns: The solution, at `self.precision`.
+    /// - Throws: `MPFRError.divideByZero` if the matrix is singular.
+    ///
+    /// - Requires: The matrix must be square and `rhs.count == rowCount`.
+    public func solve(_ rhs: [MPFRFloat]) throws -> [MPFRFloat] {
+        try luDecomposition().solve(rhs)
+    }
+
+    /// The inverse matrix.
+    ///
+    /// - Returns: The inverse, at `self.precision`.
+    /// - Throws: `MPFRError.divideByZero` if the matrix is singular.
+    ///
+    /// - Requires: The matrix must be square.
+    public func inverse() throws -> MPFRMatrix {
+        try luDecomposition().solve(
+            .identity(rowCount, precision: precision)
+        )
+    }
+
+    /// The determinant.
+    ///
+    /// - Returns: The determinant, or zero if the matrix is singular at the
+    ///   working precision.
+    ///
+    /// - Requires: The matrix must be square.
+    public var determinant: MPFRFloat {
+        guard let decomposition = try? luDecomposition() else {
+            return MPFRFloat(0, precision: precision)
+        }
+        return decomposition.determinant
+    }
+}
+
+// MARK: - LU Decomposition Result
+
+/// An LU decomposition with partial pivoting, `P A = L U`.
+public struct MPFRLUDecomposition {
+    /// The packed factors: the strictly lower triangle holds `L` (whose unit
+    /// diagonal is implicit), the upper triangle holds `U`.
+    public let factors: MPFRMatrix
+
+    /// The row permutation: row `i` of `P A` is row `permutation[i]` of `A`.
+    public let permutation: [Int]
+
+    /// The sign of the permutation, `1` or `-1`.
+    public let permutationSign: Int
+
+    /// The determinant of the original matrix.
+    public var determinant: MPFRFloat {
+        let n = factors.rowCount
+        let storage = factors._storage
+        let result = MPFRFloat(
+            permutationSign,
+            precision: factors.precision
+        ) // Mutated through pointer below
+        for k in 0 ..< n {
+            mpfr_mul(
+                &result._storage.value,
+                &result._storage.value,
+                storage[k * n + k],
+                MPFR_RNDN
+            )
+        }
+        return result
+    }
+
+    /// Solve `A · X = rhs` using the factors.
+    ///
+    /// Each right-hand side column is forward- and back-substituted
+    /// independently, so columns are processed concurrently when large
+    /// enough. Every substitution step is one `mpfr_dot`.
+    ///
+    /// - Parameter rhs: The right-hand sides, one per column.
+    /// - Returns: The solution, at the factors' precision.
+    ///
+    /// - Requires: `rhs.rowCount` must equal the dimension.
+    /// - Wraps: `mpfr_dot`
+    public func solve(_ rhs: MPFRMatrix) -> MPFRMatrix {
+        let n = factors.rowCount
+        precondition(rhs.rowCount == n, "row count must match the dimension")
+        let r = rhs.columnCount
+        // Work column-major: column c of X is solution[c * n ..< (c + 1) * n]
+        let solution = MPFRMatrix(
+            rows: r,
+            columns: n,
+            precision: factors.precision
+        )
+        let x = solution._storage
+        for i in 0 ..< n {
+            for c in 0 ..< r {
+                mpfr_set(
+                    x[c * n + i],
+                    rhs._storage[permutation[i] * r + c],
+                    MPFR_RNDN
+                )
+            }
+        }
+        guard n > 0, r > 0 else {
+            return solution.transposed
+        }
+        let lu = factors._storage
+        let rows = lu.pointerTable(rows: n, columns: n, columnMajor: false)
+        let unknowns = x.pointerTable(rows: r, columns: n, columnMajor: false)
+        let scratch = _MPFRBuffer(count: r, precision: factors.precision)
+        defer {
+            rows.deallocate()
+            unknowns.deallocate()
+        }
+        _forEachChunk(
+            0 ..< r,
+            concurrently: n * n * r >= MPFRMatrix.parallelThreshold
+        ) { range in
+            for c in range {
+                let column = unknowns + c * n
+                let sum = scratch[c]
+                // Forward substitution with the unit lower triangle
+                for i in 1 ..< n {
+                    let entry = x[c * n + i]
+                    mpfr_dot(sum, rows + i * n, column, UInt(i), MPFR_RNDN)
+                    mpfr_sub(entry, entry, sum, MPFR_RNDN)
+                }
+                // Back substitution with the upper triangle
+                for i in stride(from: n - 1, through: 0, by: -1) {
+                    let entry = x[c * n + i]
+                    let tail = n - 1 - i
+                    if tail > 0 {
+                        mpfr_dot(
+                            sum,
+                            rows + i * n + i + 1,
+                            column + i + 1,
+                            UInt(tail),
+                            MPFR_RNDN
+                        )
+                        mpfr_sub(entry, entry, sum, MPFR_RNDN)
+                    }
+                    mpfr_div(entry, entry, lu[i * n + i], MPFR_RNDN)
+                }
+            }
+        }
+        return solution.transposed
+    }
+
+    /// Solve `A · x = rhs` using the factors.
+    ///
+    /// - Parameter rhs: The right-hand side.
+    /// - Returns: The solution, at the factors' precision.
+    ///
+    /// - Requires: `rhs.count` must equal the dimension.
+    public func solve(_ rhs: [MPFRFloat]) -> [MPFRFloat] {
+        let column = MPFRMatrix(
+            rhs.map { [$0] },
+            precision: factors.precision
+        )
+        let result = solve(column)
+        return (0 ..< result.rowCount).map { result._storage.float(at: $0) }
+    }
+}
+
+// MARK: - Protocol Conformances
+
+extension MPFRMatrix: Equatable {
+    /// Matrices are equal if they have the same shape and equal entries.
+    /// Precision is not compared.
+    public static func == (lhs: MPFRMatrix, rhs: MPFRMatrix) -> Bool {
+        guard lhs.rowCount == rhs.rowCount,
+              lhs.columnCount == rhs.columnCount
+        else {
+            return false
+        }
+        for i in 0 ..< lhs.rowCount * lhs.columnCount
+            where mpfr_equal_p(lhs._storage[i], rhs._storage[i]) == 0
+        {
+            return false
+        }
+        return true
+    }
+}
@@ -0,0 +1,87 @@
+// Import CKalliope first so gmp.h is available when CLinus imports mpfr.h
+import CKalliope
+import CLinus
+import CLinusBridge
+import Kalliope
+
+extension MPFRFloat: PowerSeriesCoefficient {
+    public init(_ value: Int, matching template: MPFRFloat) {
+        self.init(value, precision: template.precision)
+    }
+
+    /// The quotient by a nonzero integer, rounded to nearest.
+    public func divided(by divisor: Int) -> MPFRFloat {
+        precondition(divisor != 0, "divisor must not be zero")
+        return self / divisor
+    }
+
+    /// The reciprocal, rounded to nearest.
+    ///
+    /// - Requires: The value must not be zero.
+    public func reciprocal() -> MPFRFloat {
+        precondition(!isZero, "value must not be zero")
+        return MPFRFloat(1, precision: precision) / self
+    }
+
+    /// The truncated product by rounded dot products.
+    ///
+    /// Each coefficient `cₖ = Σ aᵢbₖ₋ᵢ` is one `mpfr_dot` of a run of the
+    /// first factor with a run of the reversed second factor, rounded once
+    /// at the larger input precision. Both factors are copied into
+    /// `_MPFRBuffer`s so the kernel allocates nothing, and blocks of
+    /// coefficients are computed concurrently once the product has
+    /// `MPFRMatrix.parallelThreshold` multiply-adds.
+    ///
+    /// - Wraps: `mpfr_dot`
+    public static func truncatedProduct(
+        _ lhs: [MPFRFloat],
+        _ rhs: [MPFRFloat],
+        count: Int
+    ) -> [MPFRFloat] {
+        let na = Swift.min(lhs.count, count)
+        let nb = Swift.min(rhs.count, count)
+        let precision = (lhs.prefix(na) + rhs.prefix(nb))
+            .map(\.precision)
+            .max()!
+        let a = _MPFRBuffer(count: na, precision: precision)
+        let reversed = _MPFRBuffer(count: nb, precision: precision)
+        for i in 0 ..< na {
+            a.store(lhs[i], at: i)
+        }
+        for i in 0 ..< nb {
+            reversed.store(rhs[i], at: nb - 1 - i)
+        }
+        let left = a.pointerTable(rows: 1, columns: na, columnMajor: false)
+        let right = reversed.pointerTable(
+            rows: 1,
+            columns: nb,
+            columnMajor: false
+        )
+        defer {
+            left.deallocate()
+            right.deallocate()
+        }
+        let result = _MPFRBuffer(count: count, precision: precision)
+        _forEachChunk(
+            0 ..< count,
+            concurrently: na * nb >= MPFRMatrix.parallelThreshold
+        ) { block in
+            for k in block {
+                // bₖ₋ᵢ for i = low ... high is a run of the reversed factor
+                let low = Swift.max(0, k - nb + 1)
+                let high = Swift.min(k, na - 1)
+                guard low <= high else {
+                    continue
+                }
+                mpfr_dot(
+                    result[k],
+                    left + low,
+                    right + (nb - 1 - k + low),
+                    UInt(high - low + 1),
+                    MPFR_RNDN
+                )
+            }
+        }
+        return (0 ..< count).map { result.float(at: $0) }
+    }
+}
@@ -0,0 +1,24 @@
+/// Errors that can be thrown by the Newton root finders.
+///
+/// All cases are recoverable - the solver stops without a result and the
+/// caller may retry with a better seed, a bracket, or a different method.
+public enum RootFindingError: Error, Equatable {
+    /// Singular derivative error.
+    ///
+    /// Thrown when the derivative (or the Jacobian of a system) vanishes or
+    /// is singular at an iterate and no bracket is available to fall back on.
+    case singularDerivative
+
+    /// No convergence error.
+    ///
+    /// Thrown when the iteration produces a non-finite value, leaves the
+    /// bracket, or exceeds its iteration limit, and no bracket is available
+    /// to fall back on.
+    case noConvergence
+
+    /// Invalid bracket error.
+    ///
+    /// Thrown when the function does not have opposite signs at the bracket
+    /// endpoints, or is not finite there.
+    case invalidBracket
+}
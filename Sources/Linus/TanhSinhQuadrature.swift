@@ -0,0 +1,497 @@
+// Import CKalliope first so gmp.h is available when CLinus imports mpfr.h
+import CKalliope
+import CLinus
+import CLinusBridge
+import Foundation
+import Kalliope
+
+// MARK: - Quadrature Result
+
+/// The outcome of a numerical integration.
+public struct QuadratureResult {
+    /// The estimated value of the integral.
+    public let value: MPFRFloat
+
+    /// An estimate of the absolute error of `value`.
+    public let errorEstimate: MPFRFloat
+
+    /// The finest level used; the step size was `2^-level`.
+    public let level: Int
+
+    /// The number of integrand evaluations.
+    public let evaluations: Int
+
+    /// Whether `errorEstimate` met the requested accuracy.
+    public let isConverged: Bool
+}
+
+// MARK: - Tanh-Sinh Quadrature
+
+/// Double-exponential (tanh-sinh) quadrature at arbitrary precision.
+///
+/// The substitution `x = tanh(π/2 · sinh t)` maps `[-1, 1]` onto the real
+/// line and makes the transformed integrand decay double-exponentially, so
+/// the trapezoidal rule with step `h = 2^-k` converges quadratically in the
+/// number of levels `k`, even for integrands with endpoint singularities.
+///
+/// Abscissas and weights are costly (two exponentials per node at full
+/// precision) but depend only on the precision and level, never on the
+/// integrand. They are computed once per `(precision, level)` and kept in a
+/// process-wide, lock-protected cache, so repeated integrations at the same
+/// precision only pay for integrand evaluations. Call
+/// `warmUp(precision:levels:)` at startup to move the node computation out
+/// of latency-sensitive paths.
+///
+/// Nodes are stored as distances `1 - x` from the endpoints, so integrands
+/// with endpoint singularities are sampled without cancellation.
+public enum TanhSinhQuadrature {
+    /// Extra bits carried while computing nodes and weights.
+    static let guardBits = 32
+
+    /// Integrate a function over a finite interval.
+    ///
+    /// Levels are added until the error estimate (from the quadratic
+    /// convergence of successive levels) falls below
+    /// `2^-accuracyBits · max(1, |value|)`, or `maximumLevel` is reached.
+    ///
+    /// - Parameters:
+    ///   - a: The lower limit.
+    ///   - b: The upper limit.
+    ///   - precision: The working precision in bits. Defaults to the larger
+    ///     precision of `a` and `b`.
+    ///   - accuracyBits: The requested accuracy in bits. Defaults to
+    ///     `precision - 16`.
+    ///   - maximumLevel: The finest level to try. Each level doubles the
+    ///     number of nodes. Defaults to `12`.
+    ///   - concurrently: Whether to evaluate the integrand on several
+    ///     threads. Defaults to `true`.
+    ///   - integrand: The function to integrate. It is never called at the
+    ///     endpoints. Points next to a nonzero endpoint carry more than
+    ///     `precision` bits, so they stay distinct from it. When
+    ///     `concurrently` is `true`, it must be safe to call from several
+    ///     threads at once.
+    /// - Returns: The integral with its error estimate.
+    ///
+    /// - Requires: `a` and `b` must be finite. `maximumLevel` must be in
+    ///   `0 ... 30`. `accuracyBits` must be positive.
+    /// - Guarantees: The integrand is evaluated only at interior points, at
+    ///   `precision` bits or more. Results do not depend on `concurrently`.
+    public static func integrate(
+        from a: MPFRFloat,
+        to b: MPFRFloat,
+        precision: Int? = nil,
+        accuracyBits: Int? = nil,
+        maximumLevel: Int = 12,
+        concurrently: Bool = true,
+        _ integrand: (MPFRFloat) -> MPFRFloat
+    ) -> QuadratureResult {
+        precondition(a.isRegular && b.isRegular, "limits must be finite")
+        precondition(
+            maximumLevel >= 0 && maximumLevel <= 30,
+            "maximumLevel must be in 0 ... 30"
+        )
+        let precision = precision ?? Swift.max(a.precision, b.precision)
+        let accuracyBits = accuracyBits ?? Swift.max(1, precision - 16)
+        precondition(accuracyBits > 0, "accuracyBits must be positive")
+
+        var lower = MPFRFloat(precision: precision)
+        lower.set(a)
+        var upper = MPFRFloat(precision: precision)
+        upper.set(b)
+        let halfWidth = (upper - lower).dividedByPowerOf2(1).result
+        let zero = MPFRFloat(0, precision: precision)
+
+        var sum = MPFRFloat(0, precision: precision)
+        var estimates: [MPFRFloat] = []
+        var evaluations = 0
+        var errorEstimate = halfWidth.absoluteValue().result
+        var isConverged = false
+        var level = 0
+        while true {
+            if level == 0 {
+                // The node t = 0: x = 0, weight π/2
+                let center = (lower + upper).dividedByPowerOf2(1).result
+                let piOver2 = MPFRFloat.pi(precision: precision).result
+                    .dividedByPowerOf2(1).result
+                sum += piOver2 * integrand(center)
+                evaluations += 1
+            }
+            let nodes = _TanhSinhNodeCache.shared.nodes(
+                level: level,
+                precision: precision
+            )
+            sum += _weightedSum(
+                nodes: nodes,
+                lower: lower,
+                upper: upper,
+                halfWidth: halfWidth,
+                concurrently: concurrently,
+                integrand
+            )
+            evaluations += 2 * nodes.count
+
+            let estimate = (sum * halfWidth).dividedByPowerOf2(level).result
+            estimates.append(estimate)
+            if estimates.count >= 2 {
+                let count = estimates.count
+                let d1 = (estimates[count - 1] - estimates[count - 2])
+                    .absoluteValue().result
+                errorEstimate = d1
+                if count >= 3 {
+                    // Quadratic convergence: the next difference is about
+                    // d1^2 / d2
+                    let d2 = (estimates[count - 2] - estimates[count - 3])
+                        .absoluteValue().result
+                    if d1 < d2 {
+                        errorEstimate = d1 * d1 / d2
+                    }
+                }
+                var scale = estimate.absoluteValue().result
+                if scale < MPFRFloat(1, precision: precision) {
+                    scale = MPFRFloat(1, precision: precision)
+                }
+                let tolerance = scale.dividedByPowerOf2(accuracyBits).result
+                if errorEstimate <= tolerance || d1 == zero {
+                    isConverged = true
+                }
+            }
+            if isConverged || level == maximumLevel {
+                break
+            }
+            level += 1
+        }
+        return QuadratureResult(
+            value: estimates[estimates.count - 1],
+            errorEstimate: errorEstimate,
+            level: level,
+            evaluations: evaluations,
+            isConverged: isConverged
+        )
+    }
+
+    /// Compute and cache the nodes and weights for levels `0 ..< levels` at
+    /// the given precision.
+    ///
+    /// - Parameters:
+    ///   - precision: The working precision in bits, as later passed to
+    ///     `integrate`.
+    ///   - levels: The number of levels to prepare. Defaults to `8`.
+    ///
+    /// - Requires: `precision` must be a valid MPFR precision, `levels` must
+    ///   be in `0 ... 31`.
+    /// - Guarantees: Subsequent integrations at `precision` that stop before
+    ///   level `levels` compute no nodes.
+    public static func warmUp(precision: Int, levels: Int = 8) {
+        precondition(levels >= 0 && levels <= 31, "levels must be in 0 ... 31")
+        for level in 0 ..< levels {
+            _ = _TanhSinhNodeCache.shared.nodes(
+                level: level,
+                precision: precision
+            )
+        }
+    }
+
+    /// Discard all cached nodes and weights.
+    public static func clearCache() {
+        _TanhSinhNodeCache.shared.removeAll()
+    }
+
+    /// `Σ w_j (f(a + u(1 - x_j)) + f(b - u(1 - x_j)))` over one level.
+    private static func _weightedSum(
+        nodes: _TanhSinhNodes,
+        lower: MPFRFloat,
+        upper: MPFRFloat,
+        halfWidth: MPFRFloat,
+        concurrently: Bool,
+        _ integrand: (MPFRFloat) -> MPFRFloat
+    ) -> MPFRFloat {
+        let count = nodes.count
+        let precision = lower.precision
+        var terms = [MPFRFloat](
+            repeating: MPFRFloat(0, precision: precision),
+            count: count
+        )
+        terms.withUnsafeMutableBufferPointer { buffer in
+            let terms = buffer
+            _forEachChunk(0 ..< count, concurrently: concurrently) { range in
+                for j in range {
+                    let offset = halfWidth * nodes.complements[j]
+                    terms[j] = integrand(_abscissa(lower, offset))
+                        + integrand(_abscissa(upper, -offset))
+                }
+            }
+        }
+        // Summing in node order keeps the result independent of scheduling
+        var sum = MPFRFloat(0, precision: precision)
+        for j in 0 ..< count {
+            sum += nodes.weights[j] * terms[j]
+        }
+        return sum
+    }
+
+    /// `endpoint + offset`, exact.
+    ///
+    /// On the tails `offset` falls below the last bit of `endpoint` at the
+    /// working precision, and the rounded sum would be the endpoint itself.
+    /// The sum is instead widened by the gap between their exponents.
+    private static func _abscissa(
+        _ endpoint: MPFRFloat,
+        _ offset: MPFRFloat
+    ) -> MPFRFloat {
+        guard !endpoint.isZero, !offset.isZero else {
+            return endpoint + offset
+        }
+        let gap = Int(mpfr_get_exp(&endpoint._storage.value))
+            - Int(mpfr_get_exp(&offset._storage.value))
+        var wide = MPFRFloat(
+            precision: endpoint.precision + Swift.max(0, gap) + 1
+        )
+        wide.set(endpoint)
+        return wide + offset
+    }
+}
+
+// MARK: - Node Cache
+
+/// The abscissas and weights of one tanh-sinh level.
+///
+/// Level 0 holds the nodes `t = 1, 2, ...`; level `k > 0` holds the new
+/// nodes `t = j · 2^-k` for odd `j`. The center node `t = 0` is implicit.
+/// Instances are immutable once built and shared between threads.
+final class _TanhSinhNodes: @unchecked Sendable {
+    /// `1 - x_j` for each node, in increasing `t`.
+    let complements: [MPFRFloat]
+
+    /// The weight `(π/2) cosh t / cosh²(π/2 sinh t)` for each node.
+    let weights: [MPFRFloat]
+
+    /// The number of nodes.
+    var count: Int {
+        weights.count
+    }
+
+    /// The approximate memory held, in bytes.
+    var byteCount: Int {
+        guard let precision = weights.first?.precision else {
+            return 0
+        }
+        // Significand limbs plus the `mpfr_t` and its storage object
+        let perValue = Int(mpfr_custom_get_size(mpfr_prec_t(precision))) + 64
+        return 2 * count * perValue
+    }
+
+    /// Compute the nodes of a level.
+    ///
+    /// - Parameters:
+    ///   - level: The level.
+    ///   - precision: The precision of the stored values.
+    init(level: Int, precision: Int) {
+        let step = level == 0 ? 1 : 2
+        let first = 1
+        let last = Int(
+            (Self.truncationPoint(precision: precision) * Double(1 << level))
+                .rounded(.up)
+        )
+        let indices = Array(stride(from: first, through: last, by: step))
+        var complements = [MPFRFloat](
+            repeating: MPFRFloat(0, precision: precision),
+            count: indices.count
+        )
+        var weights = complements
+        complements.withUnsafeMutableBufferPointer { c in
+            weights.withUnsafeMutableBufferPointer { w in
+                let (complements, weights) = (c, w)
+                let count = indices.count
+                _forEachChunk(0 ..< count, concurrently: true) { range in
+                    let scratch = _MPFRBuffer(
+                        count: 8,
+                        precision: precision + TanhSinhQuadrature.guardBits
+                    )
+                    for k in range {
+                        Self.computeNode(
+                            indices[k],
+                            level: level,
+                            scratch: scratch
+                        )
+                        complements[k] = scratch.float(
+                            at: 0,
+                            precision: precision
+                        )
+                        weights[k] = scratch.float(at: 1, precision: precision)
+                    }
+                }
+            }
+        }
+        self.complements = complements
+        self.weights = weights
+    }
+
+    /// The `t` beyond which every weight is below `2^-(precision + guard)`.
+    ///
+    /// Uses `w(t) ≈ 2π cosh t · e^(-π sinh t)`, accurate once `t > 1`.
+    static func truncationPoint(precision: Int) -> Double {
+        let target = -Double(precision + TanhSinhQuadrature.guardBits)
+        var t = 1.0
+        while log2(2 * Double.pi * cosh(t)) - Double.pi * sinh(t) / M_LN2
+            > target
+        {
+            t += 0.125
+        }
+        return t
+    }
+
+    /// Compute `1 - x` into `scratch[0]` and the weight into `scratch[1]` for
+    /// `t = index · 2^-level`.
+    static func computeNode(_ index: Int, level: Int, scratch: _MPFRBuffer) {
+        let complement = scratch[0]
+        let weight = scratch[1]
+        let et = scratch[2]
+        let sinhT = scratch[3]
+        let coshT = scratch[4]
+        let ev2 = scratch[5]
+        let piOver2 = scratch[6]
+        let denominator = scratch[7]
+
+        mpfr_const_pi(piOver2, MPFR_RNDN)
+        mpfr_div_2ui(piOver2, piOver2, 1, MPFR_RNDN)
+
+        // e^t, then sinh t and cosh t
+        mpfr_set_ui_2exp(et, CUnsignedLong(index), -level, MPFR_RNDN)
+        mpfr_exp(et, et, MPFR_RNDN)
+        mpfr_ui_div(sinhT, 1, et, MPFR_RNDN)
+        mpfr_add(coshT, et, sinhT, MPFR_RNDN)
+        mpfr_sub(sinhT, et, sinhT, MPFR_RNDN)
+        mpfr_div_2ui(coshT, coshT, 1, MPFR_RNDN)
+        mpfr_div_2ui(sinhT, sinhT, 1, MPFR_RNDN)
+
+        // e^(2v) with v = (π/2) sinh t
+        mpfr_mul(ev2, piOver2, sinhT, MPFR_RNDN)
+        mpfr_mul_2ui(ev2, ev2, 1, MPFR_RNDN)
+        mpfr_exp(ev2, ev2, MPFR_RNDN)
+
+        // 1 - tanh v = 2 / (e^(2v) + 1)
+        mpfr_add_ui(denominator, ev2, 1, MPFR_RNDN)
+        mpfr_ui_div(complement, 2, denominator, MPFR_RNDN)
+
+        // (π/2) cosh t / cosh² v = 2π cosh t · e^(2v) / (e^(2v) + 1)²
+        mpfr_sqr(denominator, denominator, MPFR_RNDN)
+        mpfr_mul(weight, piOver2, coshT, MPFR_RNDN)
+        mpfr_mul(weight, weight, ev2, MPFR_RNDN)
+        mpfr_div(weight, weight, denominator, MPFR_RNDN)
+        mpfr_mul_2ui(weight, weight, 2, MPFR_RNDN)
+    }
+}
+
+/// The process-wide cache of tanh-sinh nodes, keyed by precision and level.
+///
+/// The cache is managed by `GMPCacheRegistry.shared`, so levels may be
+/// evicted under a byte budget and are recomputed on next use.
+final class _TanhSinhNodeCache: GMPManagedCache, @unchecked Sendable {
+    /// The shared cache, registered with the shared registry.
+    static let shared: _TanhSinhNodeCache = {
+        let cache = _TanhSinhNodeCache()
+        GMPCacheRegistry.shared.register(cache)
+        _ = MPFRFloat._cacheTrimHandler
+        return cache
+    }()
+
+    /// A cache key.
+    struct Key: Hashable {
+        let precision: Int
+        let level: Int
+    }
+
+    /// A cached level with its accounting.
+    struct Entry {
+        let nodes: _TanhSinhNodes
+        let byteCount: Int
+
+        /// The time taken to compute the level, in nanoseconds.
+        let cost: Double
+
+        var priority: Double
+    }
+
+    /// Guards `entries`.
+    private let lock = NSLock()
+
+    /// The cached levels.
+    private var entries: [Key: Entry] = [:]
+
+    let cacheName = "TanhSinhQuadrature.nodes"
+
+    /// The nodes for a level, computing them on first use.
+    ///
+    /// Computation happens outside the lock, so concurrent callers never wait
+    /// on each other's node computation; if two threads race on the same key,
+    /// the first result stored wins.
+    func nodes(level: Int, precision: Int) -> _TanhSinhNodes {
+        let key = Key(precision: precision, level: level)
+        let registry = GMPCacheRegistry.shared
+        lock.lock()
+        let cached = entries[key]
+        lock.unlock()
+        if let cached {
+            let priority = registry.priority(
+                cost: cached.cost,
+                byteCount: cached.byteCount
+            )
+            lock.lock()
+            entries[key]?.priority = priority
+            lock.unlock()
+            return cached.nodes
+        }
+        let start = DispatchTime.now().uptimeNanoseconds
+        let computed = _TanhSinhNodes(level: level, precision: precision)
+        let cost = Double(DispatchTime.now().uptimeNanoseconds - start)
+        let byteCount = computed.byteCount
+        let entry = Entry(
+            nodes: computed,
+            byteCount: byteCount,
+            cost: cost,
+            priority: registry.priority(cost: cost, byteCount: byteCount)
+        )
+        lock.lock()
+        if let existing = entries[key] {
+            lock.unlock()
+            return existing.nodes
+        }
+        entries[key] = entry
+        lock.unlock()
+        registry.didGrow()
+        return computed
+    }
+
+    /// Remove every cached level.
+    func removeAll() {
+        lock.lock()
+        defer { lock.unlock() }
+        entries.removeAll()
+    }
+
+    // MARK: - GMPManagedCache
+
+    func cacheEntries() -> [GMPCacheEntry] {
+        lock.lock()
+        defer { lock.unlock() }
+        return entries.map { key, entry in
+            GMPCacheEntry(
+                key: key,
+                byteCount: entry.byteCount,
+                priority: entry.priority
+            )
+        }
+    }
+
+    func evictCacheEntries(_ keys: [AnyHashable]) {
+        lock.lock()
+        defer { lock.unlock() }
+        for case let key as Key in keys {
+            entries[key] = nil
+        }
+    }
+
+    func removeAllCacheEntries() {
+        removeAll()
+    }
+}
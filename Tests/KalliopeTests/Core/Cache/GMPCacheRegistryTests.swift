@@ -0,0 +1,170 @@
+import Foundation
+@testable import Kalliope
+import Testing
+
+/// A cache of fixed-size entries for exercising the registry.
+private final class TestCache: GMPManagedCache, @unchecked Sendable {
+    let cacheName: String
+    private let lock = NSLock()
+    private var entries: [Int: GMPCacheEntry] = [:]
+
+    init(name: String) {
+        cacheName = name
+    }
+
+    func insert(
+        _ key: Int,
+        bytes: Int,
+        cost: Double,
+        in registry: GMPCacheRegistry
+    ) {
+        let priority = registry.priority(cost: cost, byteCount: bytes)
+        lock.lock()
+        entries[key] = GMPCacheEntry(
+            key: key,
+            byteCount: bytes,
+            priority: priority
+        )
+        lock.unlock()
+        registry.didGrow()
+    }
+
+    var keys: Set<Int> {
+        lock.lock()
+        defer { lock.unlock() }
+        return Set(entries.keys)
+    }
+
+    func cacheEntries() -> [GMPCacheEntry] {
+        lock.lock()
+        defer { lock.unlock() }
+        return Array(entries.values)
+    }
+
+    func evictCacheEntries(_ keys: [AnyHashable]) {
+        lock.lock()
+        defer { lock.unlock() }
+        for case let key as Int in keys {
+            entries[key] = nil
+        }
+    }
+
+    func removeAllCacheEntries() {
+        lock.lock()
+        defer { lock.unlock() }
+        entries.removeAll()
+    }
+}
+
+struct GMPCacheRegistryTests {
+    @Test
+    func didGrow_OverBudget_EvictsLowestPriorityAcrossCaches() async throws {
+        // Given: Two caches under a 300-byte budget
+        let registry = GMPCacheRegistry()
+        let a = TestCache(name: "a")
+        let b = TestCache(name: "b")
+        registry.register(a)
+        registry.register(b)
+        registry.byteBudget = 300
+
+        // When: Adding a cheap entry, then two expensive ones
+        a.insert(1, bytes: 100, cost: 100, in: registry)
+        b.insert(2, bytes: 100, cost: 10000, in: registry)
+        a.insert(3, bytes: 100, cost: 10000, in: registry)
+        b.insert(4, bytes: 100, cost: 10000, in: registry)
+
+        // Then: Only the cheapest entry was evicted
+        #expect(a.keys == [3])
+        #expect(b.keys == [2, 4])
+        #expect(registry.totalByteCount == 300)
+    }
+
+    @Test
+    func priority_AfterEviction_FavorsRecentlyUsedEntries() async throws {
+        // Given: Equal-cost entries, with an eviction raising inflation
+        let registry = GMPCacheRegistry()
+        let cache = TestCache(name: "lru")
+        registry.register(cache)
+        registry.byteBudget = 200
+        cache.insert(1, bytes: 100, cost: 100, in: registry)
+        cache.insert(2, bytes: 100, cost: 100, in: registry)
+        cache.insert(3, bytes: 100, cost: 100, in: registry)
+        let survivor = cache.keys.sorted().first!
+
+        // When: Using the survivor again, then adding another entry
+        cache.insert(survivor, bytes: 100, cost: 100, in: registry)
+        cache.insert(4, bytes: 100, cost: 100, in: registry)
+
+        // Then: The refreshed entry survives
+        #expect(cache.keys.contains(survivor))
+        #expect(cache.keys.count == 2)
+    }
+
+    @Test
+    func trimAll_EmptiesCachesAndRunsHandlers() async throws {
+        // Given: A cache with entries and a trim handler
+        let registry = GMPCacheRegistry()
+        let cache = TestCache(name: "c")
+        registry.register(cache)
+        cache.insert(1, bytes: 64, cost: 1, in: registry)
+        let ran = Counter()
+        registry.addTrimHandler(named: "count") { ran.increment() }
+
+        // When: Trimming everything
+        registry.trimAll()
+
+        // Then: The cache is empty and the handler ran once
+        #expect(cache.keys.isEmpty)
+        #expect(ran.value == 1)
+        #expect(registry.statistics().map(\.entryCount) == [0])
+    }
+
+    @Test
+    func trim_ToTarget_ReportsReleasedBytes() async throws {
+        // Given: 400 bytes of entries and no budget
+        let registry = GMPCacheRegistry()
+        let cache = TestCache(name: "t")
+        registry.register(cache)
+        for key in 0 ..< 4 {
+            cache.insert(key, bytes: 100, cost: 1, in: registry)
+        }
+
+        // When: Trimming to 250 bytes
+        let released = registry.trim(toBytes: 250)
+
+        // Then: Two entries are released
+        #expect(released == 200)
+        #expect(registry.totalByteCount == 200)
+    }
+
+    @Test
+    func register_ReleasedCache_IsDropped() async throws {
+        // Given: A registered cache that is then released
+        let registry = GMPCacheRegistry()
+        do {
+            let cache = TestCache(name: "gone")
+            registry.register(cache)
+            cache.insert(1, bytes: 10, cost: 1, in: registry)
+        }
+
+        // When/Then: The registry no longer reports it
+        #expect(registry.statistics().isEmpty)
+    }
+}
+
+private final class Counter: @unchecked Sendable {
+    private let lock = NSLock()
+    private var _value = 0
+
+    var value: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return _value
+    }
+
+    func increment() {
+        lock.lock()
+        _value += 1
+        lock.unlock()
+    }
+}
@@ -0,0 +1,116 @@
+@testable import Kalliope
+import Testing
+
+@Suite(.serialized)
+struct GMPDiscreteLogarithmTests {
+    /// A prime `p = kq + 1` and an element of order `q`, where `q` is the
+    /// first prime of `bits` bits.
+    private func subgroup(
+        bits: Int
+    ) -> (p: GMPInteger, q: GMPInteger, g: GMPInteger) {
+        let q = (GMPInteger(1) << (bits - 1)).nextPrime
+        var k = 2
+        while (q * k + 1).isProbablePrime() == 0 {
+            k += 2
+        }
+        let p = q * k + 1
+        var base = 2
+        var g = GMPInteger(base).raisedToPower(GMPInteger(k), modulo: p)
+        while g == 1 {
+            base += 1
+            g = GMPInteger(base).raisedToPower(GMPInteger(k), modulo: p)
+        }
+        return (p, q, g)
+    }
+
+    @Test
+    func logarithm_SmoothOrder_RecoversExponents() async throws {
+        // Given: The primitive root 3 modulo 65537, whose order is 2^16
+        let p = GMPInteger(65537)
+        let log = GMPDiscreteLogarithm(base: 3, modulus: p, order: p - 1)
+
+        // When/Then: Every tested exponent is recovered
+        #expect(log.factors.count == 1)
+        for x in [0, 1, 2, 12345, 40000, 65535] {
+            let h = GMPInteger(3).raisedToPower(x, modulo: p)
+            #expect(log.logarithm(of: h) == GMPInteger(x))
+        }
+    }
+
+    @Test
+    func logarithm_MixedOrder_CombinesPrimePowers() async throws {
+        // Given: 2^127 - 1, whose predecessor has many small prime factors,
+        // and 9, whose order (p - 1)/6 is given only as the multiple
+        // (p - 1)/2 with one factor of 3 too many
+        let p = (GMPInteger(1) << 127) - 1
+        let order = (p - 1) / 2
+        let base = GMPInteger(9)
+        let log = GMPDiscreteLogarithm(base: base, modulus: p, order: order)
+        #expect(log.order == (p - 1) / 6)
+        let x = GMPInteger(0x1234_5678_9ABC_DEF0) * 1_000_003 % order
+
+        // When: Taking the logarithm of a power of the base
+        let result = log.logarithm(of: base.raisedToPower(x, modulo: p))
+
+        // Then: The result reproduces the power
+        let found = try #require(result)
+        #expect(base.raisedToPower(found, modulo: p)
+            == base.raisedToPower(x, modulo: p))
+    }
+
+    @Test(.exclusiveTuning)
+    func logarithm_PrimeSubgroup_RhoAndBabyStepAgree() async throws {
+        // Given: A subgroup of 32-bit prime order
+        let (p, q, g) = subgroup(bits: 32)
+        let x = q - 12345
+        let h = g.raisedToPower(x, modulo: p)
+        let log = GMPDiscreteLogarithm(
+            base: g,
+            modulus: p,
+            order: q,
+            factors: [(q, 1)]
+        )
+
+        // When: Solving with each algorithm
+        let rho = GMPTuning.withValue(0, for: .discreteLogarithmRhoThreshold) {
+            log.logarithm(of: h)
+        }
+        let babyStep = GMPTuning.withValue(
+            Int.max,
+            for: .discreteLogarithmRhoThreshold
+        ) {
+            log.logarithm(of: h)
+        }
+
+        // Then: Both find the exponent
+        #expect(rho == x)
+        #expect(babyStep == x)
+    }
+
+    @Test
+    func logarithm_ValueOutsideSubgroup_ReturnsNil() async throws {
+        // Given: A subgroup of odd prime order and -1, which has order 2
+        let (p, q, g) = subgroup(bits: 20)
+        let log = GMPDiscreteLogarithm(base: g, modulus: p, order: q)
+
+        // When/Then: No logarithm exists
+        #expect(log.logarithm(of: p - 1) == nil)
+        #expect(log.logarithm(of: 0) == nil)
+    }
+
+    @Test
+    func fingerprintTable_DuplicateKeys_ReturnsAllValues() async throws {
+        // Given: A table with a repeated key
+        var table = _GMPFingerprintTable(capacity: 4)
+        table.insert(42, 1)
+        table.insert(7, 2)
+        table.insert(42, 3)
+
+        // When: Looking up the repeated key
+        var values: [UInt32] = []
+        table.forEach(matching: 42) { values.append($0) }
+
+        // Then: Every value stored under it is found
+        #expect(values.sorted() == [1, 3])
+    }
+}
@@ -0,0 +1,101 @@
+@testable import Kalliope
+import Testing
+
+struct DoubleDoubleTests {
+    @Test
+    func initInt_LargeValue_IsExact() async throws {
+        // Given: Integers that do not fit in a Double's 53-bit significand
+        let values = [Int.max, Int.min, (1 << 60) + 1, -((1 << 55) + 3)]
+
+        for value in values {
+            // When: Converting to DoubleDouble
+            let dd = DoubleDouble(value)
+
+            // Then: Converting back through GMPInteger is exact
+            #expect(dd.roundedToGMPInteger() == GMPInteger(value))
+        }
+    }
+
+    @Test
+    func initGMPInteger_WideValue_Keeps106Bits() async throws {
+        // Given: 2^100 + 1, which needs 101 bits
+        let value = GMPInteger(1).leftShifted(by: 100) + GMPInteger(1)
+
+        // When: Converting to DoubleDouble
+        let dd = DoubleDouble(value)
+
+        // Then: The low bit survives in the trailing component
+        #expect(dd.high == 0x1p100)
+        #expect(dd.low == 1)
+        #expect(dd.roundedToGMPInteger() == value)
+    }
+
+    @Test
+    func addition_InexactSum_CapturesRoundingError() async throws {
+        // Given: 1 and 2^-80, whose sum is not representable in a Double
+        let a = DoubleDouble(1.0)
+        let b = DoubleDouble(0x1p-80)
+
+        // When: Adding
+        let sum = a + b
+
+        // Then: The small term is kept in the trailing component
+        #expect(sum.high == 1.0)
+        #expect(sum.low == 0x1p-80)
+        #expect((sum - a) == b)
+    }
+
+    @Test
+    func multiplication_DoubleOperands_IsExact() async throws {
+        // Given: Two 53-bit values whose product needs 106 bits
+        let a = DoubleDouble(Double((1 << 53) - 1))
+        let b = DoubleDouble(Double((1 << 53) - 3))
+
+        // When: Multiplying
+        let product = a * b
+
+        // Then: The product equals the exact integer product
+        let expected = GMPInteger((1 << 53) - 1) * GMPInteger((1 << 53) - 3)
+        #expect(product.roundedToGMPInteger() == expected)
+    }
+
+    @Test
+    func divisionAndSquareRoot_Irrational_ReachDoubleDoubleAccuracy()
+        async throws
+    {
+        // Given: 1/3 and sqrt(2)
+        let third = DoubleDouble(1) / DoubleDouble(3)
+        let root = DoubleDouble(2).squareRoot()
+
+        // When: Reversing the operations
+        let backToOne = third * DoubleDouble(3)
+        let backToTwo = root * root
+
+        // Then: The residual error is far below Double precision
+        #expect((backToOne - DoubleDouble(1)).toDouble().magnitude < 1e-30)
+        #expect((backToTwo - DoubleDouble(2)).toDouble().magnitude < 1e-30)
+    }
+
+    @Test
+    func rounded_HalfwayLeading_UsesTrailingComponent() async throws {
+        // Given: 2.5 - 2^-60, which looks like a tie in the leading component
+        let value = DoubleDouble(high: 2.5, low: -0x1p-60)
+
+        // When: Rounding
+        let rounded = value.rounded()
+
+        // Then: It rounds down, since the true value is below 2.5
+        #expect(rounded == DoubleDouble(2))
+    }
+
+    @Test
+    func comparison_EqualLeading_OrdersByTrailing() async throws {
+        // Given: Two values equal in the leading component
+        let a = DoubleDouble(high: 1, low: 0x1p-70)
+        let b = DoubleDouble(high: 1, low: -0x1p-70)
+
+        // When/Then: The trailing components decide the order
+        #expect(b < a)
+        #expect(a != b)
+    }
+}
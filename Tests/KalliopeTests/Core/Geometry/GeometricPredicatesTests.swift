@@ -0,0 +1,151 @@
+@testable import Kalliope
+import Testing
+
+/// Tests for the adaptive exact geometric predicates.
+struct GeometricPredicatesTests {
+    /// The exact sign of orient2d, computed in rationals.
+    private func exactOrient2d(
+        _ a: SIMD2<Double>,
+        _ b: SIMD2<Double>,
+        _ c: SIMD2<Double>
+    ) -> Int {
+        func q(_ x: Double) -> GMPRational {
+            GMPRational(x)
+        }
+        let det = (q(a.x) - q(c.x)) * (q(b.y) - q(c.y))
+            - (q(a.y) - q(c.y)) * (q(b.x) - q(c.x))
+        return det.sign
+    }
+
+    // MARK: - orient2d
+
+    @Test
+    func orient2d_SimpleTriangles_ReturnsOrientation() async throws {
+        // Given: A counterclockwise triangle
+        let a = SIMD2<Double>(0, 0)
+        let b = SIMD2<Double>(1, 0)
+        let c = SIMD2<Double>(0, 1)
+
+        // When / Then: Reversing the order flips the sign
+        #expect(GeometricPredicates.orient2d(a, b, c) == 1)
+        #expect(GeometricPredicates.orient2d(a, c, b) == -1)
+        #expect(GeometricPredicates.orient2d(a, b, SIMD2(2, 0)) == 0)
+    }
+
+    @Test
+    func orient2d_NearlyCollinear_MatchesRationalSign() async throws {
+        // Given: Points perturbed by single ulps around the line y = x,
+        // where the Double determinant is mostly rounding noise
+        let b = SIMD2<Double>(12, 12)
+        let c = SIMD2<Double>(24, 24)
+        var base = SIMD2<Double>(0.5, 0.5)
+        for i in 0 ..< 16 {
+            base.y = 0.5
+            for j in 0 ..< 16 {
+                // When: Evaluating the adaptive predicate
+                let sign = GeometricPredicates.orient2d(base, b, c)
+
+                // Then: It agrees with exact rational arithmetic
+                #expect(sign == exactOrient2d(base, b, c), "\(i), \(j)")
+                base.y = base.y.nextUp
+            }
+            base.x = base.x.nextUp
+        }
+    }
+
+    @Test
+    func orient2d_ExtremeMagnitudes_FallsBackToExactPaths() async throws {
+        // Given: Collinear points near the bottom of the Double range,
+        // which need rescaling, and points spanning 400 binades, which
+        // need integers
+        let tiny = 0x1p-1000
+        let small = [
+            SIMD2(tiny, tiny), SIMD2(2 * tiny, 2 * tiny),
+            SIMD2(3 * tiny, 3 * tiny),
+        ]
+        let wide = [
+            SIMD2<Double>(0, 0), SIMD2(0x1p200, 0x1p200),
+            SIMD2(0x1p-200, 0x1p-200),
+        ]
+
+        // When / Then: Exact collinearity and one-ulp perturbations are
+        // resolved correctly
+        #expect(GeometricPredicates.orient2d(small[0], small[1], small[2])
+            == 0)
+        #expect(GeometricPredicates.orient2d(wide[0], wide[1], wide[2]) == 0)
+        let nudged = SIMD2(wide[2].x, wide[2].y.nextUp)
+        #expect(GeometricPredicates.orient2d(wide[0], wide[1], nudged)
+            == exactOrient2d(wide[0], wide[1], nudged))
+        #expect(GeometricPredicates.orient2d(wide[0], wide[1], nudged) == 1)
+    }
+
+    // MARK: - orient3d, inCircle, inSphere
+
+    @Test
+    func orient3d_PointAbovePlane_IsNegative() async throws {
+        // Given: A counterclockwise triangle in the plane z = 0
+        let a = SIMD3<Double>(0, 0, 0)
+        let b = SIMD3<Double>(1, 0, 0)
+        let c = SIMD3<Double>(0, 1, 0)
+
+        // When / Then: Above is negative, below positive, on it zero
+        #expect(GeometricPredicates.orient3d(a, b, c, SIMD3(0, 0, 1)) == -1)
+        #expect(GeometricPredicates.orient3d(a, b, c, SIMD3(0, 0, -1)) == 1)
+        #expect(GeometricPredicates.orient3d(a, b, c, SIMD3(5, 7, 0)) == 0)
+    }
+
+    @Test
+    func inCircle_UnitCircle_ClassifiesPoints() async throws {
+        // Given: Three counterclockwise points on the unit circle
+        let a = SIMD2<Double>(1, 0)
+        let b = SIMD2<Double>(0, 1)
+        let c = SIMD2<Double>(-1, 0)
+
+        // When / Then: The center is inside, (0, -1) is on the circle and
+        // the next Double below it is outside
+        #expect(GeometricPredicates.inCircle(a, b, c, SIMD2(0, 0)) == 1)
+        #expect(GeometricPredicates.inCircle(a, b, c, SIMD2(0, -1)) == 0)
+        let below = SIMD2<Double>(0, (-1.0).nextDown)
+        #expect(GeometricPredicates.inCircle(a, b, c, below) == -1)
+    }
+
+    @Test
+    func inSphere_UnitSphere_ClassifiesPoints() async throws {
+        // Given: Four points on the unit sphere with positive orientation
+        let a = SIMD3<Double>(1, 0, 0)
+        let b = SIMD3<Double>(0, 1, 0)
+        let c = SIMD3<Double>(-1, 0, 0)
+        let d = SIMD3<Double>(0, 0, -1)
+        #expect(GeometricPredicates.orient3d(a, b, c, d) == 1)
+
+        // When / Then: Inside, on and just outside the sphere
+        #expect(GeometricPredicates.inSphere(a, b, c, d, SIMD3(0, 0, 0)) == 1)
+        #expect(GeometricPredicates.inSphere(a, b, c, d, SIMD3(0, 0, 1)) == 0)
+        let above = SIMD3<Double>(0, 0, (1.0).nextUp)
+        #expect(GeometricPredicates.inSphere(a, b, c, d, above) == -1)
+    }
+
+    // MARK: - Batches
+
+    @Test
+    func orient2d_Batch_MatchesScalarEvaluation() async throws {
+        // Given: More nearly collinear triples than one batch chunk
+        let count = 2 * GeometricPredicates.batchChunk + 17
+        var generator = SystemRandomNumberGenerator()
+        let a = (0 ..< count).map { _ in
+            let x = Double.random(in: 0 ..< 1, using: &generator)
+            return SIMD2(x, x.nextUp)
+        }
+        let b = [SIMD2<Double>](repeating: SIMD2(3, 3), count: count)
+        let c = [SIMD2<Double>](repeating: SIMD2(7, 7), count: count)
+
+        // When: Evaluating the batch
+        let signs = GeometricPredicates.orient2d(a, b, c)
+
+        // Then: Every entry matches the exact sign
+        #expect(signs.count == count)
+        for i in stride(from: 0, to: count, by: 97) {
+            #expect(signs[i] == exactOrient2d(a[i], b[i], c[i]))
+        }
+    }
+}
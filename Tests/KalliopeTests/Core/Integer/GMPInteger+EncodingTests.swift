@@ -0,0 +1,166 @@
+import Foundation
+@testable import Kalliope
+import Testing
+
+struct GMPIntegerEncodingTests {
+    /// Integers whose byte counts cover every remainder modulo 8 and 12, so
+    /// both the vector loops and the byte-at-a-time tails run.
+    private var samples: [GMPInteger] {
+        var state: UInt64 = 0x2545_F491_4F6C_DD1D
+        return (0 ..< 60).map { bytes in
+            var value = GMPInteger(0)
+            for _ in 0 ..< bytes {
+                state ^= state << 13
+                state ^= state >> 7
+                state ^= state << 17
+                // The top byte is nonzero, so the byte count is exact
+                let byte = value.isZero
+                    ? Int(state % 255) + 1 : Int(state & 0xFF)
+                value = value << 8 + GMPInteger(byte)
+            }
+            return value
+        }
+    }
+
+    /// The magnitude's bytes, most significant first.
+    private func bigEndianBytes(_ value: GMPInteger) -> [UInt8] {
+        (0 ..< value.byteCount).reversed().map { i in
+            UInt8(try! (value >> (8 * i)).floorRemainder(dividingBy: 256))
+        }
+    }
+
+    // MARK: - Hex
+
+    @Test
+    func hexEncoded_KnownValues_MatchString() async throws {
+        // Given: Small values
+        let value = GMPInteger(0xDEAD_BEEF)
+
+        // Then: Digits match, with a leading zero nibble kept
+        #expect(value.hexEncoded() == "deadbeef")
+        #expect(value.hexEncoded(uppercase: true) == "DEADBEEF")
+        #expect(value.hexEncoded(endian: .little) == "efbeadde")
+        #expect(GMPInteger(0x0ABC).hexEncoded() == "0abc")
+        #expect(GMPInteger(0).hexEncoded() == "")
+        #expect(GMPInteger(-255).hexEncoded() == "ff")
+    }
+
+    @Test
+    func hexEncoded_AllSizes_MatchBaseSixteen() async throws {
+        for value in samples {
+            // When: Encoding big-endian
+            let hex = value.hexEncoded()
+
+            // Then: The digits are the base-16 string padded to whole bytes
+            var expected = value.isZero ? "" : value.toString(base: 16)
+            if expected.count % 2 == 1 {
+                expected = "0" + expected
+            }
+            #expect(hex == expected)
+            #expect(hex.utf8.count == value.hexEncodedLength)
+        }
+    }
+
+    @Test
+    func hexDecode_AllSizesAndOrders_RoundTrip() async throws {
+        for value in samples {
+            for endian in [GMPInteger.Endianness.big, .little, .native] {
+                // When: Encoding and decoding, in both cases
+                let hex = value.hexEncoded(endian: endian)
+
+                // Then: The value is recovered
+                #expect(GMPInteger(hex: hex, endian: endian) == value)
+                #expect(
+                    GMPInteger(hex: hex.uppercased(), endian: endian) == value
+                )
+            }
+        }
+    }
+
+    @Test
+    func hexDecode_InvalidInput_ReturnsNil() async throws {
+        // Given: A long valid string
+        let hex = samples[40].hexEncoded()
+
+        // Then: Odd lengths and non-digits in vector and tail positions fail
+        #expect(GMPInteger(hex: String(hex.dropLast())) == nil)
+        #expect(GMPInteger(hex: "g" + String(hex.dropFirst())) == nil)
+        #expect(GMPInteger(hex: String(hex.dropLast()) + "/") == nil)
+        #expect(GMPInteger(hex: "00ff")! == 255)
+        #expect(GMPInteger(hex: "")! == 0)
+    }
+
+    @Test
+    func encodeHex_CallerBuffer_WritesExactLength() async throws {
+        // Given: A buffer with room to spare
+        let value = samples[37]
+        var buffer = [UInt8](
+            repeating: 0x2A,
+            count: value.hexEncodedLength + 4
+        )
+
+        // When: Encoding into it
+        let written = buffer.withUnsafeMutableBytes {
+            value.encodeHex(into: $0)
+        }
+
+        // Then: Exactly the digits are written
+        #expect(written == value.hexEncodedLength)
+        #expect(
+            String(decoding: buffer.prefix(written), as: UTF8.self)
+                == value.hexEncoded()
+        )
+        #expect(buffer.suffix(4).allSatisfy { $0 == 0x2A })
+    }
+
+    // MARK: - Base64
+
+    @Test
+    func base64Encoded_AllSizesAndOrders_MatchFoundation() async throws {
+        for value in samples {
+            // Given: The bytes in each order
+            let bytes = bigEndianBytes(value)
+
+            // Then: The encodings match Foundation's
+            #expect(
+                value.base64Encoded() == Data(bytes).base64EncodedString()
+            )
+            #expect(
+                value.base64Encoded(endian: .little)
+                    == Data(bytes.reversed()).base64EncodedString()
+            )
+            #expect(
+                value.base64Encoded().utf8.count == value.base64EncodedLength
+            )
+        }
+    }
+
+    @Test
+    func base64Decode_AllSizesAndOrders_RoundTrip() async throws {
+        for value in samples {
+            for endian in [GMPInteger.Endianness.big, .little] {
+                // When: Encoding and decoding
+                let text = value.base64Encoded(endian: endian)
+
+                // Then: The value is recovered
+                #expect(GMPInteger(base64: text, endian: endian) == value)
+            }
+        }
+    }
+
+    @Test
+    func base64Decode_InvalidInput_ReturnsNil() async throws {
+        // Given: A long valid string
+        let text = samples[50].base64Encoded()
+
+        // Then: Bad characters, misplaced padding, bad lengths and nonzero
+        // trailing bits fail
+        #expect(GMPInteger(base64: "-" + String(text.dropFirst())) == nil)
+        #expect(GMPInteger(base64: "=" + String(text.dropFirst())) == nil)
+        #expect(GMPInteger(base64: String(text.dropLast())) == nil)
+        #expect(GMPInteger(base64: "3q2+7x==") == nil)
+        #expect(GMPInteger(base64: "====") == nil)
+        #expect(GMPInteger(base64: "3q2+7w==")! == 0xDEAD_BEEF)
+        #expect(GMPInteger(base64: "")! == 0)
+    }
+}
@@ -0,0 +1,75 @@
+@testable import Kalliope
+import Testing
+
+struct GMPModularContextTests {
+    /// A 521-bit modulus (2^521 - 1, a Mersenne prime).
+    private static let modulus = (GMPInteger(1) << 521) - 1
+
+    @Test
+    func multiply_MatchesReduction() async throws {
+        // Given: A context and two residues
+        let m = Self.modulus
+        let context = GMPModularContext(modulus: m)
+        let a = GMPInteger(3).raisedToPower(300) % m
+        let b = GMPInteger(7).raisedToPower(180) % m
+
+        // When: Multiplying through the context
+        let product = context.multiplied(a, b)
+
+        // Then: The result matches reducing the full product
+        #expect(product == (a * b) % m)
+    }
+
+    @Test
+    func multiply_IntoOperand_UpdatesInPlace() async throws {
+        // Given: A running product that is also an operand
+        let m = Self.modulus
+        let context = GMPModularContext(modulus: m)
+        let g = GMPInteger(5)
+        var x = GMPInteger(1)
+
+        // When: Multiplying into the running product repeatedly
+        for _ in 0 ..< 1000 {
+            context.multiply(x, g, into: &x)
+        }
+
+        // Then: The result is the corresponding power
+        #expect(x == g.raisedToPower(1000, modulo: m))
+    }
+
+    @Test
+    func multiply_IntoOperand_LeavesCopiesUnchanged() async throws {
+        // Given: A running product with copies taken along the way
+        let m = Self.modulus
+        let context = GMPModularContext(modulus: m)
+        let g = GMPInteger(3).raisedToPower(200) % m
+        var x = g
+        var copies: [GMPInteger] = []
+
+        // When: Multiplying into it and keeping each intermediate value
+        for _ in 0 ..< 4 {
+            copies.append(x)
+            context.multiply(x, x, into: &x)
+        }
+
+        // Then: Every copy still holds its own repeated square
+        for (i, copy) in copies.enumerated() {
+            #expect(copy == g.raisedToPower(1 << i, modulo: m))
+        }
+        #expect(x == g.raisedToPower(16, modulo: m))
+    }
+
+    @Test
+    func reduceAndInverse_EdgeCases() async throws {
+        // Given: A context for a composite modulus
+        let context = GMPModularContext(modulus: 15)
+
+        // When/Then: Negative values reduce into range and non-units have
+        // no inverse
+        #expect(context.reduce(-4) == 11)
+        #expect(context.inverse(of: 2) == 8)
+        #expect(context.inverse(of: 6) == nil)
+        #expect(context._fingerprint(0) == 0)
+        #expect(context._fingerprint(14) == 14)
+    }
+}
@@ -0,0 +1,115 @@
+@testable import Kalliope
+import Testing
+
+struct GMPSecureModularContextTests {
+    /// A 521-bit odd modulus (2^521 - 1, a Mersenne prime).
+    private static let modulus = GMPInteger(1).leftShifted(by: 521)
+        - GMPInteger(1)
+
+    @Test
+    func raisedToPower_LargeOperands_MatchesPowm() async throws {
+        // Given: A context for an odd modulus, a base and an exponent
+        let m = Self.modulus
+        let context = GMPSecureModularContext(modulus: m)
+        let base = GMPInteger(3).raisedToPower(300)
+        let exponent = GMPInteger(65537)
+
+        // When: Computing the power through the context
+        let result = context.raisedToPower(base, exponent)
+
+        // Then: The result matches the variable-time path
+        #expect(result == base.raisedToPower(exponent, modulo: m))
+    }
+
+    @Test
+    func raisedToPowerInto_RepeatedCalls_ReusesResult() async throws {
+        // Given: A context and a result variable
+        let m = Self.modulus
+        let context = GMPSecureModularContext(modulus: m)
+        var result = GMPInteger()
+
+        // When: Computing several powers into the same result
+        for k in 1 ... 5 {
+            let base = GMPInteger(k + 1)
+            let exponent = GMPInteger(k * 1000 + 1)
+            context.raisedToPower(base, exponent, into: &result)
+
+            // Then: Each result is correct
+            #expect(result == base.raisedToPower(exponent, modulo: m))
+        }
+    }
+
+    @Test
+    func multiply_DoubleWidthProduct_IsReduced() async throws {
+        // Given: Operands wider than the modulus
+        let m = Self.modulus
+        let context = GMPSecureModularContext(modulus: m)
+        let a = GMPInteger(7).raisedToPower(300) // about 843 bits
+        let b = GMPInteger(11).raisedToPower(150) // about 519 bits
+
+        // When: Multiplying modulo m
+        let product = context.multiplied(a, b)
+
+        // Then: The product matches mpz arithmetic
+        #expect(try product == (a * b).modulo(m))
+    }
+
+    @Test
+    func addAndSubtract_PastModulus_WrapAround() async throws {
+        // Given: Values close to the modulus
+        let m = Self.modulus
+        let context = GMPSecureModularContext(modulus: m)
+        let a = m - GMPInteger(3)
+        let b = GMPInteger(10)
+        var sum = GMPInteger()
+        var difference = GMPInteger()
+
+        // When: Adding and subtracting
+        context.add(a, b, into: &sum)
+        context.subtract(b, a, into: &difference)
+
+        // Then: Results are reduced into 0 ..< m
+        #expect(sum == GMPInteger(7))
+        #expect(difference == GMPInteger(13))
+    }
+
+    @Test
+    func inverse_Unit_MatchesModularInverse() async throws {
+        // Given: An invertible value
+        let m = Self.modulus
+        let context = GMPSecureModularContext(modulus: m)
+        let value = GMPInteger(123_456_789)
+
+        // When: Inverting
+        let inverse = try context.inverse(of: value)
+
+        // Then: value * inverse == 1 mod m
+        #expect(try (value * inverse).modulo(m) == GMPInteger(1))
+        #expect(inverse == value.modularInverse(modulo: m))
+    }
+
+    @Test
+    func inverse_NonUnit_Throws() async throws {
+        // Given: A composite modulus and a value sharing a factor
+        let context = GMPSecureModularContext(modulus: GMPInteger(15))
+
+        // When/Then: Inverting 6 throws
+        #expect(throws: GMPError.divisionByZero) {
+            _ = try context.inverse(of: GMPInteger(6))
+        }
+    }
+
+    @Test
+    func exponentBitCount_WiderExponent_IsAccepted() async throws {
+        // Given: A context whose exponent width exceeds the modulus width
+        let m = GMPInteger(1_000_003)
+        let context = GMPSecureModularContext(modulus: m, exponentBitCount: 256)
+        let exponent = GMPInteger(1).leftShifted(by: 200) + GMPInteger(1)
+
+        // When: Computing the power
+        let result = context.raisedToPower(GMPInteger(2), exponent)
+
+        // Then: The result matches mpz_powm
+        #expect(result == GMPInteger(2).raisedToPower(exponent, modulo: m))
+    }
+}
@@ -0,0 +1,119 @@
+@testable import Kalliope
+import Testing
+
+struct GMPIntegerMatrixTests {
+    @Test
+    func initRows_Subscript_ReturnsEntries() async throws {
+        // Given: A 2x3 matrix built from rows
+        let matrix = GMPIntegerMatrix([[1, 2, 3], [4, 5, 6]])
+
+        // When/Then: Dimensions and entries match
+        #expect(matrix.rowCount == 2)
+        #expect(matrix.columnCount == 3)
+        #expect(matrix[1, 2] == GMPInteger(6))
+        #expect(matrix.row(0) == [GMPInteger(1), GMPInteger(2), GMPInteger(3)])
+    }
+
+    @Test
+    func mutation_AfterCopy_LeavesCopyUnchanged() async throws {
+        // Given: A matrix and a copy
+        var a = GMPIntegerMatrix([[1, 2], [3, 4]])
+        let b = a
+
+        // When: Updating the original in place
+        a.subtractMultiple(ofRow: 0, by: GMPInteger(3), fromRow: 1)
+
+        // Then: The copy is unchanged
+        #expect(a.row(1) == [GMPInteger(0), GMPInteger(-2)])
+        #expect(b.row(1) == [GMPInteger(3), GMPInteger(4)])
+    }
+
+    @Test
+    func swapRows_TwoRows_ExchangesThem() async throws {
+        // Given: A 3x2 matrix
+        var matrix = GMPIntegerMatrix([[1, 2], [3, 4], [5, 6]])
+
+        // When: Swapping the first and last rows
+        matrix.swapRows(0, 2)
+
+        // Then: The rows are exchanged
+        #expect(matrix == GMPIntegerMatrix([[5, 6], [3, 4], [1, 2]]))
+    }
+
+    @Test
+    func subtractLinearCombination_SeveralRows_AppliesAllCoefficients()
+        async throws
+    {
+        // Given: Three rows
+        var matrix = GMPIntegerMatrix([[1, 0, 2], [0, 1, 3], [10, 20, 30]])
+
+        // When: row2 -= 10 * row0 + 20 * row1
+        matrix.subtractLinearCombination(
+            ofRows: [0, 1],
+            coefficients: [GMPInteger(10), GMPInteger(20)],
+            fromRow: 2
+        )
+
+        // Then: row2 == [0, 0, 30 - 20 - 60]
+        #expect(matrix.row(2) == [GMPInteger(0), GMPInteger(0), GMPInteger(-50)])
+    }
+
+    @Test
+    func subtractLinearCombination_WideRows_MatchesSequentialResult()
+        async throws
+    {
+        // Given: Wide rows of large entries, enough to split across cores
+        let columns = 512
+        let big = GMPInteger(1).leftShifted(by: 640)
+        var rows = [[GMPInteger]]()
+        for r in 0 ..< 3 {
+            rows.append((0 ..< columns).map { c in
+                big * GMPInteger(r + 1) + GMPInteger(c)
+            })
+        }
+        var matrix = GMPIntegerMatrix(rows)
+        let x = GMPInteger(12345)
+        let y = GMPInteger(-678)
+
+        // When: Subtracting a combination of rows 0 and 1 from row 2
+        matrix.subtractLinearCombination(
+            ofRows: [0, 1],
+            coefficients: [x, y],
+            fromRow: 2
+        )
+
+        // Then: Every entry matches the scalar computation
+        for c in 0 ..< columns {
+            let expected = rows[2][c] - x * rows[0][c] - y * rows[1][c]
+            #expect(matrix[2, c] == expected)
+        }
+    }
+
+    @Test
+    func dotProductAndGramMatrix_SmallRows_MatchManualSums() async throws {
+        // Given: A 2x3 matrix
+        let matrix = GMPIntegerMatrix([[1, 2, 3], [4, 5, 6]])
+
+        // When: Computing dot products and the Gram matrix
+        let dot = matrix.dotProduct(ofRow: 0, withRow: 1)
+        let gram = matrix.gramMatrix
+
+        // Then: Entries are the row inner products
+        #expect(dot == GMPInteger(32))
+        #expect(gram == GMPIntegerMatrix([[14, 32], [32, 77]]))
+    }
+
+    @Test
+    func multiplied_SmallMatrices_MatchesManualProduct() async throws {
+        // Given: A 2x3 and a 3x2 matrix
+        let a = GMPIntegerMatrix([[1, 2, 3], [4, 5, 6]])
+        let b = GMPIntegerMatrix([[7, 8], [9, 10], [11, 12]])
+
+        // When: Multiplying
+        let product = a * b
+
+        // Then: The product is correct and equals (b^T a^T)^T
+        #expect(product == GMPIntegerMatrix([[58, 64], [139, 154]]))
+        #expect((b.transposed * a.transposed).transposed == product)
+    }
+}
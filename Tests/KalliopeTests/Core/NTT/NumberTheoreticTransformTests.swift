@@ -0,0 +1,138 @@
+@testable import Kalliope
+import Testing
+
+@Suite(.serialized)
+struct NumberTheoreticTransformTests {
+    /// Pseudo-random residues.
+    private func residues(
+        _ count: Int,
+        _ field: WordPrimeField,
+        seed: UInt64
+    ) -> [UInt64] {
+        var state = seed &* 0x9E37_79B9_7F4A_7C15 | 1
+        return (0 ..< count).map { _ in
+            state ^= state << 13
+            state ^= state >> 7
+            state ^= state << 17
+            return state % field.modulus
+        }
+    }
+
+    // MARK: - Field
+
+    @Test
+    func field_MontgomeryProducts_MatchWideDivision() async throws {
+        // Given: A transform prime and a small prime
+        for field in [
+            WordPrimeField.transformPrimes[0],
+            WordPrimeField(modulus: 998_244_353),
+        ] {
+            let p = field.modulus
+            let a = residues(64, field, seed: 1)
+            let b = residues(64, field, seed: 2)
+
+            // When / Then: Products agree with 128-by-64-bit division, and
+            // inverses invert
+            for (x, y) in zip(a, b) {
+                let expected = p.dividingFullWidth(x.multipliedFullWidth(by: y))
+                    .remainder
+                #expect(field.multiply(x, y) == expected)
+                if let inverse = field.inverse(of: x) {
+                    #expect(field.multiply(x, inverse) == 1)
+                }
+            }
+        }
+    }
+
+    @Test
+    func transformPrimes_HaveLargeTwoAdicity() async throws {
+        // Given: The multimodular primes
+        let primes = WordPrimeField.transformPrimes
+
+        // Then: They are distinct, below 2^62 and support 2^40 points
+        #expect(primes.count == 256)
+        #expect(Set(primes.map(\.modulus)).count == primes.count)
+        #expect(primes.allSatisfy { $0.modulus < 1 << 62 })
+        #expect(primes.allSatisfy { $0.twoAdicity >= 40 })
+        let root = primes[0].rootOfUnity(log2Order: 40)
+        #expect(primes[0].power(root, 1 << 39) == primes[0].modulus - 1)
+    }
+
+    // MARK: - Transforms
+
+    @Test
+    func inverse_AfterForward_RestoresInput() async throws {
+        // Given: A transform longer than one cache block, so both the
+        // breadth-first and the blocked levels run
+        let field = WordPrimeField.transformPrimes[1]
+        let length = 4 * NumberTheoreticTransform.blockLength
+        let transform = NumberTheoreticTransform(field: field, length: length)
+        let input = residues(length, field, seed: 3)
+
+        // When: Transforming forward and back
+        var values = input
+        transform.forward(&values)
+        let spectrum = values
+        transform.inverse(&values)
+
+        // Then: The input returns, and the spectrum is fully reduced
+        #expect(values == input)
+        #expect(spectrum.allSatisfy { $0 < field.modulus })
+        #expect(spectrum != input)
+    }
+
+    @Test
+    func convolution_MatchesSchoolbook() async throws {
+        // Given: Two sequences whose product wraps around a length-64
+        // transform
+        let field = WordPrimeField(modulus: 998_244_353)
+        let transform = NumberTheoreticTransform(field: field, length: 64)
+        let a = residues(50, field, seed: 4)
+        let b = residues(40, field, seed: 5)
+
+        // When: Convolving
+        let c = transform.convolution(a, b)
+
+        // Then: Each entry is the cyclic sum of products
+        var expected = [UInt64](repeating: 0, count: 64)
+        for i in a.indices {
+            for j in b.indices {
+                let k = (i + j) % 64
+                expected[k] = field.add(expected[k], field.multiply(a[i], b[j]))
+            }
+        }
+        #expect(c == expected)
+    }
+
+    // MARK: - Multimodular Products
+
+    @Test(.exclusiveTuning)
+    func product_SignedBigCoefficients_MatchesKronecker() async throws {
+        // Given: Factors with signed coefficients of several hundred bits
+        let f = (0 ..< 70).map { i in
+            (GMPInteger(i &* 0x5851_F42D_4C95_7F2D) << 300) - GMPInteger(i)
+        }
+        let g = (0 ..< 90).map { i in
+            -(GMPInteger(i &* 0x1405_7B7E_F767_814F) << 200) + 7
+        }
+
+        // When: Multiplying serially and across primes
+        let serial = GMPTuning.withValue(
+            Int.max,
+            for: .numberTheoreticTransformParallelThreshold
+        ) {
+            NumberTheoreticTransform.product(f, g)
+        }
+        let parallel = GMPTuning.withValue(
+            0,
+            for: .numberTheoreticTransformParallelThreshold
+        ) {
+            NumberTheoreticTransform.product(f, g)
+        }
+
+        // Then: Both match the Kronecker product exactly
+        let expected = GMPInteger._kroneckerProduct(f, g, count: 159)
+        #expect(serial == expected)
+        #expect(parallel == expected)
+    }
+}
@@ -0,0 +1,134 @@
+@testable import Kalliope
+import Testing
+
+@Suite(.serialized)
+struct WordPrimePolynomialTests {
+    private let field = WordPrimeField.transformPrimes[0]
+
+    /// A pseudo-random polynomial of the given degree.
+    private func polynomial(degree: Int, seed: UInt64) -> WordPrimePolynomial {
+        var state = seed &* 0x9E37_79B9_7F4A_7C15 | 1
+        var coefficients = (0 ... degree).map { _ in
+            state ^= state << 13
+            state ^= state >> 7
+            state ^= state << 17
+            return state
+        }
+        coefficients[degree] |= 1
+        return WordPrimePolynomial(coefficients, field: field)
+    }
+
+    // MARK: - Arithmetic
+
+    @Test(.exclusiveTuning)
+    func multiply_TransformAndSchoolbook_Agree() async throws {
+        // Given: Factors above the transform threshold
+        let f = polynomial(degree: 300, seed: 1)
+        let g = polynomial(degree: 200, seed: 2)
+
+        // When: Multiplying with each method
+        let schoolbook = GMPTuning.withValue(
+            Int.max,
+            for: .wordPrimePolynomialTransformThreshold
+        ) {
+            f * g
+        }
+        let transformed = GMPTuning.withValue(
+            1,
+            for: .wordPrimePolynomialTransformThreshold
+        ) {
+            f * g
+        }
+
+        // Then: The products match and agree at a point
+        #expect(transformed == schoolbook)
+        #expect(transformed.degree == 500)
+        let x: UInt64 = 123_456_789
+        #expect(
+            transformed.evaluated(at: x)
+                == field.multiply(f.evaluated(at: x), g.evaluated(at: x))
+        )
+    }
+
+    @Test(.exclusiveTuning)
+    func quotientAndRemainder_NewtonAndClassical_Agree() async throws {
+        // Given: A dividend and a divisor both above the threshold
+        let f = polynomial(degree: 400, seed: 3)
+        let g = polynomial(degree: 150, seed: 4)
+
+        // When: Dividing by Newton inversion and by long division
+        let classical = GMPTuning.withValue(
+            Int.max,
+            for: .wordPrimePolynomialTransformThreshold
+        ) {
+            f.quotientAndRemainder(dividingBy: g)
+        }
+        let newton = GMPTuning.withValue(
+            8,
+            for: .wordPrimePolynomialTransformThreshold
+        ) {
+            f.quotientAndRemainder(dividingBy: g)
+        }
+
+        // Then: Both give f = q·g + r with deg r < deg g
+        #expect(newton.quotient == classical.quotient)
+        #expect(newton.remainder == classical.remainder)
+        #expect(newton.quotient * g + newton.remainder == f)
+        #expect(newton.remainder.degree < g.degree)
+    }
+
+    @Test
+    func gcd_CommonFactor_IsRecovered() async throws {
+        // Given: Two products sharing a monic factor
+        let common = polynomial(degree: 30, seed: 5)
+        let f = common * polynomial(degree: 40, seed: 6)
+        let g = common * polynomial(degree: 25, seed: 7)
+
+        // When: Taking the gcd
+        let d = WordPrimePolynomial.gcd(f, g)
+
+        // Then: It is the common factor made monic
+        let leading = field.inverse(of: common.coefficients.last!)!
+        let monic = common * WordPrimePolynomial([leading], field: field)
+        #expect(d == monic)
+    }
+
+    // MARK: - Evaluation
+
+    @Test(.exclusiveTuning)
+    func evaluated_SubproductTree_MatchesHorner() async throws {
+        // Given: A polynomial and more points than the threshold
+        let f = polynomial(degree: 150, seed: 8)
+        let points = (0 ..< 100).map { UInt64($0 * $0 + 17) }
+
+        // When: Evaluating through the remainder tree
+        let values = GMPTuning.withValue(
+            16,
+            for: .wordPrimePolynomialTransformThreshold
+        ) {
+            f.evaluated(at: points)
+        }
+
+        // Then: Every value matches Horner's rule
+        #expect(values == points.map { f.evaluated(at: $0) })
+    }
+
+    // MARK: - Chinese Remaindering
+
+    @Test
+    func lifted_Images_RecoverSignedCoefficients() async throws {
+        // Given: Images of an integer polynomial modulo three primes
+        let coefficients: [GMPInteger] = [
+            -(GMPInteger(1) << 150) + 5, 0, GMPInteger(3) << 100, -1,
+        ]
+        let images = WordPrimeField.transformPrimes.prefix(3).map {
+            WordPrimePolynomial(coefficients, field: $0)
+        }
+
+        // When: Lifting
+        let lifted = WordPrimePolynomial.lifted(Array(images))
+
+        // Then: The coefficients return with their signs
+        #expect(lifted == coefficients)
+    }
+}
@@ -0,0 +1,123 @@
+@testable import Kalliope
+import Testing
+
+@Suite(.serialized)
+struct GMPRealRootTests {
+    /// The coefficients of a product of polynomials.
+    private func product(_ factors: [[GMPInteger]]) -> [GMPInteger] {
+        factors.reduce([1]) { a, b in
+            var c = [GMPInteger](repeating: 0, count: a.count + b.count - 1)
+            for i in a.indices {
+                for j in b.indices {
+                    c[i + j].addProduct(a[i], b[j])
+                }
+            }
+            return c
+        }
+    }
+
+    /// Whether every exact root is a root of `p` and every other interval
+    /// has a sign change of the polynomial the root refines against.
+    private func isolates(_ roots: [GMPRealRoot], _ p: [GMPInteger]) -> Bool {
+        func sign(_ q: [GMPInteger], _ x: GMPRational) -> Int {
+            var value: GMPRational = 0
+            for c in q.reversed() {
+                value = value * x + GMPRational(c)
+            }
+            return value.sign
+        }
+        return roots.allSatisfy { root in
+            let q = root._polynomial
+            return root.isExact
+                ? sign(p, root.lower) == 0
+                : sign(q, root.lower) * sign(q, root.upper) < 0
+        }
+    }
+
+    // MARK: - Isolation
+
+    @Test
+    func roots_MixedFactors_IsolatesEachRoot() async throws {
+        // Given: x (x² - 2)(x - 1)(x + 3)(x² + 1)
+        let p = product([[0, 1], [-2, 0, 1], [-1, 1], [3, 1], [1, 0, 1]])
+
+        // When: Isolating the real roots
+        let roots = GMPRealRoot.roots(of: p)
+
+        // Then: -3, -√2, 0, 1 and √2 are found in order, the dyadic ones
+        // exactly
+        #expect(roots.count == 5)
+        #expect(isolates(roots, p))
+        #expect(roots[0].lower < -3 && roots[0].upper > -3)
+        #expect(roots[1].lower < -1.4143 && roots[1].upper > -1.4142)
+        #expect(roots[2].lower == 0 && roots[2].isExact)
+        #expect(roots[3].lower == 1 && roots[3].isExact)
+        #expect(roots[4].lower < 1.4143 && roots[4].upper > 1.4142)
+        for (left, right) in zip(roots, roots.dropFirst()) {
+            #expect(left.upper <= right.lower)
+        }
+    }
+
+    @Test
+    func roots_RepeatedFactors_ReturnsDistinctRoots() async throws {
+        // Given: (x - 5)³ (3x + 1)² (x² - 7)
+        let p = product([
+            [-5, 1], [-5, 1], [-5, 1], [1, 3], [1, 3], [-7, 0, 1],
+        ])
+
+        // When: Isolating
+        let roots = GMPRealRoot.roots(of: p)
+
+        // Then: Each distinct root appears once
+        #expect(roots.count == 4)
+        #expect(isolates(roots, p))
+        let third = try GMPRational(numerator: -1, denominator: 3)
+        let narrow = roots[1].refined(bits: 40)
+        #expect(narrow.lower < third && narrow.upper > third)
+    }
+
+    @Test(.exclusiveTuning)
+    func roots_ClusteredRoots_MatchesAcrossTaylorShifts() async throws {
+        // Given: The close pair (x - 1/1000)(x - 1/1001) times a factor
+        // with roots k/8
+        let p = product(
+            [[-1, 1000], [-1, 1001]]
+                + (1 ... 24).map { [GMPInteger(-$0), 8] }
+        )
+
+        // When: Isolating with classic and divide-and-conquer shifts
+        let classic = GMPTuning.withValue(
+            Int.max,
+            for: .realRootTaylorShiftThreshold
+        ) {
+            GMPRealRoot.roots(of: p)
+        }
+        let fast = GMPTuning.withValue(2, for: .realRootTaylorShiftThreshold) {
+            GMPRealRoot.roots(of: p)
+        }
+
+        // Then: Both find all 26 roots in the same intervals
+        #expect(classic.count == 26)
+        #expect(isolates(classic, p))
+        #expect(fast.map(\.lower) == classic.map(\.lower))
+        #expect(fast.map(\.upper) == classic.map(\.upper))
+    }
+
+    // MARK: - Refinement
+
+    @Test
+    func refined_CubeRootOfTwo_NarrowsToRequestedWidth() async throws {
+        // Given: The real root of x³ - 2
+        let root = GMPRealRoot.roots(of: [-2, 0, 0, 1])[0]
+
+        // When: Refining to 500 bits
+        let narrow = root.refined(bits: 500)
+
+        // Then: The interval is at most 2^-500 wide and still brackets the
+        // root
+        let width = narrow.upper - narrow.lower
+        #expect(width * GMPRational(GMPInteger(1) << 500) <= 1)
+        #expect(narrow.lower * narrow.lower * narrow.lower < 2)
+        #expect(narrow.upper * narrow.upper * narrow.upper > 2)
+    }
+}
@@ -0,0 +1,176 @@
+@testable import Kalliope
+import Testing
+
+@Suite(.serialized)
+struct SparsePolynomialTests {
+    /// A pseudo-random polynomial in three variables.
+    private func polynomial(terms: Int, seed: Int) -> SparsePolynomial {
+        var state = UInt64(seed) &* 0x9E37_79B9_7F4A_7C15 | 1
+        func next(_ bound: Int) -> Int {
+            state ^= state << 13
+            state ^= state >> 7
+            state ^= state << 17
+            return Int(state % UInt64(bound))
+        }
+        return SparsePolynomial(
+            variableCount: 3,
+            terms: (0 ..< terms).map { _ in
+                let exponents = [next(12), next(12), next(12)]
+                let coefficient = (GMPInteger(next(1 << 30)) << 70)
+                    - GMPInteger(next(1 << 30))
+                return (exponents, coefficient)
+            }
+        )
+    }
+
+    // MARK: - Construction
+
+    @Test
+    func init_LikeTerms_AreCombinedAndSorted() async throws {
+        // Given: Terms with a repeated monomial and a cancelling pair
+        let f = SparsePolynomial(
+            variableCount: 2,
+            terms: [
+                ([0, 1], 3), ([2, 0], 5), ([0, 1], 4), ([1, 1], 2),
+                ([1, 1], -2),
+            ]
+        )
+
+        // Then: The terms are in decreasing lexicographic order
+        let terms = f.terms
+        #expect(terms.count == 2)
+        #expect(terms[0].exponents == [2, 0])
+        #expect(terms[0].coefficient == 5)
+        #expect(terms[1].exponents == [0, 1])
+        #expect(terms[1].coefficient == 7)
+        #expect(f.degrees == [2, 1])
+    }
+
+    // MARK: - Arithmetic
+
+    @Test
+    func multiply_DifferenceOfSquares_ExpandsAndDivides() async throws {
+        // Given: x + y and x - y
+        let x = SparsePolynomial(variable: 0, of: 2)
+        let y = SparsePolynomial(variable: 1, of: 2)
+
+        // When: Multiplying and dividing back
+        let f = (x + y) * (x - y)
+        let (q, r) = f.quotientAndRemainder(dividingBy: x - y)
+
+        // Then: The product is x² - y² and the division is exact
+        let expected = SparsePolynomial(
+            variableCount: 2,
+            terms: [([2, 0], 1), ([0, 2], -1)]
+        )
+        #expect(f == expected)
+        #expect(q == x + y)
+        #expect(r.isZero)
+    }
+
+    @Test
+    func multiply_RandomFactors_MatchesEvaluation() async throws {
+        // Given: Two polynomials with big coefficients and a point
+        let f = polynomial(terms: 40, seed: 1)
+        let g = polynomial(terms: 60, seed: 2)
+        let point: [GMPInteger] = [3, -5, 7]
+
+        // When: Multiplying
+        let product = f * g
+
+        // Then: The product evaluates to the product of the values
+        #expect(
+            product.evaluated(at: point)
+                == f.evaluated(at: point) * g.evaluated(at: point)
+        )
+        #expect(product == g * f)
+    }
+
+    @Test(.exclusiveTuning)
+    func multiply_Parallel_MatchesSerial() async throws {
+        // Given: Factors with enough term products to split
+        let f = polynomial(terms: 200, seed: 3)
+        let g = polynomial(terms: 300, seed: 4)
+
+        // When: Multiplying serially and across cores
+        let serial = GMPTuning.withValue(
+            Int.max,
+            for: .sparsePolynomialParallelThreshold
+        ) {
+            f * g
+        }
+        let parallel = GMPTuning.withValue(
+            0,
+            for: .sparsePolynomialParallelThreshold
+        ) {
+            f * g
+        }
+
+        // Then: Both slicings give the same terms
+        #expect(parallel == serial)
+        #expect(serial._monomials == serial._monomials.sorted(by: >))
+    }
+
+    @Test
+    func quotientAndRemainder_InexactDivision_Reconstructs() async throws {
+        // Given: A dividend that is not a multiple of the divisor, and a
+        // divisor whose leading coefficient is not a unit
+        let f = polynomial(terms: 50, seed: 5)
+        let g = polynomial(terms: 8, seed: 6)
+
+        // When: Dividing
+        let (q, r) = f.quotientAndRemainder(dividingBy: g)
+
+        // Then: f = q·g + r
+        #expect(q * g + r == f)
+        #expect(!r.isZero)
+    }
+
+    @Test
+    func quotientAndRemainder_ExactProduct_RecoversFactor() async throws {
+        // Given: A product of two random polynomials
+        let f = polynomial(terms: 30, seed: 7)
+        let g = polynomial(terms: 20, seed: 8)
+
+        // When: Dividing the product by one factor
+        let (q, r) = (f * g).quotientAndRemainder(dividingBy: g)
+
+        // Then: The other factor is recovered
+        #expect(q == f)
+        #expect(r.isZero)
+    }
+
+    @Test
+    func quotientAndRemainder_LowerTermRaisesLaterVariable_Reconstructs()
+        async throws
+    {
+        // Given: x³ and x + y² in 16 variables, whose fields hold at most 7
+        let x = SparsePolynomial(variable: 0, of: 16)
+        let y = SparsePolynomial(variable: 1, of: 16)
+        let f = x * x * x
+        let g = x + y * y
+
+        // When: Dividing, which raises y by 2 with each quotient term
+        let (q, r) = f.quotientAndRemainder(dividingBy: g)
+
+        // Then: q = x² - xy² + y⁴ and r = -y⁶, with y⁶ near the limit
+        #expect(q == x * x - x * y * y + y * y * y * y)
+        #expect(r == -(y * y * y * y * y * y))
+        #expect(q * g + r == f)
+    }
+
+    #if os(macOS) || os(Linux)
+    @Test
+    func quotientAndRemainder_PendingProductOverflows_Traps() async throws {
+        // When/Then: x⁶ ÷ (x + y²) in 16 variables needs y⁸ in a pending
+        // product, past the maximum exponent of 7, and traps instead of
+        // returning a wrong quotient
+        await #expect(processExitsWith: .failure) {
+            let x = SparsePolynomial(variable: 0, of: 16)
+            let y = SparsePolynomial(variable: 1, of: 16)
+            let x3 = x * x * x
+            _ = (x3 * x3).quotientAndRemainder(dividingBy: x + y * y)
+        }
+    }
+    #endif
+}
@@ -0,0 +1,208 @@
+import CKalliope
+import Foundation
+@testable import Kalliope
+import Testing
+
+struct GMPPrimalityCertificateTests {
+    private let mersenne61 = (GMPInteger(1) << 61) - 1
+    private let mersenne127 = (GMPInteger(1) << 127) - 1
+
+    @Test
+    func certificate_SmallPrime_IsSmall() async throws {
+        // Given: A prime below 2^64
+        let prover = GMPPrimalityProver()
+
+        // When: Certifying it
+        let certificate = try #require(prover.certificate(for: mersenne61))
+
+        // Then: The certificate is a direct check that verifies
+        #expect(certificate == .small(mersenne61))
+        #expect(certificate.verify())
+    }
+
+    @Test
+    func certificate_Composites_ReturnNil() async throws {
+        // Given: A small and a large composite
+        let prover = GMPPrimalityProver()
+        let small = (GMPInteger(1) << 61) + 1
+        let large = mersenne127 * mersenne61
+
+        // When/Then: Neither is certified
+        #expect(prover.certificate(for: small) == nil)
+        #expect(prover.certificate(for: large) == nil)
+        #expect(prover.certificate(for: 1) == nil)
+    }
+
+    @Test
+    func certificate_MersennePrime_Verifies() async throws {
+        // Given: 2^127 - 1, whose predecessor factors easily
+        let prover = GMPPrimalityProver()
+
+        // When: Certifying it
+        let certificate = try #require(prover.certificate(for: mersenne127))
+
+        // Then: The n - 1 proof verifies
+        guard case .nMinusOne = certificate else {
+            Issue.record("expected an n - 1 proof")
+            return
+        }
+        #expect(certificate.number == mersenne127)
+        #expect(certificate.verify())
+    }
+
+    @Test
+    func certificate_LargePrime_Verifies() async throws {
+        // Given: The first prime above 2^256
+        let prime = (GMPInteger(1) << 256).nextPrime
+
+        // When: Certifying it
+        let certificate = try #require(prime.primalityCertificate())
+
+        // Then: Every step verifies
+        #expect(certificate.number == prime)
+        #expect(certificate.verify())
+    }
+
+    @Test
+    func ellipticCurveProof_Prime_Verifies() async throws {
+        // Given: The first prime above 2^160
+        let prime = (GMPInteger(1) << 160).nextPrime
+        let prover = GMPPrimalityProver()
+
+        // When: Building an elliptic curve proof directly
+        let proof = try #require(prover._ellipticCurveProof(for: prime))
+
+        // Then: The proof reduces to a smaller prime and verifies
+        #expect(proof.prime < prime)
+        #expect(proof.order.isDivisible(by: proof.prime))
+        #expect(GMPPrimalityCertificate.ellipticCurve(proof).verify())
+    }
+
+    @Test
+    func verify_TamperedPoint_ReturnsFalse() async throws {
+        // Given: A valid elliptic curve proof with its point moved
+        let prime = (GMPInteger(1) << 160).nextPrime
+        let prover = GMPPrimalityProver()
+        let proof = try #require(prover._ellipticCurveProof(for: prime))
+        let tampered = GMPEllipticCurveProof(
+            number: proof.number,
+            a: proof.a,
+            b: proof.b + 1,
+            x: proof.x,
+            y: proof.y,
+            order: proof.order,
+            prime: proof.prime,
+            certificate: proof.certificate
+        )
+
+        // When/Then: The tampered proof is rejected
+        #expect(!GMPPrimalityCertificate.ellipticCurve(tampered).verify())
+    }
+
+    @Test
+    func verify_TamperedChild_ReturnsFalse() async throws {
+        // Given: A valid n - 1 proof whose first child proves another
+        // number
+        let certificate = try #require(mersenne127.primalityCertificate())
+        guard case let .nMinusOne(proof) = certificate else {
+            Issue.record("expected an n - 1 proof")
+            return
+        }
+        var factors = proof.factors
+        let first = factors[0]
+        factors[0] = GMPNMinusOneProof.Factor(
+            prime: first.prime,
+            exponent: first.exponent,
+            witness: first.witness,
+            certificate: .small(first.prime + 2)
+        )
+        let tampered = GMPPrimalityCertificate.nMinusOne(
+            GMPNMinusOneProof(number: proof.number, factors: factors)
+        )
+
+        // When/Then: The tampered certificate is rejected
+        #expect(!tampered.verify())
+    }
+
+    @Test
+    func verify_CompositeSmall_ReturnsFalse() async throws {
+        // Given: A direct check of a composite
+        let certificate = GMPPrimalityCertificate.small(3_215_031_751)
+
+        // When/Then: It is rejected, although it is a strong pseudoprime
+        // to bases 2, 3, 5 and 7
+        #expect(!certificate.verify())
+    }
+
+    @Test
+    func serialized_RoundTrip_PreservesCertificate() async throws {
+        // Given: A certificate with nested steps
+        let prime = (GMPInteger(1) << 160).nextPrime
+        let certificate = try #require(prime.primalityCertificate())
+
+        // When: Serializing and deserializing it
+        let data = certificate.serialized()
+        let decoded = try GMPPrimalityCertificate(serialized: data)
+
+        // Then: The result is equal and still verifies
+        #expect(decoded == certificate)
+        #expect(decoded.verify())
+    }
+
+    @Test
+    func initSerialized_MalformedData_Throws() async throws {
+        // Given: A valid encoding
+        let data = GMPPrimalityCertificate.small(mersenne61).serialized()
+
+        // When/Then: Truncated, extended and mislabeled data are rejected
+        #expect(throws: GMPError.invalidCertificate) {
+            try GMPPrimalityCertificate(serialized: data.dropLast())
+        }
+        #expect(throws: GMPError.invalidCertificate) {
+            try GMPPrimalityCertificate(serialized: data + [0])
+        }
+        #expect(throws: GMPError.invalidCertificate) {
+            try GMPPrimalityCertificate(serialized: Data("KPC0".utf8))
+        }
+        #expect(throws: GMPError.invalidCertificate) {
+            try GMPPrimalityCertificate(serialized: Data())
+        }
+    }
+
+    @Test
+    func initSerialized_DeepNesting_Throws() async throws {
+        // Given: Elliptic curve steps of zeros nested past the limit
+        let step: [UInt8] = [3] + [UInt8](repeating: 0, count: 7)
+        var bytes = Array("KPC1".utf8)
+        for _ in 0 ... _GMPCertificateFormat.maxDepth {
+            bytes += step
+        }
+        bytes += [1, 0]
+
+        // When/Then: Reading stops with an error instead of recursing on
+        #expect(throws: GMPError.invalidCertificate) {
+            try GMPPrimalityCertificate(serialized: Data(bytes))
+        }
+    }
+
+    @Test
+    func verify_ExponentBeyondNMinusOne_ReturnsFalse() async throws {
+        // Given: A factor of 2^127 - 2 claimed to the largest allowed power
+        let certificate = GMPPrimalityCertificate.nMinusOne(
+            GMPNMinusOneProof(
+                number: mersenne127,
+                factors: [
+                    GMPNMinusOneProof.Factor(
+                        prime: 3,
+                        exponent: mersenne127.bitCount,
+                        witness: 3,
+                        certificate: .small(3)
+                    ),
+                ]
+            )
+        )
+
+        // When/Then: It is rejected
+        #expect(!certificate.verify())
+    }
+}
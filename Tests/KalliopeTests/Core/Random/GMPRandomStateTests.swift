@@ -1,3 +1,4 @@
+import CKalliope
 @testable import Kalliope
 import Testing
 
@@ -1392,6 +1393,26 @@ extension GMPRandomStateTests {
         }
     }
 
+    // MARK: - Pointer Access
+
+    @Test("withMutableCPointer draws advance the shared state")
+    func withMutableCPointer_Draw_AdvancesState() async throws {
+        // Given: Two states with the same seed
+        let state = GMPRandomState(mersenneTwister: GMPInteger(42))
+        var reference = GMPRandomState(mersenneTwister: GMPInteger(42))
+
+        // When: Drawing through the pointer, then through random(bits:)
+        let drawn = state.withMutableCPointer { ptr in
+            __gmp_urandomb_ui(ptr, 32)
+        }
+        var advanced = state
+        let next = advanced.random(bits: 32)
+
+        // Then: Both draws follow the reference sequence
+        #expect(Int(drawn) == reference.random(bits: 32))
+        #expect(next == reference.random(bits: 32))
+    }
+
     // MARK: - Memory Management
 
     @Test("Memory management multiple states proper cleanup")
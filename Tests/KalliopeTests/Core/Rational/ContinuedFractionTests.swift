@@ -0,0 +1,152 @@
+@testable import Kalliope
+import Testing
+
+@Suite(.serialized)
+struct ContinuedFractionTests {
+    /// The partial quotients by repeated division.
+    private func euclidQuotients(
+        _ numerator: GMPInteger,
+        _ denominator: GMPInteger
+    ) throws -> [GMPInteger] {
+        var (q, r) = try numerator
+            .floorQuotientAndRemainder(dividingBy: denominator)
+        var quotients = [q]
+        var (a, b) = (denominator, r)
+        while !b.isZero {
+            (q, r) = try a.truncatedQuotientAndRemainder(dividingBy: b)
+            quotients.append(q)
+            (a, b) = (b, r)
+        }
+        return quotients
+    }
+
+    @Test
+    func iterate_SmallRational_ReturnsPartialQuotients() async throws {
+        // Given: 355/113 and -7/3
+        let positive = try ContinuedFraction(numerator: 355, denominator: 113)
+        let negative = try ContinuedFraction(numerator: 7, denominator: -3)
+
+        // When: Collecting the quotients
+        let quotients = Array(positive)
+
+        // Then: 355/113 = [3; 7, 16] and -7/3 = [-3; 1, 2]
+        #expect(quotients == [3, 7, 16])
+        #expect(Array(negative) == [-3, 1, 2])
+    }
+
+    @Test
+    func iterate_IntegerAndZero_ReturnsSingleQuotient() async throws {
+        // Given: An integer and zero
+        let integer = ContinuedFraction(GMPRational(GMPInteger(-5)))
+        let zero = ContinuedFraction(mantissa: 0, exponent: -100)
+
+        // When/Then: Each has one quotient
+        #expect(Array(integer) == [-5])
+        #expect(Array(zero) == [0])
+    }
+
+    @Test
+    func init_ZeroDenominator_Throws() async throws {
+        #expect(throws: GMPError.divisionByZero) {
+            try ContinuedFraction(numerator: 1, denominator: 0)
+        }
+    }
+
+    @Test(.exclusiveTuning)
+    func iterate_LargeRandomRational_MatchesEuclid() async throws {
+        // Given: Random 20000-bit fractions, with the recursion cutoff at
+        // its minimum and at its default
+        let state = GMPRandomState(mersenneTwister: GMPInteger(90))
+        for threshold in [0, Int.max] {
+            let numerator = GMPInteger.random(bits: 20000, using: state)
+            let denominator = GMPInteger.random(bits: 19000, using: state) + 1
+
+            // When: Expanding with half-GCD blocks
+            let quotients = GMPTuning.withValue(
+                threshold,
+                for: .continuedFractionHalfGCDThreshold
+            ) {
+                Array(
+                    try! ContinuedFraction(
+                        numerator: numerator,
+                        denominator: denominator
+                    )
+                )
+            }
+
+            // Then: The quotients match repeated division
+            #expect(
+                try quotients == euclidQuotients(numerator, denominator)
+            )
+        }
+    }
+
+    @Test
+    func convergents_LargeRational_EndsAtValue() async throws {
+        // Given: A large rational
+        let state = GMPRandomState(mersenneTwister: GMPInteger(7))
+        let value = try GMPRational(
+            numerator: GMPInteger.random(bits: 8000, using: state),
+            denominator: GMPInteger.random(bits: 8000, using: state) + 1
+        )
+
+        // When: Generating all convergents
+        let convergents = Array(ContinuedFraction(value).convergents)
+
+        // Then: Denominators increase and the last convergent is the value
+        #expect(convergents.last == value)
+        for (a, b) in zip(convergents, convergents.dropFirst()) {
+            #expect(a.denominator < b.denominator)
+        }
+    }
+
+    @Test
+    func bestApproximation_SemiconvergentCloser_ReturnsSemiconvergent()
+        async throws
+    {
+        // Given: 355/113
+        let fraction = try ContinuedFraction(numerator: 355, denominator: 113)
+
+        // When: Bounding the denominator between convergents
+        let best = fraction.bestApproximation(maxDenominator: 100)
+
+        // Then: The semiconvergent 311/99 beats the convergent 22/7
+        #expect(best == (try GMPRational(numerator: 311, denominator: 99)))
+        #expect(
+            fraction.bestApproximation(maxDenominator: 113)
+                == (try GMPRational(numerator: 355, denominator: 113))
+        )
+    }
+
+    @Test
+    func bestApproximation_SmallBounds_MatchesBruteForce() async throws {
+        // Given: A large rational near 0.7
+        let value = try GMPRational(
+            numerator: (GMPInteger(7) << 5000) + 12345,
+            denominator: GMPInteger(10) << 5000
+        )
+        let fraction = ContinuedFraction(value)
+
+        for bound in 1 ... 60 {
+            // When: Finding the best approximation
+            let best = fraction.bestApproximation(
+                maxDenominator: GMPInteger(bound)
+            )
+
+            // Then: No fraction with a denominator up to the bound is closer
+            let error = (value - best).absoluteValue()
+            for q in 1 ... bound {
+                let p = try (value.numerator * q)
+                    .floorDivided(by: value.denominator)
+                for candidate in [p, p + 1] {
+                    let c = try GMPRational(
+                        numerator: candidate,
+                        denominator: GMPInteger(q)
+                    )
+                    #expect((value - c).absoluteValue() >= error)
+                }
+            }
+            #expect(best.denominator <= GMPInteger(bound))
+        }
+    }
+}
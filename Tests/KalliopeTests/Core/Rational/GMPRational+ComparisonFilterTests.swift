@@ -0,0 +1,138 @@
+import CKalliope
+@testable import Kalliope
+import Testing
+
+struct GMPRationalComparisonFilterTests {
+    /// A rational with a numerator and denominator of about `bits` bits.
+    private func random(
+        bits: Int,
+        using state: GMPRandomState
+    ) throws -> GMPRational {
+        try GMPRational(
+            numerator: GMPInteger.random(bits: bits, using: state) - 1 << 8,
+            denominator: GMPInteger.random(bits: bits, using: state) + 1
+        )
+    }
+
+    @Test
+    func compare_LargeDistantValues_DecidedByEstimate() async throws {
+        // Given: Two large rationals whose magnitudes differ by a factor 2^64
+        let a = try GMPRational(
+            numerator: GMPInteger(1) << 2000,
+            denominator: (GMPInteger(1) << 1000) + 1
+        )
+        let b = try GMPRational(
+            numerator: GMPInteger(1) << 2064,
+            denominator: (GMPInteger(1) << 1000) + 1
+        )
+
+        // When: Estimating both
+        let result = _GMPRationalEstimate.compare(a._estimate, b._estimate)
+
+        // Then: The estimates decide, and the operators agree
+        #expect(result == -1)
+        #expect(a < b)
+        #expect(b > a)
+        #expect(a.compare(to: b) == -1)
+    }
+
+    @Test
+    func compare_LargeCloseValues_FallsBackToExactComparison()
+        async throws
+    {
+        // Given: Two large rationals that differ by 2^-3000
+        let denominator = GMPInteger(1) << 3000
+        let a = try GMPRational(
+            numerator: (GMPInteger(3) << 2999) + 1,
+            denominator: denominator
+        )
+        let b = try GMPRational(
+            numerator: (GMPInteger(3) << 2999) + 2,
+            denominator: denominator
+        )
+
+        // When: Estimating both
+        let result = _GMPRationalEstimate.compare(a._estimate, b._estimate)
+
+        // Then: The estimates cannot decide, but the comparison is exact
+        #expect(result == nil)
+        #expect(a < b)
+        #expect(a <= b)
+        #expect(!(a >= b))
+        #expect(b.compare(to: a) == 1)
+        #expect(a.compare(to: a) == 0)
+    }
+
+    @Test
+    func compare_SignsAndZero_DecidedBySign() async throws {
+        // Given: A large negative value, zero, and a tiny positive value
+        let negative = try GMPRational(
+            numerator: -(GMPInteger(1) << 1000),
+            denominator: GMPInteger(3)
+        )
+        let zero = GMPRational()
+        let positive = try GMPRational(
+            numerator: GMPInteger(1),
+            denominator: GMPInteger(1) << 1000
+        )
+
+        // When/Then: Signs order the values, and zero equals zero
+        #expect(
+            _GMPRationalEstimate.compare(negative._estimate, zero._estimate)
+                == -1
+        )
+        #expect(
+            _GMPRationalEstimate.compare(positive._estimate, zero._estimate)
+                == 1
+        )
+        #expect(
+            _GMPRationalEstimate.compare(zero._estimate, zero._estimate) == 0
+        )
+        #expect(negative < zero)
+        #expect(zero < positive)
+    }
+
+    @Test
+    func compare_RandomValues_MatchesMpqCmp() async throws {
+        // Given: Random rationals of mixed sizes
+        let state = GMPRandomState(mersenneTwister: GMPInteger(89))
+        var values: [GMPRational] = []
+        for bits in [8, 64, 256, 1024, 4096] {
+            for _ in 0 ..< 8 {
+                try values.append(random(bits: bits, using: state))
+            }
+        }
+
+        // When/Then: Every filtered comparison matches mpq_cmp
+        for a in values {
+            for b in values {
+                let expected = Int(
+                    __gmpq_cmp(&a._storage.value, &b._storage.value)
+                ).signum()
+                #expect(a.compare(to: b) == expected)
+                #expect(
+                    GMPRationalSortKey(a).compare(to: GMPRationalSortKey(b))
+                        == expected
+                )
+            }
+        }
+    }
+
+    @Test
+    func sortKey_Sorting_MatchesSortingValues() async throws {
+        // Given: Random large rationals, including a duplicate
+        let state = GMPRandomState(mersenneTwister: GMPInteger(7))
+        var values: [GMPRational] = []
+        for _ in 0 ..< 50 {
+            try values.append(random(bits: 2048, using: state))
+        }
+        values.append(values[0])
+
+        // When: Sorting by key and by value
+        let byKey = values.map(GMPRationalSortKey.init).sorted().map(\.value)
+        let byValue = values.sorted()
+
+        // Then: The orders agree
+        #expect(byKey == byValue)
+    }
+}
@@ -0,0 +1,133 @@
+@testable import Kalliope
+import Testing
+
+struct PowerSeriesTests {
+    private typealias Series = PowerSeries<GMPRational>
+
+    /// `x` to `order` terms.
+    private func x(order: Int) -> Series {
+        Series([0, 1], order: order)
+    }
+
+    /// `1 / k!` for `k = 0 ..< count`.
+    private func inverseFactorials(_ count: Int) -> [GMPRational] {
+        var factorial = GMPInteger(1)
+        return (0 ..< count).map { k in
+            if k > 0 {
+                factorial = factorial * k
+            }
+            return try! GMPRational(numerator: 1, denominator: factorial)
+        }
+    }
+
+    @Test
+    func kroneckerProduct_SignedCoefficients_MatchesSchoolbook() async throws {
+        // Given: Two integer polynomials with large signed coefficients
+        let state = GMPRandomState(mersenneTwister: GMPInteger(93))
+        let a = (0 ..< 40).map { i in
+            let value = GMPInteger.random(bits: 200 + i, using: state)
+            return i % 3 == 0 ? -value : value
+        }
+        let b = (0 ..< 25).map { i in
+            let value = GMPInteger.random(bits: 90, using: state)
+            return i % 2 == 0 ? -value : value
+        }
+
+        // When: Multiplying by Kronecker substitution
+        let product = GMPInteger._kroneckerProduct(a, b, count: 50)
+
+        // Then: Every coefficient matches the schoolbook product
+        var expected = [GMPInteger](repeating: 0, count: 50)
+        for i in a.indices {
+            for j in b.indices where i + j < 50 {
+                expected[i + j] = expected[i + j] + a[i] * b[j]
+            }
+        }
+        #expect(product == expected)
+    }
+
+    @Test
+    func inverse_OneMinusX_IsGeometricSeries() async throws {
+        // Given: 1 - x
+        let series = Series([1, -1], order: 30)
+
+        // When: Inverting it
+        let inverse = series.inverse()
+
+        // Then: Every coefficient is 1
+        #expect(inverse.coefficients == [GMPRational](repeating: 1, count: 30))
+    }
+
+    @Test
+    func exponential_X_HasInverseFactorials() async throws {
+        // Given: x
+        let series = x(order: 40)
+
+        // When: Taking the exponential
+        let exp = series.exponential()
+
+        // Then: The coefficients are 1/k!
+        #expect(exp.coefficients == inverseFactorials(40))
+    }
+
+    @Test
+    func logarithm_Exponential_RoundTrips() async throws {
+        // Given: A series with constant term zero and rational coefficients
+        let f = Series(
+            (0 ..< 33).map {
+                try! GMPRational(numerator: GMPInteger($0 % 5), denominator: 7)
+            }
+        )
+
+        // When: Taking the logarithm of its exponential
+        let result = f.exponential().logarithm()
+
+        // Then: The series is recovered exactly
+        #expect(result.coefficients == f.coefficients)
+    }
+
+    @Test
+    func squareRoot_Squared_RecoversSeries() async throws {
+        // Given: 1 + x + 3x^2
+        let series = Series([1, 1, 3], order: 25)
+
+        // When: Squaring its square root
+        let root = series.squareRoot()
+
+        // Then: The series is recovered, and √(1 + x) starts 1 + x/2
+        #expect((root * root).coefficients == series.coefficients)
+        let sqrtOnePlusX = Series([1, 1], order: 3).squareRoot()
+        let half = try GMPRational(numerator: 1, denominator: 2)
+        #expect(sqrtOnePlusX[1] == half)
+    }
+
+    @Test
+    func composed_ExponentialOfLogarithm_IsIdentity() async throws {
+        // Given: exp(y) and log(1 + x)
+        let exp = Series(inverseFactorials(37))
+        let log = Series([1, 1], order: 37).logarithm()
+
+        // When: Composing them
+        let result = exp.composed(with: log)
+
+        // Then: exp(log(1 + x)) = 1 + x
+        #expect(result.coefficients == Series([1, 1], order: 37).coefficients)
+    }
+
+    @Test
+    func composed_MatchesHornerEvaluation() async throws {
+        // Given: Two series with mixed coefficients
+        let f = Series((0 ..< 20).map { GMPRational(GMPInteger($0 * $0 - 7)) })
+        let g = Series((0 ..< 20).map { GMPRational(GMPInteger($0 % 4)) })
+
+        // When: Composing by Brent–Kung and by Horner's rule
+        let result = f.composed(with: g)
+        var horner = Series([f[19]], order: 20)
+        for i in stride(from: 18, through: 0, by: -1) {
+            horner = horner * g + Series([f[i]], order: 20)
+        }
+
+        // Then: Both agree
+        #expect(result.coefficients == horner.coefficients)
+    }
+}
@@ -0,0 +1,104 @@
+import CKalliope
+import Foundation
+@testable import Kalliope
+import Testing
+
+/// Tests for the memory-mapped table store.
+struct GMPTableStoreTests {
+    private func temporaryPath() -> String {
+        FileManager.default.temporaryDirectory
+            .appendingPathComponent(UUID().uuidString).path
+    }
+
+    @Test
+    func write_IntegerAndWordTables_RoundTripThroughMapping() async throws {
+        // Given: A builder with factorials, powers, primes and negatives
+        let path = temporaryPath()
+        defer { try? FileManager.default.removeItem(atPath: path) }
+        var builder = GMPTableStoreBuilder(version: 7)
+        builder.addFactorials(through: 100)
+        builder.addPowers("powers3", of: GMPInteger(3), count: 50)
+        builder.addPrimes(upTo: 1000)
+        builder.add(
+            "mixed",
+            integers: [GMPInteger(0), GMPInteger(-5), GMPInteger(1) << 200]
+        )
+
+        // When: Writing and opening the store
+        try builder.write(to: path)
+        let store = try GMPTableStore(contentsOf: path)
+
+        // Then: Every table reads back with its values
+        #expect(store.version == 7)
+        #expect(store.tableNames == ["factorials", "mixed", "powers3", "primes"])
+        let factorials = try #require(store.integers(named: "factorials"))
+        #expect(factorials.count == 101)
+        #expect(factorials[0] == GMPInteger(1))
+        #expect(factorials[100] == GMPInteger.factorial(100))
+        let powers = try #require(store.integers(named: "powers3"))
+        #expect(powers[49] == GMPInteger(3).raisedToPower(49))
+        let mixed = try #require(store.integers(named: "mixed"))
+        #expect(mixed.map { $0 } == [
+            GMPInteger(0), GMPInteger(-5), GMPInteger(1) << 200,
+        ])
+        let primes = try #require(store.words(named: "primes"))
+        #expect(primes.count == 168)
+        #expect(primes.first == 2)
+        #expect(primes.last == 997)
+    }
+
+    @Test
+    func withElement_ReadOnlyView_WorksWithGMPFunctions() async throws {
+        // Given: A stored table of powers of two
+        let path = temporaryPath()
+        defer { try? FileManager.default.removeItem(atPath: path) }
+        var builder = GMPTableStoreBuilder()
+        builder.addPowers("powers2", of: GMPInteger(2), count: 130)
+        try builder.write(to: path)
+        let table = try #require(
+            GMPTableStore(contentsOf: path).integers(named: "powers2")
+        )
+
+        // When: Reading an element in place
+        let bits = table.withElement(at: 129) { element in
+            __gmpz_sizeinbase(element, 2)
+        }
+
+        // Then: The mapped limbs hold 2^129
+        #expect(bits == 130)
+    }
+
+    @Test
+    func lookup_WrongKindOrName_ReturnsNil() async throws {
+        // Given: A store with one word table
+        let path = temporaryPath()
+        defer { try? FileManager.default.removeItem(atPath: path) }
+        var builder = GMPTableStoreBuilder()
+        builder.add("words", words: [1, 2, 3])
+        try builder.write(to: path)
+        let store = try GMPTableStore(contentsOf: path)
+
+        // When/Then: Lookups by the wrong kind or a missing name fail
+        #expect(store.integers(named: "words") == nil)
+        #expect(store.words(named: "missing") == nil)
+        #expect(store.words(named: "words").map(Array.init) == [1, 2, 3])
+    }
+
+    @Test
+    func init_CorruptFile_ThrowsInvalidTableFile() async throws {
+        // Given: A file with a bad magic number
+        let path = temporaryPath()
+        defer { try? FileManager.default.removeItem(atPath: path) }
+        var data = GMPTableStoreBuilder().serialized()
+        data[0] ^= 0xFF
+        try data.write(to: URL(fileURLWithPath: path))
+
+        // When/Then: Opening it throws
+        #expect(throws: GMPError.invalidTableFile) {
+            _ = try GMPTableStore(contentsOf: path)
+        }
+        #expect(throws: GMPError.fileAccess(path + ".missing")) {
+            _ = try GMPTableStore(contentsOf: path + ".missing")
+        }
+    }
+}
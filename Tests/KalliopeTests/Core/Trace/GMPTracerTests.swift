@@ -0,0 +1,73 @@
+import Foundation
+@testable import Kalliope
+import Testing
+
+/// Tests for operation tracing.
+///
+/// Other tests may run concurrently and record their own operations, so
+/// these tests look only for events with distinctive operand sizes.
+@Suite(.serialized)
+struct GMPTracerTests {
+    @Test
+    func trace_EnabledCategory_RecordsOperationsWithSizes() async throws {
+        // Given: Multiplication tracing enabled
+        GMPTracer.reset()
+        GMPTracer.enabledCategories = [.multiply]
+        defer { GMPTracer.enabledCategories = [] }
+        let a = GMPInteger(1) << (64 * 321)
+
+        // When: Multiplying a 322-limb integer
+        _ = a * a
+
+        // Then: The multiplication is recorded iff tracing is compiled in
+        let recorded = GMPTracer.events().filter {
+            $0.name == "mpz_mul" && $0.size == 322
+        }
+        if GMPTracer.isCompiledIn {
+            #expect(!recorded.isEmpty)
+            #expect(recorded.allSatisfy { $0.category == .multiply })
+        } else {
+            #expect(recorded.isEmpty)
+        }
+    }
+
+    @Test
+    func trace_DisabledCategory_RecordsNothing() async throws {
+        // Given: Only division tracing enabled
+        GMPTracer.reset()
+        GMPTracer.enabledCategories = [.divide]
+        defer { GMPTracer.enabledCategories = [] }
+        let a = GMPInteger(1) << (64 * 456)
+
+        // When: Multiplying a 457-limb integer
+        _ = a * a
+
+        // Then: No multiplication of that size is recorded
+        #expect(!GMPTracer.events().contains {
+            $0.name == "mpz_mul" && $0.size == 457
+        })
+    }
+
+    @Test
+    func chromeTraceJSON_AfterTracing_IsValidTraceEventJSON() async throws {
+        // Given: Traced divisions and radix conversions
+        GMPTracer.reset()
+        GMPTracer.enabledCategories = .all
+        defer { GMPTracer.enabledCategories = [] }
+        let a = GMPInteger(1) << 5000
+        _ = try a.truncatedDivided(by: GMPInteger(12345))
+        _ = a.toString(base: 16)
+
+        // When: Exporting the trace
+        let json = GMPTracer.chromeTraceJSON()
+
+        // Then: It parses as a trace event object
+        let object = try JSONSerialization.jsonObject(with: Data(json.utf8))
+        let root = try #require(object as? [String: Any])
+        let events = try #require(root["traceEvents"] as? [[String: Any]])
+        if GMPTracer.isCompiledIn {
+            #expect(events.contains { $0["name"] as? String == "mpz_tdiv_q" })
+            #expect(events.allSatisfy { $0["ph"] as? String == "X" })
+        }
+    }
+}
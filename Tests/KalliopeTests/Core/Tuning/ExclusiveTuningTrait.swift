@@ -0,0 +1,64 @@
+import Testing
+
+/// Runs a test while no other test with this trait is running.
+///
+/// `GMPTuning.withValue` overrides are process-wide, and suites that are
+/// not serialized run their tests concurrently. Tests that override a
+/// parameter, such as a serial versus parallel comparison, take this trait
+/// so that another test cannot change or restore the same parameter
+/// midway.
+struct ExclusiveTuningTrait: TestTrait, TestScoping {
+    func scopeProvider(
+        for test: Test,
+        testCase: Test.Case?
+    ) -> Self? {
+        testCase == nil ? nil : self
+    }
+
+    func provideScope(
+        for test: Test,
+        testCase: Test.Case?,
+        performing function: @Sendable () async throws -> Void
+    ) async throws {
+        await _TuningTestLock.shared.lock()
+        do {
+            try await function()
+        } catch {
+            await _TuningTestLock.shared.unlock()
+            throw error
+        }
+        await _TuningTestLock.shared.unlock()
+    }
+}
+
+extension Trait where Self == ExclusiveTuningTrait {
+    /// Run the test exclusively of other tests that override tuning.
+    static var exclusiveTuning: Self {
+        ExclusiveTuningTrait()
+    }
+}
+
+/// A first-come, first-served lock that suspends instead of blocking.
+actor _TuningTestLock {
+    static let shared = _TuningTestLock()
+
+    private var isLocked = false
+    private var waiters: [CheckedContinuation<Void, Never>] = []
+
+    func lock() async {
+        guard isLocked else {
+            isLocked = true
+            return
+        }
+        await withCheckedContinuation { waiters.append($0) }
+    }
+
+    func unlock() {
+        if waiters.isEmpty {
+            isLocked = false
+        } else {
+            // Ownership passes straight to the next waiter
+            waiters.removeFirst().resume()
+        }
+    }
+}
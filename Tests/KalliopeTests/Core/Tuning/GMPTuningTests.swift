@@ -0,0 +1,97 @@
+import Foundation
+@testable import Kalliope
+import Testing
+
+@Suite(.serialized)
+struct GMPTuningTests {
+    static let cutover = GMPTuningParameter("test.cutover", default: 100)
+
+    @Test
+    func subscript_UnsetParameter_ReturnsDefault() async throws {
+        // Given: A profile that sets only one parameter
+        let profile = GMPTuningProfile(values: ["other": 7])
+
+        // When: Reading an unset parameter
+        let value = profile[Self.cutover]
+
+        // Then: The compiled-in default is used
+        #expect(value == 100)
+    }
+
+    @Test
+    func write_ThenRead_RoundTripsProfile() async throws {
+        // Given: A profile and a temporary path
+        var profile = GMPTuningProfile(machine: "test machine")
+        profile[Self.cutover] = 42
+        let path = NSTemporaryDirectory() + "tuning-\(UUID()).json"
+        defer { try? FileManager.default.removeItem(atPath: path) }
+
+        // When: Writing and reading it back
+        try profile.write(to: path)
+        let loaded = try GMPTuningProfile(contentsOf: path)
+
+        // Then: The profiles are equal
+        #expect(loaded == profile)
+        #expect(loaded[Self.cutover] == 42)
+    }
+
+    @Test
+    func init_InvalidJSON_ThrowsInvalidTuningProfile() async throws {
+        // Given: A file that is not a profile
+        let path = NSTemporaryDirectory() + "tuning-\(UUID()).json"
+        try Data("not json".utf8).write(to: URL(fileURLWithPath: path))
+        defer { try? FileManager.default.removeItem(atPath: path) }
+
+        // When/Then: Reading it throws
+        #expect(throws: GMPError.invalidTuningProfile) {
+            _ = try GMPTuningProfile(contentsOf: path)
+        }
+    }
+
+    @Test(.exclusiveTuning)
+    func withValue_Override_AppliesToMatrixThresholdAndRestores() async throws {
+        // Given: The threshold in effect
+        let before = GMPIntegerMatrix.parallelThreshold
+
+        // When: Overriding the parameter
+        let during = GMPTuning.withValue(
+            17,
+            for: .integerMatrixParallelThreshold
+        ) {
+            GMPIntegerMatrix.parallelThreshold
+        }
+
+        // Then: The override is visible only inside the closure
+        #expect(during == 17)
+        #expect(GMPIntegerMatrix.parallelThreshold == before)
+    }
+
+    @Test(.exclusiveTuning)
+    func measure_SyntheticCutover_FindsCrossover() async throws {
+        // Given: A benchmark whose guarded strategy wins from scale 3 on
+        let parameter = Self.cutover
+        let benchmark = GMPCutoverBenchmark(
+            parameter: parameter,
+            scales: [1, 2, 3, 4, 5]
+        ) { scale in
+            let work = 10 * scale
+            return (work, {
+                let guarded = work >= parameter.value
+                if guarded == (scale < 3) {
+                    usleep(2000)
+                }
+            })
+        }
+
+        // When: Measuring it
+        let tuner = GMPCutoverTuner(benchmarks: [benchmark], repetitions: 2)
+        let result = tuner.measure(benchmark)
+        let profile = tuner.run()
+
+        // Then: The threshold is the work at scale 3
+        #expect(result.threshold == 30)
+        #expect(result.measurements.map(\.work) == [10, 20, 30, 40, 50])
+        #expect(profile[parameter] == 30)
+        #expect(parameter.value == 100)
+    }
+}
@@ -0,0 +1,228 @@
+@testable import Kalliope
+import Testing
+
+/// Tests for randomized result verification.
+///
+/// The counters and automatic categories are process-wide, so tests other
+/// than the failure-rate test compare counts before and after each
+/// operation instead of resetting them.
+@Suite(.serialized)
+struct GMPVerificationTests {
+    private let a = (GMPInteger(1) << 5000) - 12345
+    private let b = (GMPInteger(3) << 4000) + 678
+
+    // MARK: - Integers
+
+    @Test
+    func verifyProduct_CorrectAndWrong_AreDistinguished() async throws {
+        // Given: A product and the same product off by one
+        let c = a * b
+
+        // Then: Only the true product passes, whatever the signs
+        #expect(GMPVerification.verifyProduct(c, a, b))
+        #expect(GMPVerification.verifyProduct(-c, -a, b))
+        #expect(!GMPVerification.verifyProduct(c + 1, a, b))
+        #expect(!GMPVerification.verifyProduct(c, a, b + 1, primeCount: 1))
+    }
+
+    @Test
+    func verifyDivision_EveryRounding_Passes() async throws {
+        // Given: A negative dividend and a divisor below 2^60
+        let d = GMPInteger(-987_654_321_987)
+        let n = -a
+
+        // When: Dividing with each rounding
+        let results = [
+            try n.floorQuotientAndRemainder(dividingBy: d),
+            try n.ceilingQuotientAndRemainder(dividingBy: d),
+            try n.truncatedQuotientAndRemainder(dividingBy: d),
+        ]
+
+        // Then: Each passes, and a quotient off by one fails since no
+        // 61-bit prime divides d
+        for (q, r) in results {
+            #expect(
+                GMPVerification.verifyDivision(
+                    dividend: n,
+                    divisor: d,
+                    quotient: q,
+                    remainder: r
+                )
+            )
+            #expect(
+                !GMPVerification.verifyDivision(
+                    dividend: n,
+                    divisor: d,
+                    quotient: q + 1,
+                    remainder: r
+                )
+            )
+        }
+    }
+
+    @Test
+    func verifyDivision_RemainderTooLarge_Fails() async throws {
+        // Given: a = q·d + r rewritten with one more divisor in r
+        let d = GMPInteger(1) << 100
+        let (q, r) = try a.floorQuotientAndRemainder(dividingBy: d)
+
+        // Then: The identity holds but the remainder is out of range
+        #expect(
+            !GMPVerification.verifyDivision(
+                dividend: a,
+                divisor: d,
+                quotient: q - 1,
+                remainder: r + d
+            )
+        )
+    }
+
+    @Test
+    func verifyModularPower_PositiveAndNegativeExponents() async throws {
+        // Given: An odd modulus and powers with both exponent signs
+        let m = (GMPInteger(1) << 1024) - 105
+        let e = (GMPInteger(1) << 300) + 17
+        let power = a.raisedToPower(e, modulo: m)
+        let inverse = a.raisedToPower(-e, modulo: m)
+
+        // Then: Both pass, and neighbouring values fail
+        #expect(
+            GMPVerification.verifyModularPower(
+                power,
+                base: a,
+                exponent: e,
+                modulus: m
+            )
+        )
+        #expect(
+            GMPVerification.verifyModularPower(
+                inverse,
+                base: a,
+                exponent: -e,
+                modulus: -m
+            )
+        )
+        #expect(
+            !GMPVerification.verifyModularPower(
+                power + 1,
+                base: a,
+                exponent: e,
+                modulus: m
+            )
+        )
+        #expect(
+            !GMPVerification.verifyModularPower(
+                power + m,
+                base: a,
+                exponent: e,
+                modulus: m
+            )
+        )
+    }
+
+    // MARK: - Polynomials
+
+    @Test
+    func verifyPolynomialProduct_Dense_DetectsOneWrongCoefficient()
+        async throws
+    {
+        // Given: A multimodular product of big-coefficient polynomials
+        let f = (0 ..< 40).map { a * $0 - b }
+        let g = (0 ..< 30).map { b - GMPInteger($0) }
+        var product = NumberTheoreticTransform.product(f, g)
+
+        // Then: It passes, and fails once a coefficient is changed
+        #expect(GMPVerification.verifyPolynomialProduct(product, f, g))
+        product[17] += 1
+        #expect(!GMPVerification.verifyPolynomialProduct(product, f, g))
+        #expect(!GMPVerification.verifyPolynomialProduct([], f, g))
+    }
+
+    @Test
+    func verifyPolynomialProduct_Sparse_DetectsWrongProduct() async throws {
+        // Given: (x + y)(x - y) and a wrong expansion
+        let x = SparsePolynomial(variable: 0, of: 2)
+        let y = SparsePolynomial(variable: 1, of: 2)
+        let wrong = SparsePolynomial(
+            variableCount: 2,
+            terms: [([2, 0], 1), ([0, 2], 1)]
+        )
+
+        // Then: Only the true product passes
+        #expect(
+            GMPVerification.verifyPolynomialProduct(
+                (x + y) * (x - y),
+                x + y,
+                x - y
+            )
+        )
+        #expect(!GMPVerification.verifyPolynomialProduct(wrong, x + y, x - y))
+    }
+
+    // MARK: - Automatic Checks and Statistics
+
+    @Test
+    func automatic_EnabledCategories_CountLargeOperations() async throws {
+        // Given: Automatic multiplication and division checks from 64 limbs
+        GMPVerification.automaticCategories = [.multiply, .divide]
+        GMPVerification.automaticMinimumLimbs = 64
+        defer {
+            GMPVerification.automaticCategories = []
+            GMPVerification.automaticMinimumLimbs = 256
+        }
+        let multiplies = GMPVerification.statistics(for: .multiply)
+        let divides = GMPVerification.statistics(for: .divide)
+        let powers = GMPVerification.statistics(for: .powm)
+
+        // When: Multiplying and dividing large operands, and raising to a
+        // power, which is not enabled
+        let c = a * b
+        _ = try c.truncatedQuotientAndRemainder(dividingBy: b)
+        _ = a.raisedToPower(GMPInteger(65537), modulo: c)
+
+        // Then: Each enabled operation is checked and passes
+        let multipliesAfter = GMPVerification.statistics(for: .multiply)
+        let dividesAfter = GMPVerification.statistics(for: .divide)
+        #expect(multipliesAfter.checks > multiplies.checks)
+        #expect(multipliesAfter.failures == multiplies.failures)
+        #expect(dividesAfter.checks > divides.checks)
+        #expect(dividesAfter.failures == divides.failures)
+        #expect(
+            GMPVerification.statistics(for: .powm).checks == powers.checks
+        )
+    }
+
+    @Test
+    func automatic_SmallOperands_AreNotChecked() async throws {
+        // Given: Automatic multiplication checks from the default size
+        GMPVerification.automaticCategories = [.multiply]
+        defer { GMPVerification.automaticCategories = [] }
+
+        // Then: Only operands of at least 256 limbs are checked, and other
+        // categories are not
+        #expect(GMPVerification.automaticMinimumLimbs == 256)
+        #expect(!GMPVerification._isAutomatic(.multiply, size: 255))
+        #expect(GMPVerification._isAutomatic(.multiply, size: 256))
+        #expect(!GMPVerification._isAutomatic(.divide, size: 256))
+    }
+
+    @Test
+    func statistics_Failures_AreCountedInTheRate() async throws {
+        // Given: Zeroed counters
+        GMPVerification.resetStatistics()
+
+        // When: Checking three correct products and one wrong one
+        let c = a * b
+        for _ in 0 ..< 3 {
+            _ = GMPVerification.verifyProduct(c, a, b)
+        }
+        _ = GMPVerification.verifyProduct(c - 1, a, b)
+
+        // Then: One failure in four checks
+        let statistics = GMPVerification.statistics(for: .multiply)
+        #expect(statistics.checks == 4)
+        #expect(statistics.failures == 1)
+        #expect(statistics.failureRate == 0.25)
+        #expect(GMPVerification.statistics().count == 4)
+    }
+}
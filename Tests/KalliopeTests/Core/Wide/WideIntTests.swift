@@ -0,0 +1,160 @@
+@testable import Kalliope
+import Testing
+
+// MARK: - Conversion Tests
+
+struct WideIntConversionTests {
+    @Test
+    func initInt_Negative_SignExtends() async throws {
+        // Given: A negative machine integer
+        let value = -42
+
+        // When: Converting to WideInt512
+        let wide = WideInt512(value)
+
+        // Then: The value is negative and round-trips through GMPInteger
+        #expect(wide.isNegative)
+        #expect(GMPInteger(wide) == GMPInteger(-42))
+        #expect(wide.magnitude == WideUInt512(42))
+    }
+
+    @Test
+    func initExactly_AtAndBeyondBounds_AcceptsOnlyInRange() async throws {
+        // Given: -2^255, 2^255 - 1 and 2^255
+        let minValue = GMPInteger(1).leftShifted(by: 255).negated()
+        let maxValue = GMPInteger(1).leftShifted(by: 255) - GMPInteger(1)
+        let beyond = GMPInteger(1).leftShifted(by: 255)
+
+        // When/Then: Only the in-range values convert
+        #expect(WideInt256(exactly: minValue) == WideInt256.min)
+        #expect(WideInt256(exactly: maxValue) == WideInt256.max)
+        #expect(WideInt256(exactly: beyond) == nil)
+    }
+
+    @Test
+    func description_Negative_IncludesSign() async throws {
+        // Given: A negative value
+        let value = WideInt1024(-1_234_567)
+
+        // When/Then: The description is the signed decimal value
+        #expect(value.description == "-1234567")
+    }
+}
+
+// MARK: - Arithmetic Tests
+
+struct WideIntArithmeticTests {
+    @Test
+    func addingReportingOverflow_PastMax_ReportsOverflow() async throws {
+        // Given: The maximum value
+        let max = WideInt256.max
+
+        // When: Adding one
+        let (sum, overflow) = max.addingReportingOverflow(1)
+
+        // Then: The sum wraps to min and overflow is reported
+        #expect(sum == WideInt256.min)
+        #expect(overflow)
+    }
+
+    @Test
+    func subtraction_MixedSigns_ReturnsExactDifference() async throws {
+        // Given: A negative and a positive value
+        let a = WideInt512(-5)
+        let b = WideInt512(7)
+
+        // When: Subtracting
+        let difference = a - b
+
+        // Then: The result is -12
+        #expect(difference == WideInt512(-12))
+    }
+
+    @Test
+    func multiplication_MixedSigns_MatchesGMPInteger() async throws {
+        // Given: Two large values of opposite sign
+        let a = GMPInteger(3).raisedToPower(200).negated()
+        let b = GMPInteger(5).raisedToPower(100)
+        let wa = try #require(WideInt1024(exactly: a))
+        let wb = try #require(WideInt1024(exactly: b))
+
+        // When: Multiplying
+        let product = wa * wb
+
+        // Then: The result matches GMPInteger
+        #expect(GMPInteger(product) == a * b)
+    }
+
+    @Test
+    func multipliedReportingOverflow_PastMax_ReportsOverflow() async throws {
+        // Given: 2^200 in a 256-bit signed integer
+        let a = WideInt256(1) << 200
+
+        // When: Squaring
+        let (_, overflow) = a.multipliedReportingOverflow(by: a)
+
+        // Then: Overflow is reported
+        #expect(overflow)
+    }
+
+    @Test
+    func division_NegativeDividend_TruncatesTowardZero() async throws {
+        // Given: -7 and 2
+        let a = WideInt256(-7)
+        let b = WideInt256(2)
+
+        // When: Dividing
+        let (q, r) = try a.quotientAndRemainder(dividingBy: b)
+
+        // Then: Matches Swift's Int semantics
+        #expect(q == WideInt256(-7 / 2))
+        #expect(r == WideInt256(-7 % 2))
+    }
+
+    @Test
+    func division_MinByMinusOne_Throws() async throws {
+        // Given: min and -1
+        let minValue = WideInt256.min
+
+        // When/Then: The overflowing division throws
+        #expect(throws: GMPError.overflow) {
+            _ = try minValue.quotientAndRemainder(dividingBy: -1)
+        }
+    }
+
+    @Test
+    func rightShift_Negative_RoundsTowardNegativeInfinity() async throws {
+        // Given: -5
+        let value = WideInt2048(-5)
+
+        // When: Shifting right by 1
+        let shifted = value >> 1
+
+        // Then: Matches Int's arithmetic shift
+        #expect(shifted == WideInt2048(-5 >> 1))
+    }
+
+    @Test
+    func modulo_NegativeValue_ReturnsNonNegativeResidue() async throws {
+        // Given: -10 and modulus 7
+        let value = WideInt256(-10)
+
+        // When: Reducing modulo 7
+        let residue = value.modulo(WideUInt256(7))
+
+        // Then: The residue is 4
+        #expect(residue == WideUInt256(4))
+    }
+
+    @Test
+    func comparison_MixedSigns_OrdersBySign() async throws {
+        // Given: A negative, zero and a positive value
+        let values: [WideInt512] = [5, -3, 0, .min, .max]
+
+        // When: Sorting
+        let sorted = values.sorted()
+
+        // Then: Ordering matches the integer values
+        #expect(sorted == [.min, -3, 0, 5, .max])
+    }
+}
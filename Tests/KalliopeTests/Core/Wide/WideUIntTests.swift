@@ -0,0 +1,276 @@
+@testable import Kalliope
+import Testing
+
+// MARK: - Conversion Tests
+
+struct WideUIntConversionTests {
+    @Test
+    func initExactly_InRange_RoundTripsThroughGMPInteger() async throws {
+        // Given: A 200-bit GMPInteger
+        let value = GMPInteger(1).leftShifted(by: 200) - GMPInteger(12345)
+
+        // When: Converting to WideUInt256 and back
+        let wide = try #require(WideUInt256(exactly: value))
+        let back = GMPInteger(wide)
+
+        // Then: The round trip is exact
+        #expect(back == value)
+        #expect(wide.bitCount == 200)
+    }
+
+    @Test
+    func initExactly_NegativeOrTooWide_ReturnsNil() async throws {
+        // Given: A negative value and a 257-bit value
+        let negative = GMPInteger(-1)
+        let tooWide = GMPInteger(1).leftShifted(by: 256)
+
+        // When/Then: Exact conversion fails for both
+        #expect(WideUInt256(exactly: negative) == nil)
+        #expect(WideUInt256(exactly: tooWide) == nil)
+    }
+
+    @Test
+    func initTruncatingIfNeeded_Negative_Wraps() async throws {
+        // Given: -1 as a GMPInteger
+        let value = GMPInteger(-1)
+
+        // When: Converting with truncation
+        let wide = WideUInt512(truncatingIfNeeded: value)
+
+        // Then: The result is all ones
+        #expect(wide == WideUInt512.max)
+        #expect(wide.nonzeroBitCount == 512)
+    }
+
+    @Test
+    func description_LargeValue_MatchesGMPInteger() async throws {
+        // Given: A 1024-bit value parsed from a string
+        let text = "179769313486231590772930519078902473361797697894230657273430"
+        let wide = try #require(WideUInt1024(text))
+
+        // When/Then: The description is the decimal value
+        #expect(wide.description == text)
+    }
+}
+
+// MARK: - Arithmetic Tests
+
+struct WideUIntArithmeticTests {
+    @Test
+    func addition_CarryAcrossLimbs_Propagates() async throws {
+        // Given: 2^64 - 1 and 1 in the unrolled and mpn widths
+        let small = WideUInt256(UInt.max)
+        let large = WideUInt2048(UInt.max)
+
+        // When: Adding one
+        let smallSum = small + 1
+        let largeSum = large + 1
+
+        // Then: The carry moves into the second limb
+        #expect(smallSum.limb(at: 0) == 0)
+        #expect(smallSum.limb(at: 1) == 1)
+        #expect(largeSum.limb(at: 0) == 0)
+        #expect(largeSum.limb(at: 1) == 1)
+    }
+
+    @Test
+    func addingReportingOverflow_CarryOut_ReportsOverflow() async throws {
+        // Given: The maximum value
+        let max = WideUInt512.max
+
+        // When: Adding one
+        let (sum, overflow) = max.addingReportingOverflow(1)
+
+        // Then: The sum wraps to zero and overflow is reported
+        #expect(sum.isZero)
+        #expect(overflow)
+    }
+
+    @Test
+    func subtractingReportingOverflow_Borrow_ReportsOverflow() async throws {
+        // Given: Zero and one
+        let zero = WideUInt4096.zero
+
+        // When: Subtracting one
+        let (difference, overflow) = zero.subtractingReportingOverflow(1)
+
+        // Then: The difference wraps to max and overflow is reported
+        #expect(difference == WideUInt4096.max)
+        #expect(overflow)
+    }
+
+    @Test
+    func multiplication_Wrapping_MatchesGMPInteger() async throws {
+        // Given: Two 250-bit values
+        let a = GMPInteger(3).raisedToPower(157)
+        let b = GMPInteger(7).raisedToPower(89)
+        let wa = try #require(WideUInt256(exactly: a))
+        let wb = try #require(WideUInt256(exactly: b))
+
+        // When: Multiplying with wrapping
+        let product = wa &* wb
+
+        // Then: The result is the product modulo 2^256
+        let expected = try (a * b).modulo(GMPInteger(1).leftShifted(by: 256))
+        #expect(GMPInteger(product) == expected)
+    }
+
+    @Test
+    func multipliedFullWidth_LargeFactors_IsExact() async throws {
+        // Given: Two large 1024-bit values
+        let a = GMPInteger(1).leftShifted(by: 1000) - GMPInteger(1)
+        let b = GMPInteger(1).leftShifted(by: 1020) + GMPInteger(99)
+        let wa = try #require(WideUInt1024(exactly: a))
+        let wb = try #require(WideUInt1024(exactly: b))
+
+        // When: Computing the double-width product
+        let (high, low) = wa.multipliedFullWidth(by: wb)
+
+        // Then: high * 2^1024 + low equals the exact product
+        let recombined = GMPInteger(high).leftShifted(by: 1024)
+            + GMPInteger(low)
+        #expect(recombined == a * b)
+    }
+
+    @Test
+    func quotientAndRemainder_MultiLimbDivisor_MatchesGMPInteger()
+        async throws
+    {
+        // Given: A 2000-bit dividend and a 700-bit divisor
+        let n = GMPInteger(5).raisedToPower(861)
+        let d = GMPInteger(3).raisedToPower(441)
+        let wn = try #require(WideUInt2048(exactly: n))
+        let wd = try #require(WideUInt2048(exactly: d))
+
+        // When: Dividing
+        let (q, r) = try wn.quotientAndRemainder(dividingBy: wd)
+
+        // Then: The quotient and remainder match truncating division
+        #expect(try GMPInteger(q) == n.truncatedDivided(by: d))
+        #expect(try GMPInteger(r) == n.truncatedRemainder(dividingBy: d))
+    }
+
+    @Test
+    func quotientAndRemainder_SingleLimbDivisor_MatchesGMPInteger()
+        async throws
+    {
+        // Given: A multi-limb dividend and a single-limb divisor
+        let n = GMPInteger(10).raisedToPower(70)
+        let wn = try #require(WideUInt256(exactly: n))
+
+        // When: Dividing by 7
+        let (q, r) = try wn.quotientAndRemainder(dividingBy: 7)
+
+        // Then: q * 7 + r == n
+        #expect(GMPInteger(q) * 7 + GMPInteger(r) == n)
+        #expect(r < 7)
+    }
+
+    @Test
+    func quotientAndRemainder_ZeroDivisor_Throws() async throws {
+        // Given: A value
+        let value = WideUInt256(42)
+
+        // When/Then: Dividing by zero throws
+        #expect(throws: GMPError.divisionByZero) {
+            _ = try value.quotientAndRemainder(dividingBy: .zero)
+        }
+    }
+}
+
+// MARK: - Shift and Bitwise Tests
+
+struct WideUIntShiftTests {
+    @Test
+    func shifts_AcrossLimbBoundaries_MoveBits() async throws {
+        // Given: One
+        let one = WideUInt512(1)
+
+        // When: Shifting left by 200 then right by 73
+        let left = one << 200
+        let right = left >> 73
+
+        // Then: The bit lands at the expected position
+        #expect(left.testBit(200))
+        #expect(left.nonzeroBitCount == 1)
+        #expect(right.trailingZeroBitCount == 127)
+    }
+
+    @Test
+    func shifts_ByFullWidth_ReturnZero() async throws {
+        // Given: The maximum value
+        let max = WideUInt256.max
+
+        // When/Then: Shifting by bitWidth clears everything
+        #expect((max << 256).isZero)
+        #expect((max >> 256).isZero)
+        #expect((max >> 64).leadingZeroBitCount == 64)
+    }
+
+    @Test
+    func bitwiseOperations_MultiLimb_ApplyToEachLimb() async throws {
+        // Given: Two patterns
+        let a = WideUInt256.max >> 128
+        let b = WideUInt256.max << 64
+
+        // When/Then: AND, OR, XOR and NOT behave limb-wise
+        #expect((a & b).nonzeroBitCount == 64)
+        #expect((a | b) == WideUInt256.max)
+        #expect((a ^ b).nonzeroBitCount == 192)
+        #expect(~WideUInt256.zero == WideUInt256.max)
+    }
+}
+
+// MARK: - Modular Arithmetic Tests
+
+struct WideUIntModularTests {
+    @Test
+    func raisedToPowerModulo_MultiLimbModulus_MatchesPowm() async throws {
+        // Given: A 1024-bit odd modulus, base and exponent
+        let m = GMPInteger(1).leftShifted(by: 1023) + GMPInteger(1155)
+        let b = GMPInteger(3).raisedToPower(500)
+        let e = GMPInteger(65537) * GMPInteger(2).raisedToPower(300)
+        let wm = try #require(WideUInt1024(exactly: m))
+        let wb = try #require(WideUInt1024(exactly: b))
+        let we = try #require(WideUInt1024(exactly: e))
+
+        // When: Computing the modular power
+        let result = wb.raisedToPower(we, modulo: wm)
+
+        // Then: The result matches GMPInteger
+        #expect(GMPInteger(result) == b.raisedToPower(e, modulo: m))
+    }
+
+    @Test
+    func raisedToPowerModulo_SingleLimbModulus_MatchesPowm() async throws {
+        // Given: A small prime modulus
+        let m = WideUInt256(1_000_000_007)
+
+        // When: Computing 2^(m-1) mod m
+        let result = WideUInt256(2).raisedToPower(m - 1, modulo: m)
+
+        // Then: Fermat's little theorem gives 1
+        #expect(result == 1)
+    }
+
+    @Test
+    func modularArithmetic_ReducedOperands_StayReduced() async throws {
+        // Given: A modulus near the top of the width and two operands
+        let m = WideUInt256.max - 188
+        let a = WideUInt256.max - 5
+        let b = WideUInt256.max - 7
+
+        // When: Adding, subtracting and multiplying modulo m
+        let sum = a.adding(b, modulo: m)
+        let difference = b.subtracting(a, modulo: m)
+        let product = a.multiplied(by: b, modulo: m)
+
+        // Then: The results agree with GMPInteger
+        let gm = GMPInteger(m)
+        let ga = GMPInteger(a)
+        let gb = GMPInteger(b)
+        #expect(try GMPInteger(sum) == (ga + gb).modulo(gm))
+        #expect(try GMPInteger(difference) == (gb - ga).modulo(gm))
+        #expect(try GMPInteger(product) == (ga * gb).modulo(gm))
+    }
+}
@@ -0,0 +1,144 @@
+import CKalliope // Import CKalliope first so gmp.h is available
+import CLinus
+import CLinusBridge
+import Kalliope
+@testable import Linus
+import Testing
+
+/// Tests for L² lattice reduction and the Gram-Schmidt scalar types.
+struct GMPIntegerMatrixLLLTests {
+    // MARK: - Helper Methods
+
+    /// The determinant of the Gram matrix, computed with exact rationals.
+    /// It is invariant under unimodular row operations.
+    private func gramDeterminant(_ matrix: GMPIntegerMatrix) -> GMPRational {
+        var rows = matrix.gramMatrix.rows.map { $0.map { GMPRational($0) } }
+        let n = rows.count
+        var determinant = GMPRational(GMPInteger(1))
+        for i in 0 ..< n {
+            guard let pivot = (i ..< n).first(where: {
+                !rows[$0][i].numerator.isZero
+            }) else {
+                return GMPRational()
+            }
+            if pivot != i {
+                rows.swapAt(pivot, i)
+                determinant = -determinant
+            }
+            determinant *= rows[i][i]
+            for k in (i + 1) ..< n {
+                let factor = try! rows[k][i] / rows[i][i]
+                for j in i ..< n {
+                    rows[k][j] -= factor * rows[i][j]
+                }
+            }
+        }
+        return determinant
+    }
+
+    /// A knapsack-style lattice: identity on the left, scaled weights in the
+    /// last column.
+    private func knapsackBasis(weights: [GMPInteger]) -> GMPIntegerMatrix {
+        let n = weights.count
+        var matrix = GMPIntegerMatrix(rows: n, columns: n + 1)
+        for i in 0 ..< n {
+            matrix[i, i] = GMPInteger(1)
+            matrix[i, n] = weights[i]
+        }
+        return matrix
+    }
+
+    // MARK: - reduceLLL
+
+    @Test
+    func reduceLLL_SmallBasis_ProducesReducedBasisOfSameLattice() async throws {
+        // Given: A classic 3-dimensional example
+        var basis = GMPIntegerMatrix([[1, 1, 1], [-1, 0, 2], [3, 5, 6]])
+        let determinant = gramDeterminant(basis)
+
+        // When: Reducing with delta = 3/4
+        let report = basis.reduceLLL(delta: 0.75)
+
+        // Then: The basis is reduced, spans the same lattice and is short
+        #expect(basis.isLLLReduced(delta: 0.75))
+        #expect(gramDeterminant(basis) == determinant)
+        #expect(basis.dotProduct(ofRow: 0, withRow: 0) == GMPInteger(1))
+        #expect(report.finalPrecision == .double)
+    }
+
+    @Test
+    func reduceLLL_KnapsackWithLargeEntries_UsesMPFRAndReduces() async throws {
+        // Given: A knapsack lattice with 1000-bit weights
+        let state = GMPRandomState(mersenneTwister: GMPInteger(42))
+        let weights = (0 ..< 12).map { _ in
+            GMPInteger.random(bits: 1000, using: state)
+        }
+        var basis = knapsackBasis(weights: weights)
+        let determinant = gramDeterminant(basis)
+
+        // When: Reducing
+        let report = basis.reduceLLL()
+
+        // Then: MPFR was needed for the exponent range and the result is
+        // reduced
+        if case .mpfr = report.finalPrecision {} else {
+            Issue.record("expected MPFR precision, got \(report.finalPrecision)")
+        }
+        #expect(basis.isLLLReduced(delta: 0.98, eta: 0.52))
+        #expect(gramDeterminant(basis) == determinant)
+    }
+
+    @Test
+    func reduceLLL_ModerateEntries_MatchesAcrossPrecisions() async throws {
+        // Given: A knapsack lattice with 100-bit weights
+        let state = GMPRandomState(mersenneTwister: GMPInteger(7))
+        let weights = (0 ..< 10).map { _ in
+            GMPInteger.random(bits: 100, using: state)
+        }
+        let original = knapsackBasis(weights: weights)
+
+        for precision in [
+            GramSchmidtPrecision.double,
+            .doubleDouble,
+            .mpfr(bits: 128),
+        ] {
+            // When: Reducing from each starting precision
+            var basis = original
+            basis.reduceLLL(startingPrecision: precision)
+
+            // Then: Each result is reduced and spans the same lattice
+            #expect(basis.isLLLReduced(delta: 0.98, eta: 0.52))
+            #expect(gramDeterminant(basis) == gramDeterminant(original))
+        }
+    }
+
+    @Test
+    func reduceLLL_AlreadyReducedBasis_PerformsNoSwaps() async throws {
+        // Given: The identity basis
+        var basis = GMPIntegerMatrix.identity(5)
+
+        // When: Reducing
+        let report = basis.reduceLLL()
+
+        // Then: Nothing changes
+        #expect(report.swapCount == 0)
+        #expect(report.sizeReductionCount == 0)
+        #expect(basis == GMPIntegerMatrix.identity(5))
+    }
+
+    // MARK: - GramSchmidtScalar
+
+    @Test
+    func gramSchmidtScalar_MPFRFloat_RoundsToNearestInteger() async throws {
+        // Given: An MPFR value just above a half-integer at high precision
+        let value = MPFRFloat(converting: 2.5, precision: 200)
+            + MPFRFloat(converting: 1e-40, precision: 200)
+
+        // When: Rounding to an integer
+        let rounded = value.roundedToGMPInteger()
+
+        // Then: The tiny excess rounds up
+        #expect(rounded == GMPInteger(3))
+        #expect(value.isFinite)
+    }
+}
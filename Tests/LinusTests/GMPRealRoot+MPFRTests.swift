@@ -0,0 +1,40 @@
+import CKalliope // Import CKalliope first so gmp.h is available
+import CLinus
+import CLinusBridge
+import Kalliope
+@testable import Linus
+import Testing
+
+/// Tests for rounding isolated real roots to `MPFRFloat`.
+struct GMPRealRootMPFRTests {
+    @Test
+    func value_SquareRootOfTwo_MatchesSquareRoot() async throws {
+        // Given: The roots of x² - 2
+        let roots = GMPRealRoot.roots(of: [-2, 0, 1])
+        #expect(roots.count == 2)
+
+        // When: Rounding both to 256 bits
+        let precision = 256
+        let negative = roots[0].value(precision: precision)
+        let positive = roots[1].value(precision: precision)
+
+        // Then: They are ±√2 to within an ulp
+        let expected = MPFRFloat(2, precision: precision).squareRoot().result
+        let error = (positive - expected).absoluteValue().result
+        #expect(error.toDouble() <= 0x1p-255)
+        let mirrored = (negative + expected).absoluteValue().result
+        #expect(mirrored.toDouble() <= 0x1p-255)
+    }
+
+    @Test
+    func value_SmallRoot_KeepsRelativeAccuracy() async throws {
+        // Given: 2^40 x - 3, whose root is far below the isolation bound
+        let roots = GMPRealRoot.roots(of: [-3, GMPInteger(1) << 40])
+
+        // When: Rounding to 128 bits
+        let value = roots[0].value(precision: 128)
+
+        // Then: The dyadic root 3/2^40 is recovered exactly
+        #expect(value == MPFRFloat(0x3p-40, precision: 128))
+    }
+}
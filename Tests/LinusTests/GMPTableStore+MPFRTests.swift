@@ -0,0 +1,91 @@
+import CKalliope // Import CKalliope first so gmp.h is available
+import CLinus
+import CLinusBridge
+import Foundation
+import Kalliope
+@testable import Linus
+import Testing
+
+/// Tests for MPFR float tables in a `GMPTableStore`.
+struct GMPTableStoreMPFRTests {
+    private func temporaryPath() -> String {
+        FileManager.default.temporaryDirectory
+            .appendingPathComponent(UUID().uuidString).path
+    }
+
+    @Test
+    func floats_Constants_RoundTripAtFullPrecision() async throws {
+        // Given: π and log 2 at 100000 bits
+        let path = temporaryPath()
+        defer { try? FileManager.default.removeItem(atPath: path) }
+        let precision = 100_000
+        var builder = GMPTableStoreBuilder()
+        builder.addConstants(precision: precision)
+        try builder.write(to: path)
+
+        // When: Mapping the store
+        let store = try GMPTableStore(contentsOf: path)
+        let constants = try #require(store.floats(named: "constants"))
+
+        // Then: The values match MPFR's constants bit for bit
+        #expect(constants.count == 2)
+        #expect(constants.precision(at: 0) == precision)
+        #expect(constants[0] == MPFRFloat.pi(precision: precision).result)
+        #expect(constants[1] == MPFRFloat.log2(precision: precision).result)
+    }
+
+    @Test
+    func floats_SpecialValues_RoundTrip() async throws {
+        // Given: Zero, negative, infinite, NaN and regular values at mixed
+        // precisions
+        let path = temporaryPath()
+        defer { try? FileManager.default.removeItem(atPath: path) }
+        let values = [
+            MPFRFloat(0, precision: 64),
+            MPFRFloat(-2.5, precision: 200),
+            MPFRFloat(Double.infinity, precision: 53),
+            MPFRFloat(precision: 80),
+            MPFRFloat(1e-300, precision: 2),
+        ]
+        var builder = GMPTableStoreBuilder()
+        builder.add("values", floats: values)
+        try builder.write(to: path)
+
+        // When: Reading the table
+        let table = try #require(
+            GMPTableStore(contentsOf: path).floats(named: "values")
+        )
+
+        // Then: Each value and precision is preserved
+        #expect(table[0].isZero)
+        #expect(table[1] == values[1])
+        #expect(table[1].precision == 200)
+        #expect(table[2].isInfinity)
+        #expect(table[3].isNaN)
+        #expect(table[4] == values[4])
+    }
+
+    @Test
+    func withElement_ReadOnlyView_IsUsableAsOperand() async throws {
+        // Given: A stored π
+        let path = temporaryPath()
+        defer { try? FileManager.default.removeItem(atPath: path) }
+        var builder = GMPTableStoreBuilder()
+        builder.addConstants(precision: 256)
+        try builder.write(to: path)
+        let constants = try #require(
+            GMPTableStore(contentsOf: path).floats(named: "constants")
+        )
+
+        // When: Doubling π straight from the mapping
+        let twoPi = MPFRFloat(precision: 256)
+        constants.withElement(at: 0) { pi in
+            mpfr_mul_2ui(&twoPi._storage.value, pi, 1, MPFR_RNDN)
+        }
+
+        // Then: The result is 2π
+        let expected = MPFRFloat.pi(precision: 256).result
+            .multipliedByPowerOf2(1).result
+        #expect(twoPi == expected)
+    }
+}
@@ -0,0 +1,155 @@
+import CKalliope // Import CKalliope first so gmp.h is available
+import CLinus
+import CLinusBridge
+import Kalliope
+@testable import Linus
+import Testing
+
+/// Tests for hypergeometric series evaluation and its power cache.
+struct HypergeometricFunctionTests {
+    // MARK: - value(at: MPFRFloat)
+
+    @Test
+    func value_ZeroFZero_ComputesExponential() async throws {
+        // Given: 0F0(; ; z) = exp(z)
+        let precision = 256
+        let z = MPFRFloat(0.75, precision: precision)
+        let f = HypergeometricFunction(upper: [], lower: [])
+
+        // When: Evaluating by rectangular splitting
+        let value = f.value(at: z)
+
+        // Then: The value matches mpfr_exp to nearly full precision
+        let expected = try z.exp().result
+        let error = (value - expected).absoluteValue().result
+        #expect(value.precision == precision)
+        #expect(error.toDouble() < 0x1p-250)
+    }
+
+    @Test
+    func value_Cancellation_KeepsAbsoluteAccuracy() async throws {
+        // Given: exp(-20), whose terms reach about 2^25 before cancelling
+        let precision = 128
+        let z = MPFRFloat(-20, precision: precision)
+        let f = HypergeometricFunction(upper: [], lower: [])
+
+        // When: Evaluating
+        let value = f.value(at: z)
+
+        // Then: The extra working precision absorbs the cancellation
+        let expected = try z.exp().result
+        let error = (value - expected).absoluteValue().result
+        #expect(error.toDouble() < 0x1p-120)
+    }
+
+    @Test
+    func value_TerminatingSeries_IgnoresConvergence() async throws {
+        // Given: 1F0(-4; ; z) = (1 - z)^4, which diverges as a series but
+        // terminates after five terms
+        let f = HypergeometricFunction(upper: [-4], lower: [])
+
+        // When: Evaluating at z = 3
+        let value = f.value(at: MPFRFloat(3, precision: 64))
+
+        // Then: The polynomial value is exact
+        #expect(value == MPFRFloat(16, precision: 64))
+    }
+
+    // MARK: - value(at: GMPRational)
+
+    @Test
+    func value_RationalArgument_UsesExactSum() async throws {
+        // Given: 2F1(1, 1; 2; z) = -log(1 - z)/z, at z = 1/2
+        let precision = 300
+        let f = HypergeometricFunction(upper: [1, 1], lower: [2])
+        let z = try GMPRational(numerator: 1, denominator: 2)
+
+        // When: Evaluating by binary splitting
+        let value = f.value(at: z, precision: precision)
+
+        // Then: The value is 2 log 2
+        let two = MPFRFloat(2, precision: precision)
+        let expected = two * (try two.log().result)
+        let error = (value - expected).absoluteValue().result
+        #expect(error.toDouble() < 0x1p-290)
+    }
+
+    @Test
+    func value_RationalAndFloat_Agree() async throws {
+        // Given: 1F1(1/3; 5/2; z) at z = 7/3, with rational parameters
+        let precision = 200
+        let f = HypergeometricFunction(
+            upper: [try GMPRational(numerator: 1, denominator: 3)],
+            lower: [try GMPRational(numerator: 5, denominator: 2)]
+        )
+        let z = try GMPRational(numerator: 7, denominator: 3)
+        var rounded = MPFRFloat(precision: precision + 64)
+        rounded.set(z)
+
+        // When: Evaluating by binary and by rectangular splitting
+        let exact = f.value(at: z, precision: precision)
+        let splitting = f.value(at: rounded, precision: precision)
+
+        // Then: Both paths agree to the requested precision
+        let error = (exact - splitting).absoluteValue().result
+        #expect(error.toDouble() < 0x1p-190)
+    }
+
+    // MARK: - Power Cache
+
+    @Test
+    func powerCache_SameArgument_ReusesTable() async throws {
+        // Given: A cached table of powers of an argument no other test uses
+        let cache = _HypergeometricPowerCache.shared
+        let z = MPFRFloat(0.3125, precision: 96)
+        let first = cache.powers(of: z, count: 12, precision: 96)
+
+        // When: Requesting fewer powers at a lower precision
+        let second = cache.powers(of: z, count: 8, precision: 80)
+
+        // Then: The table is shared and holds z^i
+        #expect(first === second)
+        #expect(first.count == 12)
+        let cube = first.buffer.float(at: 3)
+        #expect(cube == z * z * z)
+
+        // When: Requesting more powers
+        let third = cache.powers(of: z, count: 20, precision: 96)
+
+        // Then: A larger table replaces it
+        #expect(third !== first)
+        #expect(third.count == 20)
+    }
+
+    @Test
+    func powerCache_SameValueAtOtherPrecision_ReusesTable() async throws {
+        // Given: A table for an argument no other test uses
+        let cache = _HypergeometricPowerCache.shared
+        let narrow = MPFRFloat(0.40625, precision: 64)
+        let wide = MPFRFloat(0.40625, precision: 256)
+        let first = cache.powers(of: narrow, count: 6, precision: 64)
+
+        // When: Requesting the same value held at a higher precision
+        let second = cache.powers(of: wide, count: 6, precision: 64)
+
+        // Then: Both share one table
+        #expect(first === second)
+    }
+
+    @Test
+    func powerCache_Registry_ReportsEntries() async throws {
+        // Given: A cached table
+        let cache = _HypergeometricPowerCache.shared
+        let z = MPFRFloat(0.15625, precision: 64)
+        let powers = cache.powers(of: z, count: 4, precision: 64)
+
+        // When: Reading the registry statistics
+        let statistics = GMPCacheRegistry.shared.statistics()
+            .first { $0.name == cache.cacheName }
+
+        // Then: The cache is registered and its entries are accounted
+        let cached = try #require(statistics)
+        #expect(cached.byteCount >= powers.byteCount)
+        #expect(powers.byteCount > 0)
+    }
+}
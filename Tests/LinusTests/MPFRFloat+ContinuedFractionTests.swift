@@ -0,0 +1,60 @@
+import CKalliope // Import CKalliope first so gmp.h is available
+import CLinus
+import CLinusBridge
+import Kalliope
+@testable import Linus
+import Testing
+
+struct MPFRFloatContinuedFractionTests {
+    @Test
+    func init_DyadicFloat_ExpandsExactValue() async throws {
+        // Given: 0.375 = 3/8 and -6 = -6 · 2^0
+        let fraction = ContinuedFraction(MPFRFloat(0.375, precision: 64))
+        let integer = ContinuedFraction(MPFRFloat(-6.0, precision: 64))
+
+        // When/Then: 3/8 = [0; 2, 1, 2] and -6 = [-6]
+        #expect(Array(fraction) == [0, 2, 1, 2])
+        #expect(Array(integer) == [-6])
+    }
+
+    @Test
+    func bestRationalApproximation_Pi_ReturnsClassicalFractions()
+        async throws
+    {
+        // Given: π at 4096 bits
+        let pi = MPFRFloat.pi(precision: 4096).result
+
+        // When: Bounding the denominator
+        let small = pi.bestRationalApproximation(maxDenominator: 10)
+        let large = pi.bestRationalApproximation(maxDenominator: 16000)
+
+        // Then: 22/7 and 355/113
+        #expect(small == (try GMPRational(numerator: 22, denominator: 7)))
+        #expect(large == (try GMPRational(numerator: 355, denominator: 113)))
+    }
+
+    @Test
+    func init_Pi_MatchesRationalExpansion() async throws {
+        // Given: π at 20000 bits and its exact value as a rational
+        let pi = MPFRFloat.pi(precision: 20000).result
+        var mantissa = GMPInteger()
+        var exponent = 0
+        pi.withCPointer { x in
+            mantissa.withMutableCPointer { z in
+                exponent = Int(mpfr_get_z_2exp(z, x))
+            }
+        }
+        let exact = try GMPRational(
+            numerator: mantissa,
+            denominator: GMPInteger(1) << -exponent
+        )
+
+        // When: Expanding both
+        let fromFloat = Array(ContinuedFraction(pi))
+        let fromRational = Array(ContinuedFraction(exact))
+
+        // Then: They agree and start [3; 7, 15, 1, 292]
+        #expect(fromFloat == fromRational)
+        #expect(Array(fromFloat.prefix(5)) == [3, 7, 15, 1, 292])
+    }
+}
@@ -0,0 +1,97 @@
+import CKalliope // Import CKalliope first so gmp.h is available
+import CLinus
+import CLinusBridge
+import Kalliope
+@testable import Linus
+import Testing
+
+/// Tests for PSLQ integer relation detection.
+struct MPFRFloatIntegerRelationTests {
+    // MARK: - Helper Methods
+
+    /// `[1, value, value^2, ..., value^degree]`.
+    private func powers(of value: MPFRFloat, degree: Int) -> [MPFRFloat] {
+        var result = [MPFRFloat(1, precision: value.precision)]
+        for _ in 0 ..< degree {
+            result.append(result[result.count - 1] * value)
+        }
+        return result
+    }
+
+    private func squareRoot(_ value: Int, precision: Int) -> MPFRFloat {
+        MPFRFloat(value, precision: precision).squareRoot().result
+    }
+
+    // MARK: - integerRelation(among:)
+
+    @Test
+    func integerRelation_Logarithms_FindsLogProductRule() async throws {
+        // Given: log 2, log 3 and log 6 at 256 bits
+        let values = try [2, 3, 6].map {
+            try MPFRFloat($0, precision: 256).log().result
+        }
+
+        // When: Searching for a relation
+        let relation = try #require(MPFRFloat.integerRelation(among: values))
+
+        // Then: log 2 + log 3 - log 6 = 0
+        #expect(relation.coefficients == [1, 1, -1].map { GMPInteger($0) })
+        #expect(relation.residual.toDouble().magnitude < 0x1p-240)
+    }
+
+    @Test
+    func integerRelation_AlgebraicNumber_FindsMinimalPolynomial() async throws {
+        // Given: Powers of sqrt(2) + sqrt(3) + sqrt(5), whose minimal
+        // polynomial is x^8 - 40x^6 + 352x^4 - 960x^2 + 576
+        let precision = 512
+        let alpha = squareRoot(2, precision: precision)
+            + squareRoot(3, precision: precision)
+            + squareRoot(5, precision: precision)
+        let values = powers(of: alpha, degree: 8)
+
+        // When: Searching for a relation
+        let relation = try #require(MPFRFloat.integerRelation(among: values))
+
+        // Then: The coefficients are those of the minimal polynomial
+        let expected = [576, 0, -960, 0, 352, 0, -40, 0, 1]
+        #expect(relation.coefficients == expected.map { GMPInteger($0) })
+        #expect(relation.iterations > 0)
+    }
+
+    @Test
+    func integerRelation_NoSmallRelation_StopsAtNormBound() async throws {
+        // Given: 1, pi and e, which have no known integer relation
+        let precision = 256
+        let values = try [
+            MPFRFloat(1, precision: precision),
+            MPFRFloat.pi(precision: precision).result,
+            MPFRFloat(1, precision: precision).exp().result,
+        ]
+
+        // When: Searching with a small norm bound
+        let relation = MPFRFloat.integerRelation(
+            among: values,
+            maximumNorm: 1000
+        )
+
+        // Then: No relation is reported
+        #expect(relation == nil)
+    }
+
+    @Test
+    func integerRelation_ZeroValue_ReturnsUnitVector() async throws {
+        // Given: A list containing an exact zero
+        let values = [
+            MPFRFloat.pi(precision: 128).result,
+            MPFRFloat(0, precision: 128),
+            MPFRFloat(3, precision: 128),
+        ]
+
+        // When: Searching for a relation
+        let relation = try #require(MPFRFloat.integerRelation(among: values))
+
+        // Then: The zero is its own relation
+        #expect(relation.coefficients == [0, 1, 0].map { GMPInteger($0) })
+        #expect(relation.iterations == 0)
+    }
+}
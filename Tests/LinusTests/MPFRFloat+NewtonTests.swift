@@ -0,0 +1,155 @@
+import CKalliope // Import CKalliope first so gmp.h is available
+import CLinus
+import CLinusBridge
+import Kalliope
+@testable import Linus
+import Testing
+
+/// Tests for the precision-doubling Newton solvers.
+struct MPFRFloatNewtonTests {
+    // MARK: - newtonRoot
+
+    @Test
+    func newtonRoot_SquareRootOfTwo_MatchesMPFRSqrt() async throws {
+        // Given: f(x) = x^2 - 2 with a Double seed
+        let precision = 4000
+
+        // When: Solving to 4000 bits
+        let result = try MPFRFloat.newtonRoot(
+            seed: 1.4,
+            precision: precision,
+            function: { x in x * x - 2 },
+            derivative: { x in x * 2 }
+        )
+
+        // Then: The root matches mpfr_sqrt and is verified
+        let expected = MPFRFloat(2, precision: precision).squareRoot().result
+        let error = (result.root - expected).absoluteValue().result
+        #expect(result.root.precision == precision)
+        #expect(error <= expected.dividedByPowerOf2(precision - 8).result)
+        #expect(result.isVerified)
+        #expect(!result.usedBracketing)
+    }
+
+    @Test
+    func newtonRoot_DivergentSeedWithBracket_FallsBackToBracketing()
+        async throws
+    {
+        // Given: f(x) = atan(x - 1), for which Newton diverges from x = 5
+        let precision = 512
+
+        // When: Solving with a bracket
+        let result = try MPFRFloat.newtonRoot(
+            seed: 5,
+            precision: precision,
+            bracket: -10 ... 10,
+            function: { x in (x - 1).atan().result },
+            derivative: { x in
+                let shifted = x - 1
+                return MPFRFloat(1, precision: x.precision)
+                    / (shifted * shifted + 1)
+            }
+        )
+
+        // Then: The bracket rescued the iteration and the root is 1
+        let error = (result.root - MPFRFloat(1, precision: precision))
+            .absoluteValue().result
+        #expect(result.usedBracketing)
+        #expect(error.toDouble() < 0x1p-500)
+        #expect(result.isVerified)
+    }
+
+    @Test
+    func newtonRoot_DivergentSeedWithoutBracket_Throws() async throws {
+        // Given: The same divergent setup without a bracket
+        // When/Then: The solver reports non-convergence
+        #expect(throws: RootFindingError.noConvergence) {
+            _ = try MPFRFloat.newtonRoot(
+                seed: 5,
+                precision: 128,
+                function: { x in (x - 1).atan().result },
+                derivative: { x in
+                    let shifted = x - 1
+                    return MPFRFloat(1, precision: x.precision)
+                        / (shifted * shifted + 1)
+                }
+            )
+        }
+    }
+
+    @Test
+    func newtonRoot_BracketWithoutSignChange_Throws() async throws {
+        // Given: A function that is positive on the whole bracket
+        // When/Then: Bracketing is rejected once Newton fails
+        #expect(throws: RootFindingError.invalidBracket) {
+            _ = try MPFRFloat.newtonRoot(
+                seed: 0,
+                precision: 128,
+                bracket: -1 ... 1,
+                function: { x in x * x + 1 },
+                derivative: { x in x * 2 }
+            )
+        }
+    }
+
+    // MARK: - newtonSolve
+
+    @Test
+    func newtonSolve_PolynomialSystem_ConvergesToTargetPrecision()
+        async throws
+    {
+        // Given: x^2 + y^2 = 4 and x * y = 1
+        let precision = 1024
+
+        // When: Solving from a nearby seed
+        let result = try MPFRFloat.newtonSolve(
+            seed: [1.9, 0.5],
+            precision: precision,
+            system: { v in
+                [v[0] * v[0] + v[1] * v[1] - 4, v[0] * v[1] - 1]
+            },
+            jacobian: { v in
+                [[v[0] * 2, v[1] * 2], [v[1], v[0]]]
+            }
+        )
+
+        // Then: The residual is at the rounding level of the target
+        #expect(result.solution.allSatisfy { $0.precision == precision })
+        #expect(result.residualNorm.toDouble() < 0x1p-1000)
+    }
+
+    @Test
+    func newtonSolve_SingularJacobian_Throws() async throws {
+        // Given: A system whose Jacobian is identically singular
+        // When/Then: The solver reports the singular Jacobian
+        #expect(throws: RootFindingError.singularDerivative) {
+            _ = try MPFRFloat.newtonSolve(
+                seed: [1, 1],
+                precision: 128,
+                system: { v in [v[0] + v[1] - 2, v[0] + v[1] - 2] },
+                jacobian: { v in
+                    let one = MPFRFloat(1, precision: v[0].precision)
+                    return [[one, one], [one, one]]
+                }
+            )
+        }
+    }
+
+    // MARK: - Precision Schedule
+
+    @Test
+    func precisionSchedule_EndsAtTargetAndRoughlyDoubles() async throws {
+        // Given: A large target precision
+        let target = 100_000
+
+        // When: Building the schedule
+        let schedule = MPFRFloat._newtonPrecisionSchedule(target: target)
+
+        // Then: It increases to the target, at most doubling per step
+        #expect(schedule.last == target)
+        for (previous, next) in zip(schedule, schedule.dropFirst()) {
+            #expect(previous < next)
+            #expect(next <= 2 * previous)
+        }
+    }
+}
@@ -0,0 +1,121 @@
+import CKalliope // Import CKalliope first so gmp.h is available
+import CLinus
+import CLinusBridge
+import Kalliope
+@testable import Linus
+import Testing
+
+/// Tests for MPFR random sampling.
+struct MPFRFloatRandomTests {
+    private func mean(_ samples: MPFRMatrix) -> Double {
+        var sum = MPFRFloat(0, precision: samples.precision)
+        for i in 0 ..< samples.rowCount {
+            sum += samples[i, 0]
+        }
+        return sum.toDouble() / Double(samples.rowCount)
+    }
+
+    // MARK: - Scalar Sampling
+
+    @Test
+    func random_UniformBits_IsMultipleOfUlpInUnitInterval() async throws {
+        // Given: A seeded state
+        let state = GMPRandomState(mersenneTwister: GMPInteger(7))
+
+        // When: Drawing 100 samples of 8 random bits
+        let samples = (0 ..< 100).map { _ in
+            MPFRFloat.random(.uniformBits, precision: 8, using: state)
+        }
+
+        // Then: Each is k / 256 with 0 <= k < 256
+        for sample in samples {
+            let scaled = sample.multipliedByPowerOf2(8).result.toDouble()
+            #expect(scaled >= 0 && scaled < 256)
+            #expect(scaled == scaled.rounded())
+        }
+    }
+
+    @Test
+    func random_SameSeed_ProducesSameSequence() async throws {
+        // Given: Two states with the same seed
+        let first = GMPRandomState(mersenneTwister: GMPInteger(123))
+        let second = GMPRandomState(mersenneTwister: GMPInteger(123))
+
+        // When: Drawing normal samples from each
+        let a = (0 ..< 10).map { _ in
+            MPFRFloat.random(.normal, precision: 256, using: first)
+        }
+        let b = (0 ..< 10).map { _ in
+            MPFRFloat.random(.normal, precision: 256, using: second)
+        }
+
+        // Then: The sequences match and advance
+        #expect(a == b)
+        #expect(a[0] != a[1])
+    }
+
+    @Test
+    func random_Exponential_IsNonNegative() async throws {
+        // Given: A seeded state
+        let state = GMPRandomState(mersenneTwister: GMPInteger(99))
+
+        // When: Drawing exponential samples
+        let samples = (0 ..< 200).map { _ in
+            MPFRFloat.random(.exponential, precision: 128, using: state)
+        }
+
+        // Then: All are non-negative and carry the requested precision
+        #expect(samples.allSatisfy { !$0.isNegative && $0.precision == 128 })
+    }
+
+    // MARK: - Bulk Sampling
+
+    @Test
+    func matrixRandom_Normal_HasExpectedMoments() async throws {
+        // Given: A seeded state and enough samples for several streams
+        let state = GMPRandomState(mersenneTwister: GMPInteger(2024))
+        let count = 5 * MPFRMatrix.randomChunkSize
+
+        // When: Filling a column with normal samples
+        let samples = MPFRMatrix.random(
+            rows: count,
+            columns: 1,
+            precision: 256,
+            distribution: .normal,
+            using: state
+        )
+
+        // Then: The sample mean is near 0 and entries use the precision
+        #expect(samples.precision == 256)
+        #expect(abs(mean(samples)) < 0.05)
+    }
+
+    @Test
+    func matrixRandom_SameSeed_IsReproducible() async throws {
+        // Given: Two states with the same seed
+        let first = GMPRandomState(mersenneTwister: GMPInteger(5))
+        let second = GMPRandomState(mersenneTwister: GMPInteger(5))
+        let rows = 3 * MPFRMatrix.randomChunkSize + 17
+
+        // When: Filling matrices spanning several concurrent streams
+        let a = MPFRMatrix.random(
+            rows: rows,
+            columns: 2,
+            precision: 64,
+            distribution: .uniform,
+            using: first
+        )
+        let b = MPFRMatrix.random(
+            rows: rows,
+            columns: 2,
+            precision: 64,
+            distribution: .uniform,
+            using: second
+        )
+
+        // Then: The results are identical and the streams differ
+        #expect(a == b)
+        #expect(a[0, 0] != a[MPFRMatrix.randomChunkSize / 2, 0])
+        #expect(abs(mean(a) - 0.5) < 0.05)
+    }
+}
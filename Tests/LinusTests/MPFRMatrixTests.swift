@@ -0,0 +1,226 @@
+import CKalliope // Import CKalliope first so gmp.h is available
+import CLinus
+import CLinusBridge
+import Kalliope
+@testable import Linus
+import Testing
+
+/// Tests for `MPFRMatrix` products and LU-based solvers.
+struct MPFRMatrixTests {
+    /// A deterministic well-conditioned test matrix: diagonally dominant
+    /// with entries of mixed sign.
+    private func testMatrix(_ n: Int, precision: Int) -> MPFRMatrix {
+        var matrix = MPFRMatrix(rows: n, columns: n, precision: precision)
+        for i in 0 ..< n {
+            for j in 0 ..< n {
+                let offDiagonal = (i * 7 + j * 13) % 11 - 5
+                matrix[i, j] = i == j
+                    ? MPFRFloat(2 * n, precision: precision)
+                    : MPFRFloat(offDiagonal, precision: precision) / 3
+            }
+        }
+        return matrix
+    }
+
+    private func maximumDistance(
+        _ lhs: MPFRMatrix,
+        _ rhs: MPFRMatrix
+    ) -> MPFRFloat {
+        var result = MPFRFloat(0, precision: lhs.precision)
+        for i in 0 ..< lhs.rowCount {
+            for j in 0 ..< lhs.columnCount {
+                let distance = (lhs[i, j] - rhs[i, j]).absoluteValue().result
+                if distance > result {
+                    result = distance
+                }
+            }
+        }
+        return result
+    }
+
+    // MARK: - Storage
+
+    @Test
+    func subscript_SetOnCopy_DoesNotAffectOriginal() async throws {
+        // Given: A matrix and a copy
+        let original = MPFRMatrix.identity(3, precision: 128)
+        var copy = original
+
+        // When: Mutating the copy
+        copy[0, 0] = MPFRFloat(5, precision: 128)
+
+        // Then: The original is unchanged
+        #expect(original[0, 0] == MPFRFloat(1, precision: 128))
+        #expect(copy[0, 0] == MPFRFloat(5, precision: 128))
+        #expect(original != copy)
+    }
+
+    @Test
+    func transposed_Rectangular_SwapsIndices() async throws {
+        // Given: A 2x3 matrix
+        let matrix = MPFRMatrix([
+            [1, 2, 3].map { MPFRFloat($0, precision: 64) },
+            [4, 5, 6].map { MPFRFloat($0, precision: 64) },
+        ])
+
+        // When: Transposing
+        let transposed = matrix.transposed
+
+        // Then: The shape and entries are swapped
+        #expect(transposed.rowCount == 3)
+        #expect(transposed.columnCount == 2)
+        #expect(transposed[2, 1] == MPFRFloat(6, precision: 64))
+    }
+
+    // MARK: - Products
+
+    @Test
+    func multiplied_AgainstNaiveProduct_Matches() async throws {
+        // Given: Integer matrices larger than one tile, so products are exact
+        let precision = 256
+        let a = MPFRMatrix((0 ..< 37).map { i in
+            (0 ..< 21).map { j in
+                MPFRFloat((i * j) % 17 - 8, precision: 64)
+            }
+        }, precision: precision)
+        let b = MPFRMatrix((0 ..< 21).map { i in
+            (0 ..< 19).map { j in
+                MPFRFloat((i + 3 * j) % 13 - 6, precision: 64)
+            }
+        }, precision: precision)
+
+        // When: Multiplying
+        let product = a * b
+
+        // Then: Every entry equals the schoolbook sum
+        #expect(product.rowCount == 37)
+        #expect(product.columnCount == 19)
+        for i in 0 ..< 37 {
+            for j in 0 ..< 19 {
+                var expected = 0
+                for k in 0 ..< 21 {
+                    expected += ((i * k) % 17 - 8) * ((k + 3 * j) % 13 - 6)
+                }
+                #expect(product[i, j] == MPFRFloat(expected, precision: 64))
+            }
+        }
+    }
+
+    @Test
+    func multiplied_DotProduct_RoundsOnce() async throws {
+        // Given: 2^60 + 1 - 2^60 at 53 bits, which loses the 1 when each
+        // product is rounded separately
+        let precision = 53
+        let big = MPFRFloat(1, precision: precision)
+            .multipliedByPowerOf2(60).result
+        let one = MPFRFloat(1, precision: precision)
+        let row = MPFRMatrix([[big, one, big]])
+        let column = MPFRMatrix([[one], [one], [one.negated().result]])
+
+        // When: Multiplying
+        let product = row * column
+
+        // Then: The exact sum 1 is recovered
+        #expect(product[0, 0] == MPFRFloat(1, precision: precision))
+    }
+
+    // MARK: - LU
+
+    @Test
+    func solve_DiagonallyDominant_HasSmallResidual() async throws {
+        // Given: A 40x40 system at 300 bits
+        let precision = 300
+        let a = testMatrix(40, precision: precision)
+        let b = (0 ..< 40).map { MPFRFloat($0 - 20, precision: precision) }
+
+        // When: Solving
+        let x = try a.solve(b)
+
+        // Then: A x reproduces b to working precision
+        let residual = a.multiplied(by: x)
+        let tolerance = MPFRFloat(1, precision: precision)
+            .dividedByPowerOf2(precision - 20).result
+        for i in 0 ..< 40 {
+            let error = (residual[i] - b[i]).absoluteValue().result
+            #expect(error <= tolerance)
+        }
+    }
+
+    @Test
+    func luDecomposition_NeedsPivoting_ReconstructsPermutedMatrix()
+        async throws
+    {
+        // Given: A matrix with a zero leading entry
+        let a = MPFRMatrix([
+            [0, 2, 1].map { MPFRFloat($0, precision: 128) },
+            [3, 1, 4].map { MPFRFloat($0, precision: 128) },
+            [1, 5, 9].map { MPFRFloat($0, precision: 128) },
+        ])
+
+        // When: Decomposing
+        let lu = try a.luDecomposition()
+
+        // Then: L U equals the permuted matrix and the determinant is exact
+        var lower = MPFRMatrix.identity(3, precision: 128)
+        var upper = MPFRMatrix(rows: 3, columns: 3, precision: 128)
+        for i in 0 ..< 3 {
+            for j in 0 ..< 3 {
+                if j < i {
+                    lower[i, j] = lu.factors[i, j]
+                } else {
+                    upper[i, j] = lu.factors[i, j]
+                }
+            }
+        }
+        let product = lower * upper
+        let tolerance = MPFRFloat(1, precision: 128).dividedByPowerOf2(120)
+            .result
+        for i in 0 ..< 3 {
+            for j in 0 ..< 3 {
+                let error = (product[i, j] - a[lu.permutation[i], j])
+                    .absoluteValue().result
+                #expect(error <= tolerance)
+            }
+        }
+        let expected = MPFRFloat(-32, precision: 128)
+        let determinantError = (a.determinant - expected)
+            .absoluteValue().result
+        #expect(determinantError <= tolerance)
+    }
+
+    @Test
+    func inverse_TimesMatrix_IsIdentity() async throws {
+        // Given: A 70x70 matrix, large enough to run concurrently
+        let precision = 200
+        let a = testMatrix(70, precision: precision)
+
+        // When: Inverting
+        let inverse = try a.inverse()
+
+        // Then: A^-1 A is the identity to working precision
+        let distance = maximumDistance(
+            inverse * a,
+            .identity(70, precision: precision)
+        )
+        let tolerance = MPFRFloat(1, precision: precision)
+            .dividedByPowerOf2(precision - 20).result
+        #expect(distance <= tolerance)
+    }
+
+    @Test
+    func luDecomposition_Singular_ThrowsDivideByZero() async throws {
+        // Given: A matrix whose first two rows are parallel, chosen so
+        // elimination is exact
+        let a = MPFRMatrix([
+            [2, 4, 6].map { MPFRFloat($0, precision: 64) },
+            [1, 2, 3].map { MPFRFloat($0, precision: 64) },
+            [4, 8, 1].map { MPFRFloat($0, precision: 64) },
+        ])
+
+        // When/Then: Decomposing throws and the determinant is zero
+        #expect(throws: MPFRError.divideByZero) {
+            _ = try a.luDecomposition()
+        }
+        #expect(a.determinant.isZero)
+    }
+}
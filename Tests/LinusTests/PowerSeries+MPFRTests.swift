@@ -0,0 +1,70 @@
+import CKalliope // Import CKalliope first so gmp.h is available
+import CLinus
+import CLinusBridge
+import Kalliope
+@testable import Linus
+import Testing
+
+struct PowerSeriesMPFRTests {
+    private typealias Series = PowerSeries<MPFRFloat>
+
+    private func float(_ value: Double) -> MPFRFloat {
+        MPFRFloat(value, precision: 200)
+    }
+
+    @Test
+    func truncatedProduct_MatchesSchoolbook() async throws {
+        // Given: Two coefficient arrays
+        let a = (0 ..< 30).map { float(Double($0).squareRoot() - 2) }
+        let b = (0 ..< 17).map { float(1 / Double($0 + 1)) }
+
+        // When: Multiplying with dot products
+        let product = MPFRFloat.truncatedProduct(a, b, count: 40)
+
+        // Then: Every coefficient agrees with the schoolbook sum
+        for k in 0 ..< 40 {
+            var expected = float(0)
+            for i in 0 ... k where i < a.count && k - i < b.count {
+                expected = expected + a[i] * b[k - i]
+            }
+            let error = (product[k] - expected).toDouble()
+            #expect(abs(error) < 1e-50)
+        }
+    }
+
+    @Test
+    func exponential_X_HasInverseFactorials() async throws {
+        // Given: x at 200 bits
+        let series = Series([float(0), float(1)], order: 30)
+
+        // When: Taking the exponential
+        let exp = series.exponential()
+
+        // Then: The coefficients are 1/k! to working precision
+        var factorial = 1.0
+        for k in 0 ..< 30 {
+            if k > 0 {
+                factorial *= Double(k)
+            }
+            let error = exp[k].toDouble() * factorial - 1
+            #expect(abs(error) < 1e-14)
+        }
+    }
+
+    @Test
+    func inverse_TimesSeries_IsOne() async throws {
+        // Given: A series with constant term 3 and no zeros near the origin
+        let series = Series(
+            (0 ..< 64).map { float($0 == 0 ? 3 : Double($0 % 5) / 16) }
+        )
+
+        // When: Multiplying it by its inverse
+        let product = series * series.inverse()
+
+        // Then: The product is 1 to working precision
+        #expect(abs(product[0].toDouble() - 1) < 1e-50)
+        for k in 1 ..< 64 {
+            #expect(abs(product[k].toDouble()) < 1e-40)
+        }
+    }
+}
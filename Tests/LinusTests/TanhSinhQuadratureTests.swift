@@ -0,0 +1,164 @@
+import CKalliope // Import CKalliope first so gmp.h is available
+import CLinus
+import CLinusBridge
+import Kalliope
+@testable import Linus
+import Testing
+
+/// Tests for tanh-sinh quadrature and its node cache.
+struct TanhSinhQuadratureTests {
+    // MARK: - integrate
+
+    @Test
+    func integrate_SmoothIntegrand_ComputesPi() async throws {
+        // Given: 4 / (1 + x^2) on [0, 1], whose integral is pi
+        let precision = 256
+        let one = MPFRFloat(1, precision: precision)
+        let four = MPFRFloat(4, precision: precision)
+
+        // When: Integrating
+        let result = TanhSinhQuadrature.integrate(
+            from: MPFRFloat(0, precision: precision),
+            to: one
+        ) { x in
+            four / (one + x * x)
+        }
+
+        // Then: The result matches pi to nearly full precision
+        let pi = MPFRFloat.pi(precision: precision).result
+        let error = (result.value - pi).absoluteValue().result
+        #expect(result.isConverged)
+        #expect(error.toDouble() < 0x1p-230)
+    }
+
+    @Test
+    func integrate_EndpointSingularity_Converges() async throws {
+        // Given: 1 / sqrt(x) on [0, 1], whose integral is 2
+        let precision = 200
+        let one = MPFRFloat(1, precision: precision)
+
+        // When: Integrating
+        let result = TanhSinhQuadrature.integrate(
+            from: MPFRFloat(0, precision: precision),
+            to: one
+        ) { x in
+            one / x.squareRoot().result
+        }
+
+        // Then: The singularity at 0 does not spoil convergence
+        let error = (result.value - MPFRFloat(2, precision: precision))
+            .absoluteValue().result
+        #expect(error.toDouble() < 0x1p-150)
+    }
+
+    @Test
+    func integrate_SingularityAtNonzeroEndpoint_Converges() async throws {
+        // Given: 1 / sqrt(1 - x) on [0, 1], whose integral is 2
+        let precision = 200
+        let one = MPFRFloat(1, precision: precision)
+
+        // When: Integrating, with nodes closer to 1 than 2^-200
+        let result = TanhSinhQuadrature.integrate(
+            from: MPFRFloat(0, precision: precision),
+            to: one
+        ) { x in
+            one / (one - x).squareRoot().result
+        }
+
+        // Then: No node lands on 1, and the result is accurate
+        let error = (result.value - MPFRFloat(2, precision: precision))
+            .absoluteValue().result
+        #expect(result.value.isRegular)
+        #expect(error.toDouble() < 0x1p-150)
+    }
+
+    @Test
+    func integrate_ReversedLimits_NegatesResult() async throws {
+        // Given: x^2 on [1, 0]
+        let precision = 128
+
+        // When: Integrating from the upper to the lower limit
+        let result = TanhSinhQuadrature.integrate(
+            from: MPFRFloat(1, precision: precision),
+            to: MPFRFloat(0, precision: precision)
+        ) { x in
+            x * x
+        }
+
+        // Then: The result is -1/3
+        let expected = MPFRFloat(-1, precision: precision)
+            / MPFRFloat(3, precision: precision)
+        let error = (result.value - expected).absoluteValue().result
+        #expect(error.toDouble() < 0x1p-110)
+    }
+
+    @Test
+    func integrate_ConcurrentAndSerial_AgreeExactly() async throws {
+        // Given: A warmed cache and an integrand
+        let precision = 160
+        TanhSinhQuadrature.warmUp(precision: precision, levels: 6)
+        let a = MPFRFloat(0, precision: precision)
+        let b = MPFRFloat(2, precision: precision)
+        let integrand = { (x: MPFRFloat) -> MPFRFloat in
+            x.sin().result
+        }
+
+        // When: Integrating with and without concurrency
+        let concurrent = TanhSinhQuadrature.integrate(
+            from: a,
+            to: b,
+            concurrently: true,
+            integrand
+        )
+        let serial = TanhSinhQuadrature.integrate(
+            from: a,
+            to: b,
+            concurrently: false,
+            integrand
+        )
+
+        // Then: The sums are identical
+        #expect(concurrent.value == serial.value)
+        #expect(concurrent.evaluations == serial.evaluations)
+    }
+
+    // MARK: - Node Cache
+
+    @Test
+    func nodeCache_SameKey_ReturnsSharedNodes() async throws {
+        // Given: The shared cache
+        let cache = _TanhSinhNodeCache.shared
+
+        // When: Requesting the same level twice
+        let first = cache.nodes(level: 2, precision: 96)
+        let second = cache.nodes(level: 2, precision: 96)
+
+        // Then: The same instance is returned and weights are positive
+        #expect(first === second)
+        #expect(first.count > 0)
+        #expect(first.weights.allSatisfy { $0 > MPFRFloat(0) })
+    }
+
+    @Test
+    func nodeCache_Registry_ReportsAndEvictsLevels() async throws {
+        // Given: A cached level at a precision no other test uses
+        let cache = _TanhSinhNodeCache.shared
+        let nodes = cache.nodes(level: 1, precision: 77)
+
+        // When: Reading the registry statistics
+        let statistics = GMPCacheRegistry.shared.statistics()
+            .first { $0.name == cache.cacheName }
+
+        // Then: The cache is registered and its entries are accounted
+        let cached = try #require(statistics)
+        #expect(cached.byteCount >= nodes.byteCount)
+        #expect(nodes.byteCount > 0)
+
+        // When: Evicting the level
+        let key = _TanhSinhNodeCache.Key(precision: 77, level: 1)
+        cache.evictCacheEntries([key])
+
+        // Then: It is recomputed on next use
+        #expect(cache.nodes(level: 1, precision: 77) !== nodes)
+    }
+}
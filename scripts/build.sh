@@ -22,6 +22,7 @@ set -euo pipefail
 #   4. download       - Download and extract library source tarballs
 #   5. docs           - Generate documentation (HTML for GMP/MPFR, DocC for Kalliope)
 #   6. clean          - Clean build artifacts, downloaded files, or documentation
+#   7. tune           - Run GMP's tuneup on a native build and save gmp-mparam.h
 #
 # ============================================================================
 # TASK: build
@@ -40,6 +41,30 @@ set -euo pipefail
 #       Individual archs: ios-simulator-arm64, ios-simulator-x86_64,
 #                         macos-arm64, macos-x86_64, etc.
 #
+# Optional Parameters (GMP unless noted):
+#   --variant <name>
+#       Build a named CPU variant alongside the default build. Build and
+#       install directories get a "+<name>" suffix (e.g. macos-arm64+m2).
+#       With --library=mpfr, links against the GMP build of the same variant.
+#
+#   --cpu <name>
+#       Configure GMP for a specific microarchitecture instead of the generic
+#       CPU of the platform (e.g. skylake, zen3). Any CPU name GMP's configure
+#       accepts is valid; run "$VENDOR_DIR/gmp-$GMP_VERSION/config.guess" on
+#       the target machine to see its name. Selects GMP's assembly and
+#       default thresholds for that CPU.
+#
+#   --assembly <on|off>
+#       Override the platform's assembly setting. Apple arm64 platforms share
+#       one Mach-O ABI, so "on" for iOS-family targets configures GMP as
+#       Darwin to select its arm64 assembly while CFLAGS still target the
+#       platform SDK.
+#
+#   --mparam <path>
+#       Build with the thresholds in a gmp-mparam.h written by the tune task
+#       instead of GMP's defaults for the CPU. Changing the file triggers a
+#       full rebuild.
+#
 # Environment Variables (with defaults):
 #   CURDIR              - Current directory (default: $(pwd))
 #   VENDOR_DIR          - GMP vendor directory (default: Sources/CKalliope/vendor)
@@ -70,6 +95,14 @@ set -euo pipefail
 #   # Build and skip tests
 #   SKIP_TESTS=1 scripts/build.sh --task=build --library=gmp --platform-name=macos-arm64
 #
+#   # Build a Zen 3 variant of GMP with tuned thresholds
+#   scripts/build.sh --task=build --library=gmp --platform-name=macos-x86_64 \
+#       --variant=zen3 --cpu=zen3 \
+#       --mparam=Sources/CKalliope/vendor/mparam/macos-x86_64+zen3/gmp-mparam.h
+#
+#   # Build iOS GMP with arm64 assembly
+#   scripts/build.sh --task=build --library=gmp --platform-name=ios-arm64 --assembly=on
+#
 # ============================================================================
 # TASK: link-libs
 # ============================================================================
@@ -84,6 +117,12 @@ set -euo pipefail
 #       Space-separated list of platform identifiers. Can include both
 #       single-arch and universal platforms.
 #
+# Optional Parameters:
+#   --variant <name>
+#       Use the libraries built with --variant=<name> instead of the default
+#       builds. The output layout is unchanged, so create-xcframework then
+#       packages that variant; build one xcframework per deployment target.
+#
 # Environment Variables (with defaults):
 #   BUILD_DIR           - Build directory (default: Sources/CKalliope/vendor/build)
 #   VENDOR_DIR          - GMP vendor directory (default: Sources/CKalliope/vendor)
@@ -273,6 +312,43 @@ set -euo pipefail
 #   scripts/build.sh --task=clean
 #
 # ============================================================================
+# TASK: tune
+# ============================================================================
+# Runs GMP's tuneup program on an existing GMP build and saves the measured
+# thresholds (Karatsuba/Toom/FFT cutovers and others) as a gmp-mparam.h.
+# Pass the file to the build task with --mparam to compile them in.
+#
+# Required Parameters:
+#   --platform-name <platform>
+#       A platform whose binaries run on this machine (macos-arm64 or
+#       macos-x86_64 matching the current CPU). GMP must already be built
+#       for it.
+#
+# Optional Parameters:
+#   --variant <name>
+#       Tune the build made with --variant=<name>.
+#
+# Environment Variables (with defaults):
+#   VENDOR_DIR          - GMP vendor directory (default: Sources/CKalliope/vendor)
+#   BUILD_DIR           - Build directory (default: $VENDOR_DIR/build)
+#   CURDIR              - Current directory (default: $(pwd))
+#
+# Output:
+#   $VENDOR_DIR/mparam/<platform>[+<variant>]/gmp-mparam.h
+#
+# What it does:
+#   - Builds tune/tuneup in the platform's GMP build directory
+#   - Runs it (several minutes) and keeps the threshold definitions
+#   - Prints the build command that uses the result
+#
+# Examples:
+#   # Tune the native macOS arm64 build, then rebuild with the thresholds
+#   scripts/build.sh --task=build --library=gmp --platform-name=macos-arm64
+#   scripts/build.sh --task=tune --platform-name=macos-arm64
+#   scripts/build.sh --task=build --library=gmp --platform-name=macos-arm64 \
+#       --mparam=Sources/CKalliope/vendor/mparam/macos-arm64/gmp-mparam.h
+#
+# ============================================================================
 # SUPPORTED PLATFORMS
 # ============================================================================
 #
@@ -546,13 +622,20 @@ get_display_name() {
     fi
 }
 
-# Determine if tests should run
-should_run_tests() {
-    local host_triple="$1"
-    
-    if [ "${SKIP_TESTS:-}" = "1" ]; then
-        return 1
+# Get the build/install directory name for a platform and optional variant
+get_variant_dir_name() {
+    local platform_name="$1"
+    local variant="$2"
+    if [ -n "$variant" ]; then
+        echo "$platform_name+$variant"
+    else
+        echo "$platform_name"
     fi
+}
+
+# Determine if binaries for a host triple run on the current machine
+is_native_host() {
+    local host_triple="$1"
     
     local current_arch=$(uname -m)
     local current_os=$(uname -s | tr '[:upper:]' '[:lower:]')
@@ -580,6 +663,17 @@ should_run_tests() {
     return 1
 }
 
+# Determine if tests should run
+should_run_tests() {
+    local host_triple="$1"
+    
+    if [ "${SKIP_TESTS:-}" = "1" ]; then
+        return 1
+    fi
+    
+    is_native_host "$host_triple"
+}
+
 # ============================================================================
 # Internal Functions (Not exposed as tasks)
 # ============================================================================
@@ -930,12 +1024,21 @@ check_platform() {
 task_build() {
     local library="${PARAMS["library"]:-}"
     local platform_name="${PARAMS["platform-name"]:-}"
+    local variant="${PARAMS["variant"]:-}"
+    local cpu="${PARAMS["cpu"]:-}"
+    local assembly="${PARAMS["assembly"]:-}"
+    local mparam="${PARAMS["mparam"]:-}"
     
     if [ -z "$library" ] || [ -z "$platform_name" ]; then
         echo -e "${RED}ERROR: --library and --platform-name are required for build task${NC}" >&2
         exit 1
     fi
     
+    if [ "$library" != "gmp" ] && { [ -n "$cpu" ] || [ -n "$assembly" ] || [ -n "$mparam" ]; }; then
+        echo -e "${RED}ERROR: --cpu, --assembly, and --mparam apply only to --library=gmp${NC}" >&2
+        exit 1
+    fi
+    
     # Get environment variables with defaults
     local curdir="${CURDIR:-$(pwd)}"
     local vendor_dir="${VENDOR_DIR:-Sources/CKalliope/vendor}"
@@ -952,6 +1055,26 @@ task_build() {
     local disable_assembly="$PLATFORM_DISABLE_ASSEMBLY"
     local platform_id="$PLATFORM_ID"
     local min_version="$PLATFORM_MIN_VERSION"
+    local platform_dir_name
+    platform_dir_name=$(get_variant_dir_name "$platform_name" "$variant")
+    
+    case "$assembly" in
+        "") ;;
+        on) disable_assembly="0" ;;
+        off) disable_assembly="1" ;;
+        *)
+            echo -e "${RED}ERROR: --assembly must be on or off${NC}" >&2
+            exit 1
+            ;;
+    esac
+    
+    if [ -n "$mparam" ]; then
+        [[ "$mparam" = /* ]] || mparam="$curdir/$mparam"
+        if [ ! -f "$mparam" ]; then
+            echo -e "${RED}ERROR: gmp-mparam.h not found at $mparam${NC}" >&2
+            exit 1
+        fi
+    fi
     
     # Validate SDK
     validate_sdk "$sdk_name" "$platform_name"
@@ -972,20 +1095,20 @@ task_build() {
     local source_dir
     
     if [ "$library" = "gmp" ]; then
-        platform_build_dir="$curdir/$build_dir/$platform_name"
-        platform_install_dir="$curdir/$vendor_dir/$platform_name"
+        platform_build_dir="$curdir/$build_dir/$platform_dir_name"
+        platform_install_dir="$curdir/$vendor_dir/$platform_dir_name"
         platform_install_prefix="$platform_install_dir"
         source_dir="$curdir/$vendor_dir/gmp-$gmp_version"
     elif [ "$library" = "mpfr" ]; then
-        platform_build_dir="$curdir/$build_dir/mpfr-$platform_name"
-        platform_install_dir="$curdir/$mpfr_vendor_dir/mpfr-$platform_name"
+        platform_build_dir="$curdir/$build_dir/mpfr-$platform_dir_name"
+        platform_install_dir="$curdir/$mpfr_vendor_dir/mpfr-$platform_dir_name"
         platform_install_prefix="$platform_install_dir"
         source_dir="$curdir/$mpfr_vendor_dir/mpfr-$mpfr_version"
         
         # Validate GMP dependency
-        local gmp_install_dir="$curdir/$vendor_dir/$platform_name"
+        local gmp_install_dir="$curdir/$vendor_dir/$platform_dir_name"
         if [ ! -d "$gmp_install_dir" ] || [ ! -f "$gmp_install_dir/lib/libgmp.a" ]; then
-            echo -e "${RED}ERROR: GMP must be built first for $platform_name. Run 'make build-$platform_name' first.${NC}" >&2
+            echo -e "${RED}ERROR: GMP must be built first for $platform_dir_name. Run 'make build-$platform_name' first.${NC}" >&2
             exit 1
         fi
     else
@@ -1045,6 +1168,25 @@ task_build() {
         echo "  (Assembly enabled for $platform_name - better performance)"
     fi
     
+    # GMP picks its assembly and default thresholds from the CPU in the host
+    # triple. Tests still follow the platform's own host triple.
+    local configure_host="$host_triple"
+    if [ "$library" = "gmp" ]; then
+        local configure_host_os
+        configure_host_os=$(echo "$host_triple" | cut -d'-' -f3-)
+        if [ -n "$cpu" ]; then
+            configure_host="${cpu}-apple-darwin"
+            echo "  (Configuring GMP for CPU $cpu)"
+        elif [ "$disable_assembly" = "0" ] && [ "$configure_host_os" != "darwin" ]; then
+            # Same Mach-O ABI as macOS; GMP only knows the Darwin name
+            if [ "$arch" = "arm64" ]; then
+                configure_host="aarch64-apple-darwin"
+            else
+                configure_host="${arch}-apple-darwin"
+            fi
+        fi
+    fi
+    
     # Build BUILD_TRIPLE
     local build_cpu
     build_cpu=$(uname -m)
@@ -1095,7 +1237,7 @@ task_build() {
     CFLAGS="$cflags" \
     "$source_dir/configure" \
         --build="$build_triple" \
-        --host="$host_triple" \
+        --host="$configure_host" \
         --prefix="$platform_install_prefix" \
         --disable-cxx \
         --with-pic \
@@ -1123,6 +1265,26 @@ task_build() {
         lib_file="$platform_install_dir/lib/libmpfr.a"
     fi
     
+    # Install tuned thresholds. configure links gmp-mparam.h into the source
+    # tree, so replace the link instead of writing through it. The copy keeps
+    # the file's timestamp; a stamp of the last file used forces a full
+    # rebuild when the thresholds change.
+    local mparam_stamp="$platform_build_dir/.tuned-gmp-mparam.h"
+    if [ -n "$mparam" ]; then
+        rm -f "$platform_build_dir/gmp-mparam.h"
+        cp -p "$mparam" "$platform_build_dir/gmp-mparam.h"
+        echo "  (Using tuned thresholds from $mparam)"
+        if ! cmp -s "$mparam" "$mparam_stamp"; then
+            (cd "$platform_build_dir" && make clean >/dev/null)
+            rm -f "$lib_file"
+            cp "$mparam" "$mparam_stamp"
+        fi
+    elif [ -f "$mparam_stamp" ]; then
+        echo "  (Reverting to default thresholds)"
+        (cd "$platform_build_dir" && make clean >/dev/null)
+        rm -f "$lib_file" "$mparam_stamp"
+    fi
+    
     if [ -f "$lib_file" ] && [ "$lib_file" -nt "$platform_build_dir/Makefile" ]; then
         echo "${(U)library} library already built for $platform_name (skipping build)"
     else
@@ -1164,13 +1326,14 @@ task_build() {
     # Install
     echo "Installing ${(U)library} to $platform_install_dir..."
     cd "$platform_build_dir" && make install
-    echo -e "${GREEN}✓ ${(U)library} built and installed for $platform_name at $platform_install_dir${NC}"
+    echo -e "${GREEN}✓ ${(U)library} built and installed for $platform_dir_name at $platform_install_dir${NC}"
 }
 
 # Task: link-libs
 task_link_libs() {
     local library="${PARAMS["library"]:-}"
     local platforms="${PARAMS["platforms"]:-}"
+    local variant="${PARAMS["variant"]:-}"
     
     if [ -z "$library" ] || [ -z "$platforms" ]; then
         echo -e "${RED}ERROR: --library and --platforms are required for link-libs task${NC}" >&2
@@ -1227,12 +1390,15 @@ task_link_libs() {
             local arm64_lib_path x86_64_lib_path
             local arm64_install_dir x86_64_install_dir
             
+            local arm64_dir_name x86_64_dir_name
+            arm64_dir_name=$(get_variant_dir_name "$arm64_platform" "$variant")
+            x86_64_dir_name=$(get_variant_dir_name "$x86_64_platform" "$variant")
             if [ "$library" = "gmp" ]; then
-                arm64_install_dir="$curdir/$vendor_dir/$arm64_platform"
-                x86_64_install_dir="$curdir/$vendor_dir/$x86_64_platform"
+                arm64_install_dir="$curdir/$vendor_dir/$arm64_dir_name"
+                x86_64_install_dir="$curdir/$vendor_dir/$x86_64_dir_name"
             else
-                arm64_install_dir="$curdir/$mpfr_vendor_dir/mpfr-$arm64_platform"
-                x86_64_install_dir="$curdir/$mpfr_vendor_dir/mpfr-$x86_64_platform"
+                arm64_install_dir="$curdir/$mpfr_vendor_dir/mpfr-$arm64_dir_name"
+                x86_64_install_dir="$curdir/$mpfr_vendor_dir/mpfr-$x86_64_dir_name"
             fi
             
             arm64_lib_path="$arm64_install_dir/lib/$lib_name"
@@ -1245,8 +1411,7 @@ task_link_libs() {
             if [ "$library" = "gmp" ]; then
                 prepare_headers "$library" "$platform_headers_dir" "$arm64_install_dir" "" "$display_name"
             else
-                local gmp_platform="$arm64_platform"
-                local gmp_install_dir="$curdir/$vendor_dir/$gmp_platform"
+                local gmp_install_dir="$curdir/$vendor_dir/$arm64_dir_name"
                 prepare_headers "$library" "$platform_headers_dir" "$arm64_install_dir" "$gmp_install_dir" "$display_name"
             fi
         else
@@ -1258,11 +1423,12 @@ task_link_libs() {
             mkdir -p "$platform_headers_dir"
             
             # Determine source paths
-            local source_install_dir
+            local source_install_dir platform_dir_name
+            platform_dir_name=$(get_variant_dir_name "$platform" "$variant")
             if [ "$library" = "gmp" ]; then
-                source_install_dir="$curdir/$vendor_dir/$platform"
+                source_install_dir="$curdir/$vendor_dir/$platform_dir_name"
             else
-                source_install_dir="$curdir/$mpfr_vendor_dir/mpfr-$platform"
+                source_install_dir="$curdir/$mpfr_vendor_dir/mpfr-$platform_dir_name"
             fi
             
             local source_lib="$source_install_dir/lib/$lib_name"
@@ -1287,7 +1453,7 @@ task_link_libs() {
             if [ "$library" = "gmp" ]; then
                 prepare_headers "$library" "$platform_headers_dir" "$source_install_dir" "" "$display_name"
             else
-                local gmp_install_dir="$curdir/$vendor_dir/$platform"
+                local gmp_install_dir="$curdir/$vendor_dir/$platform_dir_name"
                 prepare_headers "$library" "$platform_headers_dir" "$source_install_dir" "$gmp_install_dir" "$display_name"
             fi
         fi
@@ -1949,6 +2115,13 @@ task_clean() {
                     rm -rf "$mpfr_install_dir"
                     echo "  Removed $mpfr_install_dir"
                 fi
+                # CPU variants (tuned gmp-mparam.h files in mparam/ are kept)
+                local variant_dirs=$(find "$vendor_dir" "$mpfr_vendor_dir" -maxdepth 1 -type d \
+                    \( -name "$platform+*" -o -name "mpfr-$platform+*" \) 2>/dev/null || true)
+                for variant_dir in ${(f)variant_dirs}; do
+                    rm -rf "$variant_dir"
+                    echo "  Removed $variant_dir"
+                done
             done
             
             if [ -d "$curdir/Sources/CKalliope/extra" ]; then
@@ -1992,6 +2165,95 @@ task_clean() {
     esac
 }
 
+# Task: tune
+task_tune() {
+    local platform_name="${PARAMS["platform-name"]:-}"
+    local variant="${PARAMS["variant"]:-}"
+    
+    if [ -z "$platform_name" ]; then
+        echo -e "${RED}ERROR: --platform-name is required for tune task${NC}" >&2
+        exit 1
+    fi
+    
+    # Get environment variables with defaults
+    local curdir="${CURDIR:-$(pwd)}"
+    local vendor_dir="${VENDOR_DIR:-Sources/CKalliope/vendor}"
+    local build_dir="${BUILD_DIR:-$vendor_dir/build}"
+    
+    parse_platform_config "$platform_name"
+    if ! is_native_host "$PLATFORM_HOST_TRIPLE"; then
+        echo -e "${RED}ERROR: $platform_name binaries cannot run on this machine; tuneup must run natively${NC}" >&2
+        exit 1
+    fi
+    
+    local platform_dir_name
+    platform_dir_name=$(get_variant_dir_name "$platform_name" "$variant")
+    local platform_build_dir="$curdir/$build_dir/$platform_dir_name"
+    if [ ! -f "$platform_build_dir/libgmp.la" ]; then
+        echo -e "${RED}ERROR: GMP must be built first for $platform_dir_name${NC}" >&2
+        exit 1
+    fi
+    
+    local mparam_dir="$curdir/$vendor_dir/mparam/$platform_dir_name"
+    local mparam_file="$mparam_dir/gmp-mparam.h"
+    mkdir -p "$mparam_dir"
+    
+    echo "Building tuneup for $platform_dir_name..."
+    cd "$platform_build_dir/tune" && make tuneup
+    
+    echo "Running tuneup for $platform_dir_name (this may take several minutes)..."
+    local tuneup_output="$mparam_dir/tuneup.out"
+    "$platform_build_dir/tune/tuneup" > "$tuneup_output"
+    
+    # tuneup prints the threshold definitions of a gmp-mparam.h; add the limb
+    # size definitions the generated file does not repeat
+    local cpu_name
+    cpu_name=$(sysctl -n machdep.cpu.brand_string 2>/dev/null || uname -m)
+    {
+        echo "/* gmp-mparam.h -- tuned for $platform_dir_name on $cpu_name"
+        echo "   Generated by scripts/build.sh --task=tune on $(date -u +%Y-%m-%d). */"
+        echo ""
+        echo "#define GMP_LIMB_BITS 64"
+        echo "#define GMP_LIMB_BYTES 8"
+        echo ""
+        # Keep each definition whole: the FFT tables continue over several
+        # lines ending in a backslash
+        awk 'cont || /^#define/ { print; cont = /\\[ \t]*$/ }' \
+            "$tuneup_output"
+    } > "$mparam_file.tmp"
+    
+    # Expand the FFT tables as GMP does, so a truncated table or a missing
+    # _SIZE macro fails here rather than in mul_fft.c
+    local check_cc
+    check_cc=$(xcrun --find clang 2>/dev/null || echo cc)
+    if ! "$check_cc" -fsyntax-only -x c -include "$mparam_file.tmp" - <<'EOF'
+struct fft_table_nk { long n; int k; };
+#ifdef MUL_FFT_TABLE3
+static const struct fft_table_nk mul_table[MUL_FFT_TABLE3_SIZE] =
+    MUL_FFT_TABLE3;
+#endif
+#ifdef SQR_FFT_TABLE3
+static const struct fft_table_nk sqr_table[SQR_FFT_TABLE3_SIZE] =
+    SQR_FFT_TABLE3;
+#endif
+EOF
+    then
+        echo -e "${RED}ERROR: generated gmp-mparam.h does not compile; tuneup output kept at $tuneup_output${NC}" >&2
+        rm -f "$mparam_file.tmp"
+        exit 1
+    fi
+    mv "$mparam_file.tmp" "$mparam_file"
+    rm -f "$tuneup_output"
+    
+    echo -e "${GREEN}✓ Tuned thresholds written to $mparam_file${NC}"
+    echo "Rebuild GMP with them:"
+    local variant_flag=""
+    if [ -n "$variant" ]; then
+        variant_flag=" --variant=$variant"
+    fi
+    echo "  scripts/build.sh --task=build --library=gmp --platform-name=$platform_name$variant_flag --mparam=${mparam_file#$curdir/}"
+}
+
 # ============================================================================
 # Argument Parsing and Task Dispatcher
 # ============================================================================
@@ -2060,13 +2322,16 @@ fi
         clean)
             task_clean
             ;;
+        tune)
+            task_tune
+            ;;
         *)
             if [ -z "$TASK" ]; then
                 echo -e "${RED}ERROR: --task is required${NC}" >&2
             else
                 echo -e "${RED}Unknown task: $TASK${NC}" >&2
             fi
-            echo "Available tasks: build, link-libs, create-xcframework, download, docs, clean" >&2
+            echo "Available tasks: build, link-libs, create-xcframework, download, docs, clean, tune" >&2
             exit 1
             ;;
     esac